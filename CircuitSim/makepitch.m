@@ -0,0 +1,75 @@
+## Copyright (C) 2024 Daniel Marks
+##
+## zlib license...
+##
+
+## Author: Daniel Marks <Daniel Marks@VECTRON>
+## Created: 2024-06-04
+
+function retval = makepitch (fl)
+
+if nargin<1
+  fl='pitch.c';
+endif
+
+fp=fopen(fl,'w');
+fprintf(fp,'/* pitch.c */\r\n\r\n#include <stdint.h>\r\n\r\n');
+
+## 2^(k/384) over one octave in Q30, 8 vco units per step
+expwv = floor(2.^((0:384)/384)*2^30+0.5);
+
+## sin over a quarter cycle in Q30
+sinwv = floor(sin((0:256)*(pi/512))*2^30+0.5);
+
+## 1/x over one octave in Q31, for divide-free reciprocals
+recipwv = floor(2^31./(1+(0:64)/64)+0.5);
+
+## exponential envelope segment shape in Q15, rising from 0 to 1
+curvewv = floor((1-exp(-5*(0:64)/64))/(1-exp(-5))*32768+0.5);
+
+## tunings as vco values (256 per semitone) for each MIDI note, rooted on C
+equal = (0:11)*100;
+just = 1200*log2([1 16/15 9/8 6/5 5/4 4/3 45/32 3/2 8/5 5/3 9/5 15/8]);
+pyth = 1200*log2([1 256/243 9/8 32/27 81/64 4/3 729/512 3/2 128/81 27/16 16/9 243/128]);
+fifths = [0 7 2 -3 4 -1 6 1 8 3 -2 5];
+mean = mod(1200*log2(5.^(fifths/4)),1200);
+
+writeary(fp,expwv,'uint32_t','table_exp2');
+writeary(fp,sinwv,'uint32_t','table_sine_quarter');
+writeary(fp,recipwv,'uint32_t','table_reciprocal');
+writeary(fp,curvewv,'uint16_t','table_envelope_curve');
+writeary(fp,maketuning(equal),'uint16_t','table_tuning_equal');
+writeary(fp,maketuning(just),'uint16_t','table_tuning_just');
+writeary(fp,maketuning(pyth),'uint16_t','table_tuning_pythagorean');
+writeary(fp,maketuning(mean),'uint16_t','table_tuning_meantone');
+
+fprintf(fp,'const uint16_t *tunings[4]= { table_tuning_equal, table_tuning_just, table_tuning_pythagorean, table_tuning_meantone };\r\n');
+fclose(fp);
+
+endfunction
+
+function x = maketuning(cents)
+
+note = 0:127;
+x = floor((floor(note/12)*12 + cents(mod(note,12)+1)/100)*256+0.5);
+x = min(max(x,0),32767);
+endfunction
+
+function x = writeary(fl,ary,tp,name);
+
+fprintf(fl,'const %s %s',tp,name);
+fprintf(fl,'[%d]={\r\n',
+length(ary));
+el=0;
+for n=1:16:length(ary)-16
+  fprintf(fl,'    ');
+  fprintf(fl,'%d,',ary(n:n+15));
+  el=el+16;
+  fprintf(fl,'\r\n');
+end
+fprintf(fl,'    ');
+fprintf(fl,'%d,',ary(el+1:length(ary)-1));
+fprintf(fl,'%d', ary(length(ary)));
+fprintf(fl,'};\r\n\r\n');
+x=0;
+endfunction
@@ -6,7 +6,7 @@
 ## Author: Daniel Marks <Daniel Marks@VECTRON>
 ## Created: 2024-06-04
 
-function retval = makewaves (n,fl)
+function retval = makewaves (n,fl,mipmax)
   
 if nargin<1
   n = 1024;
@@ -14,12 +14,15 @@ endif
 if nargin<2
   fl='waves.c';
 endif
+if nargin<3
+  mipmax = 128*1024;
+endif
 
 maxone = @(x) x./max(abs(x));
 subzero = @(x) (x-sum(x)/length(x));
 
 fp=fopen(fl,'w');
-fprintf(fp,'/* waves.c */\r\n\r\n#include <stdint.h>\r\n\r\n');
+fprintf(fp,'/* waves.c */\r\n\r\n#include <stdint.h>\r\n#include "waves.h"\r\n\r\n');
 
 qmax=2^15-1;
 ang=(0:n-1)*(2*pi/n);
@@ -103,7 +106,48 @@ writeary(fp,wd6,'table_wd6');
 writeary(fp,wd7,'table_wd7');
 writeary(fp,wd8,'table_wd8');
 
-fprintf(fp,'const int16_t *wavetables[16]= { table_sine, table_halfsine, table_rectsine, table_triangle, table_sawtooth, table_squarewave, table_squarewave2, table_squarewave3, table_wd1, table_wd2, table_wd3, table_wd4, table_wd5, table_wd6, table_wd7, table_wd8 };\r\n');
+fprintf(fp,'const int16_t *wavetables[16]= { table_sine, table_halfsine, table_rectsine, table_triangle, table_sawtooth, table_squarewave, table_squarewave2, table_squarewave3, table_wd1, table_wd2, table_wd3, table_wd4, table_wd5, table_wd6, table_wd7, table_wd8 };\r\n\r\n');
+
+## band limited copies for the higher octaves.  mip level m keeps the harmonics
+## up to len/2^(m+1), and is only stored if it drops a harmonic of the level
+## before it that was more than 1 LSB, otherwise it shares the previous table
+names = {'table_sine', 'table_halfsine', 'table_rectsine', 'table_triangle', 'table_sawtooth', 'table_squarewave', 'table_squarewave2', 'table_squarewave3', 'table_wd1', 'table_wd2', 'table_wd3', 'table_wd4', 'table_wd5', 'table_wd6', 'table_wd7', 'table_wd8'};
+tables = {sinwv, halfwv, rectwv, triwv, sawwv, sqrwv, sqrwv2, sqrwv3, wd1, wd2, wd3, wd4, wd5, wd6, wd7, wd8};
+len = length(ang);
+mips = log2(len);
+mipnames = cell(16,mips);
+mipbytes = 0;
+for t=1:16
+  spec = fft(tables{t});
+  present = find(abs(spec(2:len/2+1))/(len/2) > 1);
+  mipnames{t,1} = names{t};
+  keep = len/2;
+  for m=1:mips-1
+    lim = len/2^(m+1);
+    mipnames{t,m+1} = mipnames{t,m};
+    if any((present > lim) & (present <= keep)) && any(present <= lim)
+      mipspec = spec;
+      mipspec(lim+2:len-lim) = 0;
+      mipwv = min(max(floor(real(ifft(mipspec))+0.5),-qmax-1),qmax);
+      mipnames{t,m+1} = sprintf('%s_mip%d',names{t},m);
+      writeary(fp,mipwv,mipnames{t,m+1});
+      mipbytes = mipbytes + 2*len;
+      keep = lim;
+    endif
+  end
+end
+if mipbytes > mipmax
+  error('mip tables need %d bytes, more than %d',mipbytes,mipmax);
+endif
+
+fprintf(fp,'const int16_t *const wavetable_mips[16][%d]= {\r\n',mips);
+for t=1:16
+  fprintf(fp,'    { %s',mipnames{t,1});
+  fprintf(fp,', %s',mipnames{t,2:mips});
+  fprintf(fp,' }%s\r\n',ifelse_str(t<16,',',''));
+end
+fprintf(fp,'};\r\n\r\n');
+fprintf(fp,'const uint32_t wavetable_mip_bytes = %d;\r\n',mipbytes);
 fclose(fp);
 
 figure(1);clf;
@@ -144,6 +188,15 @@ plot(ang,wd8);
 endfunction
 
 
+function x = ifelse_str(c,a,b)
+
+if c
+  x = a;
+else
+  x = b;
+endif
+endfunction
+
 function x = writeary(fl,ary,name);
   
 fprintf(fl,'const int16_t %s',name);
@@ -0,0 +1,142 @@
+## Copyright (C) 2024 Daniel Marks
+##
+## zlib license...
+##
+
+## Line for line port of makewaves.m, for machines without Octave.  It writes
+## the same waves.c, so keep the two in step when a table is changed.
+##
+## usage: python3 makewaves.py [n] [waves.c] [mipmax]
+
+import sys
+import numpy as np
+
+def writeary(fp, ary, name):
+  fp.write('const int16_t %s' % name)
+  fp.write('[%d]={\r\n' % len(ary))
+  for n in range(0, len(ary) - 16, 16):
+    fp.write('    ')
+    fp.write(''.join('%d,' % v for v in ary[n:n + 16]))
+    fp.write('\r\n')
+  fp.write('    ')
+  fp.write(''.join('%d,' % v for v in ary[len(ary) - 16:len(ary) - 1]))
+  fp.write('%d' % ary[len(ary) - 1])
+  fp.write('};\r\n\r\n')
+
+def makewaves(n=1024, fl='waves.c', mipmax=128*1024):
+  maxone = lambda x: x / np.max(np.abs(x))
+  subzero = lambda x: x - np.sum(x) / len(x)
+  quant = lambda x: np.floor(x * qmax + 0.5).astype(np.int64)
+
+  qmax = 2**15 - 1
+  ang = np.arange(n) * (2 * np.pi / n)
+
+  sinwv = quant(np.sin(ang))
+
+  rectwv = (sinwv > 0) * sinwv
+  rectwv = quant(maxone(subzero(rectwv)))
+
+  halfwv = np.sin(np.arange(n) * (np.pi / n))
+  halfwv = quant(maxone(subzero(halfwv)))
+
+  triwv = ang * 0
+  for k in range(0, 3):
+    triwv = triwv + ((-1)**k) * (np.sin(ang * (2*k + 1))) / ((2*k + 1)**2)
+  triwv = quant(maxone(subzero(triwv)))
+
+  sawwv = ang * 0
+  for k in range(1, 12):
+    sawwv = sawwv + -((-1)**k) * (np.sin(ang * k) / k)
+  sawwv = quant(maxone(subzero(sawwv)))
+
+  sqrwv = ang * 0
+  for k in range(1, 14, 2):
+    sqrwv = sqrwv + (np.sin(ang * k) + 1e-10) / k
+  sqrwv = quant(maxone(subzero(sqrwv)))
+
+  sqrwv2 = ang * 0
+  for k in range(1, 18, 2):
+    sqrwv2 = sqrwv2 + (np.sin((np.pi/8) * k) * np.cos((ang - np.pi) * k / 2)) / k
+  sqrwv2 = quant(maxone(subzero(sqrwv2)))
+
+  sqrwv3 = ang * 0
+  for k in range(1, 34, 2):
+    sqrwv3 = sqrwv3 + (np.sin((np.pi/16) * k) * np.cos((ang - np.pi) * k / 2)) / k
+  sqrwv3 = quant(maxone(subzero(sqrwv3)))
+
+  sin, cos, sqrt = np.sin, np.cos, np.sqrt
+
+  wd1 = sin(ang)-sin(2*ang)+sin(3*ang)-sin(4*ang)+sin(5*ang)
+  wd1 = quant(maxone(subzero(wd1)))
+
+  wd2 = cos(ang)-sin(2*ang)/2+cos(3*ang)/3-sin(4*ang)/4+cos(5*ang)/5-sin(6*ang)/6+cos(7*ang)/7
+  wd2 = quant(maxone(subzero(wd2)))
+
+  wd3 = sin(2*ang)/2-cos(3*ang)/3+sin(4*ang)/4+cos(5*ang)/5
+  wd3 = quant(maxone(subzero(wd3)))
+
+  ## cos(6*ang/6) is as in makewaves.m
+  wd4 = -cos(ang)+cos(2*ang)/2-cos(3*ang)/3+cos(4*ang)/4-cos(5*ang)/5+cos(6*ang/6)-cos(7*ang)/7
+  wd4 = quant(maxone(subzero(wd4)))
+
+  wd5 = cos(ang)-cos(3*ang)+sin(5*ang)-sin(7*ang)+cos(9*ang)
+  wd5 = quant(maxone(subzero(wd5)))
+
+  wd6 = (cos(ang*0.5)**2+1)**5
+  wd6 = quant(maxone(subzero(wd6)))
+
+  wd7 = cos(ang)-cos(2*ang)/3+cos(4*ang)/5-cos(6*ang)/7+cos(8*ang)/9-cos(10*ang)/11
+  wd7 = quant(maxone(subzero(wd7)))
+
+  wd8 = cos(ang)-cos(2*ang)*sqrt(2)+sin(3*ang)*sqrt(3)-sin(4*ang)*sqrt(4)+cos(5*ang)*sqrt(5)
+  wd8 = quant(maxone(subzero(wd8)))
+
+  names = ['table_sine', 'table_halfsine', 'table_rectsine', 'table_triangle', 'table_sawtooth', 'table_squarewave', 'table_squarewave2', 'table_squarewave3', 'table_wd1', 'table_wd2', 'table_wd3', 'table_wd4', 'table_wd5', 'table_wd6', 'table_wd7', 'table_wd8']
+  tables = [sinwv, halfwv, rectwv, triwv, sawwv, sqrwv, sqrwv2, sqrwv3, wd1, wd2, wd3, wd4, wd5, wd6, wd7, wd8]
+
+  fp = open(fl, 'w', newline='')
+  fp.write('/* waves.c */\r\n\r\n#include <stdint.h>\r\n#include "waves.h"\r\n\r\n')
+
+  for t in range(16):
+    writeary(fp, tables[t], names[t])
+
+  fp.write('const int16_t *wavetables[16]= { %s };\r\n\r\n' % ', '.join(names))
+
+  ## band limited copies for the higher octaves, chosen as in makewaves.m.
+  ## present holds harmonic numbers, so it matches the 1-based indices there
+  length = len(ang)
+  mips = int(np.log2(length))
+  mipnames = [[None] * mips for t in range(16)]
+  mipbytes = 0
+  for t in range(16):
+    spec = np.fft.fft(tables[t])
+    present = np.nonzero(np.abs(spec[1:length//2 + 1]) / (length/2) > 1)[0] + 1
+    mipnames[t][0] = names[t]
+    keep = length // 2
+    for m in range(1, mips):
+      lim = length // 2**(m + 1)
+      mipnames[t][m] = mipnames[t][m - 1]
+      if np.any((present > lim) & (present <= keep)) and np.any(present <= lim):
+        mipspec = spec.copy()
+        mipspec[lim + 1:length - lim] = 0
+        mipwv = np.minimum(np.maximum(np.floor(np.real(np.fft.ifft(mipspec)) + 0.5), -qmax - 1), qmax).astype(np.int64)
+        mipnames[t][m] = '%s_mip%d' % (names[t], m)
+        writeary(fp, mipwv, mipnames[t][m])
+        mipbytes = mipbytes + 2*length
+        keep = lim
+  if mipbytes > mipmax:
+    fp.close()
+    raise SystemExit('mip tables need %d bytes, more than %d' % (mipbytes, mipmax))
+
+  fp.write('const int16_t *const wavetable_mips[16][%d]= {\r\n' % mips)
+  for t in range(16):
+    fp.write('    { %s }%s\r\n' % (', '.join(mipnames[t]), ',' if t < 15 else ''))
+  fp.write('};\r\n\r\n')
+  fp.write('const uint32_t wavetable_mip_bytes = %d;\r\n' % mipbytes)
+  fp.close()
+
+if __name__ == '__main__':
+  args = sys.argv[1:]
+  makewaves(int(args[0]) if len(args) > 0 else 1024,
+            args[1] if len(args) > 1 else 'waves.c',
+            int(args[2]) if len(args) > 2 else 128*1024)
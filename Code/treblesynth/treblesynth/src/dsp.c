@@ -41,6 +41,23 @@ dsp_unit dsp_units[MAX_DSP_UNITS];
 dsp_parm dsp_parms[MAX_DSP_UNITS];
 int32_t dsp_unit_result[MAX_DSP_UNITS+1];
 
+uint32_t dsp_samplerate = DSP_SAMPLERATE_REFERENCE;
+const uint32_t dsp_samplerates[DSP_SAMPLERATES_NUMBER] = { 25000u, 32000u, 44100u, 48000u };
+
+#ifdef PROFILE_UNITS
+unit_profile dsp_profile_unit[MAX_DSP_UNITS];
+unit_profile dsp_profile_type[DSP_TYPE_MAX_ENTRY];
+unit_profile dsp_profile_total;
+#endif
+
+/* delay lengths in the patches are in samples at the reference rate.  units keep
+   the length at the running rate, cut to max_samples so it stays in the buffer */
+static uint32_t dsp_samples_at_rate(uint32_t samples, uint32_t max_samples)
+{
+    uint32_t scaled = (uint32_t)((((uint64_t)samples) * dsp_samplerate + DSP_SAMPLERATE_REFERENCE/2) / DSP_SAMPLERATE_REFERENCE);
+    return (scaled < max_samples) ? scaled : max_samples;
+}
+
 inline int32_t sine_wave_table(uint n)
 {
     return table_sine[n & (WAVETABLES_LENGTH-1)];
@@ -92,17 +109,17 @@ int32_t dsp_type_process_sin_synth(int32_t sample, dsp_parm *dp, dsp_unit *du)
     if (dp->dtss.frequency[0] != du->dtss.last_frequency[0])
     {
         du->dtss.last_frequency[0] = dp->dtss.frequency[0];
-        du->dtss.sine_counter_inc[0] = (du->dtss.last_frequency[0]*65536) / DSP_SAMPLERATE;
+        du->dtss.sine_counter_inc[0] = (du->dtss.last_frequency[0]*65536) / dsp_samplerate;
     }
     if (dp->dtss.frequency[1] != du->dtss.last_frequency[1])
     {
         du->dtss.last_frequency[1] = dp->dtss.frequency[1];
-        du->dtss.sine_counter_inc[1] = (du->dtss.last_frequency[1]*65536) / DSP_SAMPLERATE;
+        du->dtss.sine_counter_inc[1] = (du->dtss.last_frequency[1]*65536) / dsp_samplerate;
     }
     if (dp->dtss.frequency[2] != du->dtss.last_frequency[2])
     {
         du->dtss.last_frequency[2] = dp->dtss.frequency[2];
-        du->dtss.sine_counter_inc[2] = (du->dtss.last_frequency[2]*65536) / DSP_SAMPLERATE;
+        du->dtss.sine_counter_inc[2] = (du->dtss.last_frequency[2]*65536) / dsp_samplerate;
     }
     uint ct = 1;
     int32_t sine_val = sample * ((int32_t)dp->dtss.mixval);
@@ -196,7 +213,12 @@ int32_t dsp_type_process_delay(int32_t sample, dsp_parm *dp, dsp_unit *du)
         du->dtd.pot_value2 = new_input;
         dp->dtd.echo_reduction = (du->dtd.pot_value2 * 256) / POT_MAX_VALUE;
     }
-    sample = (sample + ((sample_circ_buf_value(dp->dtd.delay_samples) * ((int16_t)dp->dtd.echo_reduction)) / 256)) / 2;
+    if (dp->dtd.delay_samples != du->dtd.last_delay_samples)
+    {
+        du->dtd.last_delay_samples = dp->dtd.delay_samples;
+        du->dtd.delay_samples = dsp_samples_at_rate(du->dtd.last_delay_samples, SAMPLE_CIRC_BUF_SIZE-1);
+    }
+    sample = (sample + ((sample_circ_buf_value(du->dtd.delay_samples) * ((int16_t)dp->dtd.echo_reduction)) / 256)) / 2;
     if (sample > (ADC_PREC_VALUE/2-1)) sample=ADC_PREC_VALUE/2-1;
     if (sample < (-ADC_PREC_VALUE/2)) sample=-ADC_PREC_VALUE/2;
     return sample;
@@ -224,7 +246,12 @@ int32_t dsp_type_process_room(int32_t sample, dsp_parm *dp, dsp_unit *du)
     {
         if (dp->dtroom.amplitude[i] != 0)
         {
-            sample += sample_circ_buf_clean_value(dp->dtroom.delay_samples[i]) * dp->dtroom.amplitude[i];
+            if (dp->dtroom.delay_samples[i] != du->dtroom.last_delay_samples[i])
+            {
+                du->dtroom.last_delay_samples[i] = dp->dtroom.delay_samples[i];
+                du->dtroom.delay_samples[i] = dsp_samples_at_rate(du->dtroom.last_delay_samples[i], SAMPLE_CIRC_BUF_CLEAN_SIZE-1);
+            }
+            sample += sample_circ_buf_clean_value(du->dtroom.delay_samples[i]) * dp->dtroom.amplitude[i];
             count++;
         }
     }
@@ -501,7 +528,7 @@ int32_t dsp_type_process_tremolo(int32_t sample, dsp_parm *dp, dsp_unit *du)
     if (dp->dttrem.frequency != du->dttrem.last_frequency)
     {
         du->dttrem.last_frequency = dp->dttrem.frequency;
-        du->dttrem.sine_counter_inc = (du->dttrem.last_frequency*65536) / DSP_SAMPLERATE;
+        du->dttrem.sine_counter_inc = (du->dttrem.last_frequency*65536) / dsp_samplerate;
     }
     du->dttrem.sine_counter += du->dttrem.sine_counter_inc;
     int32_t sine_val = sine_wave_table((du->dttrem.sine_counter & 0xFFFF) / (65536/WAVETABLES_LENGTH));
@@ -541,12 +568,17 @@ int32_t dsp_type_process_vibrato(int32_t sample, dsp_parm *dp, dsp_unit *du)
     if (dp->dtvibr.frequency != du->dtvibr.last_frequency)
     {
         du->dtvibr.last_frequency = dp->dtvibr.frequency;
-        du->dtvibr.sine_counter_inc = (du->dtvibr.last_frequency*65536) / DSP_SAMPLERATE;
+        du->dtvibr.sine_counter_inc = (du->dtvibr.last_frequency*65536) / dsp_samplerate;
+    }
+    if (dp->dtvibr.delay_samples != du->dtvibr.last_delay_samples)
+    {
+        du->dtvibr.last_delay_samples = dp->dtvibr.delay_samples;
+        du->dtvibr.delay_samples = dsp_samples_at_rate(du->dtvibr.last_delay_samples, SAMPLE_CIRC_BUF_CLEAN_SIZE-2);
     }
     du->dtvibr.sine_counter += du->dtvibr.sine_counter_inc;
     int32_t sine_val = sine_wave_table((du->dtvibr.sine_counter & 0xFFFF) / (65536 / WAVETABLES_LENGTH));
     int32_t mod_val = ((sine_val * dp->dtvibr.modulation) + QUANTIZATION_MAX * 256) / 512;
-    uint32_t delay_samples = (dp->dtvibr.delay_samples * mod_val);
+    uint32_t delay_samples = (du->dtvibr.delay_samples * mod_val);
     int32_t delay_samples_frac = delay_samples & (QUANTIZATION_MAX-1);
     delay_samples /= QUANTIZATION_MAX;
     sample = (sample_circ_buf_clean_value(delay_samples)*((QUANTIZATION_MAX-1)-delay_samples_frac) + 
@@ -985,12 +1017,17 @@ int32_t dsp_type_process_flange(int32_t sample, dsp_parm *dp, dsp_unit *du)
     if (dp->dtflng.frequency != du->dtflng.last_frequency)
     {
         du->dtflng.last_frequency = dp->dtflng.frequency;
-        du->dtflng.sine_counter_inc = du->dtflng.last_frequency; // (du->dtflng.frequency * 65536) / DSP_SAMPLERATE;
+        du->dtflng.sine_counter_inc = ((du->dtflng.last_frequency * DSP_SAMPLERATE_REFERENCE) / dsp_samplerate); // (du->dtflng.frequency * 65536) / DSP_SAMPLERATE;
+    }
+    if (dp->dtflng.delay_samples != du->dtflng.last_delay_samples)
+    {
+        du->dtflng.last_delay_samples = dp->dtflng.delay_samples;
+        du->dtflng.delay_samples = dsp_samples_at_rate(du->dtflng.last_delay_samples, SAMPLE_CIRC_BUF_SIZE-1);
     }
     du->dtflng.sine_counter += du->dtflng.sine_counter_inc;
     int32_t sine_val = sine_wave_table((du->dtflng.sine_counter & 0xFFFF00) / (0xFFFF0 / WAVETABLES_LENGTH));
     int32_t mod_val = ((sine_val * dp->dtflng.modulation) + QUANTIZATION_MAX * 256) / 512;
-    uint32_t delay_samples = (dp->dtflng.delay_samples * mod_val) / QUANTIZATION_MAX;
+    uint32_t delay_samples = (du->dtflng.delay_samples * mod_val) / QUANTIZATION_MAX;
     sample = (sample_circ_buf_value(delay_samples) * ((int32_t)dp->dtflng.feedback) + sample * ((int32_t)(255 - dp->dtflng.feedback))) / 256;
     return sample;
 
@@ -1029,13 +1066,18 @@ int32_t dsp_type_process_chorus(int32_t sample, dsp_parm *dp, dsp_unit *du)
     if (dp->dtchor.frequency != du->dtchor.last_frequency)
     {
         du->dtchor.last_frequency = dp->dtchor.frequency;
-        du->dtchor.sine_counter_inc = du->dtchor.last_frequency; // (du->dtchor.frequency * 65536) / DSP_SAMPLERATE;
+        du->dtchor.sine_counter_inc = ((du->dtchor.last_frequency * DSP_SAMPLERATE_REFERENCE) / dsp_samplerate); // (du->dtchor.frequency * 65536) / DSP_SAMPLERATE;
+    }
+    if (dp->dtchor.delay_samples != du->dtchor.last_delay_samples)
+    {
+        du->dtchor.last_delay_samples = dp->dtchor.delay_samples;
+        du->dtchor.delay_samples = dsp_samples_at_rate(du->dtchor.last_delay_samples, SAMPLE_CIRC_BUF_CLEAN_SIZE-2);
     }
     du->dtchor.sine_counter += du->dtchor.sine_counter_inc;
     int32_t sine_val = sine_wave_table((du->dtchor.sine_counter & 0xFFFF00) / (0xFFFF0 / WAVETABLES_LENGTH));
     int32_t mod_val = ((sine_val * dp->dtchor.modulation) + QUANTIZATION_MAX * 256) / 512;
     
-    uint32_t delay_samples = (dp->dtchor.delay_samples * mod_val);
+    uint32_t delay_samples = (du->dtchor.delay_samples * mod_val);
     int32_t delay_samples_frac = delay_samples & (QUANTIZATION_MAX-1);
     delay_samples /= QUANTIZATION_MAX;
     int32_t new_sample = (sample_circ_buf_clean_value(delay_samples)*((QUANTIZATION_MAX-1)-delay_samples_frac) + 
@@ -1071,7 +1113,7 @@ int32_t dsp_type_process_phaser(int32_t sample, dsp_parm *dp, dsp_unit *du)
     if (dp->dtphaser.frequency != du->dtphaser.last_frequency)
     {
         du->dtphaser.last_frequency = dp->dtphaser.frequency;
-        du->dtphaser.sine_counter_inc = du->dtphaser.last_frequency / 2; // (du->dtphaser.frequency * 65536) / DSP_SAMPLERATE;
+        du->dtphaser.sine_counter_inc = ((du->dtphaser.last_frequency * DSP_SAMPLERATE_REFERENCE) / dsp_samplerate) / 2; // (du->dtphaser.frequency * 65536) / DSP_SAMPLERATE;
     }
     if ((dp->dtphaser.freq1 != du->dtphaser.last_freq1) || (dp->dtphaser.freq2 != du->dtphaser.last_freq2) || (dp->dtphaser.Q != du->dtphaser.last_Q))
     {
@@ -1148,7 +1190,12 @@ int32_t dsp_type_process_backwards(int32_t sample, dsp_parm *dp, dsp_unit *du)
         du->dtback.pot_value2 = new_input;
         dp->dtback.balance = (du->dtback.pot_value2 * 256) / POT_MAX_VALUE;
     }
-    du->dtback.samples_count = (du->dtback.samples_count == 0) ? dp->dtback.backwards_samples : (du->dtback.samples_count-1);
+    if (dp->dtback.backwards_samples != du->dtback.last_backwards_samples)
+    {
+        du->dtback.last_backwards_samples = dp->dtback.backwards_samples;
+        du->dtback.backwards_samples = dsp_samples_at_rate(du->dtback.last_backwards_samples, SAMPLE_CIRC_BUF_CLEAN_SIZE-1);
+    }
+    du->dtback.samples_count = (du->dtback.samples_count == 0) ? du->dtback.backwards_samples : (du->dtback.samples_count-1);
     sample = (sample * ((int32_t)(255 - dp->dtback.balance)) + 
                        ((int32_t)sample_circ_buf_clean_value(du->dtback.samples_count)) * ((int32_t)dp->dtback.balance)) / 256;
     if (sample > (ADC_PREC_VALUE/2-1)) sample=ADC_PREC_VALUE/2-1;
@@ -1592,6 +1639,13 @@ void dsp_unit_reset_all(void)
         dsp_unit_reset(i);
 }
 
+/* units recompute their rate dependent coefficients after a reset */
+void dsp_set_samplerate(uint32_t samplerate)
+{
+    dsp_samplerate = samplerate;
+    dsp_unit_reset_all();
+}
+
 static inline int32_t dsp_process(int32_t sample, dsp_parm *dp, dsp_unit *du)
 {
     return dtp[(int)dp->dtn.dut](sample, dp, du);
@@ -1604,6 +1658,25 @@ void initialize_dsp(void)
         dsp_unit_initialize(unit_number, DSP_TYPE_NONE);
 }
 
+#ifdef PROFILE_UNITS
+int32_t dsp_process_all_units(int32_t sample)
+{
+    uint32_t total_cycles = profile_cycles();
+    dsp_unit_result[0] = sample;
+    for (int unit_no=0;unit_no<MAX_DSP_UNITS;unit_no++)
+    {
+        dsp_unit *du = dsp_unit_entry(unit_no);
+        dsp_parm *dp = dsp_parm_entry(unit_no);
+        uint32_t start_cycles = profile_cycles();
+        dsp_unit_result[unit_no+1] = dsp_process(dsp_unit_result[dp->dtn.source_unit-1], dp, du);
+        uint32_t cycles = profile_elapsed(start_cycles);
+        profile_add(&dsp_profile_unit[unit_no], cycles, 1);
+        profile_add(&dsp_profile_type[dp->dtn.dut], cycles, 1);
+    }
+    profile_add(&dsp_profile_total, profile_elapsed(total_cycles), 1);
+    return dsp_unit_result[MAX_DSP_UNITS];
+}
+#else
 int32_t dsp_process_all_units(int32_t sample)
 {
     dsp_unit_result[0] = sample;
@@ -1615,6 +1688,18 @@ int32_t dsp_process_all_units(int32_t sample)
     }
     return dsp_unit_result[MAX_DSP_UNITS];
 }
+#endif
+
+void dsp_profile_reset(void)
+{
+#ifdef PROFILE_UNITS
+    uint32_t ints = save_and_disable_interrupts();
+    memset(dsp_profile_unit, '\000', sizeof(dsp_profile_unit));
+    memset(dsp_profile_type, '\000', sizeof(dsp_profile_type));
+    memset(&dsp_profile_total, '\000', sizeof(dsp_profile_total));
+    restore_interrupts(ints);
+#endif
+}
 
 dsp_unit_type dsp_unit_get_type(uint dsp_unit_number)
 {
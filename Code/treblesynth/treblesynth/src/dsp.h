@@ -32,7 +32,8 @@ extern "C"
 
 #define DSP_PARM_PAD_LENGTH 128
 
-#define DSP_SAMPLERATE 25000u
+#define DSP_SAMPLERATE_REFERENCE 25000u
+#define DSP_SAMPLERATES_NUMBER 4
 
 #define QUANTIZATION_BITS 15
 #define QUANTIZATION_MAX (1<<QUANTIZATION_BITS)
@@ -168,6 +169,8 @@ typedef struct
     uint32_t notused;
     uint32_t pot_value1;
     uint32_t pot_value2;
+    uint32_t last_delay_samples;
+    uint32_t delay_samples;
 } dsp_type_delay;
 
 typedef struct
@@ -181,6 +184,8 @@ typedef struct
 typedef struct
 {
     uint32_t notused;
+    uint32_t last_delay_samples[3];
+    uint32_t delay_samples[3];
 } dsp_type_room;
 
 typedef struct
@@ -318,6 +323,8 @@ typedef struct
     uint32_t last_modulation;
     uint32_t pot_value1;
     uint32_t pot_value2;
+    uint32_t last_delay_samples;
+    uint32_t delay_samples;
 } dsp_type_vibrato;
 
 typedef struct
@@ -491,6 +498,8 @@ typedef struct
     uint32_t last_modulation;
     uint32_t pot_value1;
     uint32_t pot_value2;
+    uint32_t last_delay_samples;
+    uint32_t delay_samples;
 } dsp_type_flange;
 
 typedef struct
@@ -513,6 +522,8 @@ typedef struct
     uint32_t last_modulation;
     uint32_t pot_value1;
     uint32_t pot_value2;
+    uint32_t last_delay_samples;
+    uint32_t delay_samples;
 } dsp_type_chorus;
 
 #define PHASER_STAGES 8
@@ -559,6 +570,8 @@ typedef struct
     uint32_t samples_count;
     uint32_t pot_value1;
     uint32_t pot_value2;
+    uint32_t last_backwards_samples;
+    uint32_t backwards_samples;
 } dsp_type_backwards;
 
 typedef struct
@@ -707,6 +720,7 @@ typedef bool    (dsp_type_initialize)(void *initialization_data, dsp_unit *du);
 typedef int32_t (dsp_type_process)(int32_t sample, dsp_parm *dp, dsp_unit *du);
 
 int32_t dsp_process_all_units(int32_t sample);
+void dsp_profile_reset(void);
 void dsp_unit_struct_zero(dsp_unit *du);
 void dsp_unit_initialize(int dsp_unit_number, dsp_unit_type dut);
 
@@ -749,11 +763,15 @@ void dsp_set_value_prec(void *v, int prec, uint32_t val);
 void dsp_unit_reset(int dsp_unit_number);
 void dsp_unit_reset_all(void);
 
+extern uint32_t dsp_samplerate;
+extern const uint32_t dsp_samplerates[DSP_SAMPLERATES_NUMBER];
+void dsp_set_samplerate(uint32_t samplerate);
+
 /************Float to quantized integer offset instructions *******************************/
 
 inline float nyquist_fraction_omega(uint16_t frequency)
 {
-    return ((float)frequency)*(2.0f*MATH_PI_F/((float)DSP_SAMPLERATE));
+    return ((float)frequency)*(2.0f*MATH_PI_F/((float)dsp_samplerate));
 }
 
 inline float Q_value(uint16_t Q)
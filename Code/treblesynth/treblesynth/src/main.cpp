@@ -32,13 +32,33 @@
 #include "buttons.h"
 #include "dsp.h"
 #include "synth.h"
+#include "pitch.h"
+#include "waves.h"
 #include "ui.h"
 #include "tinycl.h"
 #include "patches.h"
 #include "usbmain.h"
 
-volatile bool waiting_for_sample = false;
-volatile uint16_t next_sample = 0;
+#ifndef SYNTH_RING_LENGTH
+#define SYNTH_RING_LENGTH 64
+#endif
+
+static_assert(((SYNTH_RING_LENGTH & (SYNTH_RING_LENGTH-1)) == 0) && (SYNTH_RING_LENGTH >= (SYNTH_BLOCK_SIZE*2)), "SYNTH_RING_LENGTH must be a power of two of at least two blocks");
+static_assert(SYNTH_EVENT_DELAY > (SYNTH_RING_LENGTH + SYNTH_BLOCK_SIZE*2 + 1), "SYNTH_EVENT_DELAY must exceed the synth ring and DMA buffer latency");
+
+volatile uint16_t synth_ring[SYNTH_RING_LENGTH];
+volatile uint32_t synth_ring_read = 0;
+volatile uint32_t synth_ring_write = 0;
+uint16_t next_sample = ADC_MAX_VALUE/2;
+
+#define LATENCY_BUCKET_US 50
+#define LATENCY_BUCKETS 256
+
+uint32_t latency_histogram[LATENCY_BUCKETS];
+uint32_t latency_count;
+uint32_t latency_min_us;
+uint32_t latency_max_us;
+uint64_t latency_total_us;
 
 uint16_t current_samples[NUMBER_OF_CONTROLS];
 uint16_t samples[NUMBER_OF_CONTROLS];
@@ -60,13 +80,17 @@ const uint button_ind[NUM_BUTTONS] = { 29,25,30,28,31,27,26,  2,1,0,3,4,6,7,5,
 void initialize_video(void);
 void halt_video(void);
 
-#define UNCLAIMED_ALARM 0xFFFFFFFF
-
 uint dac_pwm_b3_slice_num, dac_pwm_b2_slice_num, dac_pwm_b1_slice_num, dac_pwm_b0_slice_num;
 uint dac_pwm_a3_slice_num, dac_pwm_a2_slice_num, dac_pwm_a1_slice_num, dac_pwm_a0_slice_num;
-uint claimed_alarm_num = UNCLAIMED_ALARM;
+int dac_dma_timer = -1;
+int dac_dma_b3_data, dac_dma_b3_control, dac_dma_b1_data, dac_dma_b1_control;
+int dac_dma_a3_data, dac_dma_a3_control, dac_dma_a1_data, dac_dma_a1_control;
 
 volatile uint32_t counter = 0;
+volatile uint32_t audio_underruns = 0;
+volatile uint32_t audio_overruns = 0;
+volatile uint32_t audio_jitter_max_us = 0;
+volatile uint32_t audio_ring_min_fill = SYNTH_RING_LENGTH;
 
 bool pause_poll_keyboard = false;
 bool pause_poll_controls = false;
@@ -82,6 +106,8 @@ const project_configuration_s pc_default_s =
   48,                    /* transpose value */
   0,                     /* midi device number */
   45000,                 /* fail delay */
+  0,                     /* tuning */
+  0,                     /* sample rate */
 };
 
 void initialize_project_configuration(void)
@@ -154,16 +180,19 @@ typedef struct _uart_fifo
     uint head;
     uint tail;
     uint8_t buf[UART_FIFO_SIZE];
+    uint32_t *stamp;
 } uart_fifo;
 
 uart_fifo uart_fifo_input;
 uart_fifo uart_fifo_output;
+uint32_t uart_fifo_input_stamp[UART_FIFO_SIZE];
 critical_section uart_cs;
 
-void initialize_uart_fifo(uart_fifo *uf)
+void initialize_uart_fifo(uart_fifo *uf, uint32_t *stamp)
 {
     critical_section_enter_blocking(&uart_cs);
     uf->head = uf->tail = 0;
+    uf->stamp = stamp;
     critical_section_exit(&uart_cs);
 }
 
@@ -174,12 +203,13 @@ void insert_into_uart_fifo(uart_fifo *uf, uint8_t ch)
     if (nexthead != uf->tail)
     {
         uf->buf[uf->head] = ch;
+        if (uf->stamp != NULL) uf->stamp[uf->head] = time_us_32();
         uf->head = nexthead;
     }
     critical_section_exit(&uart_cs);
 }
 
-int remove_from_uart_fifo(uart_fifo *uf)
+int remove_from_uart_fifo(uart_fifo *uf, uint32_t *time_us)
 {
     int ret;
     critical_section_enter_blocking(&uart_cs);
@@ -188,15 +218,16 @@ int remove_from_uart_fifo(uart_fifo *uf)
     else 
     {
         ret = uf->buf[uf->tail];
+        if (time_us != NULL) *time_us = uf->stamp[uf->tail];
         uf->tail = uf->tail >= (UART_FIFO_SIZE-1) ? 0 : (uf->tail+1);
     }
     critical_section_exit(&uart_cs);
     return ret;
 }
 
-int uart0_input(void)
+int uart0_input(uint32_t *time_us)
 {
-    return remove_from_uart_fifo(&uart_fifo_input);
+    return remove_from_uart_fifo(&uart_fifo_input, time_us);
 }
 
 void uart0_output(const uint8_t *data, int num)
@@ -216,7 +247,7 @@ void uart0_irq_handler(void)
     while (!(((uart_hw_t *)uart0)->fr & UART_UARTFR_TXFF_BITS))
     {
         int ch;
-        if ((ch = remove_from_uart_fifo(&uart_fifo_output)) < 0)
+        if ((ch = remove_from_uart_fifo(&uart_fifo_output, NULL)) < 0)
         {
            uart_set_irq_enables(uart0, true, false);
            break;
@@ -229,8 +260,8 @@ void initialize_uart(void)
 {
     critical_section_init(&uart_cs);
     irq_set_enabled(UART0_IRQ, false);
-    initialize_uart_fifo(&uart_fifo_input);
-    initialize_uart_fifo(&uart_fifo_output);
+    initialize_uart_fifo(&uart_fifo_input, uart_fifo_input_stamp);
+    initialize_uart_fifo(&uart_fifo_output, NULL);
 
     gpio_set_function(UART_TX_PIN, GPIO_FUNC_UART);
     gpio_set_function(UART_RX_PIN, GPIO_FUNC_UART);
@@ -308,6 +339,7 @@ void idle_task(void)
 {
     usb_task();
     midi_uart_poll();
+    synth_poll_pending_starts();
     poll_potentiometers_and_buttons();
     buttons_poll();
     keyboard_poll();
@@ -403,14 +435,12 @@ uint16_t read_potentiometer_value(uint v)
     return ((uint16_t)((ind == 0) ? 0 : (samples[ind]*(POT_MAX_VALUE/ADC_MAX_VALUE))));
 }
 
-absolute_time_t last_time;
-
-static inline absolute_time_t update_next_timeout(const absolute_time_t last_time, uint32_t us, uint32_t min_us)
-{
-    absolute_time_t next_time = delayed_by_us(last_time, us);
-    absolute_time_t next_time_sooner = make_timeout_time_us(min_us);
-    return (absolute_time_diff_us(next_time, next_time_sooner) < 0) ? next_time : next_time_sooner;
-}
+/* output timing is kept in clk_sys cycles, the unit the DMA pacing timer counts in,
+   so that sample periods that are not a whole number of microseconds stay exact */
+uint32_t cycles_per_us;
+uint32_t sample_period_cycles;
+/* time in cycles at which the next sample taken from the synth ring will be played */
+uint32_t next_output_cycles;
 
 uint8_t get_scan_button(uint8_t b)
 {
@@ -436,7 +466,7 @@ void manually_poll_analog_controls(void)
        {
             current_samples[ci+csn*8] = adc_hw->result;
             select_control(ci,csn);
-            sleep_us(1000000 / DSP_SAMPLERATE);
+            sleep_us(1000000 / dsp_samplerate);
             current_samples[ci+csn*8] = adc_hw->result;
        }
    }
@@ -473,44 +503,108 @@ void reset_control_samples(uint16_t *reset_samples)
         reset_control_sample(n, last_samples[n]);
 }
 
+#define DAC_DMA_BUFFER_LENGTH (SYNTH_BLOCK_SIZE*2)
+
+uint32_t dac_dma_buffer[DAC_DMA_BUFFER_LENGTH] __attribute__((aligned(DAC_DMA_BUFFER_LENGTH*sizeof(uint32_t))));
+const uint32_t dac_dma_block_length = SYNTH_BLOCK_SIZE;
+uint32_t dac_last_level = DAC_PWM_WRAP_VALUE/2;
+
 #ifdef PLACE_IN_RAM
-static void __no_inline_not_in_flash_func(alarm_func)(uint alarm_num)
+static void __no_inline_not_in_flash_func(dac_dma_irq)(void)
 #else
-static void alarm_func(uint alarm_num)
+static void dac_dma_irq(void)
 #endif
 {
     static int32_t sample_avg;
-    static int16_t next_sample2;
 
-    absolute_time_t next_alarm_time;
+    dma_hw->ints0 = 1u << dac_dma_b3_data;
+
+    uint32_t block_cycles = sample_period_cycles * SYNTH_BLOCK_SIZE;
+    uint32_t block_time = next_output_cycles;
+    int32_t late = (int32_t)(time_us_32()*cycles_per_us - (block_time - block_cycles - sample_period_cycles));
+    if ((late / ((int32_t)cycles_per_us)) > ((int32_t)audio_jitter_max_us)) audio_jitter_max_us = late / cycles_per_us;
+    if (late >= ((int32_t)block_cycles))
+    {
+        /* whole blocks were replayed while interrupts were held off */
+        uint32_t missed = late / block_cycles;
+        audio_overruns += missed;
+        block_time += missed * block_cycles;
+    }
 
-    int16_t s = next_sample;
-    waiting_for_sample = false;
+    /* fill the half the data channel is not reading */
+    uint32_t reading = (dma_hw->ch[dac_dma_b3_data].read_addr - ((uint32_t)(uintptr_t)dac_dma_buffer)) / sizeof(uint32_t);
+    uint32_t *out = &dac_dma_buffer[(reading < SYNTH_BLOCK_SIZE) ? SYNTH_BLOCK_SIZE : 0];
 
-    pwm_set_both_levels(dac_pwm_b3_slice_num, next_sample2, next_sample2);
-    pwm_set_both_levels(dac_pwm_b1_slice_num, next_sample2, next_sample2);
-    pwm_set_both_levels(dac_pwm_a3_slice_num, next_sample2, next_sample2);
-    pwm_set_both_levels(dac_pwm_a1_slice_num, next_sample2, next_sample2);
+    uint32_t ring_read = synth_ring_read;
+    uint32_t ring_fill = synth_ring_write - ring_read;
+    if (ring_fill < audio_ring_min_fill) audio_ring_min_fill = ring_fill;
+    for (uint i=0;i<SYNTH_BLOCK_SIZE;i++)
+    {
+        if (ring_fill == 0)
+            audio_underruns++;
+        else
+        {
+            next_sample = synth_ring[ring_read & (SYNTH_RING_LENGTH-1)];
+            uint32_t probe_read = synth_latency_probe_read;
+            if (probe_read != synth_latency_probe_write)
+            {
+                synth_latency_probe *lp = &synth_latency_probes[probe_read & (SYNTH_LATENCY_PROBE_LENGTH-1)];
+                if (((int32_t)(ring_read - lp->sample_index)) >= 0)
+                {
+                    uint32_t latency_us = ((block_time + i*sample_period_cycles) - lp->time_us*cycles_per_us) / cycles_per_us;
+                    uint32_t bucket = latency_us / LATENCY_BUCKET_US;
+                    latency_histogram[bucket < LATENCY_BUCKETS ? bucket : (LATENCY_BUCKETS-1)]++;
+                    if ((latency_count == 0) || (latency_us < latency_min_us)) latency_min_us = latency_us;
+                    if (latency_us > latency_max_us) latency_max_us = latency_us;
+                    latency_total_us += latency_us;
+                    latency_count++;
+                    synth_latency_probe_read = probe_read + 1;
+                }
+            }
+            ring_read++;
+            ring_fill--;
+        }
+        int16_t s = next_sample;
+
+        s = (s - (ADC_MAX_VALUE/2))*(ADC_PREC_VALUE/ADC_MAX_VALUE);
+        sample_avg = (sample_avg*511)/512 + s;
+        s -= (sample_avg / 512);
+        if (s < (-ADC_PREC_VALUE/2)) s = (-ADC_PREC_VALUE/2);
+        if (s > (ADC_PREC_VALUE/2-1)) s = (ADC_PREC_VALUE/2-1);
+        insert_sample_circ_buf_clean(s);
+        s = dsp_process_all_units(s);
+        insert_sample_circ_buf(s);
+        uint32_t level;
+        if (s > (ADC_PREC_VALUE/2-1)) level = DAC_PWM_WRAP_VALUE-1;
+        else if (s < (-ADC_PREC_VALUE/2)) level = 0;
+        else level = (s+(ADC_PREC_VALUE/2)) / (ADC_PREC_VALUE/DAC_PWM_WRAP_VALUE);
+        out[i] = level | (level << 16);
+    }
+    synth_ring_read = ring_read;
+    dac_last_level = out[SYNTH_BLOCK_SIZE-1];
+    __sev();
 
-    s = (s - (ADC_MAX_VALUE/2))*(ADC_PREC_VALUE/ADC_MAX_VALUE);
-    sample_avg = (sample_avg*511)/512 + s;
-    s -= (sample_avg / 512);
-    if (s < (-ADC_PREC_VALUE/2)) s = (-ADC_PREC_VALUE/2);
-    if (s > (ADC_PREC_VALUE/2-1)) s = (ADC_PREC_VALUE/2-1);
-    insert_sample_circ_buf_clean(s);
-    s = dsp_process_all_units(s);
-    insert_sample_circ_buf(s);
-    if (s > (ADC_PREC_VALUE/2-1)) next_sample2 = DAC_PWM_WRAP_VALUE-1;
-    else if (s < (-ADC_PREC_VALUE/2)) next_sample2 = 0;
-    else next_sample2 = (s+(ADC_PREC_VALUE/2)) / (ADC_PREC_VALUE/DAC_PWM_WRAP_VALUE);
+    counter += SYNTH_BLOCK_SIZE;
+    next_output_cycles = block_time + block_cycles;
+    if (((int32_t)(time_us_32()*cycles_per_us - block_time)) > 0) audio_overruns++;
+}
 
-    counter++;
+/* keeps the output level steady while interrupts are disabled for a long time */
+void dac_dma_hold(void)
+{
+    for (uint i=0;i<DAC_DMA_BUFFER_LENGTH;i++)
+        dac_dma_buffer[i] = dac_last_level;
+}
 
-    last_time = delayed_by_us(last_time, 40);
-    do
-    {
-        next_alarm_time = update_next_timeout(last_time, 0, 8);
-    } while (hardware_alarm_set_target(claimed_alarm_num, next_alarm_time));
+uint32_t sample_index_from_time(uint32_t time_us)
+{
+    uint32_t ints = save_and_disable_interrupts();
+    uint32_t sample_index = synth_ring_read;
+    uint32_t sample_time = next_output_cycles;
+    restore_interrupts(ints);
+    int32_t elapsed = (int32_t)(time_us*cycles_per_us - sample_time);
+    if (elapsed < 0) elapsed -= ((int32_t)sample_period_cycles)-1;
+    return sample_index + elapsed / ((int32_t)sample_period_cycles);
 }
 
 void reset_control_samples_core(uint16_t *reset_samples)
@@ -521,32 +615,75 @@ void reset_control_samples_core(uint16_t *reset_samples)
     if (lockedout) multicore_lockout_end_blocking();
 }
 
-void reset_periodic_alarm(void)
-{
-    if (claimed_alarm_num == UNCLAIMED_ALARM) return;
-    
-    hardware_alarm_cancel(claimed_alarm_num);
-    hardware_alarm_set_callback(claimed_alarm_num, alarm_func);
-    last_time = make_timeout_time_us(1000);
-    absolute_time_t next_alarm_time = update_next_timeout(last_time, 0, 8);
-    hardware_alarm_set_target(claimed_alarm_num, next_alarm_time);
-}
-
 void reset_load_controls(void)
 {
     update_control_values();
     reset_control_samples_core(samples);
 }
 
-void initialize_periodic_alarm(void)
+static void initialize_dac_dma_channel(int data, int control, uint slice_num)
+{
+    dma_channel_config c = dma_channel_get_default_config(data);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_ring(&c, false, __builtin_ctz(sizeof(dac_dma_buffer)));
+    channel_config_set_dreq(&c, dma_get_timer_dreq(dac_dma_timer));
+    channel_config_set_chain_to(&c, control);
+    dma_channel_configure(data, &c, &pwm_hw->slice[slice_num].cc, dac_dma_buffer, SYNTH_BLOCK_SIZE, false);
+
+    /* restarts the data channel where its read address wrapped to */
+    c = dma_channel_get_default_config(control);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, false);
+    channel_config_set_write_increment(&c, false);
+    dma_channel_configure(control, &c, &dma_hw->ch[data].al1_transfer_count_trig, &dac_dma_block_length, 1, false);
+}
+
+void initialize_dac_dma(void)
+{
+    dac_dma_timer = dma_claim_unused_timer(true);
+    dma_timer_set_fraction(dac_dma_timer, 1, sample_period_cycles);
+    dac_dma_b3_data = dma_claim_unused_channel(true);
+    dac_dma_b3_control = dma_claim_unused_channel(true);
+    dac_dma_b1_data = dma_claim_unused_channel(true);
+    dac_dma_b1_control = dma_claim_unused_channel(true);
+    dac_dma_a3_data = dma_claim_unused_channel(true);
+    dac_dma_a3_control = dma_claim_unused_channel(true);
+    dac_dma_a1_data = dma_claim_unused_channel(true);
+    dac_dma_a1_control = dma_claim_unused_channel(true);
+    dac_dma_hold();
+    /* the four slices get the same level, each data channel paced by the one timer */
+    initialize_dac_dma_channel(dac_dma_b3_data, dac_dma_b3_control, dac_pwm_b3_slice_num);
+    initialize_dac_dma_channel(dac_dma_b1_data, dac_dma_b1_control, dac_pwm_b1_slice_num);
+    initialize_dac_dma_channel(dac_dma_a3_data, dac_dma_a3_control, dac_pwm_a3_slice_num);
+    initialize_dac_dma_channel(dac_dma_a1_data, dac_dma_a1_control, dac_pwm_a1_slice_num);
+
+    dma_channel_set_irq0_enabled(dac_dma_b3_data, true);
+    irq_set_exclusive_handler(DMA_IRQ_0, dac_dma_irq);
+    irq_set_enabled(DMA_IRQ_0, true);
+
+    uint32_t ints = save_and_disable_interrupts();
+    next_output_cycles = time_us_32()*cycles_per_us + (2*SYNTH_BLOCK_SIZE+1)*sample_period_cycles;
+    dma_start_channel_mask((1u << dac_dma_b3_data) | (1u << dac_dma_b1_data) |
+                           (1u << dac_dma_a3_data) | (1u << dac_dma_a1_data));
+    restore_interrupts(ints);
+}
+
+void set_sample_rate(void)
 {
-    if (claimed_alarm_num != UNCLAIMED_ALARM)
-    {
-        reset_periodic_alarm();
-        return;
-    }
-    claimed_alarm_num = hardware_alarm_claim_unused(true);
-    reset_periodic_alarm();
+    uint32_t rate = dsp_samplerates[pc.pcs.sample_rate < DSP_SAMPLERATES_NUMBER ? pc.pcs.sample_rate : 0];
+    uint32_t clk = clock_get_hz(clk_sys);
+    bool lockedout = multicore_lockout_victim_is_initialized(1);
+    if (lockedout) multicore_lockout_start_blocking();
+    dsp_set_samplerate(rate);
+    synth_set_samplerate(rate);
+    cycles_per_us = clk / 1000000u;
+    sample_period_cycles = (clk + rate/2) / rate;
+    if (dac_dma_timer >= 0)
+        dma_timer_set_fraction(dac_dma_timer, 1, sample_period_cycles);
+    if (lockedout) multicore_lockout_end_blocking();
+    synth_unit_reset_all();
 }
 
 void initialize_adc(void)
@@ -824,6 +961,7 @@ void adjust_synth_parms_unit(uint8_t unit_no)
                 if (snd.changed)
                 {
                    synth_set_value_prec((void *)(((uint8_t *)&synth_parms[unit_no]) + sp[sel-1].offset), sp[sel-1].size, snd.n);
+                   synth_compile_program();
                    update_control_values();
                    if (sp[sel-1].controldesc != NULL) potentiometer_set_state(snd.n,true);
                 }
@@ -846,7 +984,10 @@ void adjust_synth_params(void)
         {
             clear_display();
             write_str(0,0,"Synth Adj");
-            sprintf(s,"Unit #%d", unit_no+1);
+            if (unit_no < MAX_SYNTH_UNITS)
+                sprintf(s,"Unit #%d", unit_no+1);
+            else
+                sprintf(s,"Unit #%d Bus", unit_no+1);
             write_str_with_spaces(0,1,s,16);
             write_str_with_spaces(0,2,stnames[synth_parms[unit_no].stn.sut],16);
             display_refresh();
@@ -861,7 +1002,7 @@ void adjust_synth_params(void)
         {
             unit_no--;
             redraw = 1;
-        } else if (button_up() && (unit_no < (MAX_SYNTH_UNITS-1)))
+        } else if (button_up() && (unit_no < (SYNTH_ALL_UNITS-1)))
         {
             unit_no++;
             redraw = 1;
@@ -890,7 +1031,7 @@ typedef struct _flash_layout_data
     project_configuration pc;
     uint16_t samples[NUMBER_OF_CONTROLS];
     dsp_parm dsp_parms[MAX_DSP_UNITS];
-    synth_parm synth_parms[MAX_SYNTH_UNITS];
+    synth_parm synth_parms[SYNTH_ALL_UNITS];
 } flash_layout_data;
 
 typedef union _flash_layout
@@ -899,6 +1040,8 @@ typedef union _flash_layout
     uint8_t      space[FLASH_PAGE_BYTES];
 } flash_layout;
 
+static_assert(sizeof(flash_layout_data) <= FLASH_PAGE_BYTES, "patch must fit in one flash page so the banks do not move");
+
 inline static uint32_t flash_offset_bank(uint bankno)
 {
     return (FLASH_OFFSET_STORED - FLASH_PAGES(sizeof(flash_layout)) * (bankno+1));
@@ -930,11 +1073,11 @@ int write_data_to_flash(uint32_t flash_offset, const uint8_t *data, uint core, u
     bool multicore = multicore_lockout_victim_is_initialized(core);
     if (multicore) multicore_lockout_start_blocking();
     uint32_t ints = save_and_disable_interrupts();
+    dac_dma_hold();
     flash_range_erase(flash_offset, length);
     flash_range_program(flash_offset, data, length);
     restore_interrupts(ints);
     if (multicore) multicore_lockout_end_blocking();
-    reset_periodic_alarm();
     return 0;
 }
 
@@ -1033,7 +1176,9 @@ int flash_load_bank_ptr(const flash_layout *fl)
         memcpy((void *)samples, (void *) &fl->fld.samples, sizeof(samples));
         memcpy((void *)dsp_parms, (void *) &fl->fld.dsp_parms, sizeof(dsp_parms));
         memcpy((void *)synth_parms, (void *) &fl->fld.synth_parms, sizeof(synth_parms));
+        synth_compile_program();
         initialize_project_configuration();
+        set_sample_rate();
         dsp_unit_reset_all();
         synth_unit_reset_all();
         reset_load_controls();
@@ -1258,6 +1403,12 @@ void debugstuff(void)
         sprintf(str,"rate %u",(uint32_t)((((uint64_t)counter)*1000000)/time_us_32()));
         ssd1306_set_cursor(0,5);
         ssd1306_printstring(str);
+        sprintf(str,"und %u ovr %u",audio_underruns,audio_overruns);
+        ssd1306_set_cursor(0,6);
+        ssd1306_printstring(str);
+        sprintf(str,"jitter %u us",audio_jitter_max_us);
+        ssd1306_set_cursor(0,7);
+        ssd1306_printstring(str);
         ssd1306_render();
     }
 }
@@ -1691,6 +1842,199 @@ int pget_cmd(int args, tinycl_parameter *tp, void *V)
   return 1;
 }
 
+void reset_audio_stats(void)
+{
+  uint32_t ints = save_and_disable_interrupts();
+  audio_underruns = 0;
+  audio_overruns = 0;
+  audio_jitter_max_us = 0;
+  audio_ring_min_fill = SYNTH_RING_LENGTH;
+  restore_interrupts(ints);
+}
+
+int stats_cmd(int args, tinycl_parameter *tp, void *v)
+{
+  uint reset=tp[0].ti.i;
+  char s[80];
+
+  sprintf(s,"EventQueue depth %u max %u overflows %u\r\n", synth_event_queue_depth(), synth_event_queue_max_depth, synth_event_queue_overflows);
+  tinycl_put_string(s);
+  sprintf(s,"Events late %u delay %u samples\r\n", synth_event_late, SYNTH_EVENT_DELAY);
+  tinycl_put_string(s);
+  sprintf(s,"Audio underruns %u overruns %u jitter max %u us\r\n", audio_underruns, audio_overruns, audio_jitter_max_us);
+  tinycl_put_string(s);
+  sprintf(s,"Ring length %u min fill %u\r\n", SYNTH_RING_LENGTH, audio_ring_min_fill);
+  tinycl_put_string(s);
+  sprintf(s,"Voice program %u ops for %u of %u units, %u global\r\n", synth_program_ops(), synth_program_units(), MAX_SYNTH_UNITS, synth_program_globals());
+  tinycl_put_string(s);
+  sprintf(s,"Bus %u of %u units\r\n", synth_program_bus_units(), SYNTH_BUS_UNITS);
+  tinycl_put_string(s);
+  sprintf(s,"Control refresh %u Hz passes %u voice units %u\r\n", SYNTH_CONTROL_REFRESH_RATE, synth_refresh_passes, synth_refresh_units);
+  tinycl_put_string(s);
+  sprintf(s,"Silence retired %u skipped units %u\r\n", synth_silence_retired, synth_silence_skipped);
+  tinycl_put_string(s);
+  sprintf(s,"Wavetable mips %u bytes of %u\r\n", wavetable_mip_bytes, WAVETABLES_MIP_BYTES_MAX);
+  tinycl_put_string(s);
+  sprintf(s,"Voices limit %u of %u%s sheds %u\r\n", synth_voice_limit, MAX_POLYPHONY, synth_voice_limit_fixed ? " fixed" : "", synth_governor_sheds);
+  tinycl_put_string(s);
+  sprintf(s,"Synth load %u%% max %u%% per voice %u.%u%% fixed %u%%\r\n", (synth_load*100) >> 16, (synth_load_max*100) >> 16,
+            (synth_voice_cost*100) >> 16, ((synth_voice_cost*1000) >> 16) % 10, (synth_fixed_cost*100) >> 16);
+  tinycl_put_string(s);
+  sprintf(s,"Steals %u deferred %u wait max %u us\r\n", synth_steals, synth_steals_deferred, synth_steal_wait_us_max);
+  tinycl_put_string(s);
+  sprintf(s,"Steal time %u us max %u us\r\n", synth_steal_us_total, synth_steal_us_max);
+  tinycl_put_string(s);
+  if (reset)
+  {
+    synth_event_queue_reset_stats();
+    synth_governor_reset_stats();
+    synth_steal_reset_stats();
+    reset_audio_stats();
+    tinycl_put_string("Reset\r\n");
+  }
+  return 1;
+}
+
+uint32_t latency_percentile(uint32_t percent)
+{
+  uint32_t target = (latency_count * percent + 99) / 100;
+  uint32_t total = 0;
+  for (uint b=0;b<LATENCY_BUCKETS;b++)
+  {
+    total += latency_histogram[b];
+    if ((total >= target) && (total > 0))
+      return (b+1)*LATENCY_BUCKET_US;
+  }
+  return latency_max_us;
+}
+
+int latency_cmd(int args, tinycl_parameter *tp, void *v)
+{
+  uint reset=tp[0].ti.i;
+  char s[80];
+
+  if (latency_count == 0)
+    tinycl_put_string("No notes measured\r\n");
+  else
+  {
+    sprintf(s,"Notes %u min %u mean %u max %u us\r\n", latency_count, latency_min_us, (uint32_t)(latency_total_us / latency_count), latency_max_us);
+    tinycl_put_string(s);
+    sprintf(s,"p50 <%u p90 <%u p99 <%u us (bucket %u us)\r\n", latency_percentile(50), latency_percentile(90), latency_percentile(99), LATENCY_BUCKET_US);
+    tinycl_put_string(s);
+    if (latency_histogram[LATENCY_BUCKETS-1] != 0)
+    {
+      sprintf(s,"Over %u us: %u\r\n", (LATENCY_BUCKETS-1)*LATENCY_BUCKET_US, latency_histogram[LATENCY_BUCKETS-1]);
+      tinycl_put_string(s);
+    }
+  }
+  if (reset)
+  {
+    uint32_t ints = save_and_disable_interrupts();
+    memset(latency_histogram, '\000', sizeof(latency_histogram));
+    latency_count = 0;
+    latency_min_us = 0;
+    latency_max_us = 0;
+    latency_total_us = 0;
+    restore_interrupts(ints);
+    tinycl_put_string("Reset\r\n");
+  }
+  return 1;
+}
+
+#ifdef PROFILE_UNITS
+void prof_print(const char *prefix, uint num, const char *name, const unit_profile *up)
+{
+  char s[80];
+  if (up->samples == 0) return;
+  sprintf(s,"%s%u %-10s avg %u max %u\r\n", prefix, num, name, (uint32_t)(up->cycles / up->samples), up->max_cycles);
+  tinycl_put_string(s);
+}
+#endif
+
+int prof_cmd(int args, tinycl_parameter *tp, void *v)
+{
+#ifdef PROFILE_UNITS
+  uint reset=tp[0].ti.i;
+  char s[80];
+
+  sprintf(s,"Cycles/sample, budget %u\r\n", (uint32_t)(clock_get_hz(clk_sys) / dsp_samplerate));
+  tinycl_put_string(s);
+  tinycl_put_string("Synth units (per voice)\r\n");
+  for (uint unit_no=0;unit_no<SYNTH_ALL_UNITS;unit_no++)
+    prof_print("S", unit_no+1, stnames[synth_unit_get_type(unit_no)], &synth_profile_unit[unit_no]);
+  for (uint sut=0;sut<SYNTH_TYPE_MAX_ENTRY;sut++)
+    prof_print("T", sut, stnames[sut], &synth_profile_type[sut]);
+  prof_print("S", 0, "Total", &synth_profile_total);
+  tinycl_put_string("Synth note start (cycles/note)\r\n");
+  prof_print("N", 0, "Start", &synth_profile_note_start);
+  tinycl_put_string("DSP units\r\n");
+  for (uint unit_no=0;unit_no<MAX_DSP_UNITS;unit_no++)
+    prof_print("D", unit_no+1, dtnames[dsp_unit_get_type(unit_no)], &dsp_profile_unit[unit_no]);
+  for (uint dut=0;dut<DSP_TYPE_MAX_ENTRY;dut++)
+    prof_print("T", dut, dtnames[dut], &dsp_profile_type[dut]);
+  prof_print("D", 0, "Total", &dsp_profile_total);
+  if (reset)
+  {
+    synth_profile_reset();
+    dsp_profile_reset();
+    tinycl_put_string("Reset\r\n");
+  }
+#else
+  tinycl_put_string("Profiling not built, define PROFILE_UNITS\r\n");
+#endif
+  return 1;
+}
+
+int fuse_cmd(int args, tinycl_parameter *tp, void *v)
+{
+  uint mode=tp[0].ti.i;
+  char s[80];
+
+  if ((mode >= 1) && (mode <= 3))
+    synth_set_fusion_mode((synth_fusion_mode_type)(mode-1));
+  sprintf(s,"Fusion %s, program %u ops for %u units\r\n", synth_fusion_mode == SYNTH_FUSION_OFF ? "off" :
+            (synth_fusion_mode == SYNTH_FUSION_ON ? "on" : "check"), synth_program_ops(), synth_program_units());
+  tinycl_put_string(s);
+  sprintf(s,"Checked blocks %u mismatches %u\r\n", synth_fusion_checked_blocks, synth_fusion_mismatches);
+  tinycl_put_string(s);
+  if (synth_fusion_mismatches != 0)
+  {
+    const synth_fusion_mismatch *sfm = &synth_fusion_first_mismatch;
+    if (sfm->sample >= 0)
+      sprintf(s,"First units %u-%u sample %d fused %d unit path %d\r\n", sfm->fused_unit+1, sfm->unit+1,
+              sfm->sample, (int)sfm->fused, (int)sfm->reference);
+    else
+      sprintf(s,"First units %u-%u state only\r\n", sfm->fused_unit+1, sfm->unit+1);
+    tinycl_put_string(s);
+  }
+  return 1;
+}
+
+int silence_cmd(int args, tinycl_parameter *tp, void *v)
+{
+  uint level=tp[0].ti.i;
+  uint window=tp[1].ti.i;
+  char s[80];
+
+  if (level != 0)
+    synth_set_silence(level, window);
+  sprintf(s,"Silence level %u window %u samples%s\r\n", synth_silence_level, synth_silence_window, synth_silence_window ? "" : " (off)");
+  tinycl_put_string(s);
+  return 1;
+}
+
+int poly_cmd(int args, tinycl_parameter *tp, void *v)
+{
+  uint voices=tp[0].ti.i;
+  char s[80];
+
+  if (voices <= MAX_POLYPHONY)
+    synth_set_voice_limit(voices);
+  sprintf(s,"Voice limit %u of %u %s\r\n", synth_voice_limit, MAX_POLYPHONY, synth_voice_limit_fixed ? "fixed" : "adaptive");
+  tinycl_put_string(s);
+  return 1;
+}
+
 int help_cmd(int args, tinycl_parameter *tp, void *v);
 
 const tinycl_command tcmds[] =
@@ -1712,6 +2056,12 @@ const tinycl_command tcmds[] =
   { "PSET",  "Potentiometer Set", pset_cmd, TINYCL_PARM_INT, TINYCL_PARM_INT, TINYCL_PARM_END },
   { "PGET",  "Potentiometer Get", pget_cmd, TINYCL_PARM_INT, TINYCL_PARM_END },
   { "BINPATCH", "Export patch", binpatch_cmd, TINYCL_PARM_INT, TINYCL_PARM_END },
+  { "STATS", "Engine statistics (1=reset)", stats_cmd, TINYCL_PARM_INT, TINYCL_PARM_END },
+  { "LATENCY", "Note latency histogram (1=reset)", latency_cmd, TINYCL_PARM_INT, TINYCL_PARM_END },
+  { "PROF", "Unit cycle profile (1=reset)", prof_cmd, TINYCL_PARM_INT, TINYCL_PARM_END },
+  { "FUSE", "Fused kernels (1=off 2=on 3=check)", fuse_cmd, TINYCL_PARM_INT, TINYCL_PARM_END },
+  { "SILENCE", "Silence level, window (window 0=off)", silence_cmd, TINYCL_PARM_INT, TINYCL_PARM_INT, TINYCL_PARM_END },
+  { "POLY", "Voice limit (0=adaptive)", poly_cmd, TINYCL_PARM_INT, TINYCL_PARM_END },
   { "HELP", "Display This Help", help_cmd, {TINYCL_PARM_END } }
 };
 
@@ -1721,7 +2071,7 @@ int help_cmd(int args, tinycl_parameter *tp, void *v)
   return 1;
 }
 
-const char *const confmenu[] = {"Quit", "Transpose", "FailDelay", NULL };
+const char *const confmenu[] = {"Quit", "Transpose", "FailDelay", "Tuning", "SampleRate", NULL };
 
 typedef struct _configuration_entry
 {
@@ -1735,7 +2085,9 @@ typedef struct _configuration_entry
 const configuration_entry configuration_entries[] = 
 {
   { &pc.pcs.note_transpose,             1, 2, 0, 95 },    /* NOTE TRANSPOSE */
-  { &pc.pcs.fail_delay,                 4, 5, 1, 99999 }  /* FAIL DELAY */
+  { &pc.pcs.fail_delay,                 4, 5, 1, 99999 }, /* FAIL DELAY */
+  { &pc.pcs.tuning,                     1, 1, 0, PITCH_TUNINGS_NUMBER-1 }, /* TUNING */
+  { &pc.pcs.sample_rate,                1, 1, 0, DSP_SAMPLERATES_NUMBER-1 } /* SAMPLE RATE */
 };
 
 void configuration(void)
@@ -1802,6 +2154,7 @@ void configuration(void)
         case 4: *((uint32_t *)c->entry) = snd.n;
                 break;
       }
+      if (c->entry == &pc.pcs.sample_rate) set_sample_rate();
     } 
   }
 }
@@ -1812,16 +2165,29 @@ static void __no_inline_not_in_flash_func(synth_task)(void)
 static void synth_task(void)
 #endif
 {
+    int32_t block[SYNTH_BLOCK_SIZE];
+
     multicore_lockout_victim_init();
+    synth_interp_initialize();
+#ifdef PROFILE_UNITS
+    profile_initialize_cycles();
+#endif
     for (;;)
     {
-        while (waiting_for_sample) {};
+        while ((synth_ring_write - synth_ring_read) > (SYNTH_RING_LENGTH - SYNTH_BLOCK_SIZE))
+            __wfe();
 
-        int32_t s = synth_process_all_units();
-        if (s < (-QUANTIZATION_MAX)) s = -QUANTIZATION_MAX;
-        if (s > (QUANTIZATION_MAX-1)) s = QUANTIZATION_MAX-1;
-        next_sample = (s + QUANTIZATION_MAX) / ((QUANTIZATION_MAX*2) / ADC_MAX_VALUE);
-        waiting_for_sample = true;
+        uint32_t ring_write = synth_ring_write;
+        synth_process_all_units(block, ring_write);
+        for (uint i=0;i<SYNTH_BLOCK_SIZE;i++)
+        {
+            int32_t s = block[i];
+            if (s < (-QUANTIZATION_MAX)) s = -QUANTIZATION_MAX;
+            if (s > (QUANTIZATION_MAX-1)) s = QUANTIZATION_MAX-1;
+            synth_ring[(ring_write + i) & (SYNTH_RING_LENGTH-1)] = (s + QUANTIZATION_MAX) / ((QUANTIZATION_MAX*2) / ADC_MAX_VALUE);
+        }
+        DMB();
+        synth_ring_write = ring_write + SYNTH_BLOCK_SIZE;
     }
 }
 
@@ -1845,7 +2211,11 @@ int main()
     initialize_pwm();
     ssd1306_Initialize();
     initialize_adc();
-    initialize_periodic_alarm();
+#ifdef PROFILE_UNITS
+    profile_initialize_cycles();
+#endif
+    set_sample_rate();
+    initialize_dac_dma();
     flash_load_most_recent();
     start_synth_engine();
     
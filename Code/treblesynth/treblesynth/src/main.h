@@ -30,7 +30,7 @@ extern "C" {
 #endif
 
 uint8_t get_scan_button(uint8_t b);
-int uart0_input(void);
+int uart0_input(uint32_t *time_us);
 void uart0_output(const uint8_t *data, int num);
 void idle_task(void);
 void set_control_changes_midi(int i, int val);
@@ -0,0 +1,105 @@
+/* pitch.c */
+
+#include <stdint.h>
+
+const uint32_t table_exp2[385]={
+    1073741824,1075681754,1077625190,1079572136,1081522600,1083476588,1085434106,1087395161,1089359758,1091327906,1093299609,1095274874,1097253708,1099236118,1101222108,1103211687,
+    1105204861,1107201636,1109202018,1111206014,1113213631,1115224875,1117239753,1119258271,1121280436,1123306254,1125335733,1127368878,1129405696,1131446194,1133490379,1135538257,
+    1137589835,1139645120,1141704118,1143766836,1145833280,1147903458,1149977377,1152055042,1154136461,1156221640,1158310587,1160403307,1162499809,1164600099,1166704183,1168812068,
+    1170923762,1173039271,1175158602,1177281762,1179408758,1181539597,1183674286,1185812831,1187955240,1190101520,1192251678,1194405720,1196563654,1198725486,1200891225,1203060876,
+    1205234447,1207411945,1209593378,1211778751,1213968073,1216161350,1218358590,1220559799,1222764986,1224974156,1227187318,1229404479,1231625645,1233850824,1236080024,1238313250,
+    1240550512,1242791816,1245037169,1247286579,1249540052,1251797598,1254059221,1256324931,1258594735,1260868639,1263146652,1265428780,1267715031,1270005413,1272299933,1274598598,
+    1276901417,1279208396,1281519543,1283834865,1286154371,1288478067,1290805962,1293138062,1295474376,1297814910,1300159674,1302508673,1304861917,1307219412,1309581167,1311947188,
+    1314317484,1316692063,1319070932,1321454098,1323841571,1326233356,1328629463,1331029899,1333434672,1335843790,1338257260,1340675091,1343097290,1345523865,1347954824,1350390175,
+    1352829926,1355274085,1357722660,1360175659,1362633090,1365094960,1367561278,1370032052,1372507291,1374987001,1377471191,1379959869,1382453044,1384950723,1387452915,1389959628,
+    1392470869,1394986647,1397506971,1400031848,1402561287,1405095296,1407633882,1410177056,1412724824,1415277195,1417834178,1420395780,1422962010,1425532877,1428108389,1430688553,
+    1433273380,1435862876,1438457051,1441055912,1443659470,1446267730,1448880704,1451498398,1454120821,1456747983,1459379890,1462016553,1464657980,1467304179,1469955159,1472610928,
+    1475271496,1477936870,1480607060,1483282074,1485961921,1488646610,1491336149,1494030547,1496729814,1499433957,1502142985,1504856908,1507575735,1510299473,1513028133,1515761722,
+    1518500250,1521243726,1523992158,1526745556,1529503929,1532267285,1535035634,1537808984,1540587345,1543370725,1546159135,1548952582,1551751076,1554554626,1557363241,1560176931,
+    1562995704,1565819569,1568648537,1571482616,1574321815,1577166143,1580015611,1582870227,1585730000,1588594939,1591465055,1594340357,1597220853,1600106553,1602997467,1605893604,
+    1608794974,1611701585,1614613448,1617530571,1620452965,1623380639,1626313602,1629251865,1632195435,1635144324,1638098541,1641058095,1644022996,1646993254,1649968878,1652949879,
+    1655936265,1658928046,1661925233,1664927835,1667935861,1670949323,1673968228,1676992588,1680022412,1683057710,1686098492,1689144768,1692196547,1695253840,1698316657,1701385007,
+    1704458901,1707538348,1710623359,1713713944,1716810113,1719911875,1723019241,1726132222,1729250827,1732375066,1735504949,1738640488,1741781691,1744928569,1748081133,1751239393,
+    1754403359,1757573041,1760748450,1763929596,1767116489,1770309140,1773507559,1776711757,1779921743,1783137530,1786359126,1789586543,1792819790,1796058879,1799303821,1802554624,
+    1805811301,1809073862,1812342318,1815616678,1818896955,1822183157,1825475297,1828773385,1832077432,1835387448,1838703444,1842025431,1845353420,1848687422,1852027447,1855373507,
+    1858725612,1862083773,1865448001,1868818308,1872194703,1875577199,1878965806,1882360536,1885761398,1889168405,1892581567,1896000896,1899426403,1902858098,1906295993,1909740100,
+    1913190429,1916646992,1920109800,1923578864,1927054196,1930535806,1934023707,1937517909,1941018425,1944525265,1948038440,1951557963,1955083844,1958616096,1962154730,1965699756,
+    1969251188,1972809036,1976373312,1979944027,1983521194,1987104823,1990694927,1994291518,1997894606,2001504204,2005120323,2008742976,2012372174,2016007929,2019650252,2023299156,
+    2026954652,2030616753,2034285470,2037960816,2041642801,2045331439,2049026741,2052728720,2056437387,2060152754,2063874834,2067603638,2071339180,2075081470,2078830522,2082586347,
+    2086348957,2090118366,2093894584,2097677626,2101467502,2105264225,2109067808,2112878262,2116695602,2120519837,2124350982,2128189049,2132034050,2135885998,2139744905,2143610784,
+    2147483648};
+
+const uint32_t table_sine_quarter[257]={
+    0,6588356,13176464,19764076,26350943,32936819,39521455,46104602,52686014,59265442,65842639,72417357,78989349,85558366,92124163,98686491,
+    105245103,111799753,118350194,124896179,131437462,137973796,144504935,151030634,157550647,164064728,170572633,177074115,183568930,190056834,196537583,203010932,
+    209476638,215934457,222384147,228825464,235258165,241682010,248096755,254502159,260897982,267283981,273659918,280025552,286380643,292724951,299058239,305380268,
+    311690799,317989595,324276419,330551034,336813204,343062693,349299266,355522689,361732726,367929144,374111709,380280190,386434353,392573967,398698801,404808624,
+    410903207,416982319,423045732,429093217,435124548,441139496,447137835,453119340,459083786,465030947,470960600,476872522,482766489,488642281,494499676,500338453,
+    506158392,511959275,517740883,523502998,529245404,534967884,540670223,546352205,552013618,557654248,563273883,568872310,574449320,580004702,585538248,591049748,
+    596538995,602005783,607449906,612871159,618269338,623644239,628995660,634323400,639627258,644907034,650162530,655393548,660599890,665781362,670937767,676068911,
+    681174602,686254647,691308855,696337036,701339000,706314559,711263525,716185713,721080937,725949013,730789757,735602987,740388522,745146182,749875788,754577161,
+    759250125,763894504,768510122,773096806,777654384,782182683,786681534,791150767,795590213,799999706,804379079,808728167,813046808,817334838,821592095,825818421,
+    830013654,834177638,838310216,842411232,846480531,850517961,854523370,858496606,862437520,866345964,870221790,874064853,877875009,881652112,885396022,889106597,
+    892783698,896427186,900036924,903612776,907154608,910662286,914135678,917574653,920979082,924348837,927683790,930983817,934248793,937478595,940673101,943832191,
+    946955747,950043650,953095785,956112036,959092290,962036435,964944360,967815955,970651112,973449725,976211688,978936898,981625251,984276646,986890984,989468165,
+    992008094,994510675,996975812,999403415,1001793390,1004145648,1006460100,1008736660,1010975242,1013175761,1015338134,1017462281,1019548121,1021595575,1023604567,1025575020,
+    1027506862,1029400018,1031254418,1033069992,1034846671,1036584389,1038283080,1039942680,1041563127,1043144360,1044686319,1046188946,1047652185,1049075980,1050460278,1051805027,
+    1053110176,1054375676,1055601479,1056787540,1057933813,1059040255,1060106826,1061133483,1062120190,1063066909,1063973603,1064840240,1065666786,1066453210,1067199483,1067905576,
+    1068571464,1069197120,1069782521,1070327646,1070832474,1071296985,1071721163,1072104991,1072448455,1072751542,1073014240,1073236540,1073418433,1073559913,1073660973,1073721611,
+    1073741824};
+
+const uint32_t table_reciprocal[65]={
+    2147483648,2114445438,2082408386,2051327664,2021161080,1991868891,1963413621,1935759908,1908874354,1882725390,1857283155,1832519380,1808407283,1784921474,1762037865,1739733588,
+    1717986918,1696777203,1676084798,1655891006,1636178018,1616928864,1598127366,1579758086,1561806289,1544257904,1527099483,1510318170,1493901668,1477838209,1462116526,1446725826,
+    1431655765,1416896428,1402438301,1388272257,1374389535,1360781718,1347440720,1334358772,1321528399,1308942414,1296593901,1284476201,1272582903,1260907830,1249445032,1238188770,
+    1227133513,1216273925,1205604855,1195121335,1184818564,1174691910,1164736894,1154949189,1145324612,1135859120,1126548799,1117389866,1108378657,1099511628,1090785345,1082196484,
+    1073741824};
+
+const uint16_t table_envelope_curve[65]={
+    0,2479,4772,6893,8854,10668,12345,13897,15332,16659,17886,19021,20071,21042,21940,22770,
+    23538,24249,24906,25513,26075,26595,27075,27520,27931,28311,28663,28988,29289,29567,29824,30062,
+    30282,30486,30674,30848,31009,31158,31296,31423,31541,31650,31750,31844,31930,32010,32083,32151,
+    32214,32273,32327,32377,32423,32465,32505,32541,32575,32606,32635,32662,32686,32709,32730,32750,
+    32768};
+
+const uint16_t table_tuning_equal[128]={
+    0,256,512,768,1024,1280,1536,1792,2048,2304,2560,2816,3072,3328,3584,3840,
+    4096,4352,4608,4864,5120,5376,5632,5888,6144,6400,6656,6912,7168,7424,7680,7936,
+    8192,8448,8704,8960,9216,9472,9728,9984,10240,10496,10752,11008,11264,11520,11776,12032,
+    12288,12544,12800,13056,13312,13568,13824,14080,14336,14592,14848,15104,15360,15616,15872,16128,
+    16384,16640,16896,17152,17408,17664,17920,18176,18432,18688,18944,19200,19456,19712,19968,20224,
+    20480,20736,20992,21248,21504,21760,22016,22272,22528,22784,23040,23296,23552,23808,24064,24320,
+    24576,24832,25088,25344,25600,25856,26112,26368,26624,26880,27136,27392,27648,27904,28160,28416,
+    28672,28928,29184,29440,29696,29952,30208,30464,30720,30976,31232,31488,31744,32000,32256,32512};
+
+const uint16_t table_tuning_just[128]={
+    0,286,522,808,989,1275,1511,1797,2083,2264,2605,2786,3072,3358,3594,3880,
+    4061,4347,4583,4869,5155,5336,5677,5858,6144,6430,6666,6952,7133,7419,7655,7941,
+    8227,8408,8749,8930,9216,9502,9738,10024,10205,10491,10727,11013,11299,11480,11821,12002,
+    12288,12574,12810,13096,13277,13563,13799,14085,14371,14552,14893,15074,15360,15646,15882,16168,
+    16349,16635,16871,17157,17443,17624,17965,18146,18432,18718,18954,19240,19421,19707,19943,20229,
+    20515,20696,21037,21218,21504,21790,22026,22312,22493,22779,23015,23301,23587,23768,24109,24290,
+    24576,24862,25098,25384,25565,25851,26087,26373,26659,26840,27181,27362,27648,27934,28170,28456,
+    28637,28923,29159,29445,29731,29912,30253,30434,30720,31006,31242,31528,31709,31995,32231,32517};
+
+const uint16_t table_tuning_pythagorean[128]={
+    0,231,522,753,1044,1275,1566,1797,2028,2319,2550,2841,3072,3303,3594,3825,
+    4116,4347,4638,4869,5100,5391,5622,5913,6144,6375,6666,6897,7188,7419,7710,7941,
+    8172,8463,8694,8985,9216,9447,9738,9969,10260,10491,10782,11013,11244,11535,11766,12057,
+    12288,12519,12810,13041,13332,13563,13854,14085,14316,14607,14838,15129,15360,15591,15882,16113,
+    16404,16635,16926,17157,17388,17679,17910,18201,18432,18663,18954,19185,19476,19707,19998,20229,
+    20460,20751,20982,21273,21504,21735,22026,22257,22548,22779,23070,23301,23532,23823,24054,24345,
+    24576,24807,25098,25329,25620,25851,26142,26373,26604,26895,27126,27417,27648,27879,28170,28401,
+    28692,28923,29214,29445,29676,29967,30198,30489,30720,30951,31242,31473,31764,31995,32286,32517};
+
+const uint16_t table_tuning_meantone[128]={
+    0,195,494,794,989,1289,1483,1783,1978,2278,2578,2772,3072,3267,3566,3866,
+    4061,4361,4555,4855,5050,5350,5650,5844,6144,6339,6638,6938,7133,7433,7627,7927,
+    8122,8422,8722,8916,9216,9411,9710,10010,10205,10505,10699,10999,11194,11494,11794,11988,
+    12288,12483,12782,13082,13277,13577,13771,14071,14266,14566,14866,15060,15360,15555,15854,16154,
+    16349,16649,16843,17143,17338,17638,17938,18132,18432,18627,18926,19226,19421,19721,19915,20215,
+    20410,20710,21010,21204,21504,21699,21998,22298,22493,22793,22987,23287,23482,23782,24082,24276,
+    24576,24771,25070,25370,25565,25865,26059,26359,26554,26854,27154,27348,27648,27843,28142,28442,
+    28637,28937,29131,29431,29626,29926,30226,30420,30720,30915,31214,31514,31709,32009,32203,32503};
+
+const uint16_t *tunings[4]= { table_tuning_equal, table_tuning_just, table_tuning_pythagorean, table_tuning_meantone };
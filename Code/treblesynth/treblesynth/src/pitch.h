@@ -0,0 +1,51 @@
+/* pitch.h
+
+*/
+
+/*
+   Copyright (c) 2024 Daniel Marks
+
+  This software is provided 'as-is', without any express or implied
+  warranty. In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+   claim that you wrote the original software. If you use this software
+   in a product, an acknowledgment in the product documentation would be
+   appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+   misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+#ifndef _PITCH_H
+#define _PITCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define PITCH_EXP2_STEP_BITS 3
+#define PITCH_EXP2_LENGTH 385
+#define PITCH_SINE_QUARTER_LENGTH 257
+#define PITCH_TUNINGS_NUMBER 4
+#define PITCH_RECIPROCAL_BITS 6
+#define PITCH_ENVELOPE_CURVE_BITS 6
+
+extern const uint32_t table_exp2[];
+extern const uint32_t table_sine_quarter[];
+extern const uint32_t table_reciprocal[];
+extern const uint16_t table_envelope_curve[];
+extern const uint16_t *tunings[PITCH_TUNINGS_NUMBER];
+ 
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _PITCH_H
@@ -29,6 +29,7 @@
 #include <stdbool.h>
 #include <math.h>
 #include "waves.h"
+#include "pitch.h"
 #include "synth.h"
 #include "treblesynth.h"
 
@@ -37,45 +38,207 @@
 #define QUANTIZATION_MAX_FLOAT ((float)(1<<QUANTIZATION_BITS))
 
 volatile uint32_t synth_note_active[MAX_POLYPHONY];
-volatile uint32_t synth_note_stopping[MAX_POLYPHONY];
-volatile uint32_t synth_note_stopping_fast[MAX_POLYPHONY];
+uint32_t synth_note_sounding[MAX_POLYPHONY];
+uint32_t synth_note_stopping[MAX_POLYPHONY];
+uint32_t synth_note_stopping_fast[MAX_POLYPHONY];
 uint8_t synth_note_number[MAX_POLYPHONY];
 uint8_t synth_note_velocity[MAX_POLYPHONY];
 uint32_t synth_note_stopping_counter[MAX_POLYPHONY];
 uint32_t synth_note_count[MAX_POLYPHONY];
+uint32_t synth_note_block_samples[MAX_POLYPHONY];
+uint32_t synth_note_silent_samples[MAX_POLYPHONY];
+uint32_t synth_note_control_generation[MAX_POLYPHONY];
+volatile uint32_t synth_silence_level = SYNTH_SILENCE_LEVEL;
+volatile uint32_t synth_silence_window = SYNTH_SILENCE_WINDOW;
+uint32_t synth_silence_retired;
+uint32_t synth_silence_skipped;
 uint32_t synth_current_note_count;
+bool synth_note_stealing[MAX_POLYPHONY];
+bool synth_note_release_pending[MAX_POLYPHONY];
+synth_pending_start synth_pending_starts[MAX_POLYPHONY];
+uint32_t synth_steals;
+uint32_t synth_steals_deferred;
+uint32_t synth_steal_us_total;
+uint32_t synth_steal_us_max;
+uint32_t synth_steal_wait_us_max;
 int32_t synth_pitch_bend_value;
 
+volatile uint32_t synth_voice_limit = SYNTH_POLYPHONY_DEFAULT;
+volatile uint32_t synth_voice_limit_fixed;
+uint32_t synth_block_budget_us;
+uint32_t synth_load;
+uint32_t synth_load_max;
+uint32_t synth_voice_cost;
+uint32_t synth_fixed_cost;
+uint32_t synth_governor_sheds;
+
 synth_unit synth_units[MAX_POLYPHONY][MAX_SYNTH_UNITS];
-synth_parm synth_parms[MAX_SYNTH_UNITS];
-int32_t synth_unit_result[MAX_POLYPHONY][MAX_SYNTH_UNITS+1];
+synth_parm synth_parms[SYNTH_ALL_UNITS];
+int32_t synth_unit_result[MAX_POLYPHONY][MAX_SYNTH_UNITS+1][SYNTH_BLOCK_SIZE];
+synth_unit synth_global_units[MAX_SYNTH_UNITS];
+int32_t synth_global_result[MAX_SYNTH_UNITS][SYNTH_BLOCK_SIZE];
+synth_unit synth_bus_units[SYNTH_BUS_UNITS];
+int32_t synth_bus_result[SYNTH_BUS_UNITS+1][SYNTH_BLOCK_SIZE];
+
+synth_program synth_compiled_program;
+volatile uint8_t synth_fusion_mode = SYNTH_FUSION_ON;
+uint32_t synth_fusion_checked_blocks;
+uint32_t synth_fusion_mismatches;
+synth_fusion_mismatch synth_fusion_first_mismatch;
+synth_program synth_note_program[MAX_POLYPHONY];
+volatile uint32_t synth_compiled_program_id;
+synth_global_program synth_compiled_globals;
+synth_global_program synth_running_globals;
+synth_bus_program synth_compiled_bus;
+synth_bus_program synth_running_bus;
+uint32_t synth_running_globals_id;
+uint32_t synth_running_globals_generation;
+uint8_t synth_compiled_input[SYNTH_ALL_UNITS][SYNTH_INPUTS_NUMBER];
+synth_unit synth_voice_template[MAX_SYNTH_UNITS];
+uint32_t synth_patch_generation = 1;
+uint32_t synth_voice_template_generation;
+volatile uint32_t synth_control_generation;
+uint32_t synth_voice_template_control_generation;
+uint32_t synth_refresh_blocks = 1;
+uint32_t synth_refresh_countdown;
+uint32_t synth_refresh_passes;
+uint32_t synth_refresh_units;
 
 mutex_t synth_mutex;
-mutex_t note_mutexes[MAX_POLYPHONY];
 
-inline float frequency_omega_from_vco(uint32_t vco)
+synth_event synth_event_queue[SYNTH_EVENT_QUEUE_LENGTH];
+volatile uint32_t synth_event_queue_write;
+volatile uint32_t synth_event_queue_read;
+volatile bool synth_reset_pending;
+volatile bool synth_panic_pending;
+volatile uint32_t synth_event_flush_write;
+uint32_t synth_event_queue_max_depth;
+uint32_t synth_event_queue_overflows;
+uint32_t synth_event_late;
+
+synth_latency_probe synth_latency_probes[SYNTH_LATENCY_PROBE_LENGTH];
+volatile uint32_t synth_latency_probe_write;
+volatile uint32_t synth_latency_probe_read;
+
+#ifdef PROFILE_UNITS
+unit_profile synth_profile_unit[SYNTH_ALL_UNITS];
+unit_profile synth_profile_type[SYNTH_TYPE_MAX_ENTRY];
+unit_profile synth_profile_total;
+unit_profile synth_profile_note_start;
+volatile bool synth_profile_reset_pending;
+#endif
+
+#define SYNTH_VCO_OCTAVE ((QUANTIZATION_MAX/MIDI_NOTES)*12)
+#define SYNTH_COUNTER_BASE(rate) ((uint32_t)((MIDI_FREQUENCY_0/((float)(rate)))*((float)(SYNTH_OSCILLATOR_PRECISION*WAVETABLES_LENGTH))*65536.0f+0.5f))
+#define SYNTH_PERIOD_BASE(rate) ((uint32_t)((((float)(rate))/MIDI_FREQUENCY_0)*((float)SYNTH_PERIOD_PRECISION)*256.0f+0.5f))
+#define SEMITONE_LOG_STEP_Q16 ((uint32_t)(SEMITONE_LOG_STEP*65536.0f+0.5f))
+
+uint32_t synth_counter_base = SYNTH_COUNTER_BASE(DSP_SAMPLERATE_REFERENCE);
+uint32_t synth_period_base = SYNTH_PERIOD_BASE(DSP_SAMPLERATE_REFERENCE);
+uint32_t synth_reference_scale = 65536;
+
+void synth_set_samplerate(uint32_t samplerate)
+{
+    synth_counter_base = SYNTH_COUNTER_BASE(samplerate);
+    synth_period_base = SYNTH_PERIOD_BASE(samplerate);
+    synth_reference_scale = (samplerate * 65536ull + DSP_SAMPLERATE_REFERENCE/2) / DSP_SAMPLERATE_REFERENCE;
+    synth_block_budget_us = (SYNTH_BLOCK_SIZE * 1000000u) / samplerate;
+    synth_refresh_blocks = samplerate / (SYNTH_CONTROL_REFRESH_RATE * SYNTH_BLOCK_SIZE);
+    if (synth_refresh_blocks == 0) synth_refresh_blocks = 1;
+    synth_voice_cost = 0;
+    synth_fixed_cost = 0;
+    synth_patch_generation++;
+}
+
+/* times in the patches are in samples at the reference rate */
+static inline uint32_t synth_samples_from_reference(uint32_t samples)
+{
+    uint32_t scaled = (uint32_t)((((uint64_t)samples) * synth_reference_scale) >> 16);
+    return (scaled != 0) ? scaled : 1;
+}
+
+/* 2^32/x without a divide, for x of at least 2 */
+static uint32_t reciprocal_fraction(uint32_t x)
+{
+    if (x < 2) return 0xFFFFFFFFu;
+    uint32_t s = __builtin_clz(x);
+    uint32_t m = x << s;
+    uint32_t idx = (m >> (31-PITCH_RECIPROCAL_BITS)) & ((1u << PITCH_RECIPROCAL_BITS)-1);
+    uint32_t frac = (m >> (15-PITCH_RECIPROCAL_BITS)) & 0xFFFF;
+    uint32_t r = table_reciprocal[idx] - (uint32_t)((((uint64_t)(table_reciprocal[idx] - table_reciprocal[idx+1])) * frac) >> 16);
+    return r >> (30 - s);
+}
+
+static uint32_t exp2_fraction(uint32_t r)
+{
+    uint32_t i = r >> PITCH_EXP2_STEP_BITS;
+    uint32_t f = r & ((1u << PITCH_EXP2_STEP_BITS)-1);
+    uint32_t t = table_exp2[i];
+    if (f == 0) return t;
+    return t + (((table_exp2[i+1] - t) * f) >> PITCH_EXP2_STEP_BITS);
+}
+
+static uint32_t sine_quarter(uint32_t u)
+{
+    if (u >= (1u << 24)) return table_sine_quarter[PITCH_SINE_QUARTER_LENGTH-1];
+    uint32_t i = u >> 16;
+    uint32_t t = table_sine_quarter[i];
+    return t + (uint32_t)((((uint64_t)(table_sine_quarter[i+1] - t)) * (u & 0xFFFF)) >> 16);
+}
+
+static uint32_t isqrt64(uint64_t x)
 {
-    return expf((SEMITONE_LOG_STEP*((float)MIDI_NOTES)/((float)QUANTIZATION_MAX))*((float)vco))*(MATH_PI_F*2.0f*MIDI_FREQUENCY_0/((float)DSP_SAMPLERATE));
+    uint64_t res = 0, bit = 1ull << 62;
+    while (bit > x) bit >>= 2;
+    while (bit != 0)
+    {
+        if (x >= (res + bit))
+        {
+            x -= res + bit;
+            res = (res >> 1) + bit;
+        } else res >>= 1;
+        bit >>= 2;
+    }
+    return (uint32_t) res;
 }
 
-inline float frequency_fraction_from_vco(uint32_t vco)
+/* counter increment with 8 extra fraction bits */
+uint32_t counter_fraction_from_vco(uint32_t vco)
 {
-    return expf((SEMITONE_LOG_STEP*((float)MIDI_NOTES)/((float)QUANTIZATION_MAX))*((float)vco))*(MIDI_FREQUENCY_0/((float)DSP_SAMPLERATE));
+    uint32_t octave = vco / SYNTH_VCO_OCTAVE;
+    uint32_t r = vco - octave * SYNTH_VCO_OCTAVE;
+    return (uint32_t)((((uint64_t)synth_counter_base) * exp2_fraction(r)) >> (30+16-8-octave));
 }
 
-inline float frequency_semitone_fraction_from_vco(uint32_t vco)
+uint32_t counter_fraction_from_frequency(uint32_t frequency)
 {
-    return expf((SEMITONE_LOG_STEP*((float)MIDI_NOTES)/((float)QUANTIZATION_MAX))*((float)vco))*(SEMITONE_LOG_STEP*MIDI_FREQUENCY_0/((float)DSP_SAMPLERATE));
+    return (uint32_t)((((uint64_t)frequency) << 26) / dsp_samplerate);
 }
 
-inline float counter_fraction_from_vco(uint32_t vco)
+uint32_t period_count_from_vco(uint32_t vco)
 {
-    return expf((SEMITONE_LOG_STEP*((float)MIDI_NOTES)/((float)QUANTIZATION_MAX))*((float)vco))*((MIDI_FREQUENCY_0/((float)DSP_SAMPLERATE))*((((float)SYNTH_OSCILLATOR_PRECISION)*WAVETABLES_LENGTH)));
+    uint32_t octave = vco / SYNTH_VCO_OCTAVE;
+    uint32_t r = vco - octave * SYNTH_VCO_OCTAVE;
+    return (uint32_t)((((uint64_t)synth_period_base) * exp2_fraction(SYNTH_VCO_OCTAVE - r)) >> (8+31+octave));
 }
 
-inline float period_count_from_vco(uint32_t vco)
+/* counter increment times SEMITONE_LOG_STEP times gain */
+static inline int32_t counter_semitone_gain(uint32_t counter_fraction, uint32_t gain)
 {
-    return expf((-SEMITONE_LOG_STEP*((float)MIDI_NOTES)/((float)QUANTIZATION_MAX))*((float)vco))*((((float)DSP_SAMPLERATE)/MIDI_FREQUENCY_0)*((float)SYNTH_PERIOD_PRECISION));
+    return (int32_t)((((uint64_t)counter_fraction) * SEMITONE_LOG_STEP_Q16 * gain) >> (16+8));
+}
+
+/* lowpass coefficient from the frequency as a fraction of the sample rate in Q25, so that
+   1-cos(w) = 2 sin^2(w/2) keeps its precision at low frequencies */
+int32_t lowpass_dalpha_from_fraction(uint32_t u, uint32_t kneefreq)
+{
+    uint64_t s = sine_quarter(u);
+    uint64_t d = (s * s) >> 29;
+    uint64_t lb = ((uint64_t)(256 - kneefreq)) << 22;
+    uint64_t bd = (d * kneefreq) >> 8;
+    uint64_t sq = isqrt64(bd * (2*lb + bd));
+    int32_t a = (int32_t)(((uint32_t)((lb + bd - sq) >> 7)) / (256 - kneefreq));
+    return (QUANTIZATION_MAX-1) - a;
 }
 
 const int32_t harmonic_addition[7] = { 0, (int32_t) (12.0f*(QUANTIZATION_MAX/MIDI_NOTES)),
@@ -86,20 +249,40 @@ const int32_t harmonic_addition[7] = { 0, (int32_t) (12.0f*(QUANTIZATION_MAX/MID
                                        (int32_t) (33.688259f*(QUANTIZATION_MAX/MIDI_NOTES)) };
 
 
+static inline int32_t *synth_input_ptr(synth_start_st *sst, uint input)
+{
+    uint b = synth_compiled_input[sst->unit][input];
+    if (b & SYNTH_INPUT_GLOBAL)
+        return synth_global_result[b & ~SYNTH_INPUT_GLOBAL];
+    if (b & SYNTH_INPUT_BUS)
+        return synth_bus_result[b & ~SYNTH_INPUT_BUS];
+    return synth_unit_result[sst->note][b];
+}
+
+/* stores a parameter taken from a control, true if it changed */
+static inline bool synth_control_value(void *v, uint32_t val)
+{
+    if (*((uint32_t *)v) == val) return false;
+    *((uint32_t *)v) = val;
+    return true;
+}
+
 /**************************** SYNTH_TYPE_NONE **************************************************/
 
 #ifdef PLACE_IN_RAM
-static int32_t __no_inline_not_in_flash_func(synth_type_process_none)(synth_parm *sp, synth_unit *su)
+static void __no_inline_not_in_flash_func(synth_type_process_none)(synth_parm *sp, synth_unit *su, int32_t *out, uint n)
 #else
-int32_t synth_type_process_none(synth_parm *sp, synth_unit *su)
+void synth_type_process_none(synth_parm *sp, synth_unit *su, int32_t *out, uint n)
 #endif
 {
-    return (*su->stn.sample_ptr);
+    const int32_t *sample_ptr = su->stn.sample_ptr;
+    for (uint i=0;i<n;i++)
+        out[i] = sample_ptr[i];
 }
 
 void synth_note_start_none(synth_parm *sp, synth_unit *su, synth_start_st *sst)
 {
-    su->stn.sample_ptr = &synth_unit_result[sst->note][sp->stn.source_unit-1];
+    su->stn.sample_ptr = synth_input_ptr(sst, SYNTH_INPUT_SOURCE);
 }
 
 const synth_parm_configuration_entry synth_parm_configuration_entry_none[] = 
@@ -111,38 +294,132 @@ const synth_parm_configuration_entry synth_parm_configuration_entry_none[] =
 
 const synth_parm_none synth_parm_none_default = { 0, 0, 0 };
 
+/**************************** WAVETABLE LOOKUP **************************************************/
+
+/* wavetable addresses are generated by the interpolators of the core running the synth.
+   interp0 lane 0 gives the sample address from a phase counter and lane 1 blends the
+   sample with the next one by the counter fraction.  interp1 lane 0 gives the address
+   of the next sample, and lane 1 the sample address for a control oscillator so it
+   can run alongside a VCO in a fused kernel */
+
+#define SYNTH_OSCILLATOR_PRECISION_BITS 8
+#define SYNTH_WAVE_INDEX_BITS 10
+
+#if ((1 << SYNTH_OSCILLATOR_PRECISION_BITS) != SYNTH_OSCILLATOR_PRECISION) || ((1 << SYNTH_WAVE_INDEX_BITS) != WAVETABLES_LENGTH)
+#error interpolator lanes do not match the oscillator precision and wavetable length
+#endif
+
+void synth_interp_initialize(void)
+{
+    interp_config cfg = interp_default_config();
+    interp_config_set_shift(&cfg, SYNTH_OSCILLATOR_PRECISION_BITS - 1);
+    interp_config_set_mask(&cfg, 1, SYNTH_WAVE_INDEX_BITS);
+    interp_set_config(interp1, 0, &cfg);
+    interp_set_config(interp1, 1, &cfg);
+    interp_config_set_blend(&cfg, true);
+    interp_set_config(interp0, 0, &cfg);
+
+    cfg = interp_default_config();
+    interp_config_set_cross_input(&cfg, true);
+    interp_config_set_mask(&cfg, 0, SYNTH_OSCILLATOR_PRECISION_BITS - 1);
+    interp_config_set_signed(&cfg, true);
+    interp_set_config(interp0, 1, &cfg);
+}
+
+/* the band limited table level whose highest harmonic stays below nyquist for a counter increment */
+static inline uint synth_wave_mip(uint32_t counter_inc)
+{
+    if (counter_inc < SYNTH_OSCILLATOR_PRECISION) return 0;
+    uint level = (32 - SYNTH_OSCILLATOR_PRECISION_BITS) - __builtin_clz(counter_inc);
+    return level < WAVETABLES_MIPS ? level : WAVETABLES_MIPS-1;
+}
+
+static inline void synth_wave_select(const int16_t *wave)
+{
+    interp_set_base(interp0, 2, (uintptr_t)wave);
+    interp_set_base(interp1, 0, (uintptr_t)wave);
+}
+
+static inline int32_t synth_wave_sample(uint32_t counter)
+{
+    interp_set_accumulator(interp0, 0, counter);
+    return *(const int16_t *)interp_peek_full_result(interp0);
+}
+
+static inline int32_t synth_wave_blend(uint32_t counter)
+{
+    interp_set_accumulator(interp0, 0, counter);
+    interp_set_accumulator(interp1, 0, counter + SYNTH_OSCILLATOR_PRECISION);
+    interp_set_base(interp0, 0, *(const int16_t *)interp_peek_full_result(interp0));
+    interp_set_base(interp0, 1, *(const int16_t *)interp_peek_lane_result(interp1, 0));
+    return (int32_t)interp_peek_lane_result(interp0, 1);
+}
+
+static inline void synth_control_wave_select(const int16_t *wave)
+{
+    interp_set_base(interp1, 1, (uintptr_t)wave);
+}
+
+static inline int32_t synth_control_wave_sample(uint32_t counter)
+{
+    interp_set_accumulator(interp1, 1, counter);
+    return *(const int16_t *)interp_peek_lane_result(interp1, 1);
+}
+
 /**************************** SYNTH_TYPE_VCO **************************************************/
 
+static inline int32_t synth_vco_step(const synth_unit *su, uint32_t *counter, int32_t control, int32_t pitch_bend, bool interpolate, int32_t amplitude)
+{
+    *counter += (su->stvco.counter_inc + ((su->stvco.counter_semitone_control_gain*(control / 64) + 
+                                           pitch_bend)/(QUANTIZATION_MAX/64)));
+    int32_t sample = interpolate ? synth_wave_blend(*counter) : synth_wave_sample(*counter);
+    return (sample * amplitude) / 256;
+}
+
 #ifdef PLACE_IN_RAM
-static int32_t __no_inline_not_in_flash_func(synth_type_process_vco)(synth_parm *sp, synth_unit *su)
+static void __no_inline_not_in_flash_func(synth_type_process_vco)(synth_parm *sp, synth_unit *su, int32_t *out, uint n)
 #else
-int32_t synth_type_process_vco(synth_parm *sp, synth_unit *su)
+void synth_type_process_vco(synth_parm *sp, synth_unit *su, int32_t *out, uint n)
 #endif
 {
-    su->stvco.counter += (su->stvco.counter_inc + ((su->stvco.counter_semitone_control_gain*(*su->stvco.control_ptr / 64) + 
-                                                    su->stvco.counter_semitone_pitch_bend_gain * (synth_pitch_bend_value /64))/(QUANTIZATION_MAX/64)));
-    int32_t sample = su->stvco.wave[(su->stvco.counter / SYNTH_OSCILLATOR_PRECISION) & (WAVETABLES_LENGTH-1)];
-    sample = (sample * ((int32_t)sp->stvco.amplitude)) / 256;
-    return sample;
+    uint32_t counter = su->stvco.counter;
+    const int32_t *control_ptr = su->stvco.control_ptr;
+    bool interpolate = sp->stvco.interpolate;
+    int32_t pitch_bend = su->stvco.counter_semitone_pitch_bend_gain * (synth_pitch_bend_value /64);
+    int32_t amplitude = sp->stvco.amplitude;
+    synth_wave_select(su->stvco.wave);
+    for (uint i=0;i<n;i++)
+        out[i] = synth_vco_step(su, &counter, control_ptr[i], pitch_bend, interpolate, amplitude);
+    su->stvco.counter = counter;
 }
 
-void synth_note_start_vco(synth_parm *sp, synth_unit *su, synth_start_st *sst)
+bool synth_unit_controls_vco(synth_parm *sp)
 {
+    bool changed = false;
     if (sp->stvco.control_amplitude != 0)
-        sp->stvco.amplitude = read_potentiometer_value(sp->stvco.control_amplitude)/(POT_MAX_VALUE/256);
+        changed |= synth_control_value(&sp->stvco.amplitude, read_potentiometer_value(sp->stvco.control_amplitude)/(POT_MAX_VALUE/256));
     if (sp->stvco.control_control_gain != 0)
-        sp->stvco.control_gain = read_potentiometer_value(sp->stvco.control_control_gain)/(POT_MAX_VALUE/64);
+        changed |= synth_control_value(&sp->stvco.control_gain, read_potentiometer_value(sp->stvco.control_control_gain)/(POT_MAX_VALUE/64));
+    return changed;
+}
+
+void synth_unit_refresh_vco(synth_parm *sp, synth_unit *su, synth_start_st *sst)
+{
+    su->stvco.counter_semitone_control_gain = counter_semitone_gain(su->stvco.counter_fraction, sp->stvco.control_gain);
+}
 
+void synth_note_start_vco(synth_parm *sp, synth_unit *su, synth_start_st *sst)
+{
     int32_t vco = sst->vco + (sp->stvco.detune - 4096) + harmonic_addition[sp->stvco.harmonic-1];
     while (vco > (QUANTIZATION_MAX-1)) vco -= ((QUANTIZATION_MAX/MIDI_NOTES)*12);
     while (vco < 0) vco += ((QUANTIZATION_MAX/MIDI_NOTES)*12);
-    float counter_inc_float = counter_fraction_from_vco(((uint32_t)vco));
-    su->stvco.counter_inc = counter_inc_float;
-    float f = counter_inc_float * SEMITONE_LOG_STEP;
-    su->stvco.counter_semitone_control_gain = f * sp->stvco.control_gain;
-    su->stvco.counter_semitone_pitch_bend_gain = f * sp->stvco.pitch_bend_gain;
-    su->stvco.wave = wavetables[sp->stvco.osc_type-1];
-    su->stvco.control_ptr = &synth_unit_result[sst->note][sp->stvco.control_unit-1];
+    uint32_t counter_fraction = counter_fraction_from_vco(((uint32_t)vco));
+    su->stvco.counter_inc = counter_fraction >> 8;
+    su->stvco.counter_fraction = counter_fraction;
+    su->stvco.counter_semitone_control_gain = counter_semitone_gain(counter_fraction, sp->stvco.control_gain);
+    su->stvco.counter_semitone_pitch_bend_gain = counter_semitone_gain(counter_fraction, sp->stvco.pitch_bend_gain);
+    su->stvco.wave = wavetable_mips[sp->stvco.osc_type-1][synth_wave_mip(su->stvco.counter_inc)];
+    su->stvco.control_ptr = synth_input_ptr(sst, SYNTH_INPUT_CONTROL);
 }
 
 const synth_parm_configuration_entry synth_parm_configuration_entry_vco[] = 
@@ -157,88 +434,223 @@ const synth_parm_configuration_entry synth_parm_configuration_entry_vco[] =
     { "BendGain",    offsetof(synth_parm_vco,pitch_bend_gain),       4, 2, 0, 63, NULL },
     { "AmplCtrl",    offsetof(synth_parm_vco,control_amplitude),     4, 2, 0, NUMBER_OF_CONTROLS, "VCOAmpli" },
     { "GainCtrl",    offsetof(synth_parm_vco,control_control_gain),  4, 2, 0, NUMBER_OF_CONTROLS, "VCOGain" },
+    { "Interp",      offsetof(synth_parm_vco,interpolate),           4, 1, 0, 1, NULL },
     { NULL, 0, 4, 0, 0,   1, NULL    }
 };
 
-const synth_parm_vco synth_parm_vco_default = { 0, 0, 0, 1, 1, 256, 1, 0, 0, 1, 4096 };
+const synth_parm_vco synth_parm_vco_default = { 0, 0, 0, 1, 1, 256, 1, 0, 0, 1, 4096, 0 };
 
 /**************************** SYNTH_TYPE_ADSR **************************************************/
 
-#define ADSR_SLOPE_SCALING 256
+#define ADSR_LEVEL_BITS 16
+
+#define ADSR_CURVE_ATTACK 1
+#define ADSR_CURVE_DECAY 2
+#define ADSR_CURVE_RELEASE 4
+
+static inline uint32_t synth_adsr_curve(uint32_t phase)
+{
+    uint32_t idx = phase >> (32-PITCH_ENVELOPE_CURVE_BITS);
+    uint32_t frac = (phase >> (16-PITCH_ENVELOPE_CURVE_BITS)) & 0xFFFF;
+    int32_t c0 = table_envelope_curve[idx];
+    return c0 + (((((int32_t)table_envelope_curve[idx+1]) - c0) * ((int32_t)frac)) >> 16);
+}
+
+/* starts a segment moving from start to end over length samples, the phase increment
+   is held a little under 2^32/length so a curved segment never wraps before its end */
+static void synth_adsr_segment(synth_unit *su, uint32_t phase, uint32_t start, uint32_t end, uint32_t length, uint32_t inc, bool curved)
+{
+    int32_t span = ((int32_t)end) - ((int32_t)start);
+    su->stadsr.phase = phase;
+    su->stadsr.remaining = length;
+    su->stadsr.level = start << ADSR_LEVEL_BITS;
+    su->stadsr.start = start;
+    su->stadsr.span = span;
+    su->stadsr.curved = curved;
+    su->stadsr.curve_phase = 0;
+    su->stadsr.curve_inc = inc - (inc >> 12);
+    su->stadsr.delta = (int32_t)((((int64_t)span) * inc) >> (32-ADSR_LEVEL_BITS));
+}
+
+/* moves to the segment after the one just completed, true if the release has ended */
+static bool synth_adsr_next_segment(synth_unit *su)
+{
+    switch (su->stadsr.phase)
+    {
+        case 0:  synth_adsr_segment(su, 1, su->stadsr.max_amp_level, su->stadsr.sustain_amp_level,
+                                    su->stadsr.decay, su->stadsr.decay_inc, su->stadsr.curve & ADSR_CURVE_DECAY);
+                 return false;
+        case 1:  su->stadsr.phase = 2;
+                 su->stadsr.level = su->stadsr.sustain_amp_level << ADSR_LEVEL_BITS;
+                 return false;
+        case 3:  su->stadsr.phase = 4;
+                 su->stadsr.level = 0;
+                 return true;
+    }
+    return false;
+}
+
+static inline void synth_adsr_release(synth_unit *su)
+{
+    synth_adsr_segment(su, 3, su->stadsr.sustain_amp_level, 0,
+                       su->stadsr.release, su->stadsr.release_inc, su->stadsr.curve & ADSR_CURVE_RELEASE);
+}
+
+/* moves the envelope on by steps samples within the current segment */
+static inline void synth_adsr_move(synth_unit *su, uint32_t steps)
+{
+    su->stadsr.remaining -= steps;
+    if (su->stadsr.curved)
+    {
+        su->stadsr.curve_phase += su->stadsr.curve_inc * steps;
+        su->stadsr.level = (su->stadsr.start << ADSR_LEVEL_BITS) +
+                           (((uint32_t)(su->stadsr.span * ((int32_t)synth_adsr_curve(su->stadsr.curve_phase)))) << (ADSR_LEVEL_BITS-15));
+    } else
+        su->stadsr.level += su->stadsr.delta * ((int32_t)steps);
+}
+
+/* advances the envelope by one sample and returns its level */
+static inline uint32_t synth_adsr_step(synth_unit *su, uint32_t output_type, uint i)
+{
+    uint32_t amplitude = su->stadsr.level >> ADSR_LEVEL_BITS;
+    if (su->stadsr.remaining != 0)
+    {
+        synth_adsr_move(su, 1);
+        if ((su->stadsr.remaining == 0) && (synth_adsr_next_segment(su)) && (output_type == 0))
+        {
+            synth_note_sounding[su->stadsr.note] = false;
+            synth_note_block_samples[su->stadsr.note] = i+1;
+        }
+    } else if ((su->stadsr.phase == 2) && (synth_note_stopping[su->stadsr.note]))
+        synth_adsr_release(su);
+    return amplitude;
+}
+
+/* advances the envelope a control period, returning the samples until the release
+   ends if it ends within the period, otherwise 0 */
+static uint32_t synth_adsr_advance(synth_unit *su)
+{
+    uint32_t left = SYNTH_CONTROL_PERIOD;
+    while (left > 0)
+    {
+        if (su->stadsr.remaining == 0)
+        {
+            if ((su->stadsr.phase != 2) || (!synth_note_stopping[su->stadsr.note])) return 0;
+            synth_adsr_release(su);
+            left--;
+            continue;
+        }
+        uint32_t steps = (su->stadsr.remaining < left) ? su->stadsr.remaining : left;
+        synth_adsr_move(su, steps);
+        left -= steps;
+        if ((su->stadsr.remaining == 0) && (synth_adsr_next_segment(su)))
+            return SYNTH_CONTROL_PERIOD - left;
+    }
+    return 0;
+}
+
+/* control rate envelope, evaluated once a control period and ramped in between */
+static inline uint32_t synth_adsr_ramp_step(synth_unit *su, uint32_t output_type, uint i)
+{
+    if (su->stadsr.ramp_left == 0)
+    {
+        int32_t level = su->stadsr.level >> ADSR_LEVEL_BITS;
+        uint32_t end_in = synth_adsr_advance(su);
+        su->stadsr.ramp_level = level << SYNTH_CONTROL_RAMP_BITS;
+        su->stadsr.ramp_left = SYNTH_CONTROL_PERIOD;
+        if (end_in != 0)
+            su->stadsr.ramp_inc = -((int32_t)((((int64_t)su->stadsr.ramp_level) * reciprocal_fraction(end_in)) >> 32));
+        else
+            su->stadsr.ramp_inc = ((((int32_t)(su->stadsr.level >> ADSR_LEVEL_BITS)) - level) << SYNTH_CONTROL_RAMP_BITS) / SYNTH_CONTROL_PERIOD;
+        if (output_type == 0) su->stadsr.end_in = end_in;
+    }
+    uint32_t amplitude = su->stadsr.ramp_level >> SYNTH_CONTROL_RAMP_BITS;
+    su->stadsr.ramp_level += su->stadsr.ramp_inc;
+    su->stadsr.ramp_left--;
+    if ((su->stadsr.end_in != 0) && ((--su->stadsr.end_in) == 0))
+    {
+        su->stadsr.ramp_inc = 0;
+        synth_note_sounding[su->stadsr.note] = false;
+        synth_note_block_samples[su->stadsr.note] = i+1;
+    }
+    return amplitude;
+}
 
 #ifdef PLACE_IN_RAM
-static int32_t __no_inline_not_in_flash_func(synth_type_process_adsr)(synth_parm *sp, synth_unit *su)
+static void __no_inline_not_in_flash_func(synth_type_process_adsr)(synth_parm *sp, synth_unit *su, int32_t *out, uint n)
 #else
-int32_t synth_type_process_adsr(synth_parm *sp, synth_unit *su)
+void synth_type_process_adsr(synth_parm *sp, synth_unit *su, int32_t *out, uint n)
 #endif
 {
-    uint32_t amplitude = 0;
-    switch (su->stadsr.phase)
+    const int32_t *sample_ptr = su->stadsr.sample_ptr;
+    uint32_t output_type = sp->stadsr.output_type;
+    uint32_t control_rate = sp->stadsr.control_rate;
+    for (uint i=0;i<n;i++)
     {
-        case 0:  amplitude = (su->stadsr.counter * su->stadsr.rise_slope) / ADSR_SLOPE_SCALING;
-                 if ((++su->stadsr.counter) >= sp->stadsr.attack)
-                 {
-                     su->stadsr.counter = 0;
-                     su->stadsr.phase = 1;
-                 }
-                 break;
-        case 1:  amplitude = su->stadsr.max_amp_level - ((su->stadsr.counter * su->stadsr.decay_slope) / ADSR_SLOPE_SCALING);
-                 if ((++su->stadsr.counter) >= sp->stadsr.decay)
-                 {
-                     su->stadsr.counter = 0;
-                     su->stadsr.phase = 2;
-                 }
-                 break;
-        case 2:  amplitude = su->stadsr.sustain_amp_level;
-                 if (synth_note_stopping[su->stadsr.note])
-                 {
-                     su->stadsr.counter = 0;
-                     su->stadsr.phase = 3;
-                 }
-                 break;
-        case 3:  amplitude = su->stadsr.sustain_amp_level - ((su->stadsr.counter * su->stadsr.release_slope) / ADSR_SLOPE_SCALING);
-                 if ((++su->stadsr.counter) >= sp->stadsr.release)
-                 {
-                     if (sp->stadsr.output_type == 0) 
-                         synth_note_active[su->stadsr.note] = false;
-                     else
-                         su->stadsr.phase = 4;
-                 }
-                 break;
-    }
-    if (sp->stadsr.output_type == 0)
-        return (((*su->stadsr.sample_ptr) * ((int32_t)amplitude)) / QUANTIZATION_MAX);
-    return sp->stadsr.output_type == 1 ? ((int32_t)amplitude) : -((int32_t)amplitude);
+        uint32_t amplitude = control_rate ? synth_adsr_ramp_step(su, output_type, i) : synth_adsr_step(su, output_type, i);
+        if (output_type == 0)
+            out[i] = ((sample_ptr[i] * ((int32_t)amplitude)) / QUANTIZATION_MAX);
+        else
+            out[i] = output_type == 1 ? ((int32_t)amplitude) : -((int32_t)amplitude);
+    }
 }
 
-void synth_note_start_adsr(synth_parm *sp, synth_unit *su, synth_start_st *sst)
+bool synth_unit_controls_adsr(synth_parm *sp)
 {
-    su->stadsr.max_amp_level = (sst->velocity * QUANTIZATION_MAX) / 128;
+    bool changed = false;
     if (sp->stadsr.control_sustain != 0)
-        sp->stadsr.sustain_level = read_potentiometer_value(sp->stadsr.control_sustain)/64;
-    su->stadsr.sustain_amp_level = (su->stadsr.max_amp_level * sp->stadsr.sustain_level) / 256;
+        changed |= synth_control_value(&sp->stadsr.sustain_level, read_potentiometer_value(sp->stadsr.control_sustain)/64);
     if (sp->stadsr.control_attack != 0)
-        sp->stadsr.attack = read_potentiometer_value(sp->stadsr.control_attack)*2+512;
-    su->stadsr.rise_slope = (ADSR_SLOPE_SCALING * su->stadsr.max_amp_level) / sp->stadsr.attack;
+        changed |= synth_control_value(&sp->stadsr.attack, read_potentiometer_value(sp->stadsr.control_attack)*2+512);
     if (sp->stadsr.control_decay != 0)
-        sp->stadsr.decay = read_potentiometer_value(sp->stadsr.control_decay)*2+512;
-    su->stadsr.decay_slope = (ADSR_SLOPE_SCALING * (su->stadsr.max_amp_level - su->stadsr.sustain_amp_level)) / sp->stadsr.decay;
+        changed |= synth_control_value(&sp->stadsr.decay, read_potentiometer_value(sp->stadsr.control_decay)*2+512);
     if (sp->stadsr.control_release != 0)
-        sp->stadsr.release = read_potentiometer_value(sp->stadsr.control_release)*2+512;
-    su->stadsr.release_slope = (ADSR_SLOPE_SCALING * su->stadsr.sustain_amp_level) / sp->stadsr.release;
-    su->stadsr.sample_ptr = &synth_unit_result[sst->note][sp->stadsr.source_unit-1];
+        changed |= synth_control_value(&sp->stadsr.release, read_potentiometer_value(sp->stadsr.control_release)*2+512);
+    return changed;
+}
+
+/* segment lengths come with their reciprocals so nothing here or in the envelope divides */
+void synth_note_prepare_adsr(synth_parm *sp, synth_unit *su)
+{
+    su->stadsr.attack = synth_samples_from_reference(sp->stadsr.attack);
+    su->stadsr.attack_inc = reciprocal_fraction(su->stadsr.attack);
+    su->stadsr.decay = synth_samples_from_reference(sp->stadsr.decay);
+    su->stadsr.decay_inc = reciprocal_fraction(su->stadsr.decay);
+    su->stadsr.release = synth_samples_from_reference(sp->stadsr.release);
+    su->stadsr.release_inc = reciprocal_fraction(su->stadsr.release);
+    su->stadsr.curve = sp->stadsr.curve;
+}
+
+/* new segment lengths apply from the next segment, a held sustain moves at once */
+void synth_unit_refresh_adsr(synth_parm *sp, synth_unit *su, synth_start_st *sst)
+{
+    synth_note_prepare_adsr(sp, su);
+    su->stadsr.sustain_amp_level = (su->stadsr.max_amp_level * sp->stadsr.sustain_level) / 256;
+    if (su->stadsr.phase == 2)
+        su->stadsr.level = su->stadsr.sustain_amp_level << ADSR_LEVEL_BITS;
+}
+
+void synth_note_start_adsr(synth_parm *sp, synth_unit *su, synth_start_st *sst)
+{
+    su->stadsr.max_amp_level = (sst->velocity * QUANTIZATION_MAX) / 128;
+    su->stadsr.sustain_amp_level = (su->stadsr.max_amp_level * sp->stadsr.sustain_level) / 256;
+    su->stadsr.sample_ptr = synth_input_ptr(sst, SYNTH_INPUT_SOURCE);
     su->stadsr.note = sst->note;
+    synth_adsr_segment(su, 0, 0, su->stadsr.max_amp_level,
+                       su->stadsr.attack, su->stadsr.attack_inc, su->stadsr.curve & ADSR_CURVE_ATTACK);
 }
 
 const synth_parm_configuration_entry synth_parm_configuration_entry_adsr[] = 
 {
     { "SourceUnit",  offsetof(synth_parm_adsr,source_unit),           4, 2, 1, MAX_SYNTH_UNITS, NULL },
     { "ControlUnit", offsetof(synth_parm_adsr,control_unit),          4, 2, 1, MAX_SYNTH_UNITS, NULL },
-    { "Attack",      offsetof(synth_parm_adsr,attack),                4, 5, 512, DSP_SAMPLERATE*2, NULL },
-    { "Decay",       offsetof(synth_parm_adsr,decay),                 4, 5, 512, DSP_SAMPLERATE*2, NULL },
+    { "Attack",      offsetof(synth_parm_adsr,attack),                4, 5, 512, DSP_SAMPLERATE_REFERENCE*2, NULL },
+    { "Decay",       offsetof(synth_parm_adsr,decay),                 4, 5, 512, DSP_SAMPLERATE_REFERENCE*2, NULL },
     { "SustainLvl",  offsetof(synth_parm_adsr,sustain_level),         4, 3, 0, 255, NULL },
-    { "Release",     offsetof(synth_parm_adsr,release),               4, 5, 512, DSP_SAMPLERATE*2, NULL },
+    { "Release",     offsetof(synth_parm_adsr,release),               4, 5, 512, DSP_SAMPLERATE_REFERENCE*2, NULL },
     { "OutputType",  offsetof(synth_parm_adsr,output_type),           4, 1, 0, 2, NULL },
+    { "CtrlRate",    offsetof(synth_parm_adsr,control_rate),          4, 1, 0, 1, NULL },
+    { "Curve",       offsetof(synth_parm_adsr,curve),                 4, 1, 0, 7, NULL },
     { "AttackCtl",   offsetof(synth_parm_adsr,control_attack),        4, 2, 0, NUMBER_OF_CONTROLS, "AttackCtl" },
     { "DecayCtl",    offsetof(synth_parm_adsr,control_decay),         4, 2, 0, NUMBER_OF_CONTROLS, "DecayCtl" },
     { "SustainCtl",  offsetof(synth_parm_adsr,control_sustain),       4, 2, 0, NUMBER_OF_CONTROLS, "SustainCtl" },
@@ -246,40 +658,62 @@ const synth_parm_configuration_entry synth_parm_configuration_entry_adsr[] =
     { NULL, 0, 4, 0, 0,   1, NULL    }
 };
 
-const synth_parm_adsr synth_parm_adsr_default = { 0, 0, 0,  2000, 4000, 128, 2000, 0, 0, 0, 0, 0 };
+const synth_parm_adsr synth_parm_adsr_default = { 0, 0, 0,  2000, 4000, 128, 2000, 0, 0, 0, 0, 0, 0, 0 };
 
 /**************************** SYNTH_TYPE_LOWPASS **************************************************/
 
 #ifdef PLACE_IN_RAM
-static int32_t __no_inline_not_in_flash_func(synth_type_process_lowpass)(synth_parm *sp, synth_unit *su)
+static void __no_inline_not_in_flash_func(synth_type_process_lowpass)(synth_parm *sp, synth_unit *su, int32_t *out, uint n)
 #else
-int32_t synth_type_process_lowpass(synth_parm *sp, synth_unit *su)
+void synth_type_process_lowpass(synth_parm *sp, synth_unit *su, int32_t *out, uint n)
 #endif
 {
-    int32_t dalpha = su->stlp.dalpha + (((int32_t)(*su->stlp.control_ptr))*((int32_t)sp->stlp.control_gain))/256;
-    if (dalpha > (QUANTIZATION_MAX-1)) dalpha = QUANTIZATION_MAX-1;
-    int32_t alpha = (QUANTIZATION_MAX-1) - dalpha;
-    int32_t sample = (*su->stlp.sample_ptr) - ((*su->stlp.feedback_ptr)*((int32_t)sp->stlp.resonance)) / 64;
-    if (sample > (QUANTIZATION_MAX-1)) sample = QUANTIZATION_MAX-1;
-    if (sample < (-QUANTIZATION_MAX)) sample = -QUANTIZATION_MAX;
-    for (uint n=0;n<sp->stlp.stages;n++)
-        su->stlp.stage_y[n] = sample = (dalpha*sample + alpha*su->stlp.stage_y[n]) / QUANTIZATION_MAX;
-    return sample;
+    const int32_t *sample_ptr = su->stlp.sample_ptr;
+    const int32_t *control_ptr = su->stlp.control_ptr;
+    int32_t control_gain = sp->stlp.control_gain;
+    int32_t resonance = sp->stlp.resonance;
+    uint stages = sp->stlp.stages;
+    for (uint i=0;i<n;i++)
+    {
+        int32_t dalpha = su->stlp.dalpha + (control_ptr[i]*control_gain)/256;
+        if (dalpha > (QUANTIZATION_MAX-1)) dalpha = QUANTIZATION_MAX-1;
+        int32_t alpha = (QUANTIZATION_MAX-1) - dalpha;
+        int32_t sample = sample_ptr[i] - ((*su->stlp.feedback_ptr)*resonance) / 64;
+        if (sample > (QUANTIZATION_MAX-1)) sample = QUANTIZATION_MAX-1;
+        if (sample < (-QUANTIZATION_MAX)) sample = -QUANTIZATION_MAX;
+        for (uint st=0;st<stages;st++)
+            su->stlp.stage_y[st] = sample = (dalpha*sample + alpha*su->stlp.stage_y[st]) / QUANTIZATION_MAX;
+        out[i] = sample;
+    }
+}
+
+bool synth_unit_controls_lowpass(synth_parm *sp)
+{
+    if (sp->stlp.control_kneefreq == 0) return false;
+    return synth_control_value(&sp->stlp.kneefreq, read_potentiometer_value(sp->stlp.control_kneefreq)/(POT_MAX_VALUE/256));
+}
+
+/* a fixed frequency filter has the same coefficient for every note */
+void synth_note_prepare_lowpass(synth_parm *sp, synth_unit *su)
+{
+    if (sp->stlp.frequency != 0)
+        su->stlp.dalpha = lowpass_dalpha_from_fraction((uint32_t)((((uint64_t)sp->stlp.frequency) << 25) / dsp_samplerate), sp->stlp.kneefreq);
+}
+
+void synth_unit_refresh_lowpass(synth_parm *sp, synth_unit *su, synth_start_st *sst)
+{
+    if (sp->stlp.frequency == 0)
+        su->stlp.dalpha = lowpass_dalpha_from_fraction(counter_fraction_from_vco(sst->vco) >> 1, sp->stlp.kneefreq);
+    else
+        synth_note_prepare_lowpass(sp, su);
 }
 
 void synth_note_start_lowpass(synth_parm *sp, synth_unit *su, synth_start_st *sst)
 {
-    if (sp->stlp.control_kneefreq != 0)
-        sp->stlp.kneefreq = read_potentiometer_value(sp->stlp.control_kneefreq)/(POT_MAX_VALUE/256);
-
-    float b = ((float)sp->stlp.kneefreq) * (1.0f/256.0f);
-    float c0 = cosf(sp->stlp.frequency == 0 ? frequency_omega_from_vco(sst->vco) : ((float)sp->stlp.frequency)*((float)(MATH_PI_F*2.0f/((float)DSP_SAMPLERATE))));
-    float lbw = 1.0f-b*c0;
-    float lb = 1.0f-b;
-    float a = (lbw-sqrtf(lbw*lbw-lb*lb)) / lb;
-    su->stlp.dalpha = (QUANTIZATION_MAX-1) -  ((int32_t) (a * QUANTIZATION_MAX));  
-    su->stlp.sample_ptr = &synth_unit_result[sst->note][sp->stlp.source_unit-1];
-    su->stlp.control_ptr = &synth_unit_result[sst->note][sp->stlp.control_unit-1];
+    if (sp->stlp.frequency == 0)
+        su->stlp.dalpha = lowpass_dalpha_from_fraction(counter_fraction_from_vco(sst->vco) >> 1, sp->stlp.kneefreq);
+    su->stlp.sample_ptr = synth_input_ptr(sst, SYNTH_INPUT_SOURCE);
+    su->stlp.control_ptr = synth_input_ptr(sst, SYNTH_INPUT_CONTROL);
     su->stlp.feedback_ptr = &su->stlp.stage_y[sp->stlp.stages-1];
 }
 
@@ -300,46 +734,101 @@ const synth_parm_lowpass synth_parm_lowpass_default = { 0, 0, 0, 192, 4, 0, 0, 2
 
 /**************************** SYNTH_TYPE_OSC **************************************************/
 
+static inline int32_t synth_osc_bend(const synth_parm *sp, const synth_unit *su)
+{
+    if (sp->stosc.control_bend == 0) return 0;
+    int32_t pot_value = read_potentiometer_value(sp->stosc.control_bend)/64;
+    return (su->stosc.counter_semitone_bend_gain*pot_value)/(POT_MAX_VALUE/64);
+}
+
+static inline int32_t synth_osc_step(const synth_unit *su, uint32_t *counter, int32_t control, int32_t bend, int32_t amplitude)
+{
+    *counter += (su->stosc.counter_inc + (su->stosc.counter_semitone_control_gain*( control /64))/(QUANTIZATION_MAX/64) );
+    *counter += bend;
+    int32_t sample = synth_control_wave_sample(*counter);
+    return (sample * amplitude) / 256;
+}
+
+/* control rate oscillator, the phase is advanced a control period at a time with the
+   control input and bend taken at the start of the period, and the output ramped */
+static inline int32_t synth_osc_ramp_step(synth_parm *sp, synth_unit *su, uint32_t *counter, int32_t control, int32_t amplitude)
+{
+    if (su->stosc.ramp_left == 0)
+    {
+        int32_t level = (synth_control_wave_sample(*counter) * amplitude) / 256;
+        *counter += (su->stosc.counter_inc + (su->stosc.counter_semitone_control_gain*( control /64))/(QUANTIZATION_MAX/64)
+                     + synth_osc_bend(sp, su)) * SYNTH_CONTROL_PERIOD;
+        int32_t target = (synth_control_wave_sample(*counter) * amplitude) / 256;
+        su->stosc.ramp_level = level << SYNTH_CONTROL_RAMP_BITS;
+        su->stosc.ramp_inc = ((target - level) << SYNTH_CONTROL_RAMP_BITS) / SYNTH_CONTROL_PERIOD;
+        su->stosc.ramp_left = SYNTH_CONTROL_PERIOD;
+    }
+    int32_t sample = su->stosc.ramp_level >> SYNTH_CONTROL_RAMP_BITS;
+    su->stosc.ramp_level += su->stosc.ramp_inc;
+    su->stosc.ramp_left--;
+    return sample;
+}
+
 #ifdef PLACE_IN_RAM
-static int32_t __no_inline_not_in_flash_func(synth_type_process_osc)(synth_parm *sp, synth_unit *su)
+static void __no_inline_not_in_flash_func(synth_type_process_osc)(synth_parm *sp, synth_unit *su, int32_t *out, uint n)
 #else
-int32_t synth_type_process_osc(synth_parm *sp, synth_unit *su)
+void synth_type_process_osc(synth_parm *sp, synth_unit *su, int32_t *out, uint n)
 #endif
 {
-    int32_t sample;
-    su->stosc.counter += (su->stosc.counter_inc + (su->stosc.counter_semitone_control_gain*( (*su->stosc.control_ptr) /64))/(QUANTIZATION_MAX/64) );
-    if (sp->stosc.control_bend != 0)
+    uint32_t counter = su->stosc.counter;
+    const int32_t *control_ptr = su->stosc.control_ptr;
+    int32_t amplitude = sp->stosc.amplitude;
+    synth_control_wave_select(su->stosc.wave);
+    if (sp->stosc.control_rate)
+    {
+        for (uint i=0;i<n;i++)
+            out[i] = synth_osc_ramp_step(sp, su, &counter, control_ptr[i], amplitude);
+    } else
     {
-        int32_t pot_value = read_potentiometer_value(sp->stosc.control_bend)/64;
-        su->stosc.counter += (su->stosc.counter_semitone_bend_gain*pot_value)/(POT_MAX_VALUE/64);
+        int32_t bend = synth_osc_bend(sp, su);
+        for (uint i=0;i<n;i++)
+            out[i] = synth_osc_step(su, &counter, control_ptr[i], bend, amplitude);
     }
-    sample = su->stosc.wave[(su->stosc.counter / SYNTH_OSCILLATOR_PRECISION) & (WAVETABLES_LENGTH-1)];
-    sample = (sample * ((int32_t)sp->stosc.amplitude)) / 256;
-    return sample;
+    su->stosc.counter = counter;
 }
 
 #define OSC_MINFREQ 1.0f
 #define OSC_MAXFREQ 100.0f
 
-const float osc_scaling = logf( OSC_MAXFREQ / OSC_MINFREQ ) / ((float)POT_MAX_VALUE);
+#define OSC_SCALING_VCO ((uint32_t)(6.64385619f*((float)SYNTH_VCO_OCTAVE)))
 
-void synth_note_start_osc(synth_parm *sp, synth_unit *su, synth_start_st *sst)
+bool synth_unit_controls_osc(synth_parm *sp)
 {
+    bool changed = false;
     if (sp->stosc.control_amplitude != 0)
-        sp->stosc.amplitude = read_potentiometer_value(sp->stosc.control_amplitude)/(POT_MAX_VALUE/256);
-
+        changed |= synth_control_value(&sp->stosc.amplitude, read_potentiometer_value(sp->stosc.control_amplitude)/(POT_MAX_VALUE/256));
     if (sp->stosc.control_frequency != 0)
     {
-        int32_t pot_value = read_potentiometer_value(sp->stosc.control_frequency);
-        sp->stosc.frequency = expf(osc_scaling * ((float)pot_value))*OSC_MINFREQ;
+        uint32_t vco = (read_potentiometer_value(sp->stosc.control_frequency) * OSC_SCALING_VCO) / POT_MAX_VALUE;
+        uint32_t octave = vco / SYNTH_VCO_OCTAVE;
+        changed |= synth_control_value(&sp->stosc.frequency, (uint32_t)((((uint64_t)exp2_fraction(vco - octave * SYNTH_VCO_OCTAVE)) * ((uint32_t)OSC_MINFREQ)) >> (30 - octave)));
     }
-    float counter_inc_float = ((float)sp->stosc.frequency)*((((float)SYNTH_OSCILLATOR_PRECISION)*((float)WAVETABLES_LENGTH))/((float)DSP_SAMPLERATE));
-    su->stosc.counter_inc = counter_inc_float;
-    float f = (counter_inc_float * SEMITONE_LOG_STEP);
-    su->stosc.counter_semitone_control_gain = f * sp->stosc.control_gain;
-    su->stosc.counter_semitone_bend_gain = f * sp->stosc.bend_gain;
+    return changed;
+}
+
+/* the oscillator does not follow the note, so all but its input come from the patch */
+void synth_note_prepare_osc(synth_parm *sp, synth_unit *su)
+{
+    uint32_t counter_fraction = counter_fraction_from_frequency(sp->stosc.frequency);
+    su->stosc.counter_inc = counter_fraction >> 8;
+    su->stosc.counter_semitone_control_gain = counter_semitone_gain(counter_fraction, sp->stosc.control_gain);
+    su->stosc.counter_semitone_bend_gain = counter_semitone_gain(counter_fraction, sp->stosc.bend_gain);
     su->stosc.wave = wavetables[sp->stosc.osc_type-1];
-    su->stosc.control_ptr = &synth_unit_result[sst->note][sp->stosc.control_unit-1];
+}
+
+void synth_unit_refresh_osc(synth_parm *sp, synth_unit *su, synth_start_st *sst)
+{
+    synth_note_prepare_osc(sp, su);
+}
+
+void synth_note_start_osc(synth_parm *sp, synth_unit *su, synth_start_st *sst)
+{
+    su->stosc.control_ptr = synth_input_ptr(sst, SYNTH_INPUT_CONTROL);
 }
 
 const synth_parm_configuration_entry synth_parm_configuration_entry_osc[] = 
@@ -354,33 +843,46 @@ const synth_parm_configuration_entry synth_parm_configuration_entry_osc[] =
     { "BendCtrl",    offsetof(synth_parm_osc,control_bend),       4, 2, 0, NUMBER_OF_CONTROLS, "LFOFMGain" },
     { "FreqCtrl",    offsetof(synth_parm_osc,control_frequency),  4, 2, 0, NUMBER_OF_CONTROLS, "LFOFreq" },
     { "AmplCtrl",    offsetof(synth_parm_osc,control_amplitude),  4, 2, 0, NUMBER_OF_CONTROLS, "LFOAmpli" },
+    { "CtrlRate",    offsetof(synth_parm_osc,control_rate),       4, 1, 0, 1, NULL },
+    { "Global",      offsetof(synth_parm_osc,global),             4, 1, 0, 1, NULL },
     { NULL, 0, 4, 0, 0,   1, NULL    }
 };
 
-const synth_parm_osc synth_parm_osc_default = { 0, 0, 0, 1, 1, 6, 256, 0, 1, 0, 0 };
+const synth_parm_osc synth_parm_osc_default = { 0, 0, 0, 1, 1, 6, 256, 0, 1, 0, 0, 0, 0 };
 
 /**************************** SYNTH_TYPE_VCA **************************************************/
 
 #ifdef PLACE_IN_RAM
-static int32_t __no_inline_not_in_flash_func(synth_type_process_vca)(synth_parm *sp, synth_unit *su)
+static void __no_inline_not_in_flash_func(synth_type_process_vca)(synth_parm *sp, synth_unit *su, int32_t *out, uint n)
 #else
-int32_t synth_type_process_vca(synth_parm *sp, synth_unit *su)
+void synth_type_process_vca(synth_parm *sp, synth_unit *su, int32_t *out, uint n)
 #endif
 {
-    int32_t control = ((*su->stvca.control_ptr) * ((int32_t)sp->stvca.control_gain)) / 256;
-    int32_t sample = ((*su->stvca.sample_ptr) * ((control + QUANTIZATION_MAX)/2)) / QUANTIZATION_MAX;
-    sample = (sample * ((int32_t)sp->stvca.amplitude)) / 64;
-    if (sample > (QUANTIZATION_MAX-1)) sample = QUANTIZATION_MAX-1;
-    if (sample < (-QUANTIZATION_MAX)) sample = -QUANTIZATION_MAX;
-    return sample;
+    const int32_t *sample_ptr = su->stvca.sample_ptr;
+    const int32_t *control_ptr = su->stvca.control_ptr;
+    int32_t control_gain = sp->stvca.control_gain;
+    int32_t amplitude = sp->stvca.amplitude;
+    for (uint i=0;i<n;i++)
+    {
+        int32_t control = (control_ptr[i] * control_gain) / 256;
+        int32_t sample = (sample_ptr[i] * ((control + QUANTIZATION_MAX)/2)) / QUANTIZATION_MAX;
+        sample = (sample * amplitude) / 64;
+        if (sample > (QUANTIZATION_MAX-1)) sample = QUANTIZATION_MAX-1;
+        if (sample < (-QUANTIZATION_MAX)) sample = -QUANTIZATION_MAX;
+        out[i] = sample;
+    }
+}
+
+bool synth_unit_controls_vca(synth_parm *sp)
+{
+    if (sp->stvca.control_amplitude == 0) return false;
+    return synth_control_value(&sp->stvca.amplitude, read_potentiometer_value(sp->stvca.control_amplitude)/(POT_MAX_VALUE/256));
 }
 
 void synth_note_start_vca(synth_parm *sp, synth_unit *su, synth_start_st *sst)
 {
-    if (sp->stvca.control_amplitude != 0)
-        sp->stvca.amplitude = read_potentiometer_value(sp->stvca.control_amplitude)/(POT_MAX_VALUE/256);
-    su->stvca.sample_ptr = &synth_unit_result[sst->note][sp->stvca.source_unit-1];
-    su->stvca.control_ptr = &synth_unit_result[sst->note][sp->stvca.control_unit-1];
+    su->stvca.sample_ptr = synth_input_ptr(sst, SYNTH_INPUT_SOURCE);
+    su->stvca.control_ptr = synth_input_ptr(sst, SYNTH_INPUT_CONTROL);
 }
 
 const synth_parm_configuration_entry synth_parm_configuration_entry_vca[] = 
@@ -398,29 +900,42 @@ const synth_parm_vca synth_parm_vca_default = { 0, 0, 0, 256, 64, 0 };
 /**************************** SYNTH_TYPE_MIXER **************************************************/
 
 #ifdef PLACE_IN_RAM
-static int32_t __no_inline_not_in_flash_func(synth_type_process_mixer)(synth_parm *sp, synth_unit *su)
+static void __no_inline_not_in_flash_func(synth_type_process_mixer)(synth_parm *sp, synth_unit *su, int32_t *out, uint n)
 #else
-int32_t synth_type_process_mixer(synth_parm *sp, synth_unit *su)
+void synth_type_process_mixer(synth_parm *sp, synth_unit *su, int32_t *out, uint n)
 #endif
 {
-    int32_t control = ((*su->stmixer.control_ptr) * ((int32_t)sp->stmixer.control_gain)) / 256;
-    int32_t mixval =  (control/(QUANTIZATION_MAX/256)) + sp->stmixer.mixval;
-    if (mixval > 255) mixval = 255;
-    else if (mixval < 0) mixval = 0;
-    int32_t sample = (((*su->stmixer.sample_ptr) * mixval) + ((*su->stmixer.sample2_ptr) * (255-mixval))) / 256;
-    sample = (sample * ((int32_t) sp->stmixer.amplitude)) / 256;
-    return sample;
+    const int32_t *sample_ptr = su->stmixer.sample_ptr;
+    const int32_t *sample2_ptr = su->stmixer.sample2_ptr;
+    const int32_t *control_ptr = su->stmixer.control_ptr;
+    int32_t control_gain = sp->stmixer.control_gain;
+    int32_t amplitude = sp->stmixer.amplitude;
+    for (uint i=0;i<n;i++)
+    {
+        int32_t control = (control_ptr[i] * control_gain) / 256;
+        int32_t mixval =  (control/(QUANTIZATION_MAX/256)) + sp->stmixer.mixval;
+        if (mixval > 255) mixval = 255;
+        else if (mixval < 0) mixval = 0;
+        int32_t sample = ((sample_ptr[i] * mixval) + (sample2_ptr[i] * (255-mixval))) / 256;
+        out[i] = (sample * amplitude) / 256;
+    }
 }
 
-void synth_note_start_mixer(synth_parm *sp, synth_unit *su, synth_start_st *sst)
+bool synth_unit_controls_mixer(synth_parm *sp)
 {
+    bool changed = false;
     if (sp->stmixer.control_mixval != 0)
-        sp->stmixer.mixval = read_potentiometer_value(sp->stmixer.control_mixval)/(POT_MAX_VALUE/256);
+        changed |= synth_control_value(&sp->stmixer.mixval, read_potentiometer_value(sp->stmixer.control_mixval)/(POT_MAX_VALUE/256));
     if (sp->stmixer.control_amplitude != 0)
-        sp->stmixer.amplitude = read_potentiometer_value(sp->stmixer.control_amplitude)/(POT_MAX_VALUE/256);
-    su->stmixer.sample_ptr = &synth_unit_result[sst->note][sp->stmixer.source_unit-1];
-    su->stmixer.sample2_ptr = &synth_unit_result[sst->note][sp->stmixer.source2_unit-1];
-    su->stmixer.control_ptr = &synth_unit_result[sst->note][sp->stmixer.control_unit-1];
+        changed |= synth_control_value(&sp->stmixer.amplitude, read_potentiometer_value(sp->stmixer.control_amplitude)/(POT_MAX_VALUE/256));
+    return changed;
+}
+
+void synth_note_start_mixer(synth_parm *sp, synth_unit *su, synth_start_st *sst)
+{
+    su->stmixer.sample_ptr = synth_input_ptr(sst, SYNTH_INPUT_SOURCE);
+    su->stmixer.sample2_ptr = synth_input_ptr(sst, SYNTH_INPUT_SOURCE2);
+    su->stmixer.control_ptr = synth_input_ptr(sst, SYNTH_INPUT_CONTROL);
 }
 
 const synth_parm_configuration_entry synth_parm_configuration_entry_mixer[] = 
@@ -441,22 +956,31 @@ const synth_parm_mixer synth_parm_mixer_default = { 0, 0, 0, 1, 128, 256, 0, 0,
 /**************************** SYNTH_TYPE_RING **************************************************/
 
 #ifdef PLACE_IN_RAM
-static int32_t __no_inline_not_in_flash_func(synth_type_process_ring)(synth_parm *sp, synth_unit *su)
+static void __no_inline_not_in_flash_func(synth_type_process_ring)(synth_parm *sp, synth_unit *su, int32_t *out, uint n)
 #else
-int32_t synth_type_process_ring(synth_parm *sp, synth_unit *su)
+void synth_type_process_ring(synth_parm *sp, synth_unit *su, int32_t *out, uint n)
 #endif
 {
-    int32_t sample = ((*su->string.sample_ptr) * (*su->string.control_ptr)) / QUANTIZATION_MAX;
-    sample = (sample * ((int32_t)sp->string.amplitude)) / 256;
-    return sample;
+    const int32_t *sample_ptr = su->string.sample_ptr;
+    const int32_t *control_ptr = su->string.control_ptr;
+    int32_t amplitude = sp->string.amplitude;
+    for (uint i=0;i<n;i++)
+    {
+        int32_t sample = (sample_ptr[i] * control_ptr[i]) / QUANTIZATION_MAX;
+        out[i] = (sample * amplitude) / 256;
+    }
+}
+
+bool synth_unit_controls_ring(synth_parm *sp)
+{
+    if (sp->string.control_amplitude == 0) return false;
+    return synth_control_value(&sp->string.amplitude, read_potentiometer_value(sp->string.control_amplitude)/(POT_MAX_VALUE/256));
 }
 
 void synth_note_start_ring(synth_parm *sp, synth_unit *su, synth_start_st *sst)
 {
-    if (sp->string.control_amplitude != 0)
-        sp->string.amplitude = read_potentiometer_value(sp->string.control_amplitude)/(POT_MAX_VALUE/256);
-    su->string.sample_ptr = &synth_unit_result[sst->note][sp->string.source_unit-1];
-    su->string.control_ptr = &synth_unit_result[sst->note][sp->string.control_unit-1];
+    su->string.sample_ptr = synth_input_ptr(sst, SYNTH_INPUT_SOURCE);
+    su->string.control_ptr = synth_input_ptr(sst, SYNTH_INPUT_CONTROL);
 }
 
 const synth_parm_configuration_entry synth_parm_configuration_entry_ring[] = 
@@ -473,53 +997,66 @@ const synth_parm_ring synth_parm_ring_default = { 0, 0, 0, 256, 0 };
 /**************************** SYNTH_TYPE_VDO **************************************************/
 
 #ifdef PLACE_IN_RAM
-static int32_t __no_inline_not_in_flash_func(synth_type_process_vdo)(synth_parm *sp, synth_unit *su)
+static void __no_inline_not_in_flash_func(synth_type_process_vdo)(synth_parm *sp, synth_unit *su, int32_t *out, uint n)
 #else
-int32_t synth_type_process_vdo(synth_parm *sp, synth_unit *su)
+void synth_type_process_vdo(synth_parm *sp, synth_unit *su, int32_t *out, uint n)
 #endif
 {
-    int32_t sample;
-        
-    int32_t phase = su->stvdo.phase_mul + (((*su->stvdo.control_ptr)*(sp->stvdo.control_gain))/(QUANTIZATION_MAX*64/2048));
+    const int32_t *control_ptr = su->stvdo.control_ptr;
+    const int32_t *source_ptr = su->stvdo.source_ptr;
+    int32_t control_gain = sp->stvdo.control_gain;
+    int32_t pitch_bend_value = synth_pitch_bend_value;
+    int32_t amplitude = sp->stvdo.amplitude;
+    for (uint i=0;i<n;i++)
+    {
+        int32_t sample;
+        int32_t phase = su->stvdo.phase_mul + ((control_ptr[i]*control_gain)/(QUANTIZATION_MAX*64/2048));
     
-    if (phase < 0) phase = 0;
-    if (phase > 1023) phase = 1023;
+        if (phase < 0) phase = 0;
+        if (phase > 1023) phase = 1023;
 
-    int32_t period = (su->stvdo.period - ((su->stvdo.period_semitone_pitch_bend_gain * (( (synth_pitch_bend_value + *su->stvdo.source_ptr)/64))) / (QUANTIZATION_MAX/64)));
+        int32_t period = (su->stvdo.period - ((su->stvdo.period_semitone_pitch_bend_gain * (( (pitch_bend_value + source_ptr[i])/64))) / (QUANTIZATION_MAX/64)));
 
-    su->stvdo.counter += SYNTH_PERIOD_PRECISION;
+        su->stvdo.counter += SYNTH_PERIOD_PRECISION;
     
-    if (su->stvdo.counter > period)
-    {
-        su->stvdo.counter -= period;
-        su->stvdo.phase = QUANTIZATION_MAX-1;
-    }
+        if (su->stvdo.counter > period)
+        {
+            su->stvdo.counter -= period;
+            su->stvdo.phase = QUANTIZATION_MAX-1;
+        }
     
-    if (su->stvdo.phase > 0)
-    {
-       su->stvdo.phase -= (su->stvdo.phase_inc * phase) / 1024;
-       sample = (sp->stvdo.osc_type == 1) ? QUANTIZATION_MAX - 1 : su->stvdo.phase;
-    } else sample = 0;
-    sample = (sample * ((int32_t)sp->stvdo.amplitude)) / 256;
-    return sample;
+        if (su->stvdo.phase > 0)
+        {
+           su->stvdo.phase -= (su->stvdo.phase_inc * phase) / 1024;
+           sample = (sp->stvdo.osc_type == 1) ? QUANTIZATION_MAX - 1 : su->stvdo.phase;
+        } else sample = 0;
+        out[i] = (sample * amplitude) / 256;
+    }
 }
 
-void synth_note_start_vdo(synth_parm *sp, synth_unit *su, synth_start_st *sst)
+bool synth_unit_controls_vdo(synth_parm *sp)
 {
-    if (sp->stvdo.control_control_gain != 0)
-        sp->stvdo.control_gain = read_potentiometer_value(sp->stvdo.control_control_gain)/(POT_MAX_VALUE/64);
+    if (sp->stvdo.control_control_gain == 0) return false;
+    return synth_control_value(&sp->stvdo.control_gain, read_potentiometer_value(sp->stvdo.control_control_gain)/(POT_MAX_VALUE/64));
+}
+
+void synth_note_prepare_vdo(synth_parm *sp, synth_unit *su)
+{
+    su->stvdo.phase = QUANTIZATION_MAX-1;
+    su->stvdo.phase_mul = sp->stvdo.phase*8;
+}
 
+void synth_note_start_vdo(synth_parm *sp, synth_unit *su, synth_start_st *sst)
+{
     int32_t vco = sst->vco + (sp->stvdo.detune - 4096);
     while (vco > (QUANTIZATION_MAX-1)) vco -= ((QUANTIZATION_MAX/MIDI_NOTES)*12);
     while (vco < 0) vco += ((QUANTIZATION_MAX/MIDI_NOTES)*12);
-    float period_float = period_count_from_vco((uint32_t)vco);
-    su->stvdo.period = period_float;
-    su->stvdo.period_semitone_pitch_bend_gain = (period_float * SEMITONE_LOG_STEP) * sp->stvdo.pitch_bend_gain;
-    su->stvdo.phase_inc = (((float)(QUANTIZATION_MAX*16))*((float)SYNTH_PERIOD_PRECISION)) / period_float;
-    su->stvdo.source_ptr = &synth_unit_result[sst->note][sp->stvdo.source_unit-1];
-    su->stvdo.control_ptr = &synth_unit_result[sst->note][sp->stvdo.control_unit-1];
-    su->stvdo.phase = QUANTIZATION_MAX-1;
-    su->stvdo.phase_mul = sp->stvdo.phase*8;
+    uint32_t period = period_count_from_vco((uint32_t)vco);
+    su->stvdo.period = period;
+    su->stvdo.period_semitone_pitch_bend_gain = counter_semitone_gain(period << 8, sp->stvdo.pitch_bend_gain);
+    su->stvdo.phase_inc = (QUANTIZATION_MAX*16*SYNTH_PERIOD_PRECISION) / period;
+    su->stvdo.source_ptr = synth_input_ptr(sst, SYNTH_INPUT_SOURCE);
+    su->stvdo.control_ptr = synth_input_ptr(sst, SYNTH_INPUT_CONTROL);
 }
 
 const synth_parm_configuration_entry synth_parm_configuration_entry_vdo[] = 
@@ -540,32 +1077,51 @@ const synth_parm_vdo synth_parm_vdo_default = { 1, 0, 0, 1, 1, 256, 4096, 128, 0
 
 /**************************** SYNTH_TYPE_FOLD **************************************************/
 
+#define FOLD_WAVE_SCALE (SYNTH_OSCILLATOR_PRECISION / (2*QUANTIZATION_MAX / WAVETABLES_LENGTH))
+
 #ifdef PLACE_IN_RAM
-static int32_t __no_inline_not_in_flash_func(synth_type_process_fold)(synth_parm *sp, synth_unit *su)
+static void __no_inline_not_in_flash_func(synth_type_process_fold)(synth_parm *sp, synth_unit *su, int32_t *out, uint n)
 #else
-int32_t synth_type_process_fold(synth_parm *sp, synth_unit *su)
+void synth_type_process_fold(synth_parm *sp, synth_unit *su, int32_t *out, uint n)
 #endif
 {
-    int32_t control = ((*su->stfold.control_ptr) * ((int32_t)sp->stfold.control_gain)) / 512 + 
-                      (((int32_t)sp->stfold.amplitude) * (QUANTIZATION_MAX / 512));
+    const int32_t *sample_ptr = su->stfold.sample_ptr;
+    const int32_t *control_ptr = su->stfold.control_ptr;
+    int32_t control_gain = sp->stfold.control_gain;
+    int32_t control_offset = ((int32_t)sp->stfold.amplitude) * (QUANTIZATION_MAX / 512);
+    uint32_t offset = sp->stfold.offset * SYNTH_OSCILLATOR_PRECISION;
+    int32_t ampmix = sp->stfold.ampmix;
+    synth_wave_select(su->stfold.wave);
+    for (uint i=0;i<n;i++)
+    {
+        int32_t control = (control_ptr[i] * control_gain) / 512 + control_offset;
     
-    int32_t sample = *su->stfold.sample_ptr;
-    int32_t val1 = su->stfold.wave[(((sample + QUANTIZATION_MAX) / (2*QUANTIZATION_MAX / WAVETABLES_LENGTH)) + sp->stfold.offset) & (WAVETABLES_LENGTH-1)];
-    sample = (sample * control) / (QUANTIZATION_MAX / 16);
-    int32_t val2 = su->stfold.wave[(((sample + QUANTIZATION_MAX) / (2*QUANTIZATION_MAX / WAVETABLES_LENGTH)) + sp->stfold.offset) & (WAVETABLES_LENGTH-1)];
+        int32_t sample = sample_ptr[i];
+        int32_t val1 = synth_wave_sample(((uint32_t)(sample + QUANTIZATION_MAX)) * FOLD_WAVE_SCALE + offset);
+        sample = (sample * control) / (QUANTIZATION_MAX / 16);
+        int32_t val2 = synth_wave_sample(((uint32_t)(sample + QUANTIZATION_MAX)) * FOLD_WAVE_SCALE + offset);
     
-    return (val2*((int32_t)sp->stfold.ampmix)+val1*((int32_t)(256-sp->stfold.ampmix)))/256;
+        out[i] = (val2*ampmix+val1*(256-ampmix))/256;
+    }
 }
 
-void synth_note_start_fold(synth_parm *sp, synth_unit *su, synth_start_st *sst)
+bool synth_unit_controls_fold(synth_parm *sp)
+{
+    if (sp->stfold.control_amplitude == 0) return false;
+    return synth_control_value(&sp->stfold.amplitude, read_potentiometer_value(sp->stfold.control_amplitude)/(POT_MAX_VALUE/256));
+}
+
+void synth_note_prepare_fold(synth_parm *sp, synth_unit *su)
 {
-    if (sp->stfold.control_amplitude != 0)
-        sp->stfold.amplitude = read_potentiometer_value(sp->stfold.control_amplitude)/(POT_MAX_VALUE/256);
-    su->stfold.sample_ptr = &synth_unit_result[sst->note][sp->stfold.source_unit-1];
-    su->stfold.control_ptr = &synth_unit_result[sst->note][sp->stfold.control_unit-1];
     su->stfold.wave = wavetables[sp->stfold.osc_type-1];
 }
 
+void synth_note_start_fold(synth_parm *sp, synth_unit *su, synth_start_st *sst)
+{
+    su->stfold.sample_ptr = synth_input_ptr(sst, SYNTH_INPUT_SOURCE);
+    su->stfold.control_ptr = synth_input_ptr(sst, SYNTH_INPUT_CONTROL);
+}
+
 const synth_parm_configuration_entry synth_parm_configuration_entry_fold[] = 
 {
     { "SourceUnit",  offsetof(synth_parm_fold,source_unit),        4, 2, 1, MAX_SYNTH_UNITS, NULL },
@@ -584,41 +1140,57 @@ const synth_parm_fold synth_parm_fold_default = { 0, 0, 0, 0, 5, 255, 0, 128, 0
 /**************************** SYNTH_TYPE_NOISE **************************************************/
 
 #ifdef PLACE_IN_RAM
-static int32_t __no_inline_not_in_flash_func(synth_type_process_noise)(synth_parm *sp, synth_unit *su)
+static void __no_inline_not_in_flash_func(synth_type_process_noise)(synth_parm *sp, synth_unit *su, int32_t *out, uint n)
 #else
-int32_t synth_type_process_noise(synth_parm *sp, synth_unit *su)
+void synth_type_process_noise(synth_parm *sp, synth_unit *su, int32_t *out, uint n)
 #endif
 {
-    su->stnoise.counter += (su->stnoise.counter_inc + ((su->stnoise.counter_semitone_control_gain*(*su->stnoise.control_ptr / 64) + 
-                                                        su->stnoise.counter_semitone_pitch_bend_gain * (synth_pitch_bend_value /64))/(QUANTIZATION_MAX/64)));
-    if ( ((su->stnoise.counter ^ su->stnoise.last_counter) & ~(WAVETABLES_LENGTH*SYNTH_OSCILLATOR_PRECISION-1)) != 0)
+    const int32_t *control_ptr = su->stnoise.control_ptr;
+    int32_t pitch_bend = su->stnoise.counter_semitone_pitch_bend_gain * (synth_pitch_bend_value /64);
+    int32_t amplitude = sp->stnoise.amplitude;
+    for (uint i=0;i<n;i++)
     {
-        su->stnoise.last_counter = su->stnoise.counter;
-        su->stnoise.congruential_generator = (su->stnoise.congruential_generator * 1664525u + 1013904223u);
-        su->stnoise.sample = (int32_t)((su->stnoise.congruential_generator >> 16) & (2*QUANTIZATION_MAX - 1)) - QUANTIZATION_MAX;
+        su->stnoise.counter += (su->stnoise.counter_inc + ((su->stnoise.counter_semitone_control_gain*(control_ptr[i] / 64) + 
+                                                            pitch_bend)/(QUANTIZATION_MAX/64)));
+        if ( ((su->stnoise.counter ^ su->stnoise.last_counter) & ~(WAVETABLES_LENGTH*SYNTH_OSCILLATOR_PRECISION-1)) != 0)
+        {
+            su->stnoise.last_counter = su->stnoise.counter;
+            su->stnoise.congruential_generator = (su->stnoise.congruential_generator * 1664525u + 1013904223u);
+            su->stnoise.sample = (int32_t)((su->stnoise.congruential_generator >> 16) & (2*QUANTIZATION_MAX - 1)) - QUANTIZATION_MAX;
+        }
+        out[i] = (su->stnoise.sample * amplitude) / 256;
     }
-    return (su->stnoise.sample * ((int32_t)sp->stnoise.amplitude)) / 256;
 }
 
-void synth_note_start_noise(synth_parm *sp, synth_unit *su, synth_start_st *sst)
+bool synth_unit_controls_noise(synth_parm *sp)
 {
+    bool changed = false;
     if (sp->stnoise.control_amplitude != 0)
-        sp->stnoise.amplitude = read_potentiometer_value(sp->stnoise.control_amplitude)/(POT_MAX_VALUE/256);
+        changed |= synth_control_value(&sp->stnoise.amplitude, read_potentiometer_value(sp->stnoise.control_amplitude)/(POT_MAX_VALUE/256));
     if (sp->stnoise.control_control_gain != 0)
-        sp->stnoise.control_gain = read_potentiometer_value(sp->stnoise.control_control_gain)/(POT_MAX_VALUE/64);
-  
+        changed |= synth_control_value(&sp->stnoise.control_gain, read_potentiometer_value(sp->stnoise.control_control_gain)/(POT_MAX_VALUE/64));
+    return changed;
+}
+
+void synth_unit_refresh_noise(synth_parm *sp, synth_unit *su, synth_start_st *sst)
+{
+    su->stnoise.counter_semitone_control_gain = counter_semitone_gain(su->stnoise.counter_fraction, sp->stnoise.control_gain);
+}
+
+void synth_note_start_noise(synth_parm *sp, synth_unit *su, synth_start_st *sst)
+{
     uint32_t vco = sst->vco;
     if (sp->stnoise.shiftup != 1)
     {
         vco += ((QUANTIZATION_MAX/MIDI_NOTES)*6)*sp->stnoise.shiftup;
         if (vco >= QUANTIZATION_MAX) vco = QUANTIZATION_MAX-1;
     }
-    float counter_inc_float = counter_fraction_from_vco(vco);
-    su->stnoise.counter_inc = counter_inc_float;
-    float f = counter_inc_float * SEMITONE_LOG_STEP;
-    su->stnoise.counter_semitone_control_gain = f * sp->stnoise.control_gain;
-    su->stnoise.counter_semitone_pitch_bend_gain = f * sp->stnoise.pitch_bend_gain;
-    su->stnoise.control_ptr = &synth_unit_result[sst->note][sp->stnoise.control_unit-1];
+    uint32_t counter_fraction = counter_fraction_from_vco(vco);
+    su->stnoise.counter_inc = counter_fraction >> 8;
+    su->stnoise.counter_fraction = counter_fraction;
+    su->stnoise.counter_semitone_control_gain = counter_semitone_gain(counter_fraction, sp->stnoise.control_gain);
+    su->stnoise.counter_semitone_pitch_bend_gain = counter_semitone_gain(counter_fraction, sp->stnoise.pitch_bend_gain);
+    su->stnoise.control_ptr = synth_input_ptr(sst, SYNTH_INPUT_CONTROL);
 }
 
 const synth_parm_configuration_entry synth_parm_configuration_entry_noise[] = 
@@ -631,10 +1203,11 @@ const synth_parm_configuration_entry synth_parm_configuration_entry_noise[] =
     { "BendGain",    offsetof(synth_parm_noise,pitch_bend_gain),       4, 2, 0, 63, NULL },
     { "AmplCtrl",    offsetof(synth_parm_noise,control_amplitude),     4, 2, 0, NUMBER_OF_CONTROLS, "VCOAmpli" },
     { "GainCtrl",    offsetof(synth_parm_noise,control_control_gain),  4, 2, 0, NUMBER_OF_CONTROLS, "VCOGain" },
+    { "Global",      offsetof(synth_parm_noise,global),                4, 1, 0, 1, NULL },
     { NULL, 0, 4, 0, 0,   1, NULL    }
 };
 
-const synth_parm_noise synth_parm_noise_default = { 0, 0, 0, 1, 256, 20, 0, 0, 0 };
+const synth_parm_noise synth_parm_noise_default = { 0, 0, 0, 1, 256, 20, 0, 0, 0, 0 };
 
 /************STRUCTURES FOR ALL SYNTH TYPES *****************************/
 
@@ -699,6 +1272,54 @@ synth_note_start * const sns[] =
     synth_note_start_noise,
 };
 
+/* units without controls or patch derived state have no entry */
+synth_unit_controls * const snc[] =
+{
+    NULL,
+    synth_unit_controls_vco,
+    synth_unit_controls_adsr,
+    synth_unit_controls_lowpass,
+    synth_unit_controls_osc,
+    synth_unit_controls_vca,
+    synth_unit_controls_mixer,
+    synth_unit_controls_ring,
+    synth_unit_controls_vdo,
+    synth_unit_controls_fold,
+    synth_unit_controls_noise,
+};
+
+synth_note_prepare * const snp[] =
+{
+    NULL,
+    NULL,
+    synth_note_prepare_adsr,
+    synth_note_prepare_lowpass,
+    synth_note_prepare_osc,
+    NULL,
+    NULL,
+    NULL,
+    synth_note_prepare_vdo,
+    synth_note_prepare_fold,
+    NULL,
+};
+
+/* the units that keep values derived from their controls in the voice state, the
+   others read the controlled parameters directly while they run */
+synth_unit_refresh * const snr[] =
+{
+    NULL,
+    synth_unit_refresh_vco,
+    synth_unit_refresh_adsr,
+    synth_unit_refresh_lowpass,
+    synth_unit_refresh_osc,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    NULL,
+    synth_unit_refresh_noise,
+};
+
 const void * const synth_parm_struct_defaults[] =
 {
     (void *) &synth_parm_none_default,
@@ -729,44 +1350,193 @@ const uint32_t synth_parm_struct_defaults_len[] =
     sizeof(synth_parm_noise_default),
 };
 
-/********************* SYNTH PROCESS STRUCTURE *******************************************/
+/********************* FUSED KERNELS *******************************************/
 
-uint32_t synth_read_value_prec(void *v, int prec)
+static inline void synth_process(synth_parm *sp, synth_unit *su, int32_t *out, uint n)
 {
-    if (prec == 1)
-        return *((uint8_t *)v);
-    if (prec == 2)
-        return *((uint16_t *)v);
-    return *((uint32_t *)v);
+    stp[(int)sp->stn.sut](sp, su, out, n);
 }
 
-void synth_set_value_prec(void *v, int prec, uint32_t val)
+#ifdef PLACE_IN_RAM
+static void __no_inline_not_in_flash_func(synth_fused_vco_adsr)(synth_parm *spv, synth_unit *suv, synth_unit *sua, int32_t *out, uint n)
+#else
+void synth_fused_vco_adsr(synth_parm *spv, synth_unit *suv, synth_unit *sua, int32_t *out, uint n)
+#endif
 {
-    DMB();
-    if (prec == 1)
-    {
-        *((uint8_t *)v) = val;
-        return;
-    } else if (prec == 2)
-    {
-        *((uint16_t *)v) = val;
-        return;
-    } else
+    uint32_t counter = suv->stvco.counter;
+    const int32_t *control_ptr = suv->stvco.control_ptr;
+    bool interpolate = spv->stvco.interpolate;
+    int32_t pitch_bend = suv->stvco.counter_semitone_pitch_bend_gain * (synth_pitch_bend_value /64);
+    int32_t amplitude = spv->stvco.amplitude;
+    synth_wave_select(suv->stvco.wave);
+    for (uint i=0;i<n;i++)
     {
-        *((uint32_t *)v) = val;
+        int32_t sample = synth_vco_step(suv, &counter, control_ptr[i], pitch_bend, interpolate, amplitude);
+        out[i] = ((sample * ((int32_t)synth_adsr_step(sua, 0, i))) / QUANTIZATION_MAX);
     }
-    DMB();
-
+    suv->stvco.counter = counter;
 }
 
-void synth_lock(int note_no)
+#ifdef PLACE_IN_RAM
+static void __no_inline_not_in_flash_func(synth_fused_osc_vco)(synth_parm *spo, synth_unit *suo, synth_parm *spv, synth_unit *suv, int32_t *out, uint n)
+#else
+void synth_fused_osc_vco(synth_parm *spo, synth_unit *suo, synth_parm *spv, synth_unit *suv, int32_t *out, uint n)
+#endif
 {
-    mutex_enter_blocking(&note_mutexes[note_no]);
+    uint32_t osc_counter = suo->stosc.counter;
+    const int32_t *osc_control_ptr = suo->stosc.control_ptr;
+    int32_t osc_amplitude = spo->stosc.amplitude;
+    int32_t bend = synth_osc_bend(spo, suo);
+    uint32_t counter = suv->stvco.counter;
+    bool interpolate = spv->stvco.interpolate;
+    int32_t pitch_bend = suv->stvco.counter_semitone_pitch_bend_gain * (synth_pitch_bend_value /64);
+    int32_t amplitude = spv->stvco.amplitude;
+    synth_control_wave_select(suo->stosc.wave);
+    synth_wave_select(suv->stvco.wave);
+    for (uint i=0;i<n;i++)
+    {
+        int32_t control = synth_osc_step(suo, &osc_counter, osc_control_ptr[i], bend, osc_amplitude);
+        out[i] = synth_vco_step(suv, &counter, control, pitch_bend, interpolate, amplitude);
+    }
+    suo->stosc.counter = osc_counter;
+    suv->stvco.counter = counter;
+}
+
+#ifdef PLACE_IN_RAM
+static void __no_inline_not_in_flash_func(synth_process_fused)(const synth_program_op *pop, int note, int32_t (*sur)[SYNTH_BLOCK_SIZE], uint n)
+#else
+static void synth_process_fused(const synth_program_op *pop, int note, int32_t (*sur)[SYNTH_BLOCK_SIZE], uint n)
+#endif
+{
+    synth_parm *spf = &synth_parms[pop->fused_unit];
+    synth_unit *suf = &synth_units[note][pop->fused_unit];
+    synth_parm *sp = &synth_parms[pop->unit];
+    synth_unit *su = &synth_units[note][pop->unit];
+    switch (pop->kernel)
+    {
+        case SYNTH_KERNEL_VCO_ADSR:
+            /* the envelope may have been changed since the note started */
+            if ((sp->stadsr.output_type == 0) && (sp->stadsr.control_rate == 0))
+            {
+                synth_fused_vco_adsr(spf, suf, su, sur[pop->unit+1], n);
+                return;
+            }
+            break;
+        case SYNTH_KERNEL_OSC_VCO:
+            if (spf->stosc.control_rate == 0)
+            {
+                synth_fused_osc_vco(spf, suf, sp, su, sur[pop->unit+1], n);
+                return;
+            }
+            break;
+    }
+    synth_process(spf, suf, sur[pop->fused_unit+1], n);
+    synth_process(sp, su, sur[pop->unit+1], n);
+}
+
+/* runs the fused op, then reruns it through the unit path from the same state and
+   keeps the unit path result, counting any difference in output or state.  the
+   first difference is kept for the FUSE command */
+static void synth_process_fused_checked(const synth_program_op *pop, int note, int32_t (*sur)[SYNTH_BLOCK_SIZE], uint n)
+{
+    synth_unit *suf = &synth_units[note][pop->fused_unit];
+    synth_unit *su = &synth_units[note][pop->unit];
+    synth_unit saved_fused_unit = *suf, saved_unit = *su;
+    int32_t fused_out[SYNTH_BLOCK_SIZE];
+
+    synth_process_fused(pop, note, sur, n);
+    memcpy(fused_out, sur[pop->unit+1], sizeof(int32_t)*n);
+    synth_unit fused_state_fused_unit = *suf, fused_state_unit = *su;
+    *suf = saved_fused_unit;
+    *su = saved_unit;
+    synth_process(&synth_parms[pop->fused_unit], suf, sur[pop->fused_unit+1], n);
+    synth_process(&synth_parms[pop->unit], su, sur[pop->unit+1], n);
+    int sample = -1;
+    for (uint i=0;i<n;i++)
+        if (fused_out[i] != sur[pop->unit+1][i])
+        {
+            sample = i;
+            break;
+        }
+    if ((sample >= 0) ||
+        (memcmp(&fused_state_fused_unit, suf, sizeof(synth_unit)) != 0) ||
+        (memcmp(&fused_state_unit, su, sizeof(synth_unit)) != 0))
+    {
+        if (synth_fusion_mismatches == 0)
+        {
+            synth_fusion_mismatch *sfm = &synth_fusion_first_mismatch;
+            sfm->fused_unit = pop->fused_unit;
+            sfm->unit = pop->unit;
+            sfm->sample = sample;
+            sfm->fused = (sample >= 0) ? fused_out[sample] : 0;
+            sfm->reference = (sample >= 0) ? sur[pop->unit+1][sample] : 0;
+        }
+        synth_fusion_mismatches++;
+    }
+    synth_fusion_checked_blocks++;
+}
+
+/********************* SYNTH PROCESS STRUCTURE *******************************************/
+
+uint32_t synth_read_value_prec(void *v, int prec)
+{
+    if (prec == 1)
+        return *((uint8_t *)v);
+    if (prec == 2)
+        return *((uint16_t *)v);
+    return *((uint32_t *)v);
+}
+
+void synth_set_value_prec(void *v, int prec, uint32_t val)
+{
+    DMB();
+    if (prec == 1)
+    {
+        *((uint8_t *)v) = val;
+        return;
+    } else if (prec == 2)
+    {
+        *((uint16_t *)v) = val;
+        return;
+    } else
+    {
+        *((uint32_t *)v) = val;
+    }
+    DMB();
+
+}
+
+/* Posting never waits for core1.  When the queue is full the event is not posted,
+   the overflow is counted and the caller drops or retries it */
+static bool synth_post_event(synth_event_type type, uint note, uint32_t value, uint32_t sample_index, uint32_t time_us)
+{
+    uint32_t write = synth_event_queue_write;
+    if ((write - synth_event_queue_read) >= SYNTH_EVENT_QUEUE_LENGTH)
+    {
+        synth_event_queue_overflows++;
+        return false;
+    }
+    synth_event *se = &synth_event_queue[write & (SYNTH_EVENT_QUEUE_LENGTH-1)];
+    se->type = type;
+    se->note = note;
+    se->value = value;
+    se->sample_index = sample_index;
+    se->time_us = time_us;
+    DMB();
+    synth_event_queue_write = write + 1;
+    return true;
+}
+
+uint32_t synth_event_queue_depth(void)
+{
+    return synth_event_queue_write - synth_event_queue_read;
 }
 
-void synth_unlock(int note_no)
+void synth_event_queue_reset_stats(void)
 {
-    mutex_exit(&note_mutexes[note_no]);
+    synth_event_queue_max_depth = 0;
+    synth_event_queue_overflows = 0;
+    synth_event_late = 0;
 }
 
 void synth_unit_struct_zero(synth_unit *su)
@@ -781,27 +1551,278 @@ void synth_unit_reset(int synth_note, int synth_unit_number)
     synth_unit_struct_zero(du);
 }
 
+/* a reset takes no queue entry, so it cannot be lost to a full queue.  the flag
+   coalesces any number of them and core1 applies it at its next block, flushing
+   the events posted before synth_event_flush_write */
 void synth_unit_reset_unitno(int unitno)
 {
-    for (int j=0;j<MAX_POLYPHONY;j++)
+    synth_event_flush_write = synth_event_queue_write;
+    DMB();
+    synth_reset_pending = true;
+}
+
+void synth_unit_reset_all(void)
+{
+    synth_unit_reset_unitno(0);
+}
+
+static uint synth_unit_input_buffer(const synth_parm *sp, uint input)
+{
+    uint32_t u;
+    switch (input)
     {
-        synth_lock(j);
-        synth_unit_reset(j, unitno);        
-        synth_unlock(j);
+        case SYNTH_INPUT_SOURCE:  u = sp->stn.source_unit;
+                                  break;
+        case SYNTH_INPUT_CONTROL: u = sp->stn.control_unit;
+                                  break;
+        default:                  u = (sp->stn.sut == SYNTH_TYPE_MIXER) ? sp->stmixer.source2_unit : 1;
+                                  break;
     }
+    return ((u == 0) || (u > MAX_SYNTH_UNITS)) ? 0 : u-1;
 }
 
-void synth_unit_reset_all(void)
+static uint synth_unit_inputs_used(const synth_parm *sp)
+{
+    switch (sp->stn.sut)
+    {
+        case SYNTH_TYPE_NONE:   return (1 << SYNTH_INPUT_SOURCE);
+        case SYNTH_TYPE_VCO:
+        case SYNTH_TYPE_OSC:
+        case SYNTH_TYPE_NOISE:  return (1 << SYNTH_INPUT_CONTROL);
+        case SYNTH_TYPE_ADSR:   return (sp->stadsr.output_type == 0) ? (1 << SYNTH_INPUT_SOURCE) : 0;
+        case SYNTH_TYPE_MIXER:  return (1 << SYNTH_INPUT_SOURCE) | (1 << SYNTH_INPUT_CONTROL) | (1 << SYNTH_INPUT_SOURCE2);
+        default:                return (1 << SYNTH_INPUT_SOURCE) | (1 << SYNTH_INPUT_CONTROL);
+    }
+}
+
+/* an ADSR gating the voice ends the note, so it runs even if its output is unused */
+static bool synth_unit_has_side_effect(const synth_parm *sp)
+{
+    return (sp->stn.sut == SYNTH_TYPE_ADSR) && (sp->stadsr.output_type == 0);
+}
+
+/* an oscillator or noise source marked global that reads nothing per voice is run
+   once for all the voices, unless it is the voice output */
+static bool synth_unit_wants_global(const synth_parm *sp)
+{
+    switch (sp->stn.sut)
+    {
+        case SYNTH_TYPE_OSC:    return sp->stosc.global != 0;
+        case SYNTH_TYPE_NOISE:  return sp->stnoise.global != 0;
+        default:                return false;
+    }
+}
+
+/* a bus unit takes its source from the bus and its control from a global unit.
+   an envelope has no note to follow there, so it is passed over like an empty slot */
+static bool synth_bus_unit_runs(const synth_parm *sp)
+{
+    return (sp->stn.sut != SYNTH_TYPE_NONE) && (sp->stn.sut != SYNTH_TYPE_ADSR);
+}
+
+/* a unit can be fused into the unit after it when that is the only reader of its result */
+static synth_kernel_type synth_fused_kernel(uint producer, uint consumer, uint8_t input[][SYNTH_INPUTS_NUMBER], const bool *live, uint output)
+{
+    const synth_parm *spp = synth_parm_entry(producer);
+    const synth_parm *spc = synth_parm_entry(consumer);
+    synth_kernel_type kernel = SYNTH_KERNEL_UNIT;
+    uint consumer_input = 0;
+
+    if ((spp->stn.sut == SYNTH_TYPE_VCO) && (spc->stn.sut == SYNTH_TYPE_ADSR) && (spc->stadsr.output_type == 0) &&
+        (spc->stadsr.control_rate == 0))
+    {
+        kernel = SYNTH_KERNEL_VCO_ADSR;
+        consumer_input = SYNTH_INPUT_SOURCE;
+    } else if ((spp->stn.sut == SYNTH_TYPE_OSC) && (spc->stn.sut == SYNTH_TYPE_VCO) && (spp->stosc.control_rate == 0))
+    {
+        kernel = SYNTH_KERNEL_OSC_VCO;
+        consumer_input = SYNTH_INPUT_CONTROL;
+    } else return SYNTH_KERNEL_UNIT;
+
+    if ((output == (producer+1)) || (input[consumer][consumer_input] != (producer+1)))
+        return SYNTH_KERNEL_UNIT;
+    uint readers = 0;
+    for (uint unit_no=0;unit_no<MAX_SYNTH_UNITS;unit_no++)
+    {
+        if (!live[unit_no]) continue;
+        uint used = synth_unit_inputs_used(synth_parm_entry(unit_no));
+        for (uint in=0;in<SYNTH_INPUTS_NUMBER;in++)
+            if ((used & (1 << in)) && (input[unit_no][in] == (producer+1))) readers++;
+    }
+    return (readers == 1) ? kernel : SYNTH_KERNEL_UNIT;
+}
+
+/* Build the voice program from the unit connections.  A unit reading the result of
+   itself or a later unit sees the previous block, so the units keep their order.
+   Pass-through units whose source was computed earlier in the block are replaced by
+   that source in their readers, and units nothing reaches from the output are dropped.
+   Adjacent pairs with a fused kernel then become a single op.
+   Notes latch the program when they start, like the unit input pointers.
+   core1 copies the global and bus programs while this runs on core0, so the
+   program id is a sequence count: odd while the compiled state is written, and
+   moved on again once it is complete */
+void synth_compile_program(void)
+{
+    uint8_t alias[MAX_SYNTH_UNITS+1];
+    uint8_t input[MAX_SYNTH_UNITS][SYNTH_INPUTS_NUMBER];
+    bool live[MAX_SYNTH_UNITS];
+    bool global[MAX_SYNTH_UNITS];
+    uint8_t stack[MAX_SYNTH_UNITS];
+    uint stack_depth = 0;
+    synth_program prog;
+
+    alias[0] = 0;
+    for (uint unit_no=0;unit_no<MAX_SYNTH_UNITS;unit_no++)
+    {
+        const synth_parm *sp = synth_parm_entry(unit_no);
+        uint b = synth_unit_input_buffer(sp, SYNTH_INPUT_SOURCE);
+        alias[unit_no+1] = ((sp->stn.sut == SYNTH_TYPE_NONE) && (b <= unit_no)) ? alias[b] : unit_no+1;
+        for (uint in=0;in<SYNTH_INPUTS_NUMBER;in++)
+        {
+            b = synth_unit_input_buffer(sp, in);
+            input[unit_no][in] = (b <= unit_no) ? alias[b] : b;
+        }
+        live[unit_no] = synth_unit_has_side_effect(sp);
+        if (live[unit_no]) stack[stack_depth++] = unit_no;
+    }
+    prog.output = alias[MAX_SYNTH_UNITS];
+    for (uint unit_no=0;unit_no<MAX_SYNTH_UNITS;unit_no++)
+    {
+        uint b = input[unit_no][SYNTH_INPUT_CONTROL];
+        global[unit_no] = synth_unit_wants_global(synth_parm_entry(unit_no)) && (prog.output != (unit_no+1)) &&
+                          ((b == 0) || ((b <= unit_no) && global[b-1]));
+    }
+    synth_bus_program bus;
+    uint8_t bus_input[SYNTH_BUS_UNITS][SYNTH_INPUTS_NUMBER];
+    uint bus_source = 0;
+    bus.units = 0;
+    for (uint k=0;k<SYNTH_BUS_UNITS;k++)
+    {
+        const synth_parm *sp = synth_parm_entry(MAX_SYNTH_UNITS+k);
+        uint b = alias[synth_unit_input_buffer(sp, SYNTH_INPUT_CONTROL)];
+        bus_input[k][SYNTH_INPUT_SOURCE] = bus_source | SYNTH_INPUT_BUS;
+        bus_input[k][SYNTH_INPUT_CONTROL] = 0;
+        bus_input[k][SYNTH_INPUT_SOURCE2] = 0;
+        if (!synth_bus_unit_runs(sp)) continue;
+        if ((b != 0) && (global[b-1]))
+        {
+            bus_input[k][SYNTH_INPUT_CONTROL] = b;
+            if (!live[b-1])
+            {
+                live[b-1] = true;
+                stack[stack_depth++] = b-1;
+            }
+        }
+        bus.unit[bus.units++] = k;
+        bus_source = k+1;
+    }
+    if ((prog.output != 0) && (!live[prog.output-1]))
+    {
+        live[prog.output-1] = true;
+        stack[stack_depth++] = prog.output-1;
+    }
+    while (stack_depth > 0)
+    {
+        uint unit_no = stack[--stack_depth];
+        uint used = synth_unit_inputs_used(synth_parm_entry(unit_no));
+        for (uint in=0;in<SYNTH_INPUTS_NUMBER;in++)
+        {
+            uint b = input[unit_no][in];
+            if ((used & (1 << in)) && (b != 0) && (!live[b-1]))
+            {
+                live[b-1] = true;
+                stack[stack_depth++] = b-1;
+            }
+        }
+    }
+    uint8_t live_units[MAX_SYNTH_UNITS];
+    synth_global_program globals;
+    prog.units = 0;
+    globals.units = 0;
+    for (uint unit_no=0;unit_no<MAX_SYNTH_UNITS;unit_no++)
+    {
+        if (!live[unit_no]) continue;
+        if (global[unit_no])
+            globals.unit[globals.units++] = unit_no;
+        else
+            live_units[prog.units++] = unit_no;
+    }
+    prog.ops = 0;
+    for (uint k=0;k<prog.units;k++)
+    {
+        synth_program_op *op = &prog.op[prog.ops++];
+        op->kernel = SYNTH_KERNEL_UNIT;
+        op->unit = live_units[k];
+        op->fused_unit = live_units[k];
+        if ((synth_fusion_mode != SYNTH_FUSION_OFF) && ((k+1) < prog.units))
+        {
+            synth_kernel_type kernel = synth_fused_kernel(live_units[k], live_units[k+1], input, live, prog.output);
+            if (kernel != SYNTH_KERNEL_UNIT)
+            {
+                op->kernel = kernel;
+                op->unit = live_units[++k];
+            }
+        }
+    }
+    for (uint unit_no=0;unit_no<MAX_SYNTH_UNITS;unit_no++)
+        for (uint in=0;in<SYNTH_INPUTS_NUMBER;in++)
+        {
+            uint b = input[unit_no][in];
+            if ((b != 0) && (global[b-1]))
+                input[unit_no][in] = (b-1) | SYNTH_INPUT_GLOBAL;
+        }
+    for (uint k=0;k<SYNTH_BUS_UNITS;k++)
+    {
+        uint b = bus_input[k][SYNTH_INPUT_CONTROL];
+        if (b != 0) bus_input[k][SYNTH_INPUT_CONTROL] = (b-1) | SYNTH_INPUT_GLOBAL;
+    }
+    for (uint op=0;op<prog.ops;op++)
+        memcpy(prog.op[op].input, input[prog.op[op].unit], sizeof(prog.op[op].input));
+    synth_compiled_program_id++;
+    DMB();
+    memcpy(synth_compiled_input, input, sizeof(input));
+    memcpy(synth_compiled_input[MAX_SYNTH_UNITS], bus_input, sizeof(bus_input));
+    synth_compiled_program = prog;
+    synth_compiled_globals = globals;
+    synth_compiled_bus = bus;
+    DMB();
+    synth_compiled_program_id++;
+    synth_patch_generation++;
+}
+
+uint32_t synth_program_ops(void)
+{
+    return synth_compiled_program.ops;
+}
+
+uint32_t synth_program_units(void)
+{
+    return synth_compiled_program.units;
+}
+
+uint32_t synth_program_globals(void)
+{
+    return synth_compiled_globals.units;
+}
+
+uint32_t synth_program_bus_units(void)
+{
+    return synth_compiled_bus.units;
+}
+
+void synth_set_fusion_mode(synth_fusion_mode_type mode)
 {
-    for (int i=0;i<MAX_SYNTH_UNITS;i++)
-        synth_unit_reset_unitno(i);
+    synth_fusion_mode = mode;
+    synth_fusion_checked_blocks = 0;
+    synth_fusion_mismatches = 0;
+    synth_compile_program();
 }
 
 void synth_unit_initialize(int synth_unit_number, synth_unit_type sut)
 {
     synth_parm *sp;
     
-    if (sut >= SYNTH_TYPE_MAX_ENTRY) return;
+    if ((sut >= SYNTH_TYPE_MAX_ENTRY) || (synth_unit_number >= SYNTH_ALL_UNITS)) return;
     
     sp = synth_parm_entry(synth_unit_number);
     
@@ -809,205 +1830,906 @@ void synth_unit_initialize(int synth_unit_number, synth_unit_type sut)
     memset((void *)sp, '\000', sizeof(synth_parm));
     memcpy((void *)sp, synth_parm_struct_defaults[sut], synth_parm_struct_defaults_len[sut]);
     if (sp->stn.source_unit == 0)
-        sp->stn.source_unit = synth_unit_number + 1;
+        sp->stn.source_unit = (synth_unit_number < MAX_SYNTH_UNITS) ? synth_unit_number + 1 : 1;
     if (sp->stn.control_unit == 0)
         sp->stn.control_unit = 1;
     DMB();
     sp->stn.sut = sut;
     DMB();
+    synth_compile_program();
+}
+
+/* the units of a program in execution order, including the fused ones */
+static uint synth_program_unit_list(const synth_program *prog, uint8_t *units)
+{
+    uint count = 0;
+    for (uint op=0;op<prog->ops;op++)
+    {
+        if (prog->op[op].fused_unit != prog->op[op].unit)
+            units[count++] = prog->op[op].fused_unit;
+        units[count++] = prog->op[op].unit;
+    }
+    return count;
 }
 
-static inline int32_t synth_process(synth_parm *sp, synth_unit *su)
+/* Units start from a template holding everything that depends only on the patch.
+   It is rebuilt when the patch generation moves on, which happens when the program
+   is compiled after any parameter change, or when core1 has read a new control
+   value.  The note on then only fills in the pitch, velocity and the
+   input pointers of its voice. */
+static void synth_build_voice_template(const uint8_t *units, uint count)
 {
-    return stp[(int)sp->stn.sut](sp, su);
+    synth_voice_template_control_generation = synth_control_generation;
+    DMB();
+    memset(synth_voice_template, '\000', sizeof(synth_voice_template));
+    for (uint k=0;k<count;k++)
+    {
+        synth_parm *sp = synth_parm_entry(units[k]);
+        if (snp[(int)sp->stn.sut] != NULL)
+            snp[(int)sp->stn.sut](sp, &synth_voice_template[units[k]]);
+    }
+    synth_voice_template_generation = synth_patch_generation;
 }
 
-void synth_start_note_val(uint8_t note_no, uint8_t velocity, int note)
+bool synth_start_note_val(uint8_t note_no, uint8_t velocity, int note, uint32_t sample_index, uint32_t time_us)
 {
-    uint32_t vco = ((uint32_t)note_no)*(QUANTIZATION_MAX/MIDI_NOTES);
-    synth_unit *su = synth_unit_entry(note, 0);
-    memset(su,'\000',sizeof(synth_unit)*MAX_SYNTH_UNITS);
-    synth_parm *sp = synth_parm_entry(0);
+#ifdef PROFILE_UNITS
+    uint32_t start_cycles = profile_cycles();
+#endif
+    uint32_t vco = tunings[pc.pcs.tuning < PITCH_TUNINGS_NUMBER ? pc.pcs.tuning : 0][note_no & (MIDI_NOTES-1)];
+    synth_program *prog = &synth_note_program[note];
+    uint8_t units[MAX_SYNTH_UNITS];
+    *prog = synth_compiled_program;
+    uint count = synth_program_unit_list(prog, units);
+    if ((synth_voice_template_generation != synth_patch_generation) ||
+        (synth_voice_template_control_generation != synth_control_generation))
+        synth_build_voice_template(units, count);
+    synth_note_control_generation[note] = synth_voice_template_control_generation;
+    memcpy(synth_unit_entry(note, 0), synth_voice_template, sizeof(synth_voice_template));
     synth_start_st sst;
     sst.note_no = note_no;
     sst.vco = vco;
     sst.velocity = velocity;
     sst.note = note;
-    for (int unit_no=0;unit_no<MAX_SYNTH_UNITS;unit_no++)
+    for (uint k=0;k<count;k++)
     {
-        sns[(int)sp->stn.sut](sp, su, &sst);
-        su++;
-        sp++;
+        sst.unit = units[k];
+        synth_parm *sp = synth_parm_entry(sst.unit);
+        sns[(int)sp->stn.sut](sp, synth_unit_entry(note, sst.unit), &sst);
     }
+#ifdef PROFILE_UNITS
+    profile_add(&synth_profile_note_start, profile_elapsed(start_cycles), 1);
+#endif
     synth_note_number[note] = note_no;
     synth_note_velocity[note] = velocity;
-    synth_note_stopping[note] = false;
-    synth_note_stopping_fast[note] = false;
-    synth_note_stopping_counter[note] = 0;
     synth_note_count[note] = ++synth_current_note_count;
-    DMB();
-    mutex_enter_blocking(&note_mutexes[note]);
+    synth_note_stealing[note] = false;
+    synth_note_release_pending[note] = false;
     synth_note_active[note] = true;
-    DMB();
-    mutex_exit(&note_mutexes[note]);
+    if (synth_post_event(SYNTH_EVENT_NOTE_ON, note, 0, sample_index, time_us)) return true;
+    /* core1 never saw the voice, so the note is dropped and the voice is free again */
+    synth_note_active[note] = false;
+    return false;
 }
 
-void synth_stop_note_now(int note)
+/* the voice fades out on core1 and is retired there, core0 does not wait for it.
+   it is no longer counted against the voice limit or matched by note number */
+static bool synth_steal_voice(int note, uint32_t sample_index)
 {
-    mutex_enter_blocking(&note_mutexes[note]);
-    synth_note_stopping_counter[note] = SYNTH_STOPPING_COUNTER;
-    DMB();
-    synth_note_stopping_fast[note] = true;
-    DMB();
-    mutex_exit(&note_mutexes[note]);
-    while (synth_note_active[note]) {};
+    if (!synth_post_event(SYNTH_EVENT_NOTE_STEAL, note, 0, sample_index, 0)) return false;
+    synth_note_stealing[note] = true;
+    synth_note_release_pending[note] = false;
+    synth_steals++;
+    return true;
+}
+
+/* a note off that finds the queue full is retried by synth_poll_pending_starts,
+   so a full queue cannot leave a note hanging */
+static void synth_release_voice(int note, uint32_t sample_index, uint32_t time_us)
+{
+    synth_note_release_pending[note] = !synth_post_event(SYNTH_EVENT_NOTE_OFF, note, pc.pcs.fail_delay, sample_index, time_us);
 }
 
-void synth_start_note(uint8_t note_no, uint8_t velocity)
+/* starts the notes that were waiting for a stolen voice to finish its fade, and
+   retries the note offs that were not posted */
+void synth_poll_pending_starts(void)
 {
     for (int note=0;note<MAX_POLYPHONY;note++)
     {
-        if ((synth_note_active[note]) && (synth_note_number[note] == note_no))
-            synth_stop_note_now(note);
+        synth_pending_start *ps = &synth_pending_starts[note];
+        if ((synth_note_release_pending[note]) && (synth_note_active[note]) && (!synth_note_stealing[note]))
+        {
+            uint32_t now_us = time_us_32();
+            synth_release_voice(note, sample_index_from_time(now_us) + SYNTH_EVENT_DELAY, now_us);
+        }
+        if ((!ps->pending) || (synth_note_active[note])) continue;
+        uint32_t now_us = time_us_32();
+        uint32_t wait_us = now_us - ps->defer_us;
+        uint32_t sample_index = sample_index_from_time(now_us) + SYNTH_EVENT_DELAY;
+        if (wait_us > synth_steal_wait_us_max) synth_steal_wait_us_max = wait_us;
+        ps->pending = false;
+        if ((synth_start_note_val(ps->note_no, ps->velocity, note, sample_index, ps->time_us)) && (ps->released))
+            synth_release_voice(note, sample_index, now_us);
     }
+}
+
+/* A retriggered note or the oldest voice over the limit is stolen without waiting.
+   The new note starts in a free slot while the stolen voice fades, or if all the
+   slots are in use it is attached to a fading voice and started when that retires */
+void synth_start_note(uint8_t note_no, uint8_t velocity, uint32_t time_us)
+{
+    uint32_t start_us = time_us_32();
+    uint32_t sample_index = sample_index_from_time(time_us) + SYNTH_EVENT_DELAY;
+    uint32_t voice_limit = synth_voice_limit;
+    uint active_notes = 0;
+    int free_note = -1, stolen_note = -1;
+    synth_poll_pending_starts();
     for (int note=0;note<MAX_POLYPHONY;note++)
     {
-        if (!synth_note_active[note])
+        if ((synth_pending_starts[note].pending) && (synth_pending_starts[note].note_no == note_no))
+            synth_pending_starts[note].pending = false;
+        else if ((synth_note_active[note]) && (!synth_note_stealing[note]) && (synth_note_number[note] == note_no))
         {
-            synth_start_note_val(note_no, velocity, note);
-            return;
+            if (synth_steal_voice(note, sample_index))
+                stolen_note = note;
+        }
+    }
+    for (int note=0;note<MAX_POLYPHONY;note++)
+    {
+        if ((synth_note_active[note]) ? (!synth_note_stealing[note]) : synth_pending_starts[note].pending)
+            active_notes++;
+        else if ((free_note < 0) && (!synth_note_active[note]))
+            free_note = note;
+    }
+    if (active_notes >= voice_limit)
+    {
+        int oldest_note = -1;
+        for (int note=0;note<MAX_POLYPHONY;note++)
+        {
+            if ((synth_note_active[note]) && (!synth_note_stealing[note]) && 
+                ((oldest_note < 0) || (synth_note_count[note] < synth_note_count[oldest_note])))
+                oldest_note = note;
         }
+        if ((oldest_note < 0) || (!synth_steal_voice(oldest_note, sample_index))) return;
+        stolen_note = oldest_note;
     }
-    int oldest_note = 0;
-    uint32_t oldest_note_count = synth_note_count[0];
-    for (int note=1;note<MAX_POLYPHONY;note++)
+    if (free_note >= 0)
+        synth_start_note_val(note_no, velocity, free_note, sample_index, time_us);
+    else
     {
-        if (synth_note_count[note] < oldest_note_count)
+        if ((stolen_note < 0) || (synth_pending_starts[stolen_note].pending))
         {
-            oldest_note_count = synth_note_count[note];
-            oldest_note = note;
+            stolen_note = -1;
+            for (int note=0;note<MAX_POLYPHONY;note++)
+                if ((synth_note_active[note]) && (synth_note_stealing[note]) && (!synth_pending_starts[note].pending))
+                {
+                    stolen_note = note;
+                    break;
+                }
+            if (stolen_note < 0) return;
         }
+        synth_pending_start *ps = &synth_pending_starts[stolen_note];
+        ps->note_no = note_no;
+        ps->velocity = velocity;
+        ps->released = false;
+        ps->time_us = time_us;
+        ps->defer_us = start_us;
+        ps->pending = true;
+        synth_steals_deferred++;
+    }
+    if (stolen_note >= 0)
+    {
+        uint32_t steal_us = time_us_32() - start_us;
+        synth_steal_us_total += steal_us;
+        if (steal_us > synth_steal_us_max) synth_steal_us_max = steal_us;
     }
-    synth_stop_note_now(oldest_note);
-    synth_start_note_val(note_no, velocity, oldest_note);
 }
 
-void synth_stop_note(uint8_t note_no, uint8_t velocity)
+void synth_stop_note(uint8_t note_no, uint8_t velocity, uint32_t time_us)
 {
     for (int note=0;note<MAX_POLYPHONY;note++)
-        if ((synth_note_active[note]) && (synth_note_number[note] == note_no))
+    {
+        if ((synth_pending_starts[note].pending) && (synth_pending_starts[note].note_no == note_no))
+        {
+            synth_pending_starts[note].released = true;
+            return;
+        }
+        if ((synth_note_active[note]) && (!synth_note_stealing[note]) && (synth_note_number[note] == note_no))
         {
-            mutex_enter_blocking(&note_mutexes[note]);
-            synth_note_stopping_counter[note] = pc.pcs.fail_delay;
-            DMB();
-            synth_note_stopping[note] = true;
-            DMB();
-            mutex_exit(&note_mutexes[note]);
+            synth_release_voice(note, sample_index_from_time(time_us) + SYNTH_EVENT_DELAY, time_us);
             return;
         }
+    }
+}
+
+void synth_steal_reset_stats(void)
+{
+    synth_steals = 0;
+    synth_steals_deferred = 0;
+    synth_steal_us_total = 0;
+    synth_steal_us_max = 0;
+    synth_steal_wait_us_max = 0;
 }
 
 void synth_panic(void)
 {
     synth_pitch_bend_value = 0;
     for (int note=0;note<MAX_POLYPHONY;note++)
-        if (synth_note_active[note])
-        {
-            synth_note_stopping_counter[note] = pc.pcs.fail_delay;
-            DMB();
-            mutex_enter_blocking(&note_mutexes[note]);
-            synth_note_stopping[note] = true;
-            DMB();
-            mutex_exit(&note_mutexes[note]);
-        }
+    {
+        synth_pending_starts[note].pending = false;
+        synth_note_release_pending[note] = false;
+    }
+    /* like a reset, a panic is a flag rather than a queue entry */
+    synth_event_flush_write = synth_event_queue_write;
+    DMB();
+    synth_panic_pending = true;
 }
 
 void synth_initialize(void)
 {
     static bool is_mutex_initialized = false;
     
-    if (!is_mutex_initialized) mutex_init(&synth_mutex);
-    synth_current_note_count = 0;
-    synth_pitch_bend_value = 0;
-    for (int note=0;note<MAX_POLYPHONY;note++)
+    if (!is_mutex_initialized)
     {
-        synth_note_active[note] = false;
-        synth_note_stopping[note] = false;
-        synth_note_stopping_fast[note] = false;
-        synth_note_stopping_counter[note] = 0;
-        synth_note_number[note] = 0;
-        synth_note_velocity[note] = 0;
-        synth_note_count[note] = 0;
-        if (!is_mutex_initialized) mutex_init(&note_mutexes[note]);
+        mutex_init(&synth_mutex);
+        synth_event_queue_write = 0;
+        synth_event_queue_read = 0;
+        synth_latency_probe_write = 0;
+        synth_latency_probe_read = 0;
+        synth_reset_pending = false;
+        synth_panic_pending = false;
+        synth_event_flush_write = 0;
+        synth_event_queue_reset_stats();
+        synth_steal_reset_stats();
+        for (int note=0;note<MAX_POLYPHONY;note++)
+        {
+            synth_note_active[note] = false;
+            synth_note_stealing[note] = false;
+            synth_note_release_pending[note] = false;
+            synth_pending_starts[note].pending = false;
+            synth_note_sounding[note] = false;
+            synth_note_number[note] = 0;
+            synth_note_velocity[note] = 0;
+            synth_note_count[note] = 0;
+        }
     }
-    for (int unit_number=0;unit_number<MAX_SYNTH_UNITS;unit_number++) 
+    synth_current_note_count = 0;
+    synth_pitch_bend_value = 0;
+    for (int unit_number=0;unit_number<SYNTH_ALL_UNITS;unit_number++) 
         synth_unit_initialize(unit_number, SYNTH_TYPE_NONE);
     is_mutex_initialized = true;
 }
 
+static void synth_retire_note(int note)
+{
+    synth_note_sounding[note] = false;
+    DMB();
+    synth_note_active[note] = false;
+}
+
+/* the output side times the note from its arrival to when its first sample is played */
+static void synth_post_latency_probe(uint32_t sample_index, uint32_t time_us)
+{
+    uint32_t write = synth_latency_probe_write;
+    if ((write - synth_latency_probe_read) >= SYNTH_LATENCY_PROBE_LENGTH) return;
+    synth_latency_probe *lp = &synth_latency_probes[write & (SYNTH_LATENCY_PROBE_LENGTH-1)];
+    lp->sample_index = sample_index;
+    lp->time_us = time_us;
+    DMB();
+    synth_latency_probe_write = write + 1;
+}
+
+static inline void synth_refresh_start_st(synth_start_st *sst, uint note_no, uint velocity, uint note)
+{
+    sst->note_no = note_no;
+    sst->vco = tunings[pc.pcs.tuning < PITCH_TUNINGS_NUMBER ? pc.pcs.tuning : 0][note_no & (MIDI_NOTES-1)];
+    sst->velocity = velocity;
+    sst->note = note;
+}
+
+/* refreshes the units of a voice whose controlled parameters changed */
+static void synth_refresh_voice(int note, uint32_t changed)
+{
+    const synth_program *prog = &synth_note_program[note];
+    synth_start_st sst;
+    synth_refresh_start_st(&sst, synth_note_number[note], synth_note_velocity[note], note);
+    for (uint op=0;op<prog->ops;op++)
+    {
+        sst.unit = prog->op[op].fused_unit;
+        for (;;)
+        {
+            synth_parm *sp = synth_parm_entry(sst.unit);
+            if ((changed & (1u << sst.unit)) && (snr[(int)sp->stn.sut] != NULL))
+            {
+                snr[(int)sp->stn.sut](sp, &synth_units[note][sst.unit], &sst);
+                synth_refresh_units++;
+            }
+            if (sst.unit == prog->op[op].unit) break;
+            sst.unit = prog->op[op].unit;
+        }
+    }
+}
+
+static void synth_apply_event(const synth_event *se, uint32_t sample_index)
+{
+    int note = se->note;
+    switch (se->type)
+    {
+        case SYNTH_EVENT_NOTE_ON:
+            synth_note_stopping[note] = false;
+            synth_note_stopping_fast[note] = false;
+            synth_note_stopping_counter[note] = 0;
+            synth_note_silent_samples[note] = 0;
+            /* a control read on core1 after the voice was set up is applied to it here */
+            if (synth_note_control_generation[note] != synth_control_generation)
+                synth_refresh_voice(note, 0xFFFFFFFFu);
+            synth_note_sounding[note] = true;
+            synth_post_latency_probe(sample_index, se->time_us);
+            break;
+        case SYNTH_EVENT_NOTE_OFF:
+            if ((synth_note_sounding[note]) && (!synth_note_stopping_fast[note]))
+            {
+                synth_note_stopping_counter[note] = se->value;
+                synth_note_stopping[note] = true;
+            }
+            break;
+        case SYNTH_EVENT_NOTE_STEAL:
+            if (synth_note_sounding[note])
+            {
+                synth_note_stopping_counter[note] = SYNTH_STOPPING_COUNTER;
+                synth_note_stopping_fast[note] = true;
+            }
+            break;
+    }
+}
+
+/* the flag is cleared before the reset or panic is applied, so one posted meanwhile
+   is applied again at the next block rather than lost.  the note events posted
+   before it are flushed rather than left to fire after it: a voice whose note on
+   is flushed never sounds and is retired, a steal still fades its voice out, and
+   a note off is not needed any more.  returns the new queue read index */
+static uint32_t synth_apply_pending(uint32_t read)
+{
+    bool reset = synth_reset_pending;
+    bool panic = synth_panic_pending;
+    if (!(reset || panic)) return read;
+    if (reset) synth_reset_pending = false;
+    if (panic) synth_panic_pending = false;
+    DMB();
+    uint32_t flush = synth_event_flush_write;
+    while (((int32_t)(flush - read)) > 0)
+    {
+        synth_event *se = &synth_event_queue[read & (SYNTH_EVENT_QUEUE_LENGTH-1)];
+        if (se->type == SYNTH_EVENT_NOTE_ON)
+            synth_retire_note(se->note);
+        else if (se->type == SYNTH_EVENT_NOTE_STEAL)
+            synth_apply_event(se, 0);
+        read++;
+    }
+    if (reset)
+    {
+        for (int note=0;note<MAX_POLYPHONY;note++)
+            if (synth_note_sounding[note])
+            {
+                memset(synth_units[note],'\000',sizeof(synth_unit)*MAX_SYNTH_UNITS);
+                synth_retire_note(note);
+            }
+    }
+    if (panic)
+    {
+        for (int note=0;note<MAX_POLYPHONY;note++)
+            if ((synth_note_sounding[note]) && (!synth_note_stopping_fast[note]))
+            {
+                synth_note_stopping_counter[note] = pc.pcs.fail_delay;
+                synth_note_stopping[note] = true;
+            }
+    }
+    return read;
+}
+
+static uint synth_apply_events(uint32_t sample_index, uint ofs)
+{
+    uint32_t read = synth_event_queue_read;
+    uint32_t write = synth_event_queue_write;
+    uint next = SYNTH_BLOCK_SIZE;
+    if (ofs == 0)
+    {
+        if ((write - read) > synth_event_queue_max_depth)
+            synth_event_queue_max_depth = write - read;
+    }
+    DMB();
+    read = synth_apply_pending(read);
+    /* the flush may have passed the write index read above */
+    if (((int32_t)(write - read)) < 0) write = read;
+    while (read != write)
+    {
+        synth_event *se = &synth_event_queue[read & (SYNTH_EVENT_QUEUE_LENGTH-1)];
+        int32_t due = (int32_t)(se->sample_index - sample_index);
+        if (due > ((int32_t)ofs))
+        {
+            if (due < SYNTH_BLOCK_SIZE) next = due;
+            break;
+        }
+        if (due < 0) synth_event_late++;
+        synth_apply_event(se, sample_index + ofs);
+        read++;
+    }
+    DMB();
+    synth_event_queue_read = read;
+    return next;
+}
+
+/* Within a pass over a voice, bit b of the silent mask is set when result buffer b
+   of the voice is all zero.  Buffer 0 always is, and a VCA or ADSR is checked after
+   it runs.  A unit whose output is zero whenever the inputs it passes on are zero
+   is skipped while they are, and its output marked silent in turn.  The inputs are
+   the buffer numbers the op was compiled with, a global one is never silent. */
+static inline bool synth_input_silent(uint b, uint32_t silent)
+{
+    return ((b & (SYNTH_INPUT_GLOBAL | SYNTH_INPUT_BUS)) == 0) && ((silent & (1u << b)) != 0);
+}
+
+static bool synth_unit_silenced(const synth_parm *sp, const synth_unit *su, const synth_program_op *pop, uint32_t silent)
+{
+    const uint8_t *in = pop->input;
+    switch (sp->stn.sut)
+    {
+        case SYNTH_TYPE_NONE:
+        case SYNTH_TYPE_VCA:     return synth_input_silent(in[SYNTH_INPUT_SOURCE], silent);
+        case SYNTH_TYPE_RING:    return synth_input_silent(in[SYNTH_INPUT_SOURCE], silent) ||
+                                        synth_input_silent(in[SYNTH_INPUT_CONTROL], silent);
+        case SYNTH_TYPE_MIXER:   return synth_input_silent(in[SYNTH_INPUT_SOURCE], silent) &&
+                                        synth_input_silent(in[SYNTH_INPUT_SOURCE2], silent);
+        case SYNTH_TYPE_LOWPASS: return synth_input_silent(in[SYNTH_INPUT_SOURCE], silent) &&
+                                        ((su->stlp.stage_y[0] | su->stlp.stage_y[1] | su->stlp.stage_y[2] | su->stlp.stage_y[3]) == 0);
+        default:                 return false;
+    }
+}
+
+static inline uint32_t synth_output_silence(const synth_parm *sp, const int32_t *out, uint n, uint unit_no, uint32_t silent)
+{
+    if ((sp->stn.sut != SYNTH_TYPE_VCA) && (sp->stn.sut != SYNTH_TYPE_ADSR)) return silent;
+    for (uint i=0;i<n;i++)
+        if (out[i] != 0) return silent;
+    return silent | (1u << (unit_no+1));
+}
+
 #ifdef PLACE_IN_RAM
-static int32_t __no_inline_not_in_flash_func(synth_local_process_all_units)(void)
+static inline void __not_in_flash_func(synth_process_op)(const synth_program_op *pop, int note, int32_t (*sur)[SYNTH_BLOCK_SIZE], uint n, uint32_t *silent)
 #else
-int32_t synth_local_process_all_units(void)
+static inline void synth_process_op(const synth_program_op *pop, int note, int32_t (*sur)[SYNTH_BLOCK_SIZE], uint n, uint32_t *silent)
 #endif
 {
-    int32_t total_sample = 0;
-    for (int note=0;note<MAX_POLYPHONY;note++)
+    uint unit_no = pop->unit;
+    synth_parm *sp = &synth_parms[unit_no];
+    synth_unit *su = &synth_units[note][unit_no];
+    if ((pop->kernel == SYNTH_KERNEL_UNIT) && (synth_unit_silenced(sp, su, pop, *silent)))
+    {
+        memset(sur[unit_no+1], '\000', sizeof(int32_t)*n);
+        *silent |= (1u << (unit_no+1));
+        synth_silence_skipped++;
+        return;
+    }
+    if (pop->kernel != SYNTH_KERNEL_UNIT)
+    {
+        if (synth_fusion_mode == SYNTH_FUSION_CHECK)
+            synth_process_fused_checked(pop, note, sur, n);
+        else
+            synth_process_fused(pop, note, sur, n);
+    }
+    else if (sp->stn.sut == 0)
+        memcpy(sur[unit_no+1], su->stn.sample_ptr, sizeof(int32_t)*n);
+    else
+        synth_process(sp, su, sur[unit_no+1], n);
+    *silent = synth_output_silence(sp, sur[unit_no+1], n, unit_no, *silent);
+}
+
+/* runs the program of one voice, an op at a time */
+#ifdef PLACE_IN_RAM
+static void __no_inline_not_in_flash_func(synth_process_voice)(int note, uint n)
+#else
+static void synth_process_voice(int note, uint n)
+#endif
+{
+    int32_t (*sur)[SYNTH_BLOCK_SIZE] = synth_unit_result[note];
+    const synth_program *prog = &synth_note_program[note];
+    uint32_t silent = 1;
+    for (uint op=0;op<prog->ops;op++)
+    {
+#ifdef PROFILE_UNITS
+        uint32_t start_cycles = profile_cycles();
+#endif
+        synth_process_op(&prog->op[op], note, sur, n, &silent);
+#ifdef PROFILE_UNITS
+        uint32_t cycles = profile_elapsed(start_cycles);
+        uint unit_no = prog->op[op].unit;
+        profile_add(&synth_profile_unit[unit_no], cycles, n);
+        profile_add(&synth_profile_type[synth_parms[unit_no].stn.sut], cycles, n);
+#endif
+    }
+}
+
+/* a released voice whose output has stayed under the silence level for the
+   silence window is retired without waiting for its stopping counter */
+static void synth_track_silence(int note, const int32_t *sample, uint samples)
+{
+    int32_t peak = 0;
+    for (uint i=0;i<samples;i++)
+    {
+        int32_t a = sample[i] < 0 ? -sample[i] : sample[i];
+        if (a > peak) peak = a;
+    }
+    if (peak >= ((int32_t)synth_silence_level))
+    {
+        synth_note_silent_samples[note] = 0;
+        return;
+    }
+    synth_note_silent_samples[note] += samples;
+    if ((synth_note_sounding[note]) && (synth_note_stopping[note] || synth_note_stopping_fast[note]) && (synth_note_silent_samples[note] >= synth_silence_window))
+    {
+        synth_note_sounding[note] = false;
+        synth_silence_retired++;
+    }
+}
+
+static void synth_mix_voice(int note, int32_t *total_sample)
+{
+    int32_t *sample = synth_unit_result[note][synth_note_program[note].output];
+    uint samples = synth_note_block_samples[note];
+    if (synth_silence_window != 0)
+        synth_track_silence(note, sample, samples);
+    if (synth_note_stopping_fast[note])
     {
-        if ((synth_note_active[note]) && (mutex_try_enter(&note_mutexes[note],NULL)))
+        for (uint i=0;i<samples;i++)
         {
-            int32_t *sur = synth_unit_result[note];
-            sur[0] = 0;
-            synth_parm *sp = synth_parms;
-            synth_unit *su = synth_units[note];
-            for (int unit_no=0;unit_no<MAX_SYNTH_UNITS;unit_no++)
-            {
-                sur[unit_no+1] = (sp->stn.sut == 0) ? sur[sp->stn.source_unit-1] : synth_process(sp, su);
-                sp++;
-                su++;
-            }
-            int32_t sample = sur[MAX_SYNTH_UNITS];
-            if (synth_note_stopping_fast[note])
+            if (synth_note_stopping_counter[note] > 0)
             {
-               if (synth_note_stopping_counter[note] > 0)
-               {
-                    synth_note_stopping_counter[note]--;
-                    total_sample += (sample * ((int32_t)synth_note_stopping_counter[note])) / SYNTH_STOPPING_COUNTER;
-               } else
-                    synth_note_active[note] = false;
+                synth_note_stopping_counter[note]--;
+                total_sample[i] += (sample[i] * ((int32_t)synth_note_stopping_counter[note])) / SYNTH_STOPPING_COUNTER;
             } else
             {
-                total_sample += sample;
-                if (synth_note_stopping[note])
-                {
-                    if (synth_note_stopping_counter[note] > 0)
-                        synth_note_stopping_counter[note]--;
-                    else
-                        synth_note_active[note] = false;
-                }
+                synth_note_sounding[note] = false;
+                break;
+            }
+        }
+    } else
+    {
+        if (synth_note_stopping[note])
+        {
+            if (synth_note_stopping_counter[note] >= samples)
+                synth_note_stopping_counter[note] -= samples;
+            else
+            {
+                samples = synth_note_stopping_counter[note]+1;
+                synth_note_stopping_counter[note] = 0;
+                synth_note_sounding[note] = false;
             }
-            mutex_exit(&note_mutexes[note]);
+        }
+        for (uint i=0;i<samples;i++)
+            total_sample[i] += sample[i];
+    }
+    if (!synth_note_sounding[note])
+        synth_retire_note(note);
+}
+
+#ifdef PLACE_IN_RAM
+static uint __no_inline_not_in_flash_func(synth_local_process_all_units)(int32_t *total_sample, uint n)
+#else
+uint synth_local_process_all_units(int32_t *total_sample, uint n)
+#endif
+{
+    uint voices = 0;
+    for (int note=0;note<MAX_POLYPHONY;note++)
+    {
+        if (!synth_note_sounding[note]) continue;
+        voices++;
+        synth_note_block_samples[note] = n;
+        synth_process_voice(note, n);
+        /* a voice whose envelope ended while rendering is no longer sounding, but its
+           last samples are still mixed and it is retired there */
+        synth_mix_voice(note, total_sample);
+    }
+    return voices;
+}
+
+void synth_set_silence(uint32_t level, uint32_t window)
+{
+    synth_silence_level = level;
+    synth_silence_window = window;
+}
+
+/* Controls are read here on core1 only, at SYNTH_CONTROL_REFRESH_RATE so held
+   notes follow the pots.  Only the units whose controlled parameters changed have
+   the values derived from them refreshed, in the sounding voices and the shared
+   units.  The change also marks the voice template as out of date, and a voice
+   set up on core0 from an older template is refreshed when its note on arrives. */
+static void synth_refresh_controls(void)
+{
+    uint32_t changed = 0;
+    if ((++synth_refresh_countdown) < synth_refresh_blocks) return;
+    synth_refresh_countdown = 0;
+    for (uint unit_no=0;unit_no<SYNTH_ALL_UNITS;unit_no++)
+    {
+        synth_parm *sp = synth_parm_entry(unit_no);
+        if ((snc[(int)sp->stn.sut] != NULL) && (snc[(int)sp->stn.sut](sp)))
+            changed |= (1u << unit_no);
+    }
+    if (changed == 0) return;
+    synth_refresh_passes++;
+    DMB();
+    synth_control_generation++;
+    synth_start_st sst;
+    for (int note=0;note<MAX_POLYPHONY;note++)
+        if (synth_note_sounding[note])
+            synth_refresh_voice(note, changed);
+    synth_refresh_start_st(&sst, SYNTH_GLOBAL_NOTE, 127, 0);
+    for (uint k=0;k<synth_running_globals.units;k++)
+    {
+        sst.unit = synth_running_globals.unit[k];
+        synth_parm *sp = synth_parm_entry(sst.unit);
+        if ((changed & (1u << sst.unit)) && (snr[(int)sp->stn.sut] != NULL))
+            snr[(int)sp->stn.sut](sp, &synth_global_units[sst.unit], &sst);
+    }
+    for (uint k=0;k<synth_running_bus.units;k++)
+    {
+        sst.unit = MAX_SYNTH_UNITS + synth_running_bus.unit[k];
+        synth_parm *sp = synth_parm_entry(sst.unit);
+        if ((changed & (1u << sst.unit)) && (snr[(int)sp->stn.sut] != NULL))
+            snr[(int)sp->stn.sut](sp, &synth_bus_units[synth_running_bus.unit[k]], &sst);
+    }
+}
+
+/* Global units are started on core1 when it finds a newly compiled program.
+   When only the patch generation has moved on, the patch derived fields are
+   prepared again so the units keep their phase.
+   The programs are copied while core0 may be compiling, so the copy is only
+   used when the program id is even and unchanged across it.  Otherwise the
+   running programs are kept and the copy is tried again at the next block.  If
+   a compile starts while the units are started, they are started again then */
+static void synth_update_globals(void)
+{
+    uint32_t program_id = synth_compiled_program_id;
+    uint32_t generation = synth_patch_generation;
+    if ((program_id != synth_running_globals_id) && (!(program_id & 1)))
+    {
+        DMB();
+        synth_global_program globals = synth_compiled_globals;
+        synth_bus_program bus = synth_compiled_bus;
+        DMB();
+        if (synth_compiled_program_id != program_id) return;
+        synth_running_globals = globals;
+        synth_running_bus = bus;
+        synth_start_st sst;
+        sst.note_no = SYNTH_GLOBAL_NOTE;
+        sst.vco = tunings[pc.pcs.tuning < PITCH_TUNINGS_NUMBER ? pc.pcs.tuning : 0][SYNTH_GLOBAL_NOTE];
+        sst.velocity = 127;
+        sst.note = 0;
+        for (uint k=0;k<synth_running_globals.units;k++)
+        {
+            sst.unit = synth_running_globals.unit[k];
+            synth_parm *sp = synth_parm_entry(sst.unit);
+            synth_unit *su = &synth_global_units[sst.unit];
+            synth_unit_struct_zero(su);
+            if (snp[(int)sp->stn.sut] != NULL)
+                snp[(int)sp->stn.sut](sp, su);
+            sns[(int)sp->stn.sut](sp, su, &sst);
+        }
+        for (uint k=0;k<synth_running_bus.units;k++)
+        {
+            sst.unit = MAX_SYNTH_UNITS + synth_running_bus.unit[k];
+            synth_parm *sp = synth_parm_entry(sst.unit);
+            synth_unit *su = &synth_bus_units[synth_running_bus.unit[k]];
+            synth_unit_struct_zero(su);
+            if (snp[(int)sp->stn.sut] != NULL)
+                snp[(int)sp->stn.sut](sp, su);
+            sns[(int)sp->stn.sut](sp, su, &sst);
+        }
+        DMB();
+        if (synth_compiled_program_id == program_id)
+            synth_running_globals_id = program_id;
+    } else if (generation != synth_running_globals_generation)
+    {
+        for (uint k=0;k<synth_running_globals.units;k++)
+        {
+            uint unit_no = synth_running_globals.unit[k];
+            synth_parm *sp = synth_parm_entry(unit_no);
+            if (snp[(int)sp->stn.sut] != NULL)
+                snp[(int)sp->stn.sut](sp, &synth_global_units[unit_no]);
+        }
+        for (uint k=0;k<synth_running_bus.units;k++)
+        {
+            uint bus_no = synth_running_bus.unit[k];
+            synth_parm *sp = synth_parm_entry(MAX_SYNTH_UNITS + bus_no);
+            if (snp[(int)sp->stn.sut] != NULL)
+                snp[(int)sp->stn.sut](sp, &synth_bus_units[bus_no]);
         }
     }
-    return (total_sample / DIVIDER_POLYPHONY);
+    synth_running_globals_generation = generation;
 }
 
+#ifdef PLACE_IN_RAM
+static void __no_inline_not_in_flash_func(synth_process_globals)(uint n)
+#else
+static void synth_process_globals(uint n)
+#endif
+{
+    for (uint k=0;k<synth_running_globals.units;k++)
+    {
+        uint unit_no = synth_running_globals.unit[k];
+        synth_parm *sp = &synth_parms[unit_no];
+#ifdef PROFILE_UNITS
+        uint32_t start_cycles = profile_cycles();
+#endif
+        synth_process(sp, &synth_global_units[unit_no], synth_global_result[unit_no], n);
+#ifdef PROFILE_UNITS
+        uint32_t cycles = profile_elapsed(start_cycles);
+        profile_add(&synth_profile_unit[unit_no], cycles, n);
+        profile_add(&synth_profile_type[sp->stn.sut], cycles, n);
+#endif
+    }
+}
+
+/* the bus units run once on the mixed voices, each taking the output of the one before */
+#ifdef PLACE_IN_RAM
+static void __no_inline_not_in_flash_func(synth_process_bus)(int32_t *samples, uint n)
+#else
+static void synth_process_bus(int32_t *samples, uint n)
+#endif
+{
+    uint output = 0;
+    memcpy(synth_bus_result[0], samples, sizeof(int32_t)*n);
+    for (uint k=0;k<synth_running_bus.units;k++)
+    {
+        uint bus_no = synth_running_bus.unit[k];
+        synth_parm *sp = &synth_parms[MAX_SYNTH_UNITS + bus_no];
+#ifdef PROFILE_UNITS
+        uint32_t start_cycles = profile_cycles();
+#endif
+        synth_process(sp, &synth_bus_units[bus_no], synth_bus_result[bus_no+1], n);
+#ifdef PROFILE_UNITS
+        uint32_t cycles = profile_elapsed(start_cycles);
+        profile_add(&synth_profile_unit[MAX_SYNTH_UNITS + bus_no], cycles, n);
+        profile_add(&synth_profile_type[sp->stn.sut], cycles, n);
+#endif
+        output = bus_no+1;
+    }
+    memcpy(samples, synth_bus_result[output], sizeof(int32_t)*n);
+}
+
+/* the governor sets the voice limit from the measured render time per voice, so the
+   voices fit in what the rest of the block leaves of the target share of the block
+   period.  only the voice render is timed for the cost per voice; the events, global
+   units and bus make up the fixed cost.  if a block runs over the shed level anyway,
+   the oldest voices over the limit are faded out quickly */
+static void synth_governor_shed(uint32_t limit)
+{
+    for (;;)
+    {
+        int oldest_note = -1;
+        uint voices = 0;
+        for (int note=0;note<MAX_POLYPHONY;note++)
+        {
+            if ((!synth_note_sounding[note]) || (synth_note_stopping_fast[note])) continue;
+            voices++;
+            if ((oldest_note < 0) || (synth_note_count[note] < synth_note_count[oldest_note]))
+                oldest_note = note;
+        }
+        if (voices <= limit) return;
+        synth_note_stopping_counter[oldest_note] = SYNTH_STOPPING_COUNTER;
+        synth_note_stopping_fast[oldest_note] = true;
+        synth_governor_sheds++;
+    }
+}
+
+static void synth_governor_update(uint32_t busy_us, uint32_t voice_us, uint32_t voice_samples)
+{
+    if (synth_block_budget_us == 0) return;
+    uint32_t load = (busy_us << 16) / synth_block_budget_us;
+    synth_load = load;
+    if (load > synth_load_max) synth_load_max = load;
+    uint32_t voice_load = (voice_us << 16) / synth_block_budget_us;
+    if (voice_load > load) voice_load = load;
+    if (synth_fixed_cost == 0)
+        synth_fixed_cost = load - voice_load;
+    else
+        synth_fixed_cost += ((int32_t)(load - voice_load - synth_fixed_cost)) / SYNTH_GOVERNOR_SMOOTHING;
+    if (voice_samples > 0)
+    {
+        uint32_t cost = (uint32_t)((((uint64_t)voice_load) * SYNTH_BLOCK_SIZE) / voice_samples);
+        if (cost == 0) cost = 1;
+        if (synth_voice_cost == 0)
+            synth_voice_cost = cost;
+        else
+            synth_voice_cost += ((int32_t)(cost - synth_voice_cost)) / SYNTH_GOVERNOR_SMOOTHING;
+    }
+    if (synth_voice_limit_fixed != 0) return;
+    uint32_t limit = SYNTH_POLYPHONY_DEFAULT;
+    if (synth_voice_cost != 0)
+    {
+        uint32_t target = (SYNTH_GOVERNOR_TARGET << 16) / 100;
+        limit = (target > synth_fixed_cost) ? (target - synth_fixed_cost) / synth_voice_cost : 0;
+        if (limit < SYNTH_POLYPHONY_MIN) limit = SYNTH_POLYPHONY_MIN;
+        if (limit > MAX_POLYPHONY) limit = MAX_POLYPHONY;
+    }
+    synth_voice_limit = limit;
+    if (load > ((SYNTH_GOVERNOR_SHED << 16) / 100))
+        synth_governor_shed(limit);
+}
+
+void synth_set_voice_limit(uint32_t voices)
+{
+    if (voices > MAX_POLYPHONY) voices = MAX_POLYPHONY;
+    synth_voice_limit_fixed = voices;
+    synth_voice_limit = (voices != 0) ? voices : SYNTH_POLYPHONY_DEFAULT;
+}
+
+void synth_governor_reset_stats(void)
+{
+    synth_load_max = 0;
+    synth_governor_sheds = 0;
+    synth_refresh_passes = 0;
+    synth_refresh_units = 0;
+    synth_silence_retired = 0;
+    synth_silence_skipped = 0;
+}
+
+void synth_profile_reset(void)
+{
+#ifdef PROFILE_UNITS
+    memset(&synth_profile_note_start, '\000', sizeof(synth_profile_note_start));
+    synth_profile_reset_pending = true;
+#endif
+}
 
-int32_t synth_process_all_units(void)
+void synth_process_all_units(int32_t *samples, uint32_t sample_index)
 {
-    return synth_local_process_all_units();
+    uint ofs = 0;
+    uint32_t voice_us = 0, voice_samples = 0;
+    uint32_t start_us = time_us_32();
+#ifdef PROFILE_UNITS
+    if (synth_profile_reset_pending)
+    {
+        memset(synth_profile_unit, '\000', sizeof(synth_profile_unit));
+        memset(synth_profile_type, '\000', sizeof(synth_profile_type));
+        memset(&synth_profile_total, '\000', sizeof(synth_profile_total));
+        synth_profile_reset_pending = false;
+    }
+    uint32_t start_cycles = profile_cycles();
+#endif
+    for (uint i=0;i<SYNTH_BLOCK_SIZE;i++)
+        samples[i] = 0;
+    synth_update_globals();
+    synth_refresh_controls();
+    while (ofs < SYNTH_BLOCK_SIZE)
+    {
+        uint next = synth_apply_events(sample_index, ofs);
+        synth_process_globals(next - ofs);
+        uint32_t voice_start_us = time_us_32();
+        uint voices = synth_local_process_all_units(samples + ofs, next - ofs);
+        voice_us += time_us_32() - voice_start_us;
+        voice_samples += voices * (next - ofs);
+        for (uint i=ofs;i<next;i++)
+            samples[i] /= DIVIDER_POLYPHONY;
+        if (synth_running_bus.units > 0)
+            synth_process_bus(samples + ofs, next - ofs);
+        ofs = next;
+    }
+    synth_governor_update(time_us_32() - start_us, voice_us, voice_samples);
+#ifdef PROFILE_UNITS
+    profile_add(&synth_profile_total, profile_elapsed(start_cycles), SYNTH_BLOCK_SIZE);
+#endif
 }
 
 synth_unit_type synth_unit_get_type(uint synth_unit_number)
 {
-    if (synth_unit_number >= MAX_SYNTH_UNITS) return SYNTH_TYPE_MAX_ENTRY;
+    if (synth_unit_number >= SYNTH_ALL_UNITS) return SYNTH_TYPE_MAX_ENTRY;
     synth_parm *sp = synth_parm_entry(synth_unit_number);
     return sp->stn.sut;
 }
 
 const synth_parm_configuration_entry *synth_unit_get_configuration_entry(uint synth_unit_number, uint num)
 {
-    if (synth_unit_number >= MAX_SYNTH_UNITS) return NULL;
+    if (synth_unit_number >= SYNTH_ALL_UNITS) return NULL;
     synth_parm *sp = synth_parm_entry(synth_unit_number);
     const synth_parm_configuration_entry *spce_l = spce[sp->stn.sut];
     while (spce_l->desc != NULL)
@@ -1021,7 +2743,7 @@ const synth_parm_configuration_entry *synth_unit_get_configuration_entry(uint sy
 
 bool synth_unit_set_value(uint synth_unit_number, const char *desc, uint32_t value)
 {
-    if (synth_unit_number >= MAX_SYNTH_UNITS) return NULL;
+    if (synth_unit_number >= SYNTH_ALL_UNITS) return NULL;
     synth_parm *sp = synth_parm_entry(synth_unit_number);
     const synth_parm_configuration_entry *spce_l = spce[sp->stn.sut];
     while (spce_l->desc != NULL)
@@ -1031,6 +2753,7 @@ bool synth_unit_set_value(uint synth_unit_number, const char *desc, uint32_t val
            if ((value >= spce_l->minval) && (value <= spce_l->maxval))
            {
                 synth_set_value_prec((void *)(((uint8_t *)synth_parm_entry(synth_unit_number)) + spce_l->offset), spce_l->size, value); 
+                synth_compile_program();
                 return true;
            } else return false;
             
@@ -1042,7 +2765,7 @@ bool synth_unit_set_value(uint synth_unit_number, const char *desc, uint32_t val
 
 bool synth_unit_get_value(uint synth_unit_number, const char *desc, uint32_t *value)
 {
-    if (synth_unit_number >= MAX_SYNTH_UNITS) return NULL;
+    if (synth_unit_number >= SYNTH_ALL_UNITS) return NULL;
     synth_parm *sp = synth_parm_entry(synth_unit_number);
     const synth_parm_configuration_entry *spce_l = spce[sp->stn.sut];
     while (spce_l->desc != NULL)
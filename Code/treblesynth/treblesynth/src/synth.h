@@ -36,13 +36,64 @@ extern "C"
 #define MIDI_FREQUENCY_0 8.17579891564f
 #define MIDI_NOTES 128
 
-#define MAX_POLYPHONY 6
+#define MAX_POLYPHONY 12
+#define SYNTH_POLYPHONY_DEFAULT 6
+#define SYNTH_POLYPHONY_MIN 1
 #define DIVIDER_POLYPHONY 4
 #define MAX_SYNTH_UNITS 10
+#define SYNTH_BUS_UNITS 2
+#define SYNTH_ALL_UNITS (MAX_SYNTH_UNITS+SYNTH_BUS_UNITS)
 #define SYNTH_OSCILLATOR_PRECISION 256
 #define SYNTH_STOPPING_COUNTER 256
 #define SYNTH_PERIOD_PRECISION 256
 #define SYNTH_PARM_PAD_LENGTH 128
+#define SYNTH_EVENT_QUEUE_LENGTH 32
+#define SYNTH_LATENCY_PROBE_LENGTH 8
+
+#ifndef SYNTH_BLOCK_SIZE
+#define SYNTH_BLOCK_SIZE 16
+#endif
+
+/* percent of the block period the voices are allowed, and the load at which voices are shed */
+#define SYNTH_GOVERNOR_TARGET 75
+#define SYNTH_GOVERNOR_SHED 90
+#define SYNTH_GOVERNOR_SMOOTHING 8
+
+#ifndef SYNTH_EVENT_DELAY
+#define SYNTH_EVENT_DELAY (SYNTH_BLOCK_SIZE*4+64)
+#endif
+
+#if (SYNTH_BLOCK_SIZE != 8) && (SYNTH_BLOCK_SIZE != 16) && (SYNTH_BLOCK_SIZE != 32)
+#error SYNTH_BLOCK_SIZE must be 8, 16, or 32
+#endif
+
+/* samples between evaluations of units running at control rate */
+#ifndef SYNTH_CONTROL_PERIOD
+#define SYNTH_CONTROL_PERIOD 16
+#endif
+
+#if (SYNTH_CONTROL_PERIOD < 2) || (SYNTH_CONTROL_PERIOD > 64) || ((SYNTH_CONTROL_PERIOD & (SYNTH_CONTROL_PERIOD-1)) != 0)
+#error SYNTH_CONTROL_PERIOD must be a power of two from 2 to 64
+#endif
+
+#define SYNTH_CONTROL_RAMP_BITS 12
+
+/* a released voice under this output level for this many samples is retired */
+#ifndef SYNTH_SILENCE_LEVEL
+#define SYNTH_SILENCE_LEVEL 32
+#endif
+#ifndef SYNTH_SILENCE_WINDOW
+#define SYNTH_SILENCE_WINDOW 256
+#endif
+
+/* rate in Hz at which held notes follow the controls */
+#ifndef SYNTH_CONTROL_REFRESH_RATE
+#define SYNTH_CONTROL_REFRESH_RATE 1000
+#endif
+
+#if SYNTH_ALL_UNITS > 32
+#error the control refresh keeps the changed units in a 32 bit mask
+#endif
 
 typedef enum 
 {
@@ -85,12 +136,14 @@ typedef struct
     uint32_t control_control_gain;
     uint32_t pitch_bend_gain;
     uint32_t detune;
+    uint32_t interpolate;
 } synth_parm_vco;
 
 typedef struct
 {
     uint32_t counter;
     uint32_t counter_inc;
+    uint32_t counter_fraction;
     int32_t  counter_semitone_control_gain;
     int32_t  counter_semitone_pitch_bend_gain;
     int32_t  *control_ptr;
@@ -112,19 +165,36 @@ typedef struct
     uint32_t control_decay;
     uint32_t control_release;
     uint32_t output_type;
+    uint32_t control_rate;
+    uint32_t curve;
 } synth_parm_adsr;
 
 typedef struct
 {
     int32_t  *sample_ptr;
     uint32_t phase;
-    uint32_t counter;
+    uint32_t remaining;
+    uint32_t level;
+    int32_t  delta;
+    uint32_t curved;
+    uint32_t curve_phase;
+    uint32_t curve_inc;
+    uint32_t start;
+    int32_t  span;
     uint32_t max_amp_level;
     uint32_t sustain_amp_level;
-    uint32_t rise_slope;
-    uint32_t decay_slope;
-    uint32_t release_slope;
+    uint32_t attack;
+    uint32_t decay;
+    uint32_t release;
+    uint32_t attack_inc;
+    uint32_t decay_inc;
+    uint32_t release_inc;
+    uint32_t curve;
     uint32_t note;
+    int32_t  ramp_level;
+    int32_t  ramp_inc;
+    uint32_t ramp_left;
+    uint32_t end_in;
 } synth_type_adsr;    
 
 typedef struct
@@ -162,6 +232,8 @@ typedef struct
     uint32_t bend_gain;
     uint32_t control_frequency;
     uint32_t control_amplitude;
+    uint32_t control_rate;
+    uint32_t global;
 } synth_parm_osc;
 
 typedef struct
@@ -172,6 +244,9 @@ typedef struct
     int32_t  counter_semitone_bend_gain;
     int32_t  *control_ptr;
     const int16_t *wave;
+    int32_t  ramp_level;
+    int32_t  ramp_inc;
+    uint32_t ramp_left;
 } synth_type_osc;    
 
 typedef struct
@@ -282,12 +357,14 @@ typedef struct
     uint32_t control_amplitude;
     uint32_t control_control_gain;
     uint32_t pitch_bend_gain;
+    uint32_t global;
 } synth_parm_noise;
 
 typedef struct
 {
     uint32_t counter;
     uint32_t counter_inc;
+    uint32_t counter_fraction;
     uint32_t last_counter;
     uint32_t congruential_generator;
     int32_t  sample, sample2;
@@ -333,17 +410,126 @@ typedef struct
     uint32_t vco;
     uint32_t velocity;
     uint32_t note;
+    uint32_t unit;
 } synth_start_st;
 
-typedef int32_t (synth_type_process)(synth_parm *sp, synth_unit *su);
+#define SYNTH_INPUT_SOURCE 0
+#define SYNTH_INPUT_CONTROL 1
+#define SYNTH_INPUT_SOURCE2 2
+#define SYNTH_INPUTS_NUMBER 3
+
+/* an input buffer number with this bit set is the shared result of a global unit,
+   and with this one a buffer of the bus after the voices are mixed */
+#define SYNTH_INPUT_GLOBAL 0x80
+#define SYNTH_INPUT_BUS 0x40
+
+/* global units that follow the note use the pitch of this note */
+#define SYNTH_GLOBAL_NOTE 60
+
+typedef enum
+{
+    SYNTH_KERNEL_UNIT = 0,
+    SYNTH_KERNEL_VCO_ADSR,
+    SYNTH_KERNEL_OSC_VCO
+} synth_kernel_type;
+
+typedef enum
+{
+    SYNTH_FUSION_OFF = 0,
+    SYNTH_FUSION_ON,
+    SYNTH_FUSION_CHECK
+} synth_fusion_mode_type;
+
+/* the units evaluated once for all the voices, in execution order */
+typedef struct
+{
+    uint8_t  units;
+    uint8_t  unit[MAX_SYNTH_UNITS];
+} synth_global_program;
+
+/* the bus units in use, each reading the output of the one before, the first the voice mix */
+typedef struct
+{
+    uint8_t  units;
+    uint8_t  unit[SYNTH_BUS_UNITS];
+} synth_bus_program;
+
+/* a fused op computes fused_unit and feeds it to unit without storing its result.
+   input holds the buffer numbers of the inputs of unit */
+typedef struct
+{
+    uint8_t  kernel;
+    uint8_t  unit;
+    uint8_t  fused_unit;
+    uint8_t  input[SYNTH_INPUTS_NUMBER];
+} synth_program_op;
+
+/* the units that contribute to the voice output, in execution order,
+   and the result buffer the voice output is taken from */
+typedef struct
+{
+    uint8_t  ops;
+    uint8_t  units;
+    uint8_t  output;
+    synth_program_op op[MAX_SYNTH_UNITS];
+} synth_program;
+
+typedef enum
+{
+    SYNTH_EVENT_NOTE_ON = 0,
+    SYNTH_EVENT_NOTE_OFF,
+    SYNTH_EVENT_NOTE_STEAL
+} synth_event_type;
+
+typedef struct
+{
+    uint8_t  type;
+    uint8_t  note;
+    uint32_t value;
+    uint32_t sample_index;
+    uint32_t time_us;
+} synth_event;
+
+typedef struct
+{
+    uint32_t sample_index;
+    uint32_t time_us;
+} synth_latency_probe;
+
+/* the first fused op that differed from the unit path.  sample is -1 when the
+   outputs matched and only the unit state differed */
+typedef struct
+{
+    uint8_t  fused_unit;
+    uint8_t  unit;
+    int16_t  sample;
+    int32_t  fused;
+    int32_t  reference;
+} synth_fusion_mismatch;
+
+/* a note waiting for the stolen voice it will replace to finish fading */
+typedef struct
+{
+    bool     pending;
+    bool     released;
+    uint8_t  note_no;
+    uint8_t  velocity;
+    uint32_t time_us;
+    uint32_t defer_us;
+} synth_pending_start;
+
+typedef void (synth_type_process)(synth_parm *sp, synth_unit *su, int32_t *out, uint n);
 typedef void (synth_note_start)(synth_parm *sp, synth_unit *su, synth_start_st *sst);
+typedef void (synth_note_prepare)(synth_parm *sp, synth_unit *su);
+typedef bool (synth_unit_controls)(synth_parm *sp);
+typedef void (synth_unit_refresh)(synth_parm *sp, synth_unit *su, synth_start_st *sst);
 
-int32_t synth_process_all_units(void);
+void synth_process_all_units(int32_t *samples, uint32_t sample_index);
 void synth_unit_struct_zero(synth_unit *su);
 void synth_unit_initialize(int synth_unit_number, synth_unit_type dut);
 
 extern const void * const synth_parm_struct_defaults[];
-extern synth_parm synth_parms[MAX_SYNTH_UNITS];
+extern synth_parm synth_parms[SYNTH_ALL_UNITS];
 extern synth_unit synth_units[MAX_POLYPHONY][MAX_SYNTH_UNITS];
 
 inline synth_unit *synth_unit_entry(uint m, uint e)
@@ -379,14 +565,65 @@ extern const char * const stnames[];
 uint32_t synth_read_value_prec(void *v, int prec);
 void synth_set_value_prec(void *v, int prec, uint32_t val);
 
+void synth_compile_program(void);
+uint32_t synth_program_ops(void);
+uint32_t synth_program_units(void);
+uint32_t synth_program_globals(void);
+uint32_t synth_program_bus_units(void);
+void synth_set_fusion_mode(synth_fusion_mode_type mode);
+void synth_set_silence(uint32_t level, uint32_t window);
 void synth_unit_reset_unitno(int synth_unit_number);
 void synth_unit_reset_all(void);
 void synth_initialize(void);
 
-void synth_start_note(uint8_t note_no, uint8_t velocity);
-void synth_stop_note(uint8_t note_no, uint8_t velocity);
+void synth_start_note(uint8_t note_no, uint8_t velocity, uint32_t time_us);
+void synth_stop_note(uint8_t note_no, uint8_t velocity, uint32_t time_us);
+void synth_poll_pending_starts(void);
+void synth_steal_reset_stats(void);
 
 void synth_panic(void);
+void synth_set_samplerate(uint32_t samplerate);
+void synth_interp_initialize(void);
+void synth_set_voice_limit(uint32_t voices);
+void synth_governor_reset_stats(void);
+void synth_profile_reset(void);
+
+uint32_t synth_event_queue_depth(void);
+void synth_event_queue_reset_stats(void);
+
+extern uint32_t synth_event_queue_max_depth;
+extern uint32_t synth_event_queue_overflows;
+extern uint32_t synth_event_late;
+
+extern uint32_t synth_steals;
+extern uint32_t synth_steals_deferred;
+extern uint32_t synth_steal_us_total;
+extern uint32_t synth_steal_us_max;
+extern uint32_t synth_steal_wait_us_max;
+
+extern volatile uint32_t synth_voice_limit;
+extern volatile uint32_t synth_voice_limit_fixed;
+extern uint32_t synth_load;
+extern uint32_t synth_load_max;
+extern uint32_t synth_voice_cost;
+extern uint32_t synth_fixed_cost;
+extern uint32_t synth_governor_sheds;
+
+extern uint32_t synth_refresh_passes;
+extern volatile uint32_t synth_silence_level;
+extern volatile uint32_t synth_silence_window;
+extern uint32_t synth_silence_retired;
+extern uint32_t synth_silence_skipped;
+extern uint32_t synth_refresh_units;
+
+extern volatile uint8_t synth_fusion_mode;
+extern uint32_t synth_fusion_checked_blocks;
+extern uint32_t synth_fusion_mismatches;
+extern synth_fusion_mismatch synth_fusion_first_mismatch;
+
+extern synth_latency_probe synth_latency_probes[SYNTH_LATENCY_PROBE_LENGTH];
+extern volatile uint32_t synth_latency_probe_write;
+extern volatile uint32_t synth_latency_probe_read;
 
 #ifdef __cplusplus
 }
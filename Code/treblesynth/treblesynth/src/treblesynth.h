@@ -26,6 +26,7 @@
 #define _TREBLESYNTH_H
 
 #define PLACE_IN_RAM
+/* #define PROFILE_UNITS */
 
 #define POTENTIOMETER_MAX 23
 #define NUMBER_OF_CONTROLS 64
@@ -42,11 +43,51 @@
 #include "hardware/flash.h"
 #include "hardware/uart.h"
 #include "hardware/irq.h"
+#include "hardware/interp.h"
 #include "pico/stdlib.h"
 #include "pico/multicore.h"
 
 #define DMB() __dmb()
 
+#ifdef PROFILE_UNITS
+#include "hardware/structs/systick.h"
+
+#define PROFILE_CYCLES_MASK 0xFFFFFFu
+
+typedef struct
+{
+    uint64_t cycles;
+    uint32_t samples;
+    uint32_t max_cycles;
+} unit_profile;
+
+/* SysTick is per core, so each core that profiles must call this */
+static inline void profile_initialize_cycles(void)
+{
+    systick_hw->rvr = PROFILE_CYCLES_MASK;
+    systick_hw->cvr = 0;
+    systick_hw->csr = M0PLUS_SYST_CSR_CLKSOURCE_BITS | M0PLUS_SYST_CSR_ENABLE_BITS;
+}
+
+static inline uint32_t profile_cycles(void)
+{
+    return systick_hw->cvr;
+}
+
+static inline uint32_t profile_elapsed(uint32_t start_cycles)
+{
+    return (start_cycles - systick_hw->cvr) & PROFILE_CYCLES_MASK;
+}
+
+static inline void profile_add(unit_profile *up, uint32_t cycles, uint32_t samples)
+{
+    up->cycles += cycles;
+    up->samples += samples;
+    if (samples > 1) cycles /= samples;
+    if (cycles > up->max_cycles) up->max_cycles = cycles;
+}
+#endif
+
 #define UART_TX_PIN 0
 #define UART_RX_PIN 1
 
@@ -95,9 +136,20 @@ extern "C"
 #endif
 
 uint16_t read_potentiometer_value(uint v);
+uint32_t sample_index_from_time(uint32_t time_us);
 
 void set_debug_vals(int32_t v1, int32_t v2, int32_t v3);
 
+#ifdef PROFILE_UNITS
+extern unit_profile synth_profile_unit[];
+extern unit_profile synth_profile_type[];
+extern unit_profile synth_profile_total;
+extern unit_profile synth_profile_note_start;
+extern unit_profile dsp_profile_unit[];
+extern unit_profile dsp_profile_type[];
+extern unit_profile dsp_profile_total;
+#endif
+
 #define POTENTIOMETER_VALUE_SENSITIVITY 20
 #define PROJECT_MAGIC_NUMBER 0xF00BB00E
 
@@ -109,6 +161,8 @@ typedef struct _project_configuration_s
   uint8_t   note_transpose;
   uint8_t   midi_device_no;
   uint32_t  fail_delay;
+  uint8_t   tuning;
+  uint8_t   sample_rate;
 } project_configuration_s;  
 
 typedef union _project_configuration
@@ -124,7 +124,7 @@ void midi_send_note(uint8_t note, uint8_t velocity)
     last_note = note;
 }
 
-bool midi_perform_event(const uint8_t cmdbuf[], int num)
+bool midi_perform_event(const uint8_t cmdbuf[], int num, uint32_t time_us)
 {
    bool ex = false;
    int cmdprefix = cmdbuf[0] & 0xF0;
@@ -136,17 +136,17 @@ bool midi_perform_event(const uint8_t cmdbuf[], int num)
             case 0x90:  
                         if (cmdbuf[2] == 0)
                         {
-                            synth_stop_note(cmdbuf[1],0);
+                            synth_stop_note(cmdbuf[1],0,time_us);
                             gpio_put(LED_PIN,0);
                         } else
                         {
-                            synth_start_note(cmdbuf[1],cmdbuf[2]);
+                            synth_start_note(cmdbuf[1],cmdbuf[2],time_us);
                             gpio_put(LED_PIN,1);
                         }
                         ex = true;
                         break;
             case 0x80:  gpio_put(LED_PIN,0);
-                        synth_stop_note(cmdbuf[1],cmdbuf[2]);
+                        synth_stop_note(cmdbuf[1],cmdbuf[2],time_us);
                         ex = true;
                         break;
             case 0xB0:  if ((cmdbuf[1] == 120) || (cmdbuf[1] == 123))
@@ -187,7 +187,7 @@ void midi_button_event(uint8_t note, uint8_t on_off)
         msg[2] = 127;                     // Velocity
         tud_midi_n_stream_write(0, 0, msg, 3);
         uart0_output(msg, 3);
-        midi_perform_event(msg, 3);
+        midi_perform_event(msg, 3, time_us_32());
     } else
     {
         msg[0] = 0x80;                    // Note Off - Channel 1
@@ -195,7 +195,7 @@ void midi_button_event(uint8_t note, uint8_t on_off)
         msg[2] = 127;                     // Velocity
         tud_midi_n_stream_write(0, 0, msg, 3);
         uart0_output(msg, 3);
-        midi_perform_event(msg, 3);
+        midi_perform_event(msg, 3, time_us_32());
     }
 }
 
@@ -203,14 +203,15 @@ void midi_uart_poll(void)
 {
     static int num = 0;
     static uint8_t cmdbuf[3];
+    uint32_t time_us;
     
-    int ch = uart0_input();
+    int ch = uart0_input(&time_us);
     
     if ((ch < 0) || (ch >= 0xF6)) return;
     if (ch & 0x80) num = 0;
     if (num < (sizeof(cmdbuf)/sizeof(cmdbuf[0])))
         cmdbuf[num++] = ch;
-    if ((num >= 2) && (midi_perform_event(cmdbuf, num))) num = 1;
+    if ((num >= 2) && (midi_perform_event(cmdbuf, num, time_us))) num = 1;
 }
 
 void midi_task(void)
@@ -219,7 +220,7 @@ void midi_task(void)
     while ( tud_midi_n_available(0,0) ) 
     {
         tud_midi_n_packet_read(0,cmdbuf);
-        midi_perform_event(&cmdbuf[1],3);
+        midi_perform_event(&cmdbuf[1],3,time_us_32());
     }
 }
 
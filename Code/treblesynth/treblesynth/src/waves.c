@@ -1,6 +1,7 @@
 /* waves.c */
 
 #include <stdint.h>
+#include "waves.h"
 
 const int16_t table_sine[1024]={
     0,201,402,603,804,1005,1206,1407,1608,1809,2009,2210,2410,2611,2811,3012,
@@ -1059,3 +1060,4050 @@ const int16_t table_wd8[1024]={
     10219,10296,10361,10415,10458,10489,10510,10519,10517,10504,10480,10445,10399,10341,10273,10194};
 
 const int16_t *wavetables[16]= { table_sine, table_halfsine, table_rectsine, table_triangle, table_sawtooth, table_squarewave, table_squarewave2, table_squarewave3, table_wd1, table_wd2, table_wd3, table_wd4, table_wd5, table_wd6, table_wd7, table_wd8 };
+
+const int16_t table_halfsine_mip2[1024]={
+    -32646,-32606,-32495,-32334,-32150,-31965,-31795,-31642,-31499,-31356,-31204,-31043,-30875,-30707,-30545,-30391,
+    -30240,-30090,-29935,-29775,-29611,-29448,-29288,-29133,-28981,-28828,-28672,-28513,-28351,-28189,-28031,-27875,
+    -27722,-27569,-27413,-27254,-27094,-26934,-26776,-26620,-26467,-26313,-26157,-25999,-25840,-25681,-25524,-25369,
+    -25215,-25061,-24906,-24749,-24590,-24432,-24276,-24121,-23968,-23814,-23660,-23503,-23346,-23189,-23033,-22879,
+    -22726,-22573,-22419,-22263,-22106,-21950,-21796,-21643,-21490,-21338,-21184,-21029,-20874,-20719,-20565,-20413,
+    -20261,-20110,-19957,-19803,-19649,-19495,-19342,-19190,-19039,-18889,-18737,-18584,-18431,-18278,-18127,-17976,
+    -17826,-17676,-17526,-17374,-17222,-17071,-16920,-16771,-16622,-16473,-16324,-16173,-16023,-15873,-15723,-15575,
+    -15428,-15280,-15132,-14983,-14833,-14685,-14537,-14390,-14244,-14097,-13950,-13803,-13655,-13507,-13361,-13215,
+    -13070,-12925,-12780,-12634,-12488,-12342,-12197,-12053,-11910,-11766,-11622,-11477,-11333,-11189,-11045,-10903,
+    -10761,-10619,-10477,-10334,-10191,-10048,-9907,-9766,-9626,-9485,-9345,-9204,-9062,-8922,-8782,-8643,
+    -8504,-8366,-8227,-8088,-7948,-7810,-7672,-7535,-7398,-7261,-7124,-6986,-6849,-6712,-6576,-6441,
+    -6307,-6172,-6037,-5901,-5766,-5631,-5497,-5364,-5231,-5098,-4965,-4832,-4698,-4566,-4434,-4303,
+    -4172,-4042,-3911,-3779,-3648,-3518,-3388,-3259,-3131,-3002,-2873,-2744,-2615,-2487,-2360,-2233,
+    -2106,-1980,-1854,-1727,-1601,-1475,-1350,-1225,-1101,-977,-853,-729,-605,-481,-359,-237,
+    -115,6,128,250,372,493,613,732,851,971,1090,1209,1328,1447,1564,1681,
+    1798,1914,2031,2148,2264,2380,2495,2609,2723,2837,2951,3065,3179,3292,3405,3516,
+    3628,3739,3850,3962,4072,4183,4292,4401,4510,4618,4727,4835,4943,5051,5158,5264,
+    5369,5475,5581,5687,5792,5896,6000,6103,6206,6309,6412,6515,6617,6719,6819,6920,
+    7020,7120,7219,7319,7418,7517,7615,7712,7809,7905,8002,8099,8195,8291,8386,8480,
+    8574,8667,8761,8855,8948,9041,9132,9223,9314,9404,9495,9585,9675,9765,9853,9941,
+    10029,10116,10203,10291,10377,10463,10549,10633,10717,10801,10886,10969,11053,11136,11218,11299,
+    11380,11461,11542,11622,11702,11782,11860,11938,12016,12094,12171,12248,12325,12401,12476,12551,
+    12625,12699,12774,12847,12921,12993,13065,13136,13207,13278,13349,13419,13489,13558,13626,13694,
+    13761,13829,13896,13962,14029,14094,14159,14223,14287,14351,14415,14478,14541,14603,14664,14725,
+    14785,14845,14905,14965,15024,15083,15140,15197,15254,15310,15367,15423,15479,15533,15588,15641,
+    15694,15747,15800,15852,15904,15956,16006,16056,16105,16155,16204,16252,16300,16348,16394,16441,
+    16486,16532,16578,16623,16667,16711,16754,16796,16838,16880,16922,16964,17004,17044,17083,17122,
+    17160,17199,17237,17274,17311,17348,17383,17418,17452,17487,17521,17555,17588,17620,17652,17683,
+    17714,17744,17775,17805,17834,17863,17891,17918,17945,17972,17999,18025,18050,18075,18099,18123,
+    18146,18169,18192,18214,18236,18257,18277,18296,18316,18335,18354,18372,18390,18407,18424,18440,
+    18455,18470,18485,18500,18514,18527,18540,18552,18563,18575,18586,18597,18607,18616,18625,18633,
+    18641,18648,18656,18663,18669,18674,18679,18683,18687,18691,18695,18697,18700,18701,18702,18702,
+    18703,18702,18702,18701,18700,18697,18695,18691,18687,18683,18679,18674,18669,18663,18656,18648,
+    18641,18633,18625,18616,18607,18597,18586,18575,18563,18552,18540,18527,18514,18500,18485,18470,
+    18455,18440,18424,18407,18390,18372,18354,18335,18316,18296,18277,18257,18236,18214,18192,18169,
+    18146,18123,18099,18075,18050,18025,17999,17972,17945,17918,17891,17863,17834,17805,17775,17744,
+    17714,17683,17652,17620,17588,17555,17521,17487,17452,17418,17383,17348,17311,17274,17237,17199,
+    17160,17122,17083,17044,17004,16964,16922,16880,16838,16796,16754,16711,16667,16623,16578,16532,
+    16486,16441,16394,16348,16300,16252,16204,16155,16105,16056,16006,15956,15904,15852,15800,15747,
+    15694,15641,15588,15533,15479,15423,15367,15310,15254,15197,15140,15083,15024,14965,14905,14845,
+    14785,14725,14664,14603,14541,14478,14415,14351,14287,14223,14159,14094,14029,13962,13896,13829,
+    13761,13694,13626,13558,13489,13419,13349,13278,13207,13136,13065,12993,12921,12847,12774,12699,
+    12625,12551,12476,12401,12325,12248,12171,12094,12016,11938,11860,11782,11702,11622,11542,11461,
+    11380,11299,11218,11136,11053,10969,10886,10801,10717,10633,10549,10463,10377,10291,10203,10116,
+    10029,9941,9853,9765,9675,9585,9495,9404,9314,9223,9132,9041,8948,8855,8761,8667,
+    8574,8480,8386,8291,8195,8099,8002,7905,7809,7712,7615,7517,7418,7319,7219,7120,
+    7020,6920,6819,6719,6617,6515,6412,6309,6206,6103,6000,5896,5792,5687,5581,5475,
+    5369,5264,5158,5051,4943,4835,4727,4618,4510,4401,4292,4183,4072,3962,3850,3739,
+    3628,3516,3405,3292,3179,3065,2951,2837,2723,2609,2495,2380,2264,2148,2031,1914,
+    1798,1681,1564,1447,1328,1209,1090,971,851,732,613,493,372,250,128,6,
+    -115,-237,-359,-481,-605,-729,-853,-977,-1101,-1225,-1350,-1475,-1601,-1727,-1854,-1980,
+    -2106,-2233,-2360,-2487,-2615,-2744,-2873,-3002,-3131,-3259,-3388,-3518,-3648,-3779,-3911,-4042,
+    -4172,-4303,-4434,-4566,-4698,-4832,-4965,-5098,-5231,-5364,-5497,-5631,-5766,-5901,-6037,-6172,
+    -6307,-6441,-6576,-6712,-6849,-6986,-7124,-7261,-7398,-7535,-7672,-7810,-7948,-8088,-8227,-8366,
+    -8504,-8643,-8782,-8922,-9062,-9204,-9345,-9485,-9626,-9766,-9907,-10048,-10191,-10334,-10477,-10619,
+    -10761,-10903,-11045,-11189,-11333,-11477,-11622,-11766,-11910,-12053,-12197,-12342,-12488,-12634,-12780,-12925,
+    -13070,-13215,-13361,-13507,-13655,-13803,-13950,-14097,-14244,-14390,-14537,-14685,-14833,-14983,-15132,-15280,
+    -15428,-15575,-15723,-15873,-16023,-16173,-16324,-16473,-16622,-16771,-16920,-17071,-17222,-17374,-17526,-17676,
+    -17826,-17976,-18127,-18278,-18431,-18584,-18737,-18889,-19039,-19190,-19342,-19495,-19649,-19803,-19957,-20110,
+    -20261,-20413,-20565,-20719,-20874,-21029,-21184,-21338,-21490,-21643,-21796,-21950,-22106,-22263,-22419,-22573,
+    -22726,-22879,-23033,-23189,-23346,-23503,-23660,-23814,-23968,-24121,-24276,-24432,-24590,-24749,-24906,-25061,
+    -25215,-25369,-25524,-25681,-25840,-25999,-26157,-26313,-26467,-26620,-26776,-26934,-27094,-27254,-27413,-27569,
+    -27722,-27875,-28031,-28189,-28351,-28513,-28672,-28828,-28981,-29133,-29288,-29448,-29611,-29775,-29935,-30090,
+    -30240,-30391,-30545,-30707,-30875,-31043,-31204,-31356,-31499,-31642,-31795,-31965,-32150,-32334,-32495,-32606};
+
+const int16_t table_halfsine_mip3[1024]={
+    -32516,-32496,-32438,-32343,-32218,-32067,-31898,-31718,-31532,-31346,-31165,-30992,-30827,-30670,-30520,-30375,
+    -30233,-30090,-29945,-29796,-29641,-29482,-29318,-29152,-28984,-28816,-28650,-28488,-28329,-28173,-28021,-27870,
+    -27721,-27571,-27421,-27267,-27112,-26953,-26792,-26630,-26466,-26304,-26142,-25983,-25825,-25671,-25518,-25366,
+    -25215,-25064,-24912,-24758,-24603,-24446,-24287,-24127,-23967,-23807,-23648,-23491,-23335,-23182,-23029,-22878,
+    -22727,-22576,-22424,-22271,-22116,-21961,-21804,-21646,-21488,-21331,-21175,-21020,-20866,-20714,-20563,-20412,
+    -20262,-20112,-19961,-19810,-19657,-19503,-19348,-19193,-19038,-18883,-18729,-18576,-18424,-18274,-18125,-17976,
+    -17828,-17679,-17530,-17380,-17229,-17077,-16925,-16773,-16620,-16468,-16317,-16167,-16017,-15869,-15722,-15575,
+    -15429,-15282,-15135,-14988,-14839,-14690,-14541,-14391,-14241,-14092,-13944,-13797,-13650,-13505,-13360,-13216,
+    -13072,-12928,-12783,-12638,-12493,-12347,-12200,-12054,-11907,-11761,-11616,-11472,-11329,-11187,-11045,-10904,
+    -10763,-10621,-10480,-10338,-10195,-10052,-9909,-9766,-9623,-9481,-9339,-9199,-9059,-8920,-8782,-8644,
+    -8506,-8368,-8230,-8091,-7953,-7813,-7674,-7534,-7395,-7257,-7119,-6982,-6846,-6711,-6576,-6442,
+    -6308,-6174,-6039,-5905,-5770,-5634,-5499,-5363,-5228,-5094,-4960,-4828,-4696,-4565,-4434,-4304,
+    -4174,-4044,-3913,-3783,-3652,-3521,-3390,-3259,-3128,-2998,-2869,-2741,-2613,-2486,-2360,-2234,
+    -2108,-1982,-1856,-1730,-1604,-1477,-1351,-1225,-1099,-974,-849,-725,-603,-480,-359,-238,
+    -117,4,126,247,369,490,612,733,854,974,1094,1212,1330,1447,1564,1680,
+    1796,1913,2029,2145,2261,2378,2494,2610,2726,2841,2955,3068,3181,3293,3404,3515,
+    3626,3737,3848,3959,4070,4181,4292,4402,4512,4621,4730,4838,4945,5051,5157,5263,
+    5368,5473,5579,5684,5790,5895,6000,6105,6209,6312,6415,6517,6618,6719,6819,6919,
+    7018,7118,7217,7317,7416,7515,7614,7713,7811,7909,8005,8101,8196,8291,8385,8479,
+    8572,8666,8759,8853,8946,9039,9132,9224,9316,9407,9498,9587,9676,9765,9852,9940,
+    10027,10114,10201,10289,10375,10462,10549,10635,10720,10804,10888,10971,11054,11135,11217,11298,
+    11379,11459,11540,11620,11701,11781,11861,11940,12019,12097,12174,12250,12326,12401,12475,12550,
+    12624,12698,12772,12846,12919,12993,13065,13138,13210,13281,13351,13420,13489,13557,13625,13693,
+    13760,13827,13894,13961,14027,14094,14160,14225,14290,14354,14417,14479,14541,14602,14663,14723,
+    14784,14844,14904,14963,15023,15082,15141,15199,15256,15313,15369,15424,15479,15533,15586,15640,
+    15693,15746,15798,15851,15903,15955,16007,16058,16108,16157,16206,16253,16301,16347,16393,16439,
+    16485,16531,16576,16621,16666,16711,16755,16798,16841,16883,16924,16964,17004,17043,17082,17121,
+    17159,17197,17235,17273,17310,17347,17384,17420,17455,17489,17523,17556,17588,17619,17651,17682,
+    17712,17743,17773,17803,17833,17863,17892,17920,17948,17974,18000,18026,18050,18074,18098,18121,
+    18144,18167,18190,18213,18235,18257,18278,18299,18318,18337,18356,18373,18390,18406,18422,18438,
+    18454,18469,18484,18499,18514,18528,18541,18554,18566,18577,18588,18597,18607,18615,18623,18631,
+    18639,18647,18654,18661,18668,18675,18680,18685,18690,18693,18696,18698,18699,18700,18701,18701,
+    18701,18701,18701,18700,18699,18698,18696,18693,18690,18685,18680,18675,18668,18661,18654,18647,
+    18639,18631,18623,18615,18607,18597,18588,18577,18566,18554,18541,18528,18514,18499,18484,18469,
+    18454,18438,18422,18406,18390,18373,18356,18337,18318,18299,18278,18257,18235,18213,18190,18167,
+    18144,18121,18098,18074,18050,18026,18000,17974,17948,17920,17892,17863,17833,17803,17773,17743,
+    17712,17682,17651,17619,17588,17556,17523,17489,17455,17420,17384,17347,17310,17273,17235,17197,
+    17159,17121,17082,17043,17004,16964,16924,16883,16841,16798,16755,16711,16666,16621,16576,16531,
+    16485,16439,16393,16347,16301,16253,16206,16157,16108,16058,16007,15955,15903,15851,15798,15746,
+    15693,15640,15586,15533,15479,15424,15369,15313,15256,15199,15141,15082,15023,14963,14904,14844,
+    14784,14723,14663,14602,14541,14479,14417,14354,14290,14225,14160,14094,14027,13961,13894,13827,
+    13760,13693,13625,13557,13489,13420,13351,13281,13210,13138,13065,12993,12919,12846,12772,12698,
+    12624,12550,12475,12401,12326,12250,12174,12097,12019,11940,11861,11781,11701,11620,11540,11459,
+    11379,11298,11217,11135,11054,10971,10888,10804,10720,10635,10549,10462,10375,10289,10201,10114,
+    10027,9940,9852,9765,9676,9587,9498,9407,9316,9224,9132,9039,8946,8853,8759,8666,
+    8572,8479,8385,8291,8196,8101,8005,7909,7811,7713,7614,7515,7416,7317,7217,7118,
+    7018,6919,6819,6719,6618,6517,6415,6312,6209,6105,6000,5895,5790,5684,5579,5473,
+    5368,5263,5157,5051,4945,4838,4730,4621,4512,4402,4292,4181,4070,3959,3848,3737,
+    3626,3515,3404,3293,3181,3068,2955,2841,2726,2610,2494,2378,2261,2145,2029,1913,
+    1796,1680,1564,1447,1330,1212,1094,974,854,733,612,490,369,247,126,4,
+    -117,-238,-359,-480,-603,-725,-849,-974,-1099,-1225,-1351,-1477,-1604,-1730,-1856,-1982,
+    -2108,-2234,-2360,-2486,-2613,-2741,-2869,-2998,-3128,-3259,-3390,-3521,-3652,-3783,-3913,-4044,
+    -4174,-4304,-4434,-4565,-4696,-4828,-4960,-5094,-5228,-5363,-5499,-5634,-5770,-5905,-6039,-6174,
+    -6308,-6442,-6576,-6711,-6846,-6982,-7119,-7257,-7395,-7534,-7674,-7813,-7953,-8091,-8230,-8368,
+    -8506,-8644,-8782,-8920,-9059,-9199,-9339,-9481,-9623,-9766,-9909,-10052,-10195,-10338,-10480,-10621,
+    -10763,-10904,-11045,-11187,-11329,-11472,-11616,-11761,-11907,-12054,-12200,-12347,-12493,-12638,-12783,-12928,
+    -13072,-13216,-13360,-13505,-13650,-13797,-13944,-14092,-14241,-14391,-14541,-14690,-14839,-14988,-15135,-15282,
+    -15429,-15575,-15722,-15869,-16017,-16167,-16317,-16468,-16620,-16773,-16925,-17077,-17229,-17380,-17530,-17679,
+    -17828,-17976,-18125,-18274,-18424,-18576,-18729,-18883,-19038,-19193,-19348,-19503,-19657,-19810,-19961,-20112,
+    -20262,-20412,-20563,-20714,-20866,-21020,-21175,-21331,-21488,-21646,-21804,-21961,-22116,-22271,-22424,-22576,
+    -22727,-22878,-23029,-23182,-23335,-23491,-23648,-23807,-23967,-24127,-24287,-24446,-24603,-24758,-24912,-25064,
+    -25215,-25366,-25518,-25671,-25825,-25983,-26142,-26304,-26466,-26630,-26792,-26953,-27112,-27267,-27421,-27571,
+    -27721,-27870,-28021,-28173,-28329,-28488,-28650,-28816,-28984,-29152,-29318,-29482,-29641,-29796,-29945,-30090,
+    -30233,-30375,-30520,-30670,-30827,-30992,-31165,-31346,-31532,-31718,-31898,-32067,-32218,-32343,-32438,-32496};
+
+const int16_t table_halfsine_mip4[1024]={
+    -32264,-32254,-32225,-32175,-32107,-32020,-31917,-31799,-31666,-31520,-31364,-31198,-31026,-30847,-30664,-30479,
+    -30293,-30108,-29923,-29742,-29563,-29388,-29218,-29052,-28890,-28732,-28578,-28428,-28281,-28136,-27993,-27851,
+    -27709,-27567,-27424,-27280,-27134,-26986,-26835,-26682,-26527,-26369,-26208,-26046,-25882,-25717,-25551,-25384,
+    -25217,-25051,-24885,-24721,-24558,-24396,-24237,-24079,-23923,-23770,-23617,-23467,-23317,-23169,-23022,-22875,
+    -22728,-22580,-22433,-22284,-22135,-21984,-21832,-21679,-21525,-21369,-21212,-21054,-20895,-20736,-20576,-20416,
+    -20257,-20098,-19939,-19781,-19625,-19469,-19315,-19162,-19011,-18860,-18711,-18563,-18416,-18269,-18123,-17977,
+    -17831,-17685,-17539,-17392,-17244,-17096,-16947,-16797,-16646,-16494,-16342,-16189,-16036,-15882,-15728,-15575,
+    -15421,-15269,-15116,-14965,-14815,-14665,-14516,-14369,-14223,-14077,-13933,-13789,-13646,-13503,-13361,-13219,
+    -13077,-12934,-12792,-12649,-12506,-12362,-12218,-12073,-11927,-11781,-11635,-11488,-11341,-11194,-11047,-10900,
+    -10754,-10608,-10463,-10319,-10175,-10032,-9890,-9750,-9610,-9470,-9332,-9194,-9057,-8920,-8784,-8647,
+    -8511,-8375,-8238,-8101,-7964,-7826,-7688,-7550,-7411,-7272,-7133,-6994,-6854,-6715,-6576,-6437,
+    -6299,-6161,-6024,-5888,-5752,-5617,-5483,-5350,-5218,-5086,-4956,-4825,-4695,-4566,-4437,-4308,
+    -4179,-4050,-3921,-3792,-3662,-3532,-3402,-3272,-3141,-3011,-2880,-2749,-2618,-2488,-2358,-2228,
+    -2099,-1970,-1842,-1715,-1588,-1463,-1338,-1214,-1090,-968,-846,-724,-603,-483,-362,-242,
+    -122,-2,118,239,359,480,601,722,843,964,1085,1206,1327,1447,1567,1687,
+    1806,1924,2042,2159,2275,2391,2505,2619,2732,2845,2957,3068,3179,3290,3400,3510,
+    3621,3731,3841,3951,4061,4171,4282,4392,4503,4613,4723,4833,4943,5052,5161,5270,
+    5378,5485,5591,5697,5802,5906,6009,6112,6214,6315,6416,6516,6616,6715,6815,6914,
+    7012,7111,7210,7309,7408,7507,7606,7704,7803,7902,8000,8098,8196,8293,8390,8486,
+    8582,8677,8771,8864,8957,9049,9140,9230,9320,9409,9498,9586,9673,9761,9848,9935,
+    10021,10108,10195,10281,10368,10454,10540,10627,10713,10799,10884,10970,11054,11139,11223,11306,
+    11388,11470,11551,11631,11711,11789,11867,11945,12021,12097,12173,12248,12322,12397,12471,12544,
+    12618,12692,12765,12839,12912,12985,13058,13131,13204,13276,13348,13420,13491,13561,13631,13701,
+    13769,13837,13904,13971,14036,14101,14165,14229,14291,14353,14415,14476,14537,14598,14658,14718,
+    14778,14837,14897,14956,15016,15075,15134,15193,15251,15310,15367,15425,15482,15538,15593,15648,
+    15702,15756,15808,15860,15911,15961,16011,16060,16108,16156,16203,16250,16296,16342,16388,16434,
+    16479,16525,16570,16615,16660,16704,16749,16793,16837,16880,16923,16966,17008,17049,17090,17130,
+    17169,17207,17245,17281,17317,17353,17387,17421,17455,17487,17520,17552,17583,17614,17645,17676,
+    17707,17737,17767,17797,17827,17857,17886,17915,17944,17973,18000,18028,18054,18080,18106,18130,
+    18154,18177,18199,18221,18241,18261,18281,18299,18317,18335,18352,18369,18385,18401,18417,18432,
+    18448,18463,18478,18493,18508,18522,18536,18550,18563,18576,18589,18600,18612,18622,18632,18641,
+    18649,18656,18663,18669,18674,18678,18682,18685,18688,18690,18692,18693,18694,18695,18695,18695,
+    18695,18695,18695,18695,18694,18693,18692,18690,18688,18685,18682,18678,18674,18669,18663,18656,
+    18649,18641,18632,18622,18612,18600,18589,18576,18563,18550,18536,18522,18508,18493,18478,18463,
+    18448,18432,18417,18401,18385,18369,18352,18335,18317,18299,18281,18261,18241,18221,18199,18177,
+    18154,18130,18106,18080,18054,18028,18000,17973,17944,17915,17886,17857,17827,17797,17767,17737,
+    17707,17676,17645,17614,17583,17552,17520,17487,17455,17421,17387,17353,17317,17281,17245,17207,
+    17169,17130,17090,17049,17008,16966,16923,16880,16837,16793,16749,16704,16660,16615,16570,16525,
+    16479,16434,16388,16342,16296,16250,16203,16156,16108,16060,16011,15961,15911,15860,15808,15756,
+    15702,15648,15593,15538,15482,15425,15367,15310,15251,15193,15134,15075,15016,14956,14897,14837,
+    14778,14718,14658,14598,14537,14476,14415,14353,14291,14229,14165,14101,14036,13971,13904,13837,
+    13769,13701,13631,13561,13491,13420,13348,13276,13204,13131,13058,12985,12912,12839,12765,12692,
+    12618,12544,12471,12397,12322,12248,12173,12097,12021,11945,11867,11789,11711,11631,11551,11470,
+    11388,11306,11223,11139,11054,10970,10884,10799,10713,10627,10540,10454,10368,10281,10195,10108,
+    10021,9935,9848,9761,9673,9586,9498,9409,9320,9230,9140,9049,8957,8864,8771,8677,
+    8582,8486,8390,8293,8196,8098,8000,7902,7803,7704,7606,7507,7408,7309,7210,7111,
+    7012,6914,6815,6715,6616,6516,6416,6315,6214,6112,6009,5906,5802,5697,5591,5485,
+    5378,5270,5161,5052,4943,4833,4723,4613,4503,4392,4282,4171,4061,3951,3841,3731,
+    3621,3510,3400,3290,3179,3068,2957,2845,2732,2619,2505,2391,2275,2159,2042,1924,
+    1806,1687,1567,1447,1327,1206,1085,964,843,722,601,480,359,239,118,-2,
+    -122,-242,-362,-483,-603,-724,-846,-968,-1090,-1214,-1338,-1463,-1588,-1715,-1842,-1970,
+    -2099,-2228,-2358,-2488,-2618,-2749,-2880,-3011,-3141,-3272,-3402,-3532,-3662,-3792,-3921,-4050,
+    -4179,-4308,-4437,-4566,-4695,-4825,-4956,-5086,-5218,-5350,-5483,-5617,-5752,-5888,-6024,-6161,
+    -6299,-6437,-6576,-6715,-6854,-6994,-7133,-7272,-7411,-7550,-7688,-7826,-7964,-8101,-8238,-8375,
+    -8511,-8647,-8784,-8920,-9057,-9194,-9332,-9470,-9610,-9750,-9890,-10032,-10175,-10319,-10463,-10608,
+    -10754,-10900,-11047,-11194,-11341,-11488,-11635,-11781,-11927,-12073,-12218,-12362,-12506,-12649,-12792,-12934,
+    -13077,-13219,-13361,-13503,-13646,-13789,-13933,-14077,-14223,-14369,-14516,-14665,-14815,-14965,-15116,-15269,
+    -15421,-15575,-15728,-15882,-16036,-16189,-16342,-16494,-16646,-16797,-16947,-17096,-17244,-17392,-17539,-17685,
+    -17831,-17977,-18123,-18269,-18416,-18563,-18711,-18860,-19011,-19162,-19315,-19469,-19625,-19781,-19939,-20098,
+    -20257,-20416,-20576,-20736,-20895,-21054,-21212,-21369,-21525,-21679,-21832,-21984,-22135,-22284,-22433,-22580,
+    -22728,-22875,-23022,-23169,-23317,-23467,-23617,-23770,-23923,-24079,-24237,-24396,-24558,-24721,-24885,-25051,
+    -25217,-25384,-25551,-25717,-25882,-26046,-26208,-26369,-26527,-26682,-26835,-26986,-27134,-27280,-27424,-27567,
+    -27709,-27851,-27993,-28136,-28281,-28428,-28578,-28732,-28890,-29052,-29218,-29388,-29563,-29742,-29923,-30108,
+    -30293,-30479,-30664,-30847,-31026,-31198,-31364,-31520,-31666,-31799,-31917,-32020,-32107,-32175,-32225,-32254};
+
+const int16_t table_halfsine_mip5[1024]={
+    -31775,-31770,-31755,-31729,-31694,-31649,-31594,-31529,-31455,-31372,-31281,-31180,-31072,-30955,-30832,-30701,
+    -30563,-30420,-30270,-30115,-29955,-29791,-29622,-29450,-29275,-29097,-28917,-28735,-28551,-28367,-28181,-27996,
+    -27810,-27625,-27441,-27257,-27075,-26894,-26715,-26537,-26361,-26188,-26016,-25847,-25680,-25515,-25353,-25193,
+    -25035,-24879,-24725,-24573,-24424,-24275,-24129,-23984,-23840,-23697,-23555,-23414,-23274,-23134,-22994,-22855,
+    -22715,-22575,-22435,-22294,-22153,-22011,-21868,-21724,-21579,-21433,-21286,-21138,-20989,-20838,-20686,-20533,
+    -20379,-20223,-20067,-19910,-19751,-19592,-19432,-19272,-19111,-18949,-18787,-18625,-18463,-18301,-18139,-17977,
+    -17815,-17654,-17494,-17334,-17175,-17017,-16859,-16703,-16547,-16393,-16239,-16087,-15936,-15786,-15636,-15489,
+    -15342,-15196,-15051,-14907,-14764,-14622,-14480,-14339,-14199,-14060,-13920,-13781,-13643,-13504,-13366,-13228,
+    -13089,-12951,-12812,-12673,-12534,-12395,-12255,-12114,-11973,-11832,-11690,-11547,-11404,-11260,-11116,-10972,
+    -10826,-10681,-10535,-10388,-10242,-10095,-9948,-9801,-9653,-9506,-9359,-9212,-9065,-8918,-8772,-8626,
+    -8481,-8336,-8192,-8048,-7905,-7763,-7622,-7481,-7341,-7202,-7064,-6927,-6791,-6655,-6521,-6387,
+    -6254,-6121,-5990,-5859,-5729,-5599,-5470,-5341,-5213,-5086,-4958,-4831,-4704,-4577,-4451,-4324,
+    -4197,-4071,-3944,-3817,-3690,-3563,-3436,-3308,-3180,-3052,-2924,-2795,-2666,-2537,-2408,-2278,
+    -2149,-2019,-1889,-1759,-1629,-1499,-1370,-1240,-1110,-981,-852,-724,-595,-468,-340,-214,
+    -87,38,163,287,411,534,656,777,897,1017,1136,1254,1371,1488,1604,1719,
+    1833,1947,2060,2173,2285,2396,2507,2617,2728,2837,2947,3056,3165,3274,3383,3491,
+    3600,3708,3817,3925,4034,4143,4251,4360,4469,4578,4687,4796,4905,5014,5123,5232,
+    5341,5450,5559,5668,5776,5885,5993,6100,6208,6315,6421,6527,6633,6738,6842,6946,
+    7049,7151,7253,7354,7454,7554,7652,7750,7847,7944,8039,8134,8228,8322,8414,8506,
+    8598,8689,8779,8868,8958,9046,9134,9222,9310,9397,9483,9570,9656,9742,9828,9914,
+    10000,10085,10171,10256,10342,10427,10512,10598,10683,10768,10853,10938,11023,11108,11193,11277,
+    11362,11446,11529,11613,11696,11779,11861,11943,12025,12106,12186,12266,12345,12424,12502,12579,
+    12655,12731,12806,12880,12954,13026,13098,13170,13240,13309,13378,13446,13514,13581,13647,13712,
+    13777,13841,13905,13968,14030,14093,14154,14216,14277,14337,14398,14458,14518,14578,14637,14696,
+    14756,14815,14874,14932,14991,15050,15108,15167,15225,15283,15341,15398,15456,15513,15570,15627,
+    15683,15739,15795,15850,15905,15959,16013,16067,16119,16171,16223,16274,16324,16373,16422,16470,
+    16517,16563,16609,16654,16698,16741,16784,16825,16866,16907,16946,16985,17023,17060,17097,17133,
+    17169,17204,17238,17273,17306,17339,17372,17405,17437,17468,17500,17531,17562,17593,17624,17654,
+    17684,17715,17744,17774,17804,17833,17863,17892,17921,17949,17978,18006,18034,18061,18088,18115,
+    18142,18168,18193,18218,18243,18267,18290,18313,18335,18356,18377,18397,18416,18435,18452,18469,
+    18486,18501,18516,18529,18542,18555,18566,18577,18587,18596,18605,18612,18620,18626,18632,18638,
+    18643,18647,18651,18655,18658,18661,18663,18665,18667,18669,18670,18671,18672,18672,18673,18673,
+    18673,18673,18673,18672,18672,18671,18670,18669,18667,18665,18663,18661,18658,18655,18651,18647,
+    18643,18638,18632,18626,18620,18612,18605,18596,18587,18577,18566,18555,18542,18529,18516,18501,
+    18486,18469,18452,18435,18416,18397,18377,18356,18335,18313,18290,18267,18243,18218,18193,18168,
+    18142,18115,18088,18061,18034,18006,17978,17949,17921,17892,17863,17833,17804,17774,17744,17715,
+    17684,17654,17624,17593,17562,17531,17500,17468,17437,17405,17372,17339,17306,17273,17238,17204,
+    17169,17133,17097,17060,17023,16985,16946,16907,16866,16825,16784,16741,16698,16654,16609,16563,
+    16517,16470,16422,16373,16324,16274,16223,16171,16119,16067,16013,15959,15905,15850,15795,15739,
+    15683,15627,15570,15513,15456,15398,15341,15283,15225,15167,15108,15050,14991,14932,14874,14815,
+    14756,14696,14637,14578,14518,14458,14398,14337,14277,14216,14154,14093,14030,13968,13905,13841,
+    13777,13712,13647,13581,13514,13446,13378,13309,13240,13170,13098,13026,12954,12880,12806,12731,
+    12655,12579,12502,12424,12345,12266,12186,12106,12025,11943,11861,11779,11696,11613,11529,11446,
+    11362,11277,11193,11108,11023,10938,10853,10768,10683,10598,10512,10427,10342,10256,10171,10085,
+    10000,9914,9828,9742,9656,9570,9483,9397,9310,9222,9134,9046,8958,8868,8779,8689,
+    8598,8506,8414,8322,8228,8134,8039,7944,7847,7750,7652,7554,7454,7354,7253,7151,
+    7049,6946,6842,6738,6633,6527,6421,6315,6208,6100,5993,5885,5776,5668,5559,5450,
+    5341,5232,5123,5014,4905,4796,4687,4578,4469,4360,4251,4143,4034,3925,3817,3708,
+    3600,3491,3383,3274,3165,3056,2947,2837,2728,2617,2507,2396,2285,2173,2060,1947,
+    1833,1719,1604,1488,1371,1254,1136,1017,897,777,656,534,411,287,163,38,
+    -87,-214,-340,-468,-595,-724,-852,-981,-1110,-1240,-1370,-1499,-1629,-1759,-1889,-2019,
+    -2149,-2278,-2408,-2537,-2666,-2795,-2924,-3052,-3180,-3308,-3436,-3563,-3690,-3817,-3944,-4071,
+    -4197,-4324,-4451,-4577,-4704,-4831,-4958,-5086,-5213,-5341,-5470,-5599,-5729,-5859,-5990,-6121,
+    -6254,-6387,-6521,-6655,-6791,-6927,-7064,-7202,-7341,-7481,-7622,-7763,-7905,-8048,-8192,-8336,
+    -8481,-8626,-8772,-8918,-9065,-9212,-9359,-9506,-9653,-9801,-9948,-10095,-10242,-10388,-10535,-10681,
+    -10826,-10972,-11116,-11260,-11404,-11547,-11690,-11832,-11973,-12114,-12255,-12395,-12534,-12673,-12812,-12951,
+    -13089,-13228,-13366,-13504,-13643,-13781,-13920,-14060,-14199,-14339,-14480,-14622,-14764,-14907,-15051,-15196,
+    -15342,-15489,-15636,-15786,-15936,-16087,-16239,-16393,-16547,-16703,-16859,-17017,-17175,-17334,-17494,-17654,
+    -17815,-17977,-18139,-18301,-18463,-18625,-18787,-18949,-19111,-19272,-19432,-19592,-19751,-19910,-20067,-20223,
+    -20379,-20533,-20686,-20838,-20989,-21138,-21286,-21433,-21579,-21724,-21868,-22011,-22153,-22294,-22435,-22575,
+    -22715,-22855,-22994,-23134,-23274,-23414,-23555,-23697,-23840,-23984,-24129,-24275,-24424,-24573,-24725,-24879,
+    -25035,-25193,-25353,-25515,-25680,-25847,-26016,-26188,-26361,-26537,-26715,-26894,-27075,-27257,-27441,-27625,
+    -27810,-27996,-28181,-28367,-28551,-28735,-28917,-29097,-29275,-29450,-29622,-29791,-29955,-30115,-30270,-30420,
+    -30563,-30701,-30832,-30955,-31072,-31180,-31281,-31372,-31455,-31529,-31594,-31649,-31694,-31729,-31755,-31770};
+
+const int16_t table_halfsine_mip6[1024]={
+    -30840,-30837,-30830,-30816,-30798,-30775,-30746,-30712,-30674,-30630,-30581,-30527,-30468,-30404,-30335,-30262,
+    -30184,-30101,-30014,-29922,-29826,-29726,-29621,-29512,-29399,-29282,-29162,-29037,-28909,-28778,-28643,-28504,
+    -28363,-28218,-28070,-27920,-27767,-27611,-27453,-27292,-27129,-26964,-26797,-26628,-26457,-26284,-26110,-25935,
+    -25758,-25580,-25401,-25221,-25040,-24859,-24677,-24494,-24311,-24128,-23944,-23760,-23576,-23393,-23209,-23026,
+    -22843,-22660,-22478,-22297,-22116,-21935,-21756,-21577,-21399,-21222,-21047,-20872,-20698,-20525,-20353,-20183,
+    -20013,-19845,-19678,-19513,-19348,-19185,-19024,-18863,-18704,-18546,-18389,-18234,-18079,-17926,-17775,-17624,
+    -17475,-17327,-17180,-17034,-16889,-16745,-16602,-16460,-16320,-16180,-16040,-15902,-15765,-15628,-15492,-15356,
+    -15221,-15087,-14953,-14820,-14687,-14555,-14422,-14290,-14159,-14027,-13896,-13765,-13634,-13502,-13371,-13240,
+    -13109,-12978,-12846,-12714,-12582,-12450,-12318,-12185,-12052,-11918,-11784,-11650,-11515,-11380,-11245,-11109,
+    -10972,-10835,-10698,-10560,-10421,-10282,-10143,-10003,-9863,-9722,-9581,-9439,-9297,-9154,-9011,-8868,
+    -8724,-8580,-8436,-8291,-8146,-8001,-7855,-7710,-7564,-7418,-7272,-7125,-6979,-6833,-6686,-6540,
+    -6394,-6248,-6102,-5956,-5811,-5665,-5520,-5375,-5231,-5087,-4943,-4800,-4657,-4514,-4373,-4231,
+    -4090,-3950,-3811,-3672,-3533,-3395,-3258,-3122,-2987,-2852,-2718,-2584,-2452,-2320,-2189,-2059,
+    -1929,-1801,-1673,-1546,-1420,-1294,-1170,-1046,-923,-801,-679,-558,-438,-319,-201,-83,
+    34,150,266,381,496,609,723,835,947,1059,1170,1280,1391,1500,1609,1718,
+    1827,1935,2043,2150,2257,2364,2471,2578,2684,2790,2896,3002,3108,3213,3319,3425,
+    3530,3635,3741,3846,3952,4057,4162,4268,4373,4479,4585,4690,4796,4902,5008,5114,
+    5220,5326,5432,5538,5644,5750,5857,5963,6069,6176,6282,6388,6494,6600,6706,6812,
+    6918,7024,7130,7235,7341,7446,7551,7655,7760,7864,7968,8071,8174,8277,8379,8481,
+    8583,8684,8785,8885,8985,9084,9183,9281,9378,9475,9571,9667,9762,9856,9950,10043,
+    10135,10226,10317,10407,10497,10585,10673,10760,10847,10932,11017,11101,11184,11267,11348,11429,
+    11509,11589,11667,11745,11822,11899,11974,12049,12123,12197,12270,12342,12413,12484,12554,12624,
+    12693,12761,12829,12896,12963,13029,13094,13159,13224,13288,13352,13415,13478,13541,13603,13665,
+    13726,13787,13848,13909,13969,14029,14089,14148,14208,14267,14326,14384,14443,14501,14559,14617,
+    14675,14733,14791,14848,14906,14963,15020,15077,15134,15191,15247,15304,15360,15417,15473,15529,
+    15585,15640,15696,15751,15806,15861,15916,15971,16025,16079,16133,16186,16239,16292,16345,16397,
+    16449,16501,16552,16603,16653,16703,16752,16801,16850,16898,16945,16992,17038,17084,17129,17174,
+    17218,17261,17304,17346,17387,17428,17468,17507,17545,17583,17620,17656,17692,17727,17761,17794,
+    17826,17858,17889,17919,17948,17977,18005,18031,18058,18083,18108,18131,18154,18177,18198,18219,
+    18239,18258,18277,18295,18312,18328,18344,18359,18374,18387,18401,18413,18425,18437,18448,18458,
+    18468,18477,18486,18494,18502,18510,18517,18523,18529,18535,18541,18546,18550,18555,18559,18563,
+    18566,18569,18572,18575,18577,18580,18582,18583,18585,18586,18587,18588,18589,18590,18590,18591,
+    18591,18591,18590,18590,18589,18588,18587,18586,18585,18583,18582,18580,18577,18575,18572,18569,
+    18566,18563,18559,18555,18550,18546,18541,18535,18529,18523,18517,18510,18502,18494,18486,18477,
+    18468,18458,18448,18437,18425,18413,18401,18387,18374,18359,18344,18328,18312,18295,18277,18258,
+    18239,18219,18198,18177,18154,18131,18108,18083,18058,18031,18005,17977,17948,17919,17889,17858,
+    17826,17794,17761,17727,17692,17656,17620,17583,17545,17507,17468,17428,17387,17346,17304,17261,
+    17218,17174,17129,17084,17038,16992,16945,16898,16850,16801,16752,16703,16653,16603,16552,16501,
+    16449,16397,16345,16292,16239,16186,16133,16079,16025,15971,15916,15861,15806,15751,15696,15640,
+    15585,15529,15473,15417,15360,15304,15247,15191,15134,15077,15020,14963,14906,14848,14791,14733,
+    14675,14617,14559,14501,14443,14384,14326,14267,14208,14148,14089,14029,13969,13909,13848,13787,
+    13726,13665,13603,13541,13478,13415,13352,13288,13224,13159,13094,13029,12963,12896,12829,12761,
+    12693,12624,12554,12484,12413,12342,12270,12197,12123,12049,11974,11899,11822,11745,11667,11589,
+    11509,11429,11348,11267,11184,11101,11017,10932,10847,10760,10673,10585,10497,10407,10317,10226,
+    10135,10043,9950,9856,9762,9667,9571,9475,9378,9281,9183,9084,8985,8885,8785,8684,
+    8583,8481,8379,8277,8174,8071,7968,7864,7760,7655,7551,7446,7341,7235,7130,7024,
+    6918,6812,6706,6600,6494,6388,6282,6176,6069,5963,5857,5750,5644,5538,5432,5326,
+    5220,5114,5008,4902,4796,4690,4585,4479,4373,4268,4162,4057,3952,3846,3741,3635,
+    3530,3425,3319,3213,3108,3002,2896,2790,2684,2578,2471,2364,2257,2150,2043,1935,
+    1827,1718,1609,1500,1391,1280,1170,1059,947,835,723,609,496,381,266,150,
+    34,-83,-201,-319,-438,-558,-679,-801,-923,-1046,-1170,-1294,-1420,-1546,-1673,-1801,
+    -1929,-2059,-2189,-2320,-2452,-2584,-2718,-2852,-2987,-3122,-3258,-3395,-3533,-3672,-3811,-3950,
+    -4090,-4231,-4373,-4514,-4657,-4800,-4943,-5087,-5231,-5375,-5520,-5665,-5811,-5956,-6102,-6248,
+    -6394,-6540,-6686,-6833,-6979,-7125,-7272,-7418,-7564,-7710,-7855,-8001,-8146,-8291,-8436,-8580,
+    -8724,-8868,-9011,-9154,-9297,-9439,-9581,-9722,-9863,-10003,-10143,-10282,-10421,-10560,-10698,-10835,
+    -10972,-11109,-11245,-11380,-11515,-11650,-11784,-11918,-12052,-12185,-12318,-12450,-12582,-12714,-12846,-12978,
+    -13109,-13240,-13371,-13502,-13634,-13765,-13896,-14027,-14159,-14290,-14422,-14555,-14687,-14820,-14953,-15087,
+    -15221,-15356,-15492,-15628,-15765,-15902,-16040,-16180,-16320,-16460,-16602,-16745,-16889,-17034,-17180,-17327,
+    -17475,-17624,-17775,-17926,-18079,-18234,-18389,-18546,-18704,-18863,-19024,-19185,-19348,-19513,-19678,-19845,
+    -20013,-20183,-20353,-20525,-20698,-20872,-21047,-21222,-21399,-21577,-21756,-21935,-22116,-22297,-22478,-22660,
+    -22843,-23026,-23209,-23393,-23576,-23760,-23944,-24128,-24311,-24494,-24677,-24859,-25040,-25221,-25401,-25580,
+    -25758,-25935,-26110,-26284,-26457,-26628,-26797,-26964,-27129,-27292,-27453,-27611,-27767,-27920,-28070,-28218,
+    -28363,-28504,-28643,-28778,-28909,-29037,-29162,-29282,-29399,-29512,-29621,-29726,-29826,-29922,-30014,-30101,
+    -30184,-30262,-30335,-30404,-30468,-30527,-30581,-30630,-30674,-30712,-30746,-30775,-30798,-30816,-30830,-30837};
+
+const int16_t table_halfsine_mip7[1024]={
+    -29126,-29125,-29121,-29114,-29105,-29092,-29077,-29059,-29039,-29016,-28990,-28961,-28930,-28896,-28859,-28820,
+    -28778,-28733,-28686,-28636,-28583,-28528,-28470,-28410,-28347,-28281,-28213,-28143,-28070,-27995,-27917,-27837,
+    -27754,-27669,-27581,-27492,-27400,-27305,-27209,-27110,-27009,-26905,-26800,-26692,-26582,-26471,-26357,-26241,
+    -26123,-26003,-25881,-25757,-25632,-25504,-25375,-25244,-25111,-24976,-24840,-24702,-24562,-24421,-24278,-24134,
+    -23988,-23841,-23692,-23542,-23390,-23237,-23083,-22928,-22771,-22613,-22454,-22294,-22133,-21971,-21808,-21643,
+    -21478,-21312,-21145,-20977,-20809,-20639,-20469,-20298,-20127,-19954,-19782,-19608,-19434,-19260,-19085,-18910,
+    -18734,-18558,-18382,-18205,-18028,-17851,-17674,-17496,-17318,-17141,-16963,-16785,-16607,-16429,-16251,-16073,
+    -15895,-15717,-15539,-15362,-15185,-15008,-14831,-14655,-14478,-14303,-14127,-13952,-13777,-13603,-13429,-13255,
+    -13082,-12910,-12738,-12566,-12395,-12225,-12055,-11886,-11718,-11550,-11382,-11216,-11050,-10885,-10720,-10556,
+    -10393,-10231,-10070,-9909,-9749,-9590,-9431,-9273,-9117,-8961,-8806,-8651,-8498,-8345,-8193,-8042,
+    -7892,-7743,-7595,-7447,-7301,-7155,-7010,-6866,-6723,-6581,-6439,-6299,-6159,-6020,-5882,-5745,
+    -5609,-5473,-5339,-5205,-5072,-4940,-4809,-4679,-4549,-4420,-4292,-4165,-4038,-3913,-3788,-3664,
+    -3540,-3418,-3296,-3175,-3054,-2934,-2815,-2697,-2579,-2462,-2345,-2229,-2114,-2000,-1886,-1772,
+    -1659,-1547,-1435,-1324,-1213,-1103,-993,-884,-775,-667,-559,-452,-345,-238,-132,-26,
+    79,184,289,394,498,602,705,808,911,1014,1116,1218,1320,1422,1524,1625,
+    1726,1827,1928,2029,2129,2230,2330,2430,2531,2631,2730,2830,2930,3030,3129,3229,
+    3329,3428,3528,3627,3727,3826,3926,4025,4125,4224,4324,4423,4523,4623,4722,4822,
+    4922,5021,5121,5221,5321,5421,5521,5621,5721,5821,5921,6021,6121,6221,6322,6422,
+    6522,6623,6723,6823,6924,7024,7125,7225,7326,7426,7526,7627,7727,7828,7928,8028,
+    8128,8229,8329,8429,8529,8629,8728,8828,8928,9027,9126,9226,9325,9423,9522,9621,
+    9719,9817,9915,10013,10110,10208,10305,10402,10498,10594,10690,10786,10881,10976,11071,11165,
+    11260,11353,11446,11539,11632,11724,11816,11907,11998,12088,12178,12267,12356,12445,12533,12620,
+    12707,12794,12880,12965,13050,13134,13218,13301,13383,13465,13546,13627,13707,13786,13865,13943,
+    14020,14097,14173,14248,14323,14397,14470,14543,14615,14686,14756,14826,14895,14963,15030,15097,
+    15163,15228,15292,15356,15419,15481,15542,15603,15663,15722,15780,15837,15894,15950,16005,16059,
+    16112,16165,16217,16268,16318,16368,16417,16465,16512,16558,16604,16649,16693,16736,16779,16821,
+    16862,16902,16942,16980,17018,17056,17092,17128,17163,17198,17232,17265,17297,17329,17360,17390,
+    17420,17449,17477,17505,17532,17558,17584,17609,17634,17658,17681,17704,17726,17748,17769,17789,
+    17809,17829,17847,17866,17884,17901,17918,17934,17950,17966,17981,17995,18009,18023,18036,18049,
+    18061,18073,18085,18096,18107,18117,18127,18137,18146,18155,18164,18173,18181,18188,18196,18203,
+    18210,18216,18223,18229,18235,18240,18245,18250,18255,18260,18264,18268,18272,18276,18279,18282,
+    18285,18288,18291,18293,18295,18297,18299,18301,18302,18304,18305,18306,18307,18307,18308,18308,
+    18308,18308,18308,18307,18307,18306,18305,18304,18302,18301,18299,18297,18295,18293,18291,18288,
+    18285,18282,18279,18276,18272,18268,18264,18260,18255,18250,18245,18240,18235,18229,18223,18216,
+    18210,18203,18196,18188,18181,18173,18164,18155,18146,18137,18127,18117,18107,18096,18085,18073,
+    18061,18049,18036,18023,18009,17995,17981,17966,17950,17934,17918,17901,17884,17866,17847,17829,
+    17809,17789,17769,17748,17726,17704,17681,17658,17634,17609,17584,17558,17532,17505,17477,17449,
+    17420,17390,17360,17329,17297,17265,17232,17198,17163,17128,17092,17056,17018,16980,16942,16902,
+    16862,16821,16779,16736,16693,16649,16604,16558,16512,16465,16417,16368,16318,16268,16217,16165,
+    16112,16059,16005,15950,15894,15837,15780,15722,15663,15603,15542,15481,15419,15356,15292,15228,
+    15163,15097,15030,14963,14895,14826,14756,14686,14615,14543,14470,14397,14323,14248,14173,14097,
+    14020,13943,13865,13786,13707,13627,13546,13465,13383,13301,13218,13134,13050,12965,12880,12794,
+    12707,12620,12533,12445,12356,12267,12178,12088,11998,11907,11816,11724,11632,11539,11446,11353,
+    11260,11165,11071,10976,10881,10786,10690,10594,10498,10402,10305,10208,10110,10013,9915,9817,
+    9719,9621,9522,9423,9325,9226,9126,9027,8928,8828,8728,8629,8529,8429,8329,8229,
+    8128,8028,7928,7828,7727,7627,7526,7426,7326,7225,7125,7024,6924,6823,6723,6623,
+    6522,6422,6322,6221,6121,6021,5921,5821,5721,5621,5521,5421,5321,5221,5121,5021,
+    4922,4822,4722,4623,4523,4423,4324,4224,4125,4025,3926,3826,3727,3627,3528,3428,
+    3329,3229,3129,3030,2930,2830,2730,2631,2531,2430,2330,2230,2129,2029,1928,1827,
+    1726,1625,1524,1422,1320,1218,1116,1014,911,808,705,602,498,394,289,184,
+    79,-26,-132,-238,-345,-452,-559,-667,-775,-884,-993,-1103,-1213,-1324,-1435,-1547,
+    -1659,-1772,-1886,-2000,-2114,-2229,-2345,-2462,-2579,-2697,-2815,-2934,-3054,-3175,-3296,-3418,
+    -3540,-3664,-3788,-3913,-4038,-4165,-4292,-4420,-4549,-4679,-4809,-4940,-5072,-5205,-5339,-5473,
+    -5609,-5745,-5882,-6020,-6159,-6299,-6439,-6581,-6723,-6866,-7010,-7155,-7301,-7447,-7595,-7743,
+    -7892,-8042,-8193,-8345,-8498,-8651,-8806,-8961,-9117,-9273,-9431,-9590,-9749,-9909,-10070,-10231,
+    -10393,-10556,-10720,-10885,-11050,-11216,-11382,-11550,-11718,-11886,-12055,-12225,-12395,-12566,-12738,-12910,
+    -13082,-13255,-13429,-13603,-13777,-13952,-14127,-14303,-14478,-14655,-14831,-15008,-15185,-15362,-15539,-15717,
+    -15895,-16073,-16251,-16429,-16607,-16785,-16963,-17141,-17318,-17496,-17674,-17851,-18028,-18205,-18382,-18558,
+    -18734,-18910,-19085,-19260,-19434,-19608,-19782,-19954,-20127,-20298,-20469,-20639,-20809,-20977,-21145,-21312,
+    -21478,-21643,-21808,-21971,-22133,-22294,-22454,-22613,-22771,-22928,-23083,-23237,-23390,-23542,-23692,-23841,
+    -23988,-24134,-24278,-24421,-24562,-24702,-24840,-24976,-25111,-25244,-25375,-25504,-25632,-25757,-25881,-26003,
+    -26123,-26241,-26357,-26471,-26582,-26692,-26800,-26905,-27009,-27110,-27209,-27305,-27400,-27492,-27581,-27669,
+    -27754,-27837,-27917,-27995,-28070,-28143,-28213,-28281,-28347,-28410,-28470,-28528,-28583,-28636,-28686,-28733,
+    -28778,-28820,-28859,-28896,-28930,-28961,-28990,-29016,-29039,-29059,-29077,-29092,-29105,-29114,-29121,-29125};
+
+const int16_t table_halfsine_mip8[1024]={
+    -26214,-26213,-26211,-26207,-26202,-26195,-26187,-26177,-26166,-26154,-26140,-26124,-26107,-26089,-26069,-26047,
+    -26025,-26000,-25974,-25947,-25919,-25888,-25857,-25824,-25789,-25753,-25716,-25677,-25637,-25595,-25552,-25507,
+    -25461,-25414,-25365,-25315,-25263,-25211,-25156,-25100,-25043,-24985,-24925,-24863,-24801,-24737,-24672,-24605,
+    -24537,-24467,-24397,-24325,-24251,-24177,-24101,-24024,-23945,-23865,-23784,-23702,-23618,-23533,-23447,-23360,
+    -23271,-23181,-23090,-22998,-22905,-22810,-22714,-22617,-22519,-22420,-22319,-22218,-22115,-22011,-21906,-21800,
+    -21693,-21584,-21475,-21364,-21253,-21140,-21027,-20912,-20796,-20680,-20562,-20443,-20324,-20203,-20081,-19959,
+    -19835,-19711,-19585,-19459,-19332,-19204,-19075,-18945,-18814,-18683,-18550,-18417,-18283,-18148,-18012,-17876,
+    -17739,-17601,-17462,-17322,-17182,-17041,-16900,-16757,-16614,-16470,-16326,-16181,-16035,-15889,-15742,-15595,
+    -15447,-15298,-15149,-14999,-14848,-14698,-14546,-14394,-14242,-14089,-13936,-13782,-13627,-13473,-13317,-13162,
+    -13006,-12849,-12693,-12536,-12378,-12220,-12062,-11903,-11745,-11586,-11426,-11266,-11107,-10946,-10786,-10625,
+    -10464,-10303,-10142,-9981,-9819,-9657,-9495,-9333,-9171,-9009,-8846,-8684,-8521,-8358,-8196,-8033,
+    -7870,-7707,-7545,-7382,-7219,-7056,-6894,-6731,-6568,-6406,-6243,-6081,-5918,-5756,-5594,-5432,
+    -5270,-5109,-4947,-4786,-4625,-4464,-4303,-4142,-3982,-3822,-3662,-3502,-3343,-3184,-3025,-2867,
+    -2709,-2551,-2393,-2236,-2079,-1922,-1766,-1610,-1455,-1300,-1145,-991,-837,-683,-530,-377,
+    -225,-74,78,229,379,529,678,827,976,1123,1271,1418,1564,1710,1855,2000,
+    2144,2287,2430,2573,2715,2856,2997,3137,3276,3415,3553,3691,3828,3964,4100,4235,
+    4369,4503,4636,4768,4900,5031,5161,5291,5420,5548,5676,5803,5929,6054,6179,6303,
+    6426,6549,6671,6792,6912,7032,7151,7269,7386,7503,7619,7734,7848,7962,8075,8187,
+    8298,8409,8518,8627,8736,8843,8950,9056,9161,9265,9369,9472,9574,9675,9775,9875,
+    9974,10072,10169,10266,10362,10456,10551,10644,10737,10828,10919,11010,11099,11188,11276,11363,
+    11449,11535,11619,11703,11786,11869,11951,12031,12111,12191,12269,12347,12424,12501,12576,12651,
+    12725,12798,12871,12942,13013,13084,13153,13222,13290,13357,13424,13490,13555,13619,13683,13746,
+    13808,13870,13931,13991,14050,14109,14167,14224,14281,14337,14393,14447,14501,14554,14607,14659,
+    14711,14761,14811,14861,14909,14958,15005,15052,15098,15144,15189,15233,15277,15320,15363,15405,
+    15447,15487,15528,15567,15607,15645,15683,15721,15758,15794,15830,15865,15900,15934,15968,16001,
+    16034,16066,16098,16129,16160,16190,16220,16249,16278,16306,16334,16361,16388,16415,16441,16466,
+    16491,16516,16540,16564,16588,16611,16633,16656,16677,16699,16720,16740,16761,16781,16800,16819,
+    16838,16857,16875,16892,16910,16927,16943,16960,16976,16991,17007,17022,17037,17051,17065,17079,
+    17093,17106,17119,17131,17144,17156,17168,17179,17191,17202,17212,17223,17233,17243,17253,17262,
+    17271,17280,17289,17298,17306,17314,17322,17330,17337,17344,17351,17358,17364,17371,17377,17383,
+    17389,17394,17399,17405,17410,17414,17419,17423,17427,17431,17435,17439,17442,17446,17449,17452,
+    17455,17457,17460,17462,17464,17466,17468,17469,17471,17472,17473,17474,17474,17475,17475,17476,
+    17476,17476,17475,17475,17474,17474,17473,17472,17471,17469,17468,17466,17464,17462,17460,17457,
+    17455,17452,17449,17446,17442,17439,17435,17431,17427,17423,17419,17414,17410,17405,17399,17394,
+    17389,17383,17377,17371,17364,17358,17351,17344,17337,17330,17322,17314,17306,17298,17289,17280,
+    17271,17262,17253,17243,17233,17223,17212,17202,17191,17179,17168,17156,17144,17131,17119,17106,
+    17093,17079,17065,17051,17037,17022,17007,16991,16976,16960,16943,16927,16910,16892,16875,16857,
+    16838,16819,16800,16781,16761,16740,16720,16699,16677,16656,16633,16611,16588,16564,16540,16516,
+    16491,16466,16441,16415,16388,16361,16334,16306,16278,16249,16220,16190,16160,16129,16098,16066,
+    16034,16001,15968,15934,15900,15865,15830,15794,15758,15721,15683,15645,15607,15567,15528,15487,
+    15447,15405,15363,15320,15277,15233,15189,15144,15098,15052,15005,14958,14909,14861,14811,14761,
+    14711,14659,14607,14554,14501,14447,14393,14337,14281,14224,14167,14109,14050,13991,13931,13870,
+    13808,13746,13683,13619,13555,13490,13424,13357,13290,13222,13153,13084,13013,12942,12871,12798,
+    12725,12651,12576,12501,12424,12347,12269,12191,12111,12031,11951,11869,11786,11703,11619,11535,
+    11449,11363,11276,11188,11099,11010,10919,10828,10737,10644,10551,10456,10362,10266,10169,10072,
+    9974,9875,9775,9675,9574,9472,9369,9265,9161,9056,8950,8843,8736,8627,8518,8409,
+    8298,8187,8075,7962,7848,7734,7619,7503,7386,7269,7151,7032,6912,6792,6671,6549,
+    6426,6303,6179,6054,5929,5803,5676,5548,5420,5291,5161,5031,4900,4768,4636,4503,
+    4369,4235,4100,3964,3828,3691,3553,3415,3276,3137,2997,2856,2715,2573,2430,2287,
+    2144,2000,1855,1710,1564,1418,1271,1123,976,827,678,529,379,229,78,-74,
+    -225,-377,-530,-683,-837,-991,-1145,-1300,-1455,-1610,-1766,-1922,-2079,-2236,-2393,-2551,
+    -2709,-2867,-3025,-3184,-3343,-3502,-3662,-3822,-3982,-4142,-4303,-4464,-4625,-4786,-4947,-5109,
+    -5270,-5432,-5594,-5756,-5918,-6081,-6243,-6406,-6568,-6731,-6894,-7056,-7219,-7382,-7545,-7707,
+    -7870,-8033,-8196,-8358,-8521,-8684,-8846,-9009,-9171,-9333,-9495,-9657,-9819,-9981,-10142,-10303,
+    -10464,-10625,-10786,-10946,-11107,-11266,-11426,-11586,-11745,-11903,-12062,-12220,-12378,-12536,-12693,-12849,
+    -13006,-13162,-13317,-13473,-13627,-13782,-13936,-14089,-14242,-14394,-14546,-14698,-14848,-14999,-15149,-15298,
+    -15447,-15595,-15742,-15889,-16035,-16181,-16326,-16470,-16614,-16757,-16900,-17041,-17182,-17322,-17462,-17601,
+    -17739,-17876,-18012,-18148,-18283,-18417,-18550,-18683,-18814,-18945,-19075,-19204,-19332,-19459,-19585,-19711,
+    -19835,-19959,-20081,-20203,-20324,-20443,-20562,-20680,-20796,-20912,-21027,-21140,-21253,-21364,-21475,-21584,
+    -21693,-21800,-21906,-22011,-22115,-22218,-22319,-22420,-22519,-22617,-22714,-22810,-22905,-22998,-23090,-23181,
+    -23271,-23360,-23447,-23533,-23618,-23702,-23784,-23865,-23945,-24024,-24101,-24177,-24251,-24325,-24397,-24467,
+    -24537,-24605,-24672,-24737,-24801,-24863,-24925,-24985,-25043,-25100,-25156,-25211,-25263,-25315,-25365,-25414,
+    -25461,-25507,-25552,-25595,-25637,-25677,-25716,-25753,-25789,-25824,-25857,-25888,-25919,-25947,-25974,-26000,
+    -26025,-26047,-26069,-26089,-26107,-26124,-26140,-26154,-26166,-26177,-26187,-26195,-26202,-26207,-26211,-26213};
+
+const int16_t table_halfsine_mip9[1024]={
+    -21845,-21844,-21843,-21841,-21838,-21834,-21830,-21825,-21818,-21811,-21804,-21795,-21786,-21775,-21764,-21752,
+    -21740,-21726,-21712,-21696,-21680,-21664,-21646,-21628,-21608,-21588,-21567,-21546,-21523,-21500,-21476,-21451,
+    -21425,-21398,-21371,-21343,-21314,-21284,-21254,-21222,-21190,-21157,-21123,-21089,-21053,-21017,-20980,-20943,
+    -20904,-20865,-20825,-20784,-20742,-20700,-20657,-20613,-20568,-20522,-20476,-20429,-20381,-20332,-20283,-20233,
+    -20182,-20130,-20078,-20025,-19971,-19916,-19861,-19804,-19747,-19690,-19631,-19572,-19512,-19452,-19390,-19328,
+    -19265,-19202,-19138,-19073,-19007,-18940,-18873,-18805,-18737,-18668,-18598,-18527,-18456,-18384,-18311,-18237,
+    -18163,-18088,-18013,-17937,-17860,-17782,-17704,-17625,-17546,-17466,-17385,-17303,-17221,-17138,-17055,-16971,
+    -16886,-16801,-16715,-16628,-16541,-16453,-16365,-16276,-16186,-16096,-16005,-15913,-15821,-15728,-15635,-15541,
+    -15447,-15352,-15256,-15160,-15063,-14965,-14868,-14769,-14670,-14570,-14470,-14370,-14268,-14167,-14064,-13962,
+    -13858,-13754,-13650,-13545,-13440,-13334,-13227,-13120,-13013,-12905,-12797,-12688,-12578,-12469,-12358,-12248,
+    -12136,-12025,-11912,-11800,-11687,-11573,-11460,-11345,-11230,-11115,-11000,-10884,-10767,-10650,-10533,-10416,
+    -10298,-10179,-10060,-9941,-9822,-9702,-9581,-9461,-9340,-9218,-9097,-8975,-8852,-8730,-8607,-8483,
+    -8360,-8236,-8111,-7987,-7862,-7737,-7611,-7485,-7359,-7233,-7106,-6979,-6852,-6725,-6597,-6469,
+    -6341,-6213,-6084,-5955,-5826,-5697,-5567,-5438,-5308,-5178,-5047,-4917,-4786,-4655,-4524,-4393,
+    -4262,-4130,-3998,-3867,-3735,-3602,-3470,-3338,-3205,-3073,-2940,-2807,-2674,-2541,-2408,-2275,
+    -2141,-2008,-1874,-1741,-1607,-1473,-1340,-1206,-1072,-938,-804,-670,-536,-402,-268,-134,
+    0,134,268,402,536,670,804,938,1072,1206,1340,1473,1607,1741,1874,2008,
+    2141,2275,2408,2541,2674,2807,2940,3073,3205,3338,3470,3602,3735,3867,3998,4130,
+    4262,4393,4524,4655,4786,4917,5047,5178,5308,5438,5567,5697,5826,5955,6084,6213,
+    6341,6469,6597,6725,6852,6979,7106,7233,7359,7485,7611,7737,7862,7987,8111,8236,
+    8360,8483,8607,8730,8852,8975,9097,9219,9340,9461,9581,9702,9822,9941,10060,10179,
+    10298,10416,10533,10650,10767,10884,11000,11115,11230,11345,11460,11573,11687,11800,11913,12025,
+    12136,12248,12358,12469,12578,12688,12797,12905,13013,13120,13227,13334,13440,13545,13650,13754,
+    13858,13962,14064,14167,14268,14370,14470,14570,14670,14769,14868,14965,15063,15160,15256,15352,
+    15447,15541,15635,15728,15821,15913,16005,16096,16186,16276,16365,16453,16541,16628,16715,16801,
+    16886,16971,17055,17138,17221,17303,17385,17466,17546,17625,17704,17782,17860,17937,18013,18088,
+    18163,18237,18311,18384,18456,18527,18598,18668,18737,18805,18873,18940,19007,19073,19138,19202,
+    19265,19328,19390,19452,19512,19572,19631,19690,19747,19804,19861,19916,19971,20025,20078,20130,
+    20182,20233,20283,20332,20381,20429,20476,20522,20568,20613,20657,20700,20742,20784,20825,20865,
+    20904,20943,20980,21017,21053,21089,21123,21157,21190,21222,21254,21284,21314,21343,21371,21398,
+    21425,21451,21476,21500,21523,21546,21567,21588,21608,21628,21646,21664,21680,21696,21712,21726,
+    21740,21752,21764,21775,21786,21795,21804,21811,21818,21825,21830,21834,21838,21841,21843,21844,
+    21845,21844,21843,21841,21838,21834,21830,21825,21818,21811,21804,21795,21786,21775,21764,21752,
+    21740,21726,21712,21696,21680,21664,21646,21628,21608,21588,21567,21546,21523,21500,21476,21451,
+    21425,21398,21371,21343,21314,21284,21254,21222,21190,21157,21123,21089,21053,21017,20980,20943,
+    20904,20865,20825,20784,20742,20700,20657,20613,20568,20522,20476,20429,20381,20332,20283,20233,
+    20182,20130,20078,20025,19971,19916,19861,19804,19747,19690,19631,19572,19512,19452,19390,19328,
+    19265,19202,19138,19073,19007,18940,18873,18805,18737,18668,18598,18527,18456,18384,18311,18237,
+    18163,18088,18013,17937,17860,17782,17704,17625,17546,17466,17385,17303,17221,17138,17055,16971,
+    16886,16801,16715,16628,16541,16453,16365,16276,16186,16096,16005,15913,15821,15728,15635,15541,
+    15447,15352,15256,15160,15063,14965,14868,14769,14670,14570,14470,14370,14268,14167,14064,13962,
+    13858,13754,13650,13545,13440,13334,13227,13120,13013,12905,12797,12688,12578,12469,12358,12248,
+    12136,12025,11913,11800,11687,11573,11460,11345,11230,11115,11000,10884,10767,10650,10533,10416,
+    10298,10179,10060,9941,9822,9702,9581,9461,9340,9219,9097,8975,8852,8730,8607,8483,
+    8360,8236,8111,7987,7862,7737,7611,7485,7359,7233,7106,6979,6852,6725,6597,6469,
+    6341,6213,6084,5955,5826,5697,5567,5438,5308,5178,5047,4917,4786,4655,4524,4393,
+    4262,4130,3998,3867,3735,3602,3470,3338,3205,3073,2940,2807,2674,2541,2408,2275,
+    2141,2008,1874,1741,1607,1473,1340,1206,1072,938,804,670,536,402,268,134,
+    0,-134,-268,-402,-536,-670,-804,-938,-1072,-1206,-1340,-1473,-1607,-1741,-1874,-2008,
+    -2141,-2275,-2408,-2541,-2674,-2807,-2940,-3073,-3205,-3338,-3470,-3602,-3735,-3867,-3998,-4130,
+    -4262,-4393,-4524,-4655,-4786,-4917,-5047,-5178,-5308,-5438,-5567,-5697,-5826,-5955,-6084,-6213,
+    -6341,-6469,-6597,-6725,-6852,-6979,-7106,-7233,-7359,-7485,-7611,-7737,-7862,-7987,-8111,-8236,
+    -8360,-8483,-8607,-8730,-8852,-8975,-9097,-9218,-9340,-9461,-9581,-9702,-9822,-9941,-10060,-10179,
+    -10298,-10416,-10533,-10650,-10767,-10884,-11000,-11115,-11230,-11345,-11460,-11573,-11687,-11800,-11912,-12025,
+    -12136,-12248,-12358,-12469,-12578,-12688,-12797,-12905,-13013,-13120,-13227,-13334,-13440,-13545,-13650,-13754,
+    -13858,-13962,-14064,-14167,-14268,-14370,-14470,-14570,-14670,-14769,-14868,-14965,-15063,-15160,-15256,-15352,
+    -15447,-15541,-15635,-15728,-15821,-15913,-16005,-16096,-16186,-16276,-16365,-16453,-16541,-16628,-16715,-16801,
+    -16886,-16971,-17055,-17138,-17221,-17303,-17385,-17466,-17546,-17625,-17704,-17782,-17860,-17937,-18013,-18088,
+    -18163,-18237,-18311,-18384,-18456,-18527,-18598,-18668,-18737,-18805,-18873,-18940,-19007,-19073,-19138,-19202,
+    -19265,-19328,-19390,-19452,-19512,-19572,-19631,-19690,-19747,-19804,-19861,-19916,-19971,-20025,-20078,-20130,
+    -20182,-20233,-20283,-20332,-20381,-20429,-20476,-20522,-20568,-20613,-20657,-20700,-20742,-20784,-20825,-20865,
+    -20904,-20943,-20980,-21017,-21053,-21089,-21123,-21157,-21190,-21222,-21254,-21284,-21314,-21343,-21371,-21398,
+    -21425,-21451,-21476,-21500,-21523,-21546,-21567,-21588,-21608,-21628,-21646,-21664,-21680,-21696,-21712,-21726,
+    -21740,-21752,-21764,-21775,-21786,-21795,-21804,-21811,-21818,-21825,-21830,-21834,-21838,-21841,-21843,-21844};
+
+const int16_t table_rectsine_mip2[1024]={
+    -15188,-15003,-14752,-14454,-14134,-13814,-13508,-13218,-12938,-12656,-12368,-12070,-11766,-11463,-11165,-10875,
+    -10588,-10301,-10011,-9715,-9416,-9118,-8824,-8534,-8247,-7960,-7670,-7377,-7082,-6788,-6496,-6209,
+    -5923,-5638,-5350,-5060,-4768,-4478,-4190,-3904,-3621,-3338,-3053,-2767,-2480,-2194,-1910,-1628,
+    -1348,-1068,-787,-504,-222,59,339,616,892,1168,1445,1723,2000,2276,2550,2822,
+    3093,3364,3636,3908,4180,4450,4719,4985,5251,5516,5781,6047,6312,6576,6838,7098,
+    7357,7616,7875,8135,8393,8650,8905,9158,9410,9662,9914,10166,10417,10666,10914,11159,
+    11403,11647,11892,12136,12379,12620,12859,13096,13332,13568,13803,14039,14273,14506,14736,14965,
+    15192,15419,15645,15872,16097,16320,16542,16761,16979,17196,17413,17630,17845,18059,18270,18479,
+    18687,18895,19102,19308,19513,19716,19918,20117,20315,20512,20708,20903,21097,21289,21480,21668,
+    21855,22041,22227,22411,22594,22775,22954,23131,23307,23482,23656,23829,24000,24169,24336,24502,
+    24665,24828,24990,25151,25310,25467,25622,25776,25927,26078,26228,26377,26524,26668,26811,26951,
+    27090,27228,27365,27501,27635,27767,27897,28024,28151,28276,28400,28523,28644,28763,28880,28994,
+    29107,29219,29330,29439,29547,29652,29755,29857,29957,30055,30153,30248,30342,30434,30523,30610,
+    30696,30781,30865,30947,31027,31105,31180,31254,31326,31396,31466,31534,31600,31663,31725,31785,
+    31843,31899,31955,32009,32060,32110,32157,32202,32246,32288,32329,32369,32407,32442,32474,32505,
+    32535,32563,32589,32614,32637,32658,32677,32693,32709,32722,32735,32745,32754,32759,32763,32765,
+    32766,32765,32763,32759,32754,32745,32735,32722,32709,32693,32677,32658,32637,32614,32589,32563,
+    32535,32505,32474,32442,32407,32369,32329,32288,32246,32202,32157,32110,32060,32009,31955,31899,
+    31843,31785,31725,31663,31600,31534,31466,31396,31326,31254,31180,31105,31027,30947,30865,30781,
+    30696,30610,30523,30434,30342,30248,30153,30055,29957,29857,29755,29652,29547,29439,29330,29219,
+    29107,28994,28880,28763,28644,28523,28400,28276,28151,28024,27897,27767,27635,27501,27365,27228,
+    27090,26951,26811,26668,26524,26377,26228,26078,25927,25776,25622,25467,25310,25151,24990,24828,
+    24665,24502,24336,24169,24000,23829,23656,23482,23307,23131,22954,22775,22594,22411,22227,22041,
+    21855,21668,21480,21289,21097,20903,20708,20512,20315,20117,19918,19716,19513,19308,19102,18895,
+    18687,18479,18270,18059,17845,17630,17413,17196,16979,16761,16542,16320,16097,15872,15645,15419,
+    15192,14965,14736,14506,14273,14039,13803,13568,13332,13096,12859,12620,12379,12136,11892,11647,
+    11403,11159,10914,10666,10417,10166,9914,9662,9410,9158,8905,8650,8393,8135,7875,7616,
+    7357,7098,6838,6576,6312,6047,5781,5516,5251,4985,4719,4450,4180,3908,3636,3364,
+    3093,2822,2550,2276,2000,1723,1445,1168,892,616,339,59,-222,-504,-787,-1068,
+    -1348,-1628,-1910,-2194,-2480,-2767,-3053,-3338,-3621,-3904,-4190,-4478,-4768,-5060,-5350,-5638,
+    -5923,-6209,-6496,-6788,-7082,-7377,-7670,-7960,-8247,-8534,-8824,-9118,-9416,-9715,-10011,-10301,
+    -10588,-10875,-11165,-11463,-11766,-12070,-12368,-12656,-12938,-13218,-13508,-13814,-14134,-14454,-14752,-15003,
+    -15188,-15298,-15341,-15338,-15313,-15288,-15278,-15282,-15296,-15309,-15315,-15311,-15301,-15293,-15289,-15292,
+    -15300,-15306,-15309,-15306,-15300,-15295,-15293,-15295,-15300,-15305,-15306,-15304,-15300,-15296,-15295,-15297,
+    -15301,-15304,-15305,-15303,-15299,-15297,-15296,-15298,-15301,-15303,-15304,-15302,-15299,-15297,-15297,-15298,
+    -15301,-15303,-15303,-15302,-15299,-15297,-15297,-15299,-15301,-15302,-15303,-15301,-15299,-15298,-15298,-15299,
+    -15301,-15302,-15302,-15301,-15299,-15298,-15298,-15299,-15301,-15302,-15302,-15301,-15299,-15298,-15298,-15299,
+    -15301,-15302,-15302,-15301,-15299,-15298,-15298,-15299,-15301,-15302,-15302,-15300,-15299,-15298,-15299,-15300,
+    -15301,-15302,-15301,-15300,-15299,-15298,-15299,-15300,-15301,-15302,-15301,-15300,-15299,-15298,-15299,-15300,
+    -15301,-15301,-15301,-15300,-15299,-15299,-15299,-15300,-15301,-15301,-15301,-15300,-15299,-15299,-15299,-15300,
+    -15301,-15301,-15301,-15300,-15299,-15299,-15299,-15300,-15301,-15301,-15301,-15300,-15299,-15299,-15299,-15300,
+    -15301,-15301,-15301,-15300,-15299,-15299,-15299,-15300,-15301,-15301,-15301,-15300,-15299,-15299,-15299,-15300,
+    -15301,-15301,-15301,-15300,-15299,-15299,-15299,-15300,-15301,-15301,-15301,-15300,-15299,-15299,-15299,-15300,
+    -15301,-15301,-15301,-15300,-15299,-15299,-15300,-15300,-15301,-15301,-15300,-15300,-15299,-15299,-15300,-15300,
+    -15301,-15301,-15300,-15300,-15299,-15299,-15300,-15300,-15301,-15301,-15300,-15300,-15299,-15299,-15300,-15300,
+    -15301,-15301,-15300,-15300,-15299,-15299,-15300,-15300,-15301,-15301,-15300,-15299,-15299,-15299,-15300,-15301,
+    -15301,-15301,-15300,-15299,-15299,-15299,-15300,-15301,-15301,-15301,-15300,-15299,-15299,-15299,-15300,-15301,
+    -15301,-15301,-15300,-15299,-15299,-15299,-15300,-15301,-15301,-15301,-15300,-15299,-15299,-15299,-15300,-15301,
+    -15301,-15301,-15300,-15299,-15299,-15299,-15300,-15301,-15301,-15301,-15300,-15299,-15299,-15299,-15300,-15301,
+    -15301,-15301,-15300,-15299,-15299,-15299,-15300,-15301,-15301,-15301,-15300,-15299,-15299,-15299,-15300,-15301,
+    -15301,-15301,-15300,-15299,-15299,-15299,-15300,-15301,-15301,-15300,-15300,-15299,-15299,-15300,-15300,-15301,
+    -15301,-15300,-15300,-15299,-15299,-15300,-15300,-15301,-15301,-15300,-15300,-15299,-15299,-15300,-15300,-15301,
+    -15301,-15300,-15300,-15299,-15299,-15300,-15300,-15301,-15301,-15300,-15300,-15299,-15299,-15300,-15301,-15301,
+    -15301,-15300,-15299,-15299,-15299,-15300,-15301,-15301,-15301,-15300,-15299,-15299,-15299,-15300,-15301,-15301,
+    -15301,-15300,-15299,-15299,-15299,-15300,-15301,-15301,-15301,-15300,-15299,-15299,-15299,-15300,-15301,-15301,
+    -15301,-15300,-15299,-15299,-15299,-15300,-15301,-15301,-15301,-15300,-15299,-15299,-15299,-15300,-15301,-15301,
+    -15301,-15300,-15299,-15299,-15299,-15300,-15301,-15301,-15301,-15300,-15299,-15299,-15299,-15300,-15301,-15301,
+    -15301,-15300,-15299,-15298,-15299,-15300,-15301,-15302,-15301,-15300,-15299,-15298,-15299,-15300,-15301,-15302,
+    -15301,-15300,-15299,-15298,-15299,-15300,-15302,-15302,-15301,-15299,-15298,-15298,-15299,-15301,-15302,-15302,
+    -15301,-15299,-15298,-15298,-15299,-15301,-15302,-15302,-15301,-15299,-15298,-15298,-15299,-15301,-15302,-15302,
+    -15301,-15299,-15298,-15298,-15299,-15301,-15303,-15302,-15301,-15299,-15297,-15297,-15299,-15302,-15303,-15303,
+    -15301,-15298,-15297,-15297,-15299,-15302,-15304,-15303,-15301,-15298,-15296,-15297,-15299,-15303,-15305,-15304,
+    -15301,-15297,-15295,-15296,-15300,-15304,-15306,-15305,-15300,-15295,-15293,-15295,-15300,-15306,-15309,-15306,
+    -15300,-15292,-15289,-15293,-15301,-15311,-15315,-15309,-15296,-15282,-15278,-15288,-15313,-15338,-15341,-15298};
+
+const int16_t table_rectsine_mip3[1024]={
+    -15068,-14902,-14699,-14463,-14198,-13909,-13603,-13287,-12966,-12646,-12330,-12022,-11721,-11429,-11143,-10862,
+    -10583,-10303,-10021,-9735,-9444,-9149,-8851,-8550,-8248,-7947,-7649,-7353,-7062,-6773,-6488,-6206,
+    -5924,-5641,-5358,-5073,-4785,-4495,-4204,-3911,-3619,-3328,-3038,-2751,-2467,-2185,-1905,-1627,
+    -1350,-1072,-794,-515,-234,48,331,614,896,1177,1457,1734,2009,2282,2553,2822,
+    3091,3360,3630,3900,4170,4441,4713,4984,5254,5523,5791,6056,6319,6580,6839,7098,
+    7355,7613,7870,8127,8385,8643,8901,9159,9415,9669,9922,10173,10422,10669,10914,11158,
+    11401,11644,11887,12129,12372,12614,12856,13097,13337,13575,13811,14045,14277,14507,14735,14963,
+    15189,15415,15641,15866,16091,16316,16540,16762,16983,17203,17420,17635,17848,18059,18269,18477,
+    18685,18892,19098,19304,19509,19713,19917,20119,20319,20517,20714,20908,21100,21290,21479,21666,
+    21852,22038,22223,22407,22590,22773,22954,23134,23312,23487,23661,23832,24002,24169,24335,24499,
+    24663,24825,24986,25147,25307,25466,25623,25778,25932,26083,26233,26380,26525,26668,26809,26949,
+    27088,27225,27362,27498,27632,27766,27898,28028,28155,28281,28405,28526,28645,28762,28878,28992,
+    29104,29216,29327,29436,29545,29652,29757,29860,29961,30060,30156,30250,30342,30433,30521,30608,
+    30694,30778,30862,30944,31025,31104,31181,31257,31330,31401,31469,31536,31600,31662,31723,31782,
+    31840,31896,31952,32006,32059,32110,32159,32206,32250,32293,32333,32370,32406,32440,32472,32502,
+    32532,32560,32587,32612,32636,32659,32679,32697,32713,32726,32737,32746,32753,32758,32761,32763,
+    32763,32763,32761,32758,32753,32746,32737,32726,32713,32697,32679,32659,32636,32612,32587,32560,
+    32532,32502,32472,32440,32406,32370,32333,32293,32250,32206,32159,32110,32059,32006,31952,31896,
+    31840,31782,31723,31662,31600,31536,31469,31401,31330,31257,31181,31104,31025,30944,30862,30778,
+    30694,30608,30521,30433,30342,30250,30156,30060,29961,29860,29757,29652,29545,29436,29327,29216,
+    29104,28992,28878,28762,28645,28526,28405,28281,28155,28028,27898,27766,27632,27498,27362,27225,
+    27088,26949,26809,26668,26525,26380,26233,26083,25932,25778,25623,25466,25307,25147,24986,24825,
+    24663,24499,24335,24169,24002,23832,23661,23487,23312,23134,22954,22773,22590,22407,22223,22038,
+    21852,21666,21479,21290,21100,20908,20714,20517,20319,20119,19917,19713,19509,19304,19098,18892,
+    18685,18477,18269,18059,17848,17635,17420,17203,16983,16762,16540,16316,16091,15866,15641,15415,
+    15189,14963,14735,14507,14277,14045,13811,13575,13337,13097,12856,12614,12372,12129,11887,11644,
+    11401,11158,10914,10669,10422,10173,9922,9669,9415,9159,8901,8643,8385,8127,7870,7613,
+    7355,7098,6839,6580,6319,6056,5791,5523,5254,4984,4713,4441,4170,3900,3630,3360,
+    3091,2822,2553,2282,2009,1734,1457,1177,896,614,331,48,-234,-515,-794,-1072,
+    -1350,-1627,-1905,-2185,-2467,-2751,-3038,-3328,-3619,-3911,-4204,-4495,-4785,-5073,-5358,-5641,
+    -5924,-6206,-6488,-6773,-7062,-7353,-7649,-7947,-8248,-8550,-8851,-9149,-9444,-9735,-10021,-10303,
+    -10583,-10862,-11143,-11429,-11721,-12022,-12330,-12646,-12966,-13287,-13603,-13909,-14198,-14463,-14699,-14902,
+    -15068,-15197,-15289,-15348,-15377,-15383,-15372,-15350,-15324,-15298,-15277,-15263,-15257,-15259,-15267,-15280,
+    -15294,-15308,-15319,-15326,-15328,-15326,-15320,-15311,-15301,-15292,-15284,-15280,-15279,-15281,-15287,-15293,
+    -15301,-15308,-15313,-15316,-15316,-15314,-15310,-15304,-15298,-15293,-15289,-15286,-15287,-15289,-15293,-15297,
+    -15302,-15307,-15310,-15312,-15311,-15309,-15306,-15302,-15297,-15293,-15291,-15290,-15290,-15292,-15295,-15299,
+    -15303,-15306,-15308,-15309,-15308,-15307,-15304,-15300,-15297,-15294,-15292,-15292,-15293,-15294,-15297,-15300,
+    -15303,-15306,-15307,-15308,-15307,-15305,-15302,-15299,-15297,-15294,-15293,-15293,-15294,-15296,-15298,-15301,
+    -15303,-15305,-15306,-15306,-15305,-15304,-15301,-15299,-15297,-15295,-15294,-15294,-15295,-15297,-15299,-15301,
+    -15304,-15305,-15306,-15305,-15304,-15303,-15301,-15298,-15296,-15295,-15295,-15295,-15296,-15298,-15300,-15302,
+    -15304,-15305,-15305,-15305,-15304,-15302,-15300,-15298,-15296,-15295,-15295,-15296,-15297,-15298,-15300,-15302,
+    -15304,-15305,-15305,-15304,-15303,-15301,-15299,-15298,-15296,-15296,-15295,-15296,-15297,-15299,-15301,-15302,
+    -15304,-15304,-15304,-15304,-15302,-15301,-15299,-15298,-15296,-15296,-15296,-15297,-15298,-15299,-15301,-15303,
+    -15304,-15304,-15304,-15303,-15302,-15300,-15299,-15297,-15296,-15296,-15296,-15297,-15298,-15300,-15301,-15303,
+    -15304,-15304,-15304,-15303,-15301,-15300,-15298,-15297,-15296,-15296,-15296,-15297,-15299,-15300,-15302,-15303,
+    -15304,-15304,-15303,-15302,-15301,-15300,-15298,-15297,-15296,-15296,-15297,-15298,-15299,-15301,-15302,-15303,
+    -15304,-15304,-15303,-15302,-15301,-15299,-15298,-15297,-15296,-15296,-15297,-15298,-15300,-15301,-15302,-15303,
+    -15304,-15304,-15303,-15302,-15300,-15299,-15298,-15297,-15296,-15297,-15297,-15298,-15300,-15301,-15303,-15303,
+    -15304,-15303,-15303,-15301,-15300,-15298,-15297,-15297,-15296,-15297,-15298,-15299,-15300,-15302,-15303,-15304,
+    -15304,-15303,-15302,-15301,-15300,-15298,-15297,-15296,-15296,-15297,-15298,-15299,-15301,-15302,-15303,-15304,
+    -15304,-15303,-15302,-15301,-15299,-15298,-15297,-15296,-15296,-15297,-15298,-15300,-15301,-15302,-15303,-15304,
+    -15304,-15303,-15302,-15300,-15299,-15297,-15296,-15296,-15296,-15297,-15298,-15300,-15301,-15303,-15304,-15304,
+    -15304,-15303,-15301,-15300,-15298,-15297,-15296,-15296,-15296,-15297,-15299,-15300,-15302,-15303,-15304,-15304,
+    -15304,-15303,-15301,-15299,-15298,-15297,-15296,-15296,-15296,-15298,-15299,-15301,-15302,-15304,-15304,-15304,
+    -15304,-15302,-15301,-15299,-15297,-15296,-15295,-15296,-15296,-15298,-15299,-15301,-15303,-15304,-15305,-15305,
+    -15304,-15302,-15300,-15298,-15297,-15296,-15295,-15295,-15296,-15298,-15300,-15302,-15304,-15305,-15305,-15305,
+    -15304,-15302,-15300,-15298,-15296,-15295,-15295,-15295,-15296,-15298,-15301,-15303,-15304,-15305,-15306,-15305,
+    -15304,-15301,-15299,-15297,-15295,-15294,-15294,-15295,-15297,-15299,-15301,-15304,-15305,-15306,-15306,-15305,
+    -15303,-15301,-15298,-15296,-15294,-15293,-15293,-15294,-15297,-15299,-15302,-15305,-15307,-15308,-15307,-15306,
+    -15303,-15300,-15297,-15294,-15293,-15292,-15292,-15294,-15297,-15300,-15304,-15307,-15308,-15309,-15308,-15306,
+    -15303,-15299,-15295,-15292,-15290,-15290,-15291,-15293,-15297,-15302,-15306,-15309,-15311,-15312,-15310,-15307,
+    -15302,-15297,-15293,-15289,-15287,-15286,-15289,-15293,-15298,-15304,-15310,-15314,-15316,-15316,-15313,-15308,
+    -15301,-15293,-15287,-15281,-15279,-15280,-15284,-15292,-15301,-15311,-15320,-15326,-15328,-15326,-15319,-15308,
+    -15294,-15280,-15267,-15259,-15257,-15263,-15277,-15298,-15324,-15350,-15372,-15383,-15377,-15348,-15289,-15197};
+
+const int16_t table_rectsine_mip4[1024]={
+    -14838,-14681,-14505,-14311,-14099,-13870,-13625,-13365,-13093,-12808,-12514,-12211,-11902,-11588,-11270,-10950,
+    -10630,-10311,-9993,-9678,-9367,-9059,-8756,-8457,-8163,-7872,-7586,-7303,-7023,-6745,-6468,-6193,
+    -5918,-5643,-5367,-5089,-4811,-4530,-4247,-3963,-3676,-3388,-3098,-2806,-2514,-2221,-1927,-1634,
+    -1342,-1051,-761,-473,-188,96,378,657,933,1208,1480,1751,2020,2287,2554,2820,
+    3085,3351,3616,3882,4149,4416,4683,4952,5220,5490,5759,6029,6298,6567,6836,7103,
+    7370,7634,7898,8159,8418,8676,8931,9185,9436,9685,9933,10179,10424,10667,10910,11151,
+    11393,11633,11874,12114,12354,12594,12834,13074,13313,13553,13792,14030,14268,14504,14739,14973,
+    15206,15436,15665,15892,16117,16340,16561,16779,16996,17211,17424,17636,17846,18055,18262,18469,
+    18675,18881,19085,19289,19493,19696,19899,20101,20302,20502,20702,20900,21097,21293,21487,21679,
+    21870,22058,22245,22429,22611,22791,22969,23145,23319,23491,23661,23830,23997,24162,24327,24490,
+    24653,24814,24975,25134,25293,25451,25608,25764,25919,26073,26226,26377,26526,26674,26819,26963,
+    27105,27244,27382,27517,27649,27780,27908,28035,28159,28281,28402,28521,28638,28754,28869,28982,
+    29094,29205,29315,29424,29532,29639,29745,29849,29952,30053,30153,30251,30347,30442,30534,30624,
+    30711,30797,30880,30960,31039,31115,31189,31260,31330,31398,31464,31529,31591,31653,31713,31772,
+    31829,31886,31941,31995,32047,32099,32149,32197,32244,32290,32333,32375,32414,32451,32486,32519,
+    32550,32578,32603,32626,32647,32666,32683,32697,32710,32721,32730,32737,32743,32747,32751,32752,
+    32753,32752,32751,32747,32743,32737,32730,32721,32710,32697,32683,32666,32647,32626,32603,32578,
+    32550,32519,32486,32451,32414,32375,32333,32290,32244,32197,32149,32099,32047,31995,31941,31886,
+    31829,31772,31713,31653,31591,31529,31464,31398,31330,31260,31189,31115,31039,30960,30880,30797,
+    30711,30624,30534,30442,30347,30251,30153,30053,29952,29849,29745,29639,29532,29424,29315,29205,
+    29094,28982,28869,28754,28638,28521,28402,28281,28159,28035,27908,27780,27649,27517,27382,27244,
+    27105,26963,26819,26674,26526,26377,26226,26073,25919,25764,25608,25451,25293,25134,24975,24814,
+    24653,24490,24327,24162,23997,23830,23661,23491,23319,23145,22969,22791,22611,22429,22245,22058,
+    21870,21679,21487,21293,21097,20900,20702,20502,20302,20101,19899,19696,19493,19289,19085,18881,
+    18675,18469,18262,18055,17846,17636,17424,17211,16996,16779,16561,16340,16117,15892,15665,15436,
+    15206,14973,14739,14504,14268,14030,13792,13553,13313,13074,12834,12594,12354,12114,11874,11633,
+    11393,11151,10910,10667,10424,10179,9933,9685,9436,9185,8931,8676,8418,8159,7898,7634,
+    7370,7103,6836,6567,6298,6029,5759,5490,5220,4952,4683,4416,4149,3882,3616,3351,
+    3085,2820,2554,2287,2020,1751,1480,1208,933,657,378,96,-188,-473,-761,-1051,
+    -1342,-1634,-1927,-2221,-2514,-2806,-3098,-3388,-3676,-3963,-4247,-4530,-4811,-5089,-5367,-5643,
+    -5918,-6193,-6468,-6745,-7023,-7303,-7586,-7872,-8163,-8457,-8756,-9059,-9367,-9678,-9993,-10311,
+    -10630,-10950,-11270,-11588,-11902,-12211,-12514,-12808,-13093,-13365,-13625,-13870,-14099,-14311,-14505,-14681,
+    -14838,-14976,-15095,-15196,-15278,-15344,-15394,-15429,-15451,-15461,-15461,-15453,-15438,-15417,-15394,-15368,
+    -15341,-15315,-15291,-15269,-15251,-15236,-15225,-15218,-15216,-15217,-15222,-15230,-15240,-15253,-15266,-15281,
+    -15295,-15309,-15322,-15333,-15342,-15349,-15353,-15356,-15355,-15353,-15348,-15341,-15333,-15324,-15315,-15305,
+    -15295,-15286,-15278,-15271,-15265,-15261,-15259,-15259,-15260,-15263,-15267,-15273,-15279,-15287,-15294,-15302,
+    -15309,-15316,-15322,-15326,-15330,-15332,-15333,-15333,-15331,-15328,-15324,-15319,-15313,-15307,-15301,-15295,
+    -15289,-15284,-15280,-15276,-15274,-15272,-15272,-15273,-15276,-15279,-15282,-15287,-15292,-15297,-15302,-15307,
+    -15312,-15316,-15319,-15322,-15323,-15324,-15324,-15322,-15320,-15317,-15313,-15309,-15304,-15300,-15295,-15291,
+    -15287,-15284,-15281,-15280,-15279,-15279,-15280,-15281,-15284,-15287,-15290,-15294,-15298,-15302,-15306,-15310,
+    -15313,-15316,-15318,-15319,-15319,-15319,-15318,-15316,-15313,-15310,-15307,-15303,-15300,-15296,-15292,-15289,
+    -15287,-15284,-15283,-15282,-15282,-15283,-15284,-15286,-15289,-15292,-15295,-15299,-15302,-15306,-15309,-15311,
+    -15314,-15315,-15316,-15317,-15316,-15315,-15314,-15312,-15309,-15306,-15303,-15299,-15296,-15293,-15290,-15288,
+    -15286,-15285,-15284,-15284,-15285,-15286,-15288,-15290,-15293,-15296,-15299,-15302,-15305,-15308,-15310,-15312,
+    -15314,-15315,-15315,-15315,-15314,-15312,-15310,-15308,-15305,-15302,-15299,-15296,-15294,-15291,-15289,-15287,
+    -15286,-15285,-15285,-15286,-15287,-15289,-15291,-15294,-15296,-15299,-15302,-15305,-15308,-15310,-15312,-15313,
+    -15314,-15314,-15314,-15313,-15312,-15310,-15308,-15305,-15302,-15299,-15296,-15294,-15291,-15289,-15288,-15287,
+    -15286,-15286,-15287,-15288,-15289,-15291,-15294,-15296,-15299,-15302,-15305,-15307,-15310,-15312,-15313,-15314,
+    -15314,-15314,-15313,-15312,-15310,-15307,-15305,-15302,-15299,-15296,-15294,-15291,-15289,-15288,-15287,-15286,
+    -15286,-15287,-15288,-15289,-15291,-15294,-15296,-15299,-15302,-15305,-15308,-15310,-15312,-15313,-15314,-15314,
+    -15314,-15313,-15312,-15310,-15308,-15305,-15302,-15299,-15296,-15294,-15291,-15289,-15287,-15286,-15285,-15285,
+    -15286,-15287,-15289,-15291,-15294,-15296,-15299,-15302,-15305,-15308,-15310,-15312,-15314,-15315,-15315,-15315,
+    -15314,-15312,-15310,-15308,-15305,-15302,-15299,-15296,-15293,-15290,-15288,-15286,-15285,-15284,-15284,-15285,
+    -15286,-15288,-15290,-15293,-15296,-15299,-15303,-15306,-15309,-15312,-15314,-15315,-15316,-15317,-15316,-15315,
+    -15314,-15311,-15309,-15306,-15302,-15299,-15295,-15292,-15289,-15286,-15284,-15283,-15282,-15282,-15283,-15284,
+    -15287,-15289,-15292,-15296,-15300,-15303,-15307,-15310,-15313,-15316,-15318,-15319,-15319,-15319,-15318,-15316,
+    -15313,-15310,-15306,-15302,-15298,-15294,-15290,-15287,-15284,-15281,-15280,-15279,-15279,-15280,-15281,-15284,
+    -15287,-15291,-15295,-15300,-15304,-15309,-15313,-15317,-15320,-15322,-15324,-15324,-15323,-15322,-15319,-15316,
+    -15312,-15307,-15302,-15297,-15292,-15287,-15282,-15279,-15276,-15273,-15272,-15272,-15274,-15276,-15280,-15284,
+    -15289,-15295,-15301,-15307,-15313,-15319,-15324,-15328,-15331,-15333,-15333,-15332,-15330,-15326,-15322,-15316,
+    -15309,-15302,-15294,-15287,-15279,-15273,-15267,-15263,-15260,-15259,-15259,-15261,-15265,-15271,-15278,-15286,
+    -15295,-15305,-15315,-15324,-15333,-15341,-15348,-15353,-15355,-15356,-15353,-15349,-15342,-15333,-15322,-15309,
+    -15295,-15281,-15266,-15253,-15240,-15230,-15222,-15217,-15216,-15218,-15225,-15236,-15251,-15269,-15291,-15315,
+    -15341,-15368,-15394,-15417,-15438,-15453,-15461,-15461,-15451,-15429,-15394,-15344,-15278,-15196,-15095,-14976};
+
+const int16_t table_rectsine_mip5[1024]={
+    -14401,-14249,-14086,-13915,-13733,-13543,-13342,-13133,-12915,-12689,-12454,-12211,-11960,-11702,-11437,-11166,
+    -10888,-10605,-10317,-10023,-9726,-9424,-9119,-8812,-8501,-8189,-7874,-7559,-7243,-6926,-6610,-6293,
+    -5977,-5663,-5349,-5037,-4726,-4418,-4111,-3807,-3505,-3206,-2909,-2615,-2323,-2034,-1748,-1464,
+    -1183,-904,-628,-353,-81,189,457,724,989,1253,1516,1778,2038,2298,2558,2817,
+    3076,3335,3594,3853,4112,4372,4631,4892,5152,5414,5675,5938,6200,6464,6727,6991,
+    7256,7520,7785,8050,8314,8579,8843,9107,9370,9633,9895,10156,10415,10674,10932,11188,
+    11442,11695,11947,12196,12444,12690,12934,13176,13416,13654,13890,14124,14355,14585,14813,15039,
+    15263,15485,15705,15924,16140,16356,16570,16782,16993,17203,17411,17619,17825,18031,18236,18439,
+    18643,18845,19047,19248,19448,19648,19848,20047,20245,20443,20640,20836,21032,21228,21422,21616,
+    21809,22001,22192,22381,22570,22758,22944,23129,23312,23494,23674,23852,24029,24203,24376,24547,
+    24716,24882,25047,25209,25370,25528,25684,25837,25988,26138,26285,26429,26572,26713,26851,26988,
+    27122,27255,27386,27515,27642,27768,27892,28014,28135,28255,28373,28490,28606,28720,28834,28946,
+    29057,29167,29275,29383,29490,29595,29700,29803,29906,30007,30107,30206,30303,30399,30494,30588,
+    30679,30770,30858,30946,31031,31114,31196,31275,31353,31429,31502,31573,31642,31709,31774,31836,
+    31896,31953,32008,32061,32112,32160,32205,32249,32290,32329,32365,32400,32432,32463,32491,32517,
+    32541,32564,32584,32603,32621,32636,32650,32663,32674,32684,32692,32699,32704,32709,32712,32714,
+    32714,32714,32712,32709,32704,32699,32692,32684,32674,32663,32650,32636,32621,32603,32584,32564,
+    32541,32517,32491,32463,32432,32400,32365,32329,32290,32249,32205,32160,32112,32061,32008,31953,
+    31896,31836,31774,31709,31642,31573,31502,31429,31353,31275,31196,31114,31031,30946,30858,30770,
+    30679,30588,30494,30399,30303,30206,30107,30007,29906,29803,29700,29595,29490,29383,29275,29167,
+    29057,28946,28834,28720,28606,28490,28373,28255,28135,28014,27892,27768,27642,27515,27386,27255,
+    27122,26988,26851,26713,26572,26429,26285,26138,25988,25837,25684,25528,25370,25209,25047,24882,
+    24716,24547,24376,24203,24029,23852,23674,23494,23312,23129,22944,22758,22570,22381,22192,22001,
+    21809,21616,21422,21228,21032,20836,20640,20443,20245,20047,19848,19648,19448,19248,19047,18845,
+    18643,18439,18236,18031,17825,17619,17411,17203,16993,16782,16570,16356,16140,15924,15705,15485,
+    15263,15039,14813,14585,14355,14124,13890,13654,13416,13176,12934,12690,12444,12196,11947,11695,
+    11442,11188,10932,10674,10415,10156,9895,9633,9370,9107,8843,8579,8314,8050,7785,7520,
+    7256,6991,6727,6464,6200,5938,5675,5414,5152,4892,4631,4372,4112,3853,3594,3335,
+    3076,2817,2558,2298,2038,1778,1516,1253,989,724,457,189,-81,-353,-628,-904,
+    -1183,-1464,-1748,-2034,-2323,-2615,-2909,-3206,-3505,-3807,-4111,-4418,-4726,-5037,-5349,-5663,
+    -5977,-6293,-6610,-6926,-7243,-7559,-7874,-8189,-8501,-8812,-9119,-9424,-9726,-10023,-10317,-10605,
+    -10888,-11166,-11437,-11702,-11960,-12211,-12454,-12689,-12915,-13133,-13342,-13543,-13733,-13915,-14086,-14249,
+    -14401,-14543,-14676,-14799,-14913,-15017,-15112,-15197,-15274,-15342,-15401,-15452,-15496,-15532,-15561,-15583,
+    -15600,-15610,-15615,-15614,-15610,-15601,-15588,-15572,-15554,-15533,-15510,-15486,-15460,-15434,-15408,-15381,
+    -15355,-15329,-15304,-15280,-15258,-15237,-15217,-15200,-15184,-15171,-15159,-15150,-15143,-15138,-15135,-15135,
+    -15136,-15139,-15144,-15151,-15159,-15168,-15179,-15191,-15204,-15217,-15231,-15246,-15261,-15275,-15290,-15304,
+    -15318,-15331,-15344,-15356,-15367,-15376,-15385,-15393,-15399,-15404,-15408,-15410,-15411,-15411,-15409,-15407,
+    -15403,-15398,-15392,-15385,-15378,-15369,-15360,-15351,-15341,-15331,-15321,-15310,-15300,-15290,-15280,-15271,
+    -15262,-15254,-15246,-15239,-15233,-15228,-15223,-15220,-15217,-15216,-15215,-15216,-15217,-15219,-15222,-15226,
+    -15231,-15236,-15242,-15248,-15255,-15263,-15271,-15279,-15287,-15295,-15303,-15311,-15319,-15326,-15333,-15340,
+    -15346,-15351,-15356,-15360,-15364,-15367,-15369,-15370,-15370,-15370,-15369,-15367,-15364,-15361,-15357,-15353,
+    -15348,-15342,-15336,-15330,-15323,-15317,-15310,-15303,-15296,-15289,-15283,-15276,-15270,-15265,-15259,-15255,
+    -15250,-15247,-15244,-15242,-15240,-15239,-15239,-15239,-15240,-15242,-15244,-15247,-15250,-15254,-15259,-15264,
+    -15269,-15274,-15280,-15286,-15292,-15298,-15305,-15311,-15317,-15322,-15328,-15333,-15337,-15342,-15345,-15349,
+    -15351,-15354,-15355,-15356,-15356,-15356,-15355,-15354,-15351,-15349,-15346,-15342,-15338,-15333,-15328,-15323,
+    -15318,-15312,-15307,-15301,-15295,-15289,-15284,-15279,-15273,-15269,-15264,-15260,-15257,-15254,-15251,-15249,
+    -15248,-15247,-15246,-15247,-15248,-15249,-15251,-15254,-15257,-15260,-15264,-15269,-15273,-15278,-15283,-15289,
+    -15294,-15300,-15305,-15311,-15316,-15321,-15326,-15331,-15335,-15339,-15343,-15346,-15348,-15350,-15351,-15352,
+    -15353,-15352,-15351,-15350,-15348,-15346,-15343,-15339,-15335,-15331,-15326,-15321,-15316,-15311,-15305,-15300,
+    -15294,-15289,-15283,-15278,-15273,-15269,-15264,-15260,-15257,-15254,-15251,-15249,-15248,-15247,-15246,-15247,
+    -15248,-15249,-15251,-15254,-15257,-15260,-15264,-15269,-15273,-15279,-15284,-15289,-15295,-15301,-15307,-15312,
+    -15318,-15323,-15328,-15333,-15338,-15342,-15346,-15349,-15351,-15354,-15355,-15356,-15356,-15356,-15355,-15354,
+    -15351,-15349,-15345,-15342,-15337,-15333,-15328,-15322,-15317,-15311,-15305,-15298,-15292,-15286,-15280,-15274,
+    -15269,-15264,-15259,-15254,-15250,-15247,-15244,-15242,-15240,-15239,-15239,-15239,-15240,-15242,-15244,-15247,
+    -15250,-15255,-15259,-15265,-15270,-15276,-15283,-15289,-15296,-15303,-15310,-15317,-15323,-15330,-15336,-15342,
+    -15348,-15353,-15357,-15361,-15364,-15367,-15369,-15370,-15370,-15370,-15369,-15367,-15364,-15360,-15356,-15351,
+    -15346,-15340,-15333,-15326,-15319,-15311,-15303,-15295,-15287,-15279,-15271,-15263,-15255,-15248,-15242,-15236,
+    -15231,-15226,-15222,-15219,-15217,-15216,-15215,-15216,-15217,-15220,-15223,-15228,-15233,-15239,-15246,-15254,
+    -15262,-15271,-15280,-15290,-15300,-15310,-15321,-15331,-15341,-15351,-15360,-15369,-15378,-15385,-15392,-15398,
+    -15403,-15407,-15409,-15411,-15411,-15410,-15408,-15404,-15399,-15393,-15385,-15376,-15367,-15356,-15344,-15331,
+    -15318,-15304,-15290,-15275,-15261,-15246,-15231,-15217,-15204,-15191,-15179,-15168,-15159,-15151,-15144,-15139,
+    -15136,-15135,-15135,-15138,-15143,-15150,-15159,-15171,-15184,-15200,-15217,-15237,-15258,-15280,-15304,-15329,
+    -15355,-15381,-15408,-15434,-15460,-15486,-15510,-15533,-15554,-15572,-15588,-15601,-15610,-15614,-15615,-15610,
+    -15600,-15583,-15561,-15532,-15496,-15452,-15401,-15342,-15274,-15197,-15112,-15017,-14913,-14799,-14676,-14543};
+
+const int16_t table_rectsine_mip6[1024]={
+    -13601,-13450,-13295,-13135,-12970,-12799,-12624,-12444,-12258,-12068,-11873,-11673,-11468,-11259,-11045,-10827,
+    -10604,-10377,-10145,-9909,-9670,-9426,-9178,-8927,-8671,-8413,-8151,-7885,-7616,-7345,-7070,-6792,
+    -6512,-6229,-5944,-5657,-5367,-5075,-4782,-4486,-4189,-3891,-3591,-3290,-2988,-2685,-2381,-2076,
+    -1771,-1466,-1160,-854,-548,-242,64,370,675,979,1283,1587,1889,2191,2491,2790,
+    3089,3386,3681,3975,4268,4559,4849,5137,5423,5707,5990,6270,6549,6826,7101,7373,
+    7644,7913,8180,8444,8707,8968,9226,9483,9737,9989,10239,10488,10734,10978,11220,11461,
+    11699,11936,12171,12403,12635,12864,13092,13318,13542,13765,13986,14206,14424,14641,14857,15071,
+    15284,15496,15706,15915,16124,16331,16537,16742,16946,17149,17352,17553,17754,17954,18153,18351,
+    18549,18746,18942,19137,19332,19527,19720,19913,20106,20298,20489,20680,20870,21059,21248,21436,
+    21624,21811,21997,22182,22367,22551,22735,22918,23099,23280,23461,23640,23818,23995,24172,24347,
+    24521,24695,24867,25037,25207,25375,25542,25708,25872,26035,26196,26355,26514,26670,26825,26978,
+    27129,27279,27427,27573,27717,27859,27999,28137,28273,28407,28539,28668,28796,28921,29045,29166,
+    29284,29401,29515,29627,29737,29844,29949,30052,30152,30250,30346,30440,30531,30619,30706,30790,
+    30872,30952,31029,31104,31177,31248,31317,31383,31447,31510,31570,31628,31684,31738,31789,31840,
+    31888,31934,31978,32021,32061,32100,32138,32173,32207,32239,32270,32299,32326,32352,32376,32399,
+    32421,32441,32459,32477,32493,32507,32520,32532,32543,32552,32560,32567,32572,32577,32580,32582,
+    32582,32582,32580,32577,32572,32567,32560,32552,32543,32532,32520,32507,32493,32477,32459,32441,
+    32421,32399,32376,32352,32326,32299,32270,32239,32207,32173,32138,32100,32061,32021,31978,31934,
+    31888,31840,31789,31738,31684,31628,31570,31510,31447,31383,31317,31248,31177,31104,31029,30952,
+    30872,30790,30706,30619,30531,30440,30346,30250,30152,30052,29949,29844,29737,29627,29515,29401,
+    29284,29166,29045,28921,28796,28668,28539,28407,28273,28137,27999,27859,27717,27573,27427,27279,
+    27129,26978,26825,26670,26514,26355,26196,26035,25872,25708,25542,25375,25207,25037,24867,24695,
+    24521,24347,24172,23995,23818,23640,23461,23280,23099,22918,22735,22551,22367,22182,21997,21811,
+    21624,21436,21248,21059,20870,20680,20489,20298,20106,19913,19720,19527,19332,19137,18942,18746,
+    18549,18351,18153,17954,17754,17553,17352,17149,16946,16742,16537,16331,16124,15915,15706,15496,
+    15284,15071,14857,14641,14424,14206,13986,13765,13542,13318,13092,12864,12635,12403,12171,11936,
+    11699,11461,11220,10978,10734,10488,10239,9989,9737,9483,9226,8968,8707,8444,8180,7913,
+    7644,7373,7101,6826,6549,6270,5990,5707,5423,5137,4849,4559,4268,3975,3681,3386,
+    3089,2790,2491,2191,1889,1587,1283,979,675,370,64,-242,-548,-854,-1160,-1466,
+    -1771,-2076,-2381,-2685,-2988,-3290,-3591,-3891,-4189,-4486,-4782,-5075,-5367,-5657,-5944,-6229,
+    -6512,-6792,-7070,-7345,-7616,-7885,-8151,-8413,-8671,-8927,-9178,-9426,-9670,-9909,-10145,-10377,
+    -10604,-10827,-11045,-11259,-11468,-11673,-11873,-12068,-12258,-12444,-12624,-12799,-12970,-13135,-13295,-13450,
+    -13601,-13745,-13885,-14020,-14149,-14274,-14393,-14508,-14617,-14721,-14820,-14915,-15004,-15089,-15169,-15245,
+    -15315,-15381,-15443,-15500,-15553,-15602,-15647,-15688,-15724,-15757,-15786,-15812,-15834,-15853,-15868,-15880,
+    -15890,-15896,-15899,-15900,-15898,-15894,-15888,-15879,-15869,-15856,-15842,-15825,-15808,-15789,-15768,-15747,
+    -15724,-15701,-15676,-15651,-15625,-15599,-15572,-15545,-15518,-15491,-15464,-15437,-15410,-15383,-15357,-15331,
+    -15306,-15281,-15257,-15233,-15210,-15189,-15168,-15148,-15128,-15110,-15093,-15077,-15062,-15049,-15036,-15025,
+    -15014,-15005,-14997,-14990,-14985,-14981,-14977,-14975,-14974,-14975,-14976,-14978,-14982,-14986,-14992,-14998,
+    -15005,-15013,-15022,-15032,-15043,-15054,-15066,-15078,-15091,-15105,-15119,-15133,-15148,-15163,-15178,-15194,
+    -15209,-15225,-15241,-15257,-15272,-15288,-15303,-15319,-15334,-15348,-15363,-15377,-15390,-15403,-15416,-15428,
+    -15440,-15451,-15461,-15471,-15480,-15488,-15496,-15503,-15509,-15515,-15520,-15524,-15527,-15530,-15531,-15532,
+    -15533,-15532,-15531,-15529,-15526,-15523,-15518,-15514,-15508,-15502,-15496,-15488,-15481,-15472,-15464,-15454,
+    -15445,-15435,-15424,-15414,-15403,-15391,-15380,-15368,-15357,-15345,-15333,-15321,-15309,-15297,-15285,-15273,
+    -15262,-15251,-15239,-15229,-15218,-15208,-15198,-15188,-15179,-15171,-15162,-15155,-15147,-15141,-15134,-15129,
+    -15124,-15119,-15115,-15112,-15109,-15107,-15106,-15105,-15105,-15105,-15106,-15108,-15110,-15113,-15117,-15121,
+    -15125,-15130,-15136,-15142,-15148,-15155,-15163,-15171,-15179,-15188,-15197,-15206,-15215,-15225,-15235,-15245,
+    -15256,-15266,-15277,-15287,-15298,-15308,-15319,-15329,-15340,-15350,-15360,-15370,-15379,-15389,-15398,-15406,
+    -15415,-15423,-15430,-15437,-15444,-15450,-15456,-15462,-15466,-15471,-15474,-15477,-15480,-15482,-15484,-15484,
+    -15485,-15484,-15484,-15482,-15480,-15477,-15474,-15471,-15466,-15462,-15456,-15450,-15444,-15437,-15430,-15423,
+    -15415,-15406,-15398,-15389,-15379,-15370,-15360,-15350,-15340,-15329,-15319,-15308,-15298,-15287,-15277,-15266,
+    -15256,-15245,-15235,-15225,-15215,-15206,-15197,-15188,-15179,-15171,-15163,-15155,-15148,-15142,-15136,-15130,
+    -15125,-15121,-15117,-15113,-15110,-15108,-15106,-15105,-15105,-15105,-15106,-15107,-15109,-15112,-15115,-15119,
+    -15124,-15129,-15134,-15141,-15147,-15155,-15162,-15171,-15179,-15188,-15198,-15208,-15218,-15229,-15239,-15251,
+    -15262,-15273,-15285,-15297,-15309,-15321,-15333,-15345,-15357,-15368,-15380,-15391,-15403,-15414,-15424,-15435,
+    -15445,-15454,-15464,-15472,-15481,-15488,-15496,-15502,-15508,-15514,-15518,-15523,-15526,-15529,-15531,-15532,
+    -15533,-15532,-15531,-15530,-15527,-15524,-15520,-15515,-15509,-15503,-15496,-15488,-15480,-15471,-15461,-15451,
+    -15440,-15428,-15416,-15403,-15390,-15377,-15363,-15348,-15334,-15319,-15303,-15288,-15272,-15257,-15241,-15225,
+    -15209,-15194,-15178,-15163,-15148,-15133,-15119,-15105,-15091,-15078,-15066,-15054,-15043,-15032,-15022,-15013,
+    -15005,-14998,-14992,-14986,-14982,-14978,-14976,-14975,-14974,-14975,-14977,-14981,-14985,-14990,-14997,-15005,
+    -15014,-15025,-15036,-15049,-15062,-15077,-15093,-15110,-15128,-15148,-15168,-15189,-15210,-15233,-15257,-15281,
+    -15306,-15331,-15357,-15383,-15410,-15437,-15464,-15491,-15518,-15545,-15572,-15599,-15625,-15651,-15676,-15701,
+    -15724,-15747,-15768,-15789,-15808,-15825,-15842,-15856,-15869,-15879,-15888,-15894,-15898,-15900,-15899,-15896,
+    -15890,-15880,-15868,-15853,-15834,-15812,-15786,-15757,-15724,-15688,-15647,-15602,-15553,-15500,-15443,-15381,
+    -15315,-15245,-15169,-15089,-15004,-14915,-14820,-14721,-14617,-14508,-14393,-14274,-14149,-14020,-13885,-13745};
+
+const int16_t table_rectsine_mip7[1024]={
+    -12240,-12091,-11940,-11785,-11628,-11469,-11306,-11141,-10973,-10802,-10629,-10453,-10274,-10093,-9909,-9722,
+    -9533,-9342,-9148,-8951,-8752,-8550,-8346,-8140,-7931,-7720,-7506,-7290,-7072,-6852,-6629,-6404,
+    -6178,-5949,-5718,-5484,-5249,-5012,-4773,-4532,-4290,-4045,-3799,-3550,-3301,-3049,-2796,-2541,
+    -2285,-2028,-1769,-1508,-1246,-983,-719,-453,-186,82,351,621,892,1164,1436,1710,
+    1985,2260,2536,2812,3089,3367,3645,3924,4203,4482,4762,5042,5322,5602,5882,6163,
+    6443,6723,7004,7284,7564,7844,8123,8402,8681,8959,9237,9514,9791,10067,10343,10617,
+    10891,11165,11437,11709,11979,12249,12518,12785,13052,13318,13582,13845,14107,14368,14627,14885,
+    15142,15397,15651,15903,16154,16403,16651,16897,17141,17384,17625,17864,18102,18338,18572,18804,
+    19034,19263,19490,19714,19937,20158,20377,20594,20808,21021,21232,21441,21647,21852,22054,22255,
+    22453,22649,22843,23035,23224,23412,23597,23780,23961,24140,24316,24491,24663,24833,25000,25166,
+    25329,25490,25649,25806,25960,26112,26263,26410,26556,26700,26841,26980,27117,27252,27384,27515,
+    27643,27770,27894,28016,28136,28254,28370,28483,28595,28705,28812,28918,29022,29123,29223,29321,
+    29417,29511,29603,29693,29781,29867,29952,30035,30116,30195,30272,30347,30421,30493,30564,30632,
+    30699,30764,30828,30890,30950,31009,31066,31122,31176,31228,31279,31328,31376,31423,31468,31511,
+    31553,31594,31633,31670,31707,31742,31775,31807,31838,31868,31896,31923,31948,31972,31995,32017,
+    32037,32056,32074,32091,32106,32120,32133,32145,32155,32164,32172,32179,32184,32188,32191,32193,
+    32194,32193,32191,32188,32184,32179,32172,32164,32155,32145,32133,32120,32106,32091,32074,32056,
+    32037,32017,31995,31972,31948,31923,31896,31868,31838,31807,31775,31742,31707,31670,31633,31594,
+    31553,31511,31468,31423,31376,31328,31279,31228,31176,31122,31066,31009,30950,30890,30828,30764,
+    30699,30632,30564,30493,30421,30347,30272,30195,30116,30035,29952,29867,29781,29693,29603,29511,
+    29417,29321,29223,29123,29022,28918,28812,28705,28595,28483,28370,28254,28136,28016,27894,27770,
+    27643,27515,27384,27252,27117,26980,26841,26700,26556,26410,26263,26112,25960,25806,25649,25490,
+    25329,25166,25000,24833,24663,24491,24316,24140,23961,23780,23597,23412,23224,23035,22843,22649,
+    22453,22255,22054,21852,21647,21441,21232,21021,20808,20594,20377,20158,19937,19714,19490,19263,
+    19034,18804,18572,18338,18102,17864,17625,17384,17141,16897,16651,16403,16154,15903,15651,15397,
+    15142,14885,14627,14368,14107,13845,13582,13318,13052,12785,12518,12249,11979,11709,11437,11165,
+    10891,10617,10343,10067,9791,9514,9237,8959,8681,8402,8123,7844,7564,7284,7004,6723,
+    6443,6163,5882,5602,5322,5042,4762,4482,4203,3924,3645,3367,3089,2812,2536,2260,
+    1985,1710,1436,1164,892,621,351,82,-186,-453,-719,-983,-1246,-1508,-1769,-2028,
+    -2285,-2541,-2796,-3049,-3301,-3550,-3799,-4045,-4290,-4532,-4773,-5012,-5249,-5484,-5718,-5949,
+    -6178,-6404,-6629,-6852,-7072,-7290,-7506,-7720,-7931,-8140,-8346,-8550,-8752,-8951,-9148,-9342,
+    -9533,-9722,-9909,-10093,-10274,-10453,-10629,-10802,-10973,-11141,-11306,-11469,-11628,-11785,-11940,-12091,
+    -12240,-12386,-12530,-12670,-12808,-12943,-13075,-13205,-13331,-13455,-13576,-13694,-13810,-13923,-14033,-14140,
+    -14245,-14346,-14446,-14542,-14636,-14727,-14815,-14901,-14984,-15064,-15142,-15217,-15290,-15360,-15427,-15492,
+    -15555,-15615,-15673,-15728,-15781,-15831,-15879,-15925,-15969,-16010,-16049,-16086,-16121,-16153,-16184,-16212,
+    -16238,-16263,-16285,-16305,-16324,-16340,-16355,-16368,-16379,-16389,-16397,-16403,-16407,-16410,-16411,-16411,
+    -16410,-16407,-16402,-16396,-16389,-16381,-16371,-16360,-16348,-16335,-16321,-16306,-16290,-16272,-16254,-16235,
+    -16215,-16195,-16173,-16151,-16128,-16105,-16080,-16056,-16030,-16005,-15978,-15952,-15925,-15897,-15869,-15841,
+    -15813,-15784,-15756,-15727,-15698,-15669,-15640,-15610,-15581,-15552,-15523,-15494,-15465,-15437,-15408,-15380,
+    -15352,-15324,-15296,-15269,-15242,-15216,-15190,-15164,-15139,-15114,-15089,-15065,-15042,-15019,-14997,-14975,
+    -14954,-14933,-14913,-14894,-14875,-14857,-14840,-14823,-14807,-14791,-14777,-14763,-14749,-14737,-14725,-14714,
+    -14703,-14694,-14685,-14676,-14669,-14662,-14656,-14651,-14646,-14643,-14640,-14637,-14636,-14635,-14635,-14636,
+    -14637,-14639,-14642,-14645,-14649,-14654,-14659,-14666,-14672,-14680,-14688,-14696,-14705,-14715,-14726,-14736,
+    -14748,-14760,-14772,-14785,-14799,-14813,-14827,-14842,-14857,-14872,-14888,-14905,-14921,-14938,-14956,-14973,
+    -14991,-15009,-15028,-15046,-15065,-15084,-15103,-15122,-15142,-15161,-15180,-15200,-15220,-15239,-15259,-15278,
+    -15298,-15318,-15337,-15356,-15375,-15395,-15413,-15432,-15451,-15469,-15487,-15505,-15523,-15540,-15557,-15574,
+    -15590,-15606,-15622,-15638,-15653,-15667,-15681,-15695,-15709,-15721,-15734,-15746,-15757,-15768,-15779,-15789,
+    -15798,-15807,-15816,-15823,-15831,-15837,-15844,-15849,-15854,-15859,-15863,-15866,-15868,-15871,-15872,-15873,
+    -15873,-15873,-15872,-15871,-15868,-15866,-15863,-15859,-15854,-15849,-15844,-15837,-15831,-15823,-15816,-15807,
+    -15798,-15789,-15779,-15768,-15757,-15746,-15734,-15721,-15709,-15695,-15681,-15667,-15653,-15638,-15622,-15606,
+    -15590,-15574,-15557,-15540,-15523,-15505,-15487,-15469,-15451,-15432,-15413,-15395,-15375,-15356,-15337,-15318,
+    -15298,-15278,-15259,-15239,-15220,-15200,-15180,-15161,-15142,-15122,-15103,-15084,-15065,-15046,-15028,-15009,
+    -14991,-14973,-14956,-14938,-14921,-14905,-14888,-14872,-14857,-14842,-14827,-14813,-14799,-14785,-14772,-14760,
+    -14748,-14736,-14726,-14715,-14705,-14696,-14688,-14680,-14672,-14666,-14659,-14654,-14649,-14645,-14642,-14639,
+    -14637,-14636,-14635,-14635,-14636,-14637,-14640,-14643,-14646,-14651,-14656,-14662,-14669,-14676,-14685,-14694,
+    -14703,-14714,-14725,-14737,-14749,-14763,-14777,-14791,-14807,-14823,-14840,-14857,-14875,-14894,-14913,-14933,
+    -14954,-14975,-14997,-15019,-15042,-15065,-15089,-15114,-15139,-15164,-15190,-15216,-15242,-15269,-15296,-15324,
+    -15352,-15380,-15408,-15437,-15465,-15494,-15523,-15552,-15581,-15610,-15640,-15669,-15698,-15727,-15756,-15784,
+    -15813,-15841,-15869,-15897,-15925,-15952,-15978,-16005,-16030,-16056,-16080,-16105,-16128,-16151,-16173,-16195,
+    -16215,-16235,-16254,-16272,-16290,-16306,-16321,-16335,-16348,-16360,-16371,-16381,-16389,-16396,-16402,-16407,
+    -16410,-16411,-16411,-16410,-16407,-16403,-16397,-16389,-16379,-16368,-16355,-16340,-16324,-16305,-16285,-16263,
+    -16238,-16212,-16184,-16153,-16121,-16086,-16049,-16010,-15969,-15925,-15879,-15831,-15781,-15728,-15673,-15615,
+    -15555,-15492,-15427,-15360,-15290,-15217,-15142,-15064,-14984,-14901,-14815,-14727,-14636,-14542,-14446,-14346,
+    -14245,-14140,-14033,-13923,-13810,-13694,-13576,-13455,-13331,-13205,-13075,-12943,-12808,-12670,-12530,-12386};
+
+const int16_t table_rectsine_mip8[1024]={
+    -10200,-10052,-9902,-9751,-9598,-9444,-9288,-9131,-8972,-8811,-8650,-8486,-8322,-8156,-7988,-7819,
+    -7648,-7477,-7303,-7129,-6953,-6775,-6596,-6416,-6234,-6052,-5867,-5682,-5495,-5307,-5118,-4927,
+    -4735,-4542,-4347,-4152,-3955,-3757,-3558,-3358,-3156,-2953,-2750,-2545,-2339,-2132,-1924,-1715,
+    -1505,-1293,-1081,-868,-654,-439,-223,-6,212,431,650,870,1092,1314,1537,1760,
+    1985,2210,2436,2662,2889,3117,3346,3575,3805,4035,4266,4498,4730,4962,5195,5429,
+    5662,5897,6132,6367,6602,6838,7074,7311,7547,7784,8022,8259,8497,8735,8973,9211,
+    9449,9687,9926,10164,10402,10641,10879,11118,11356,11594,11832,12070,12308,12545,12783,13020,
+    13257,13493,13730,13966,14201,14437,14672,14906,15140,15374,15607,15840,16072,16303,16534,16765,
+    16994,17223,17452,17680,17907,18133,18359,18584,18808,19031,19253,19475,19695,19915,20134,20351,
+    20568,20784,20999,21213,21425,21637,21847,22057,22265,22472,22678,22882,23086,23288,23489,23688,
+    23887,24084,24279,24473,24666,24857,25047,25236,25423,25608,25792,25974,26155,26335,26512,26688,
+    26863,27035,27207,27376,27544,27710,27874,28036,28197,28356,28513,28668,28822,28973,29123,29271,
+    29417,29561,29703,29843,29981,30117,30251,30383,30514,30642,30768,30892,31013,31133,31251,31366,
+    31480,31591,31700,31807,31912,32015,32115,32213,32309,32403,32494,32584,32671,32755,32767,32767,
+    32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,
+    32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,
+    32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,
+    32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,
+    32767,32767,32767,32755,32671,32584,32494,32403,32309,32213,32115,32015,31912,31807,31700,31591,
+    31480,31366,31251,31133,31013,30892,30768,30642,30514,30383,30251,30117,29981,29843,29703,29561,
+    29417,29271,29123,28973,28822,28668,28513,28356,28197,28036,27874,27710,27544,27376,27207,27035,
+    26863,26688,26512,26335,26155,25974,25792,25608,25423,25236,25047,24857,24666,24473,24279,24084,
+    23887,23688,23489,23288,23086,22882,22678,22472,22265,22057,21847,21637,21425,21213,20999,20784,
+    20568,20351,20134,19915,19695,19475,19253,19031,18808,18584,18359,18133,17907,17680,17452,17223,
+    16994,16765,16534,16303,16072,15840,15607,15374,15140,14906,14672,14437,14201,13966,13730,13493,
+    13257,13020,12783,12545,12308,12070,11832,11594,11356,11118,10879,10641,10402,10164,9926,9687,
+    9449,9211,8973,8735,8497,8259,8022,7784,7547,7311,7074,6838,6602,6367,6132,5897,
+    5662,5429,5195,4962,4730,4498,4266,4035,3805,3575,3346,3117,2889,2662,2436,2210,
+    1985,1760,1537,1314,1092,870,650,431,212,-6,-223,-439,-654,-868,-1081,-1293,
+    -1505,-1715,-1924,-2132,-2339,-2545,-2750,-2953,-3156,-3358,-3558,-3757,-3955,-4152,-4347,-4542,
+    -4735,-4927,-5118,-5307,-5495,-5682,-5867,-6052,-6234,-6416,-6596,-6775,-6953,-7129,-7303,-7477,
+    -7648,-7819,-7988,-8156,-8322,-8486,-8650,-8811,-8972,-9131,-9288,-9444,-9598,-9751,-9902,-10052,
+    -10200,-10347,-10492,-10636,-10778,-10918,-11057,-11194,-11330,-11465,-11597,-11728,-11858,-11986,-12112,-12237,
+    -12360,-12481,-12601,-12720,-12836,-12952,-13065,-13177,-13287,-13396,-13503,-13609,-13713,-13815,-13916,-14015,
+    -14112,-14208,-14303,-14395,-14487,-14576,-14664,-14751,-14835,-14919,-15000,-15080,-15159,-15236,-15311,-15385,
+    -15458,-15528,-15598,-15665,-15732,-15796,-15860,-15921,-15981,-16040,-16097,-16153,-16207,-16260,-16311,-16361,
+    -16410,-16457,-16502,-16547,-16589,-16631,-16671,-16709,-16746,-16782,-16817,-16850,-16882,-16912,-16942,-16970,
+    -16996,-17021,-17046,-17068,-17090,-17110,-17129,-17147,-17164,-17179,-17194,-17207,-17219,-17230,-17240,-17248,
+    -17256,-17262,-17267,-17272,-17275,-17277,-17278,-17278,-17278,-17276,-17273,-17269,-17264,-17259,-17252,-17245,
+    -17237,-17227,-17217,-17206,-17195,-17182,-17169,-17154,-17140,-17124,-17107,-17090,-17072,-17054,-17035,-17015,
+    -16994,-16973,-16951,-16929,-16906,-16882,-16858,-16833,-16808,-16782,-16756,-16729,-16702,-16674,-16646,-16617,
+    -16588,-16559,-16529,-16499,-16468,-16437,-16406,-16375,-16343,-16311,-16278,-16246,-16213,-16180,-16147,-16113,
+    -16080,-16046,-16012,-15978,-15943,-15909,-15875,-15840,-15806,-15771,-15736,-15702,-15667,-15632,-15598,-15563,
+    -15529,-15494,-15460,-15425,-15391,-15357,-15323,-15289,-15255,-15221,-15188,-15155,-15121,-15089,-15056,-15023,
+    -14991,-14959,-14928,-14896,-14865,-14834,-14804,-14773,-14744,-14714,-14685,-14656,-14627,-14599,-14572,-14544,
+    -14517,-14491,-14465,-14439,-14414,-14389,-14365,-14341,-14317,-14294,-14272,-14250,-14228,-14208,-14187,-14167,
+    -14148,-14129,-14111,-14093,-14076,-14059,-14043,-14027,-14012,-13998,-13984,-13971,-13958,-13946,-13934,-13924,
+    -13913,-13904,-13895,-13886,-13878,-13871,-13865,-13859,-13853,-13849,-13844,-13841,-13838,-13836,-13834,-13833,
+    -13833,-13833,-13834,-13836,-13838,-13841,-13844,-13849,-13853,-13859,-13865,-13871,-13878,-13886,-13895,-13904,
+    -13913,-13924,-13934,-13946,-13958,-13971,-13984,-13998,-14012,-14027,-14043,-14059,-14076,-14093,-14111,-14129,
+    -14148,-14167,-14187,-14208,-14228,-14250,-14272,-14294,-14317,-14341,-14365,-14389,-14414,-14439,-14465,-14491,
+    -14517,-14544,-14572,-14599,-14627,-14656,-14685,-14714,-14744,-14773,-14804,-14834,-14865,-14896,-14928,-14959,
+    -14991,-15023,-15056,-15089,-15121,-15155,-15188,-15221,-15255,-15289,-15323,-15357,-15391,-15425,-15460,-15494,
+    -15529,-15563,-15598,-15632,-15667,-15702,-15736,-15771,-15806,-15840,-15875,-15909,-15943,-15978,-16012,-16046,
+    -16080,-16113,-16147,-16180,-16213,-16246,-16278,-16311,-16343,-16375,-16406,-16437,-16468,-16499,-16529,-16559,
+    -16588,-16617,-16646,-16674,-16702,-16729,-16756,-16782,-16808,-16833,-16858,-16882,-16906,-16929,-16951,-16973,
+    -16994,-17015,-17035,-17054,-17072,-17090,-17107,-17124,-17140,-17154,-17169,-17182,-17195,-17206,-17217,-17227,
+    -17237,-17245,-17252,-17259,-17264,-17269,-17273,-17276,-17278,-17278,-17278,-17277,-17275,-17272,-17267,-17262,
+    -17256,-17248,-17240,-17230,-17219,-17207,-17194,-17179,-17164,-17147,-17129,-17110,-17090,-17068,-17046,-17021,
+    -16996,-16970,-16942,-16912,-16882,-16850,-16817,-16782,-16746,-16709,-16671,-16631,-16589,-16547,-16502,-16457,
+    -16410,-16361,-16311,-16260,-16207,-16153,-16097,-16040,-15981,-15921,-15860,-15796,-15732,-15665,-15598,-15528,
+    -15458,-15385,-15311,-15236,-15159,-15080,-15000,-14919,-14835,-14751,-14664,-14576,-14487,-14395,-14303,-14208,
+    -14112,-14015,-13916,-13815,-13713,-13609,-13503,-13396,-13287,-13177,-13065,-12952,-12836,-12720,-12601,-12481,
+    -12360,-12237,-12112,-11986,-11858,-11728,-11597,-11465,-11330,-11194,-11057,-10918,-10778,-10636,-10492,-10347};
+
+const int16_t table_rectsine_mip9[1024]={
+    0,148,295,442,590,737,885,1032,1179,1327,1474,1621,1768,1915,2062,2209,
+    2356,2503,2649,2796,2942,3088,3235,3381,3527,3672,3818,3964,4109,4254,4399,4544,
+    4689,4833,4978,5122,5266,5410,5553,5697,5840,5983,6125,6268,6410,6552,6694,6835,
+    6977,7118,7258,7399,7539,7679,7818,7958,8097,8235,8374,8512,8650,8787,8924,9061,
+    9197,9333,9469,9604,9739,9874,10008,10142,10276,10409,10542,10674,10806,10937,11068,11199,
+    11329,11459,11589,11718,11846,11974,12102,12229,12356,12482,12608,12733,12858,12982,13106,13230,
+    13352,13475,13597,13718,13839,13959,14079,14198,14317,14435,14553,14670,14786,14902,15018,15132,
+    15247,15360,15474,15586,15698,15809,15920,16030,16140,16249,16357,16465,16572,16679,16784,16890,
+    16994,17098,17202,17304,17406,17508,17608,17708,17808,17906,18004,18102,18198,18294,18390,18484,
+    18578,18671,18764,18856,18947,19037,19127,19216,19304,19391,19478,19564,19649,19734,19818,19901,
+    19983,20065,20146,20226,20305,20383,20461,20538,20614,20690,20764,20838,20911,20984,21055,21126,
+    21196,21265,21333,21401,21467,21533,21598,21663,21726,21789,21851,21912,21972,22031,22090,22147,
+    22204,22260,22315,22370,22423,22476,22528,22579,22629,22678,22726,22774,22821,22866,22911,22955,
+    22999,23041,23083,23123,23163,23202,23240,23277,23313,23349,23383,23417,23450,23481,23512,23543,
+    23572,23600,23628,23654,23680,23704,23728,23751,23773,23795,23815,23834,23853,23870,23887,23903,
+    23918,23932,23945,23957,23968,23979,23988,23997,24005,24011,24017,24022,24026,24029,24032,24033,
+    24034,24033,24032,24029,24026,24022,24017,24011,24005,23997,23988,23979,23968,23957,23945,23932,
+    23918,23903,23887,23870,23853,23834,23815,23795,23773,23751,23728,23704,23680,23654,23628,23600,
+    23572,23543,23512,23481,23450,23417,23383,23349,23313,23277,23240,23202,23163,23123,23083,23041,
+    22999,22955,22911,22866,22821,22774,22726,22678,22629,22579,22528,22476,22423,22370,22315,22260,
+    22204,22147,22090,22031,21972,21912,21851,21789,21726,21663,21598,21533,21467,21401,21333,21265,
+    21196,21126,21055,20984,20911,20838,20764,20690,20614,20538,20461,20383,20305,20226,20146,20065,
+    19983,19901,19818,19734,19649,19564,19478,19391,19304,19216,19127,19037,18947,18856,18764,18671,
+    18578,18484,18390,18294,18198,18102,18004,17906,17808,17708,17608,17508,17406,17304,17202,17098,
+    16994,16890,16784,16679,16572,16465,16357,16249,16140,16030,15920,15809,15698,15586,15474,15360,
+    15247,15132,15018,14902,14786,14670,14553,14435,14317,14198,14079,13959,13839,13718,13597,13475,
+    13352,13230,13106,12982,12858,12733,12608,12482,12356,12229,12102,11974,11846,11718,11589,11459,
+    11329,11199,11068,10937,10806,10674,10542,10409,10276,10142,10008,9874,9739,9604,9469,9333,
+    9197,9061,8924,8787,8650,8512,8374,8235,8097,7958,7818,7679,7539,7399,7258,7118,
+    6977,6835,6694,6552,6410,6268,6125,5983,5840,5697,5553,5410,5266,5122,4978,4833,
+    4689,4544,4399,4254,4109,3964,3818,3672,3527,3381,3235,3088,2942,2796,2649,2503,
+    2356,2209,2062,1915,1768,1621,1474,1327,1179,1032,885,737,590,442,295,148,
+    0,-147,-295,-442,-590,-737,-885,-1032,-1179,-1326,-1474,-1621,-1768,-1915,-2062,-2209,
+    -2356,-2502,-2649,-2795,-2942,-3088,-3234,-3380,-3526,-3672,-3818,-3963,-4109,-4254,-4399,-4544,
+    -4689,-4833,-4977,-5122,-5266,-5409,-5553,-5696,-5840,-5982,-6125,-6268,-6410,-6552,-6694,-6835,
+    -6976,-7117,-7258,-7399,-7539,-7679,-7818,-7958,-8097,-8235,-8374,-8512,-8649,-8787,-8924,-9061,
+    -9197,-9333,-9469,-9604,-9739,-9874,-10008,-10142,-10276,-10409,-10541,-10674,-10806,-10937,-11068,-11199,
+    -11329,-11459,-11588,-11717,-11846,-11974,-12102,-12229,-12356,-12482,-12608,-12733,-12858,-12982,-13106,-13229,
+    -13352,-13475,-13596,-13718,-13839,-13959,-14079,-14198,-14317,-14435,-14552,-14669,-14786,-14902,-15017,-15132,
+    -15247,-15360,-15473,-15586,-15698,-15809,-15920,-16030,-16140,-16249,-16357,-16465,-16572,-16678,-16784,-16890,
+    -16994,-17098,-17201,-17304,-17406,-17507,-17608,-17708,-17808,-17906,-18004,-18102,-18198,-18294,-18390,-18484,
+    -18578,-18671,-18764,-18855,-18947,-19037,-19127,-19216,-19304,-19391,-19478,-19564,-19649,-19734,-19818,-19901,
+    -19983,-20065,-20145,-20225,-20305,-20383,-20461,-20538,-20614,-20689,-20764,-20838,-20911,-20983,-21055,-21126,
+    -21196,-21265,-21333,-21400,-21467,-21533,-21598,-21662,-21726,-21789,-21850,-21911,-21972,-22031,-22089,-22147,
+    -22204,-22260,-22315,-22369,-22423,-22476,-22527,-22578,-22628,-22678,-22726,-22774,-22820,-22866,-22911,-22955,
+    -22998,-23041,-23082,-23123,-23163,-23202,-23240,-23277,-23313,-23348,-23383,-23417,-23449,-23481,-23512,-23542,
+    -23572,-23600,-23627,-23654,-23680,-23704,-23728,-23751,-23773,-23794,-23815,-23834,-23853,-23870,-23887,-23903,
+    -23918,-23932,-23945,-23957,-23968,-23979,-23988,-23997,-24004,-24011,-24017,-24022,-24026,-24029,-24032,-24033,
+    -24033,-24033,-24032,-24029,-24026,-24022,-24017,-24011,-24004,-23997,-23988,-23979,-23968,-23957,-23945,-23932,
+    -23918,-23903,-23887,-23870,-23853,-23834,-23815,-23794,-23773,-23751,-23728,-23704,-23680,-23654,-23627,-23600,
+    -23572,-23542,-23512,-23481,-23449,-23417,-23383,-23348,-23313,-23277,-23240,-23202,-23163,-23123,-23082,-23041,
+    -22998,-22955,-22911,-22866,-22820,-22774,-22726,-22678,-22628,-22578,-22527,-22476,-22423,-22369,-22315,-22260,
+    -22204,-22147,-22089,-22031,-21972,-21911,-21850,-21789,-21726,-21662,-21598,-21533,-21467,-21400,-21333,-21265,
+    -21196,-21126,-21055,-20983,-20911,-20838,-20764,-20689,-20614,-20538,-20461,-20383,-20305,-20225,-20145,-20065,
+    -19983,-19901,-19818,-19734,-19649,-19564,-19478,-19391,-19304,-19216,-19127,-19037,-18947,-18855,-18764,-18671,
+    -18578,-18484,-18390,-18294,-18198,-18102,-18004,-17906,-17808,-17708,-17608,-17507,-17406,-17304,-17201,-17098,
+    -16994,-16890,-16784,-16678,-16572,-16465,-16357,-16249,-16140,-16030,-15920,-15809,-15698,-15586,-15473,-15360,
+    -15247,-15132,-15017,-14902,-14786,-14669,-14552,-14435,-14317,-14198,-14079,-13959,-13839,-13718,-13596,-13475,
+    -13352,-13229,-13106,-12982,-12858,-12733,-12608,-12482,-12356,-12229,-12102,-11974,-11846,-11717,-11588,-11459,
+    -11329,-11199,-11068,-10937,-10806,-10674,-10541,-10409,-10276,-10142,-10008,-9874,-9739,-9604,-9469,-9333,
+    -9197,-9061,-8924,-8787,-8649,-8512,-8374,-8235,-8097,-7958,-7818,-7679,-7539,-7399,-7258,-7117,
+    -6976,-6835,-6694,-6552,-6410,-6268,-6125,-5982,-5840,-5696,-5553,-5409,-5266,-5122,-4977,-4833,
+    -4689,-4544,-4399,-4254,-4109,-3963,-3818,-3672,-3526,-3380,-3234,-3088,-2942,-2795,-2649,-2502,
+    -2356,-2209,-2062,-1915,-1768,-1621,-1474,-1326,-1179,-1032,-885,-737,-590,-442,-295,-147};
+
+const int16_t table_triangle_mip7[1024]={
+    0,116,233,349,466,582,699,816,933,1050,1167,1284,1401,1519,1636,1754,
+    1872,1990,2109,2227,2346,2465,2585,2704,2824,2945,3065,3186,3308,3429,3551,3673,
+    3796,3919,4043,4167,4291,4416,4541,4666,4793,4919,5046,5174,5301,5430,5559,5688,
+    5818,5949,6080,6211,6343,6476,6609,6743,6877,7012,7147,7283,7420,7557,7694,7832,
+    7971,8111,8251,8391,8532,8674,8816,8959,9103,9247,9391,9536,9682,9829,9975,10123,
+    10271,10420,10569,10718,10869,11020,11171,11323,11475,11628,11782,11936,12090,12245,12400,12556,
+    12713,12869,13027,13184,13342,13501,13660,13819,13979,14139,14300,14460,14621,14783,14945,15107,
+    15269,15432,15594,15758,15921,16084,16248,16412,16576,16740,16904,17069,17233,17398,17562,17727,
+    17892,18056,18221,18386,18550,18715,18879,19043,19207,19371,19535,19699,19862,20025,20188,20351,
+    20513,20675,20837,20998,21159,21319,21480,21639,21798,21957,22115,22272,22429,22586,22742,22897,
+    23051,23205,23358,23510,23662,23813,23963,24112,24261,24408,24555,24700,24845,24989,25132,25274,
+    25414,25554,25693,25830,25967,26102,26236,26369,26501,26632,26761,26889,27016,27141,27265,27388,
+    27509,27629,27748,27865,27980,28094,28207,28318,28428,28536,28642,28747,28850,28952,29051,29150,
+    29246,29341,29434,29526,29615,29703,29789,29873,29956,30037,30115,30192,30267,30340,30412,30481,
+    30548,30614,30677,30739,30798,30856,30911,30965,31017,31066,31114,31159,31202,31244,31283,31320,
+    31355,31388,31419,31448,31474,31499,31521,31542,31560,31576,31590,31602,31611,31619,31624,31627,
+    31628,31627,31624,31619,31611,31602,31590,31576,31560,31542,31521,31499,31474,31448,31419,31388,
+    31355,31320,31283,31244,31202,31159,31114,31066,31017,30965,30911,30856,30798,30739,30677,30614,
+    30548,30481,30412,30340,30267,30192,30115,30037,29956,29873,29789,29703,29615,29526,29434,29341,
+    29246,29150,29051,28952,28850,28747,28642,28536,28428,28318,28207,28094,27980,27865,27748,27629,
+    27509,27388,27265,27141,27016,26889,26761,26632,26501,26369,26236,26102,25967,25830,25693,25554,
+    25414,25274,25132,24989,24845,24700,24555,24408,24261,24112,23963,23813,23662,23510,23358,23205,
+    23051,22897,22742,22586,22429,22272,22115,21957,21798,21639,21480,21319,21159,20998,20837,20675,
+    20513,20351,20188,20025,19862,19699,19535,19371,19207,19043,18879,18715,18550,18386,18221,18056,
+    17892,17727,17562,17398,17233,17069,16904,16740,16576,16412,16248,16084,15921,15758,15594,15432,
+    15269,15107,14945,14783,14621,14460,14300,14139,13979,13819,13660,13501,13342,13184,13027,12869,
+    12713,12556,12400,12245,12090,11936,11782,11628,11475,11323,11171,11020,10869,10718,10569,10420,
+    10271,10123,9975,9829,9682,9536,9391,9247,9103,8959,8816,8674,8532,8391,8251,8111,
+    7971,7832,7694,7557,7420,7283,7147,7012,6877,6743,6609,6476,6343,6211,6080,5949,
+    5818,5688,5559,5430,5301,5174,5046,4919,4793,4666,4541,4416,4291,4167,4043,3919,
+    3796,3673,3551,3429,3308,3186,3065,2945,2824,2704,2585,2465,2346,2227,2109,1990,
+    1872,1754,1636,1519,1401,1284,1167,1050,933,816,699,582,466,349,233,116,
+    0,-116,-233,-349,-466,-582,-699,-816,-933,-1050,-1167,-1284,-1401,-1519,-1636,-1754,
+    -1872,-1990,-2109,-2227,-2346,-2465,-2585,-2704,-2824,-2945,-3065,-3186,-3308,-3429,-3551,-3673,
+    -3796,-3919,-4043,-4167,-4291,-4416,-4541,-4666,-4793,-4919,-5046,-5174,-5301,-5430,-5559,-5688,
+    -5818,-5949,-6080,-6211,-6343,-6476,-6609,-6743,-6877,-7012,-7147,-7283,-7420,-7557,-7694,-7832,
+    -7971,-8111,-8251,-8391,-8532,-8674,-8816,-8959,-9103,-9247,-9391,-9536,-9682,-9829,-9975,-10123,
+    -10271,-10420,-10569,-10718,-10869,-11020,-11171,-11323,-11475,-11628,-11782,-11936,-12090,-12245,-12400,-12556,
+    -12713,-12869,-13027,-13184,-13342,-13501,-13660,-13819,-13979,-14139,-14300,-14460,-14621,-14783,-14945,-15107,
+    -15269,-15432,-15594,-15758,-15921,-16084,-16248,-16412,-16576,-16740,-16904,-17069,-17233,-17398,-17562,-17727,
+    -17892,-18056,-18221,-18386,-18550,-18715,-18879,-19043,-19207,-19371,-19535,-19699,-19862,-20025,-20188,-20351,
+    -20513,-20675,-20837,-20998,-21159,-21319,-21480,-21639,-21798,-21957,-22115,-22272,-22429,-22586,-22742,-22897,
+    -23051,-23205,-23358,-23510,-23662,-23813,-23963,-24112,-24261,-24408,-24555,-24700,-24845,-24989,-25132,-25274,
+    -25414,-25554,-25693,-25830,-25967,-26102,-26236,-26369,-26501,-26632,-26761,-26889,-27016,-27141,-27265,-27388,
+    -27509,-27629,-27748,-27865,-27980,-28094,-28207,-28318,-28428,-28536,-28642,-28747,-28850,-28952,-29051,-29150,
+    -29246,-29341,-29434,-29526,-29615,-29703,-29789,-29873,-29956,-30037,-30115,-30192,-30267,-30340,-30412,-30481,
+    -30548,-30614,-30677,-30739,-30798,-30856,-30911,-30965,-31017,-31066,-31114,-31159,-31202,-31244,-31283,-31320,
+    -31355,-31388,-31419,-31448,-31474,-31499,-31521,-31542,-31560,-31576,-31590,-31602,-31611,-31619,-31624,-31627,
+    -31628,-31627,-31624,-31619,-31611,-31602,-31590,-31576,-31560,-31542,-31521,-31499,-31474,-31448,-31419,-31388,
+    -31355,-31320,-31283,-31244,-31202,-31159,-31114,-31066,-31017,-30965,-30911,-30856,-30798,-30739,-30677,-30614,
+    -30548,-30481,-30412,-30340,-30267,-30192,-30115,-30037,-29956,-29873,-29789,-29703,-29615,-29526,-29434,-29341,
+    -29246,-29150,-29051,-28952,-28850,-28747,-28642,-28536,-28428,-28318,-28207,-28094,-27980,-27865,-27748,-27629,
+    -27509,-27388,-27265,-27141,-27016,-26889,-26761,-26632,-26501,-26369,-26236,-26102,-25967,-25830,-25693,-25554,
+    -25414,-25274,-25132,-24989,-24845,-24700,-24555,-24408,-24261,-24112,-23963,-23813,-23662,-23510,-23358,-23205,
+    -23051,-22897,-22742,-22586,-22429,-22272,-22115,-21957,-21798,-21639,-21480,-21319,-21159,-20998,-20837,-20675,
+    -20513,-20351,-20188,-20025,-19862,-19699,-19535,-19371,-19207,-19043,-18879,-18715,-18550,-18386,-18221,-18056,
+    -17892,-17727,-17562,-17398,-17233,-17069,-16904,-16740,-16576,-16412,-16248,-16084,-15921,-15758,-15594,-15432,
+    -15269,-15107,-14945,-14783,-14621,-14460,-14300,-14139,-13979,-13819,-13660,-13501,-13342,-13184,-13027,-12869,
+    -12713,-12556,-12400,-12245,-12090,-11936,-11782,-11628,-11475,-11323,-11171,-11020,-10869,-10718,-10569,-10420,
+    -10271,-10123,-9975,-9829,-9682,-9536,-9391,-9247,-9103,-8959,-8816,-8674,-8532,-8391,-8251,-8111,
+    -7971,-7832,-7694,-7557,-7420,-7283,-7147,-7012,-6877,-6743,-6609,-6476,-6343,-6211,-6080,-5949,
+    -5818,-5688,-5559,-5430,-5301,-5174,-5046,-4919,-4793,-4666,-4541,-4416,-4291,-4167,-4043,-3919,
+    -3796,-3673,-3551,-3429,-3308,-3186,-3065,-2945,-2824,-2704,-2585,-2465,-2346,-2227,-2109,-1990,
+    -1872,-1754,-1636,-1519,-1401,-1284,-1167,-1050,-933,-816,-699,-582,-466,-349,-233,-116};
+
+const int16_t table_triangle_mip8[1024]={
+    0,175,349,524,699,873,1048,1222,1397,1571,1746,1920,2094,2268,2442,2616,
+    2790,2964,3138,3311,3484,3658,3831,4004,4177,4349,4522,4694,4867,5039,5210,5382,
+    5553,5725,5896,6066,6237,6407,6577,6747,6917,7086,7255,7424,7592,7760,7928,8096,
+    8263,8430,8597,8763,8929,9095,9260,9425,9590,9754,9918,10081,10245,10407,10570,10732,
+    10893,11054,11215,11376,11535,11695,11854,12012,12171,12328,12485,12642,12798,12954,13109,13264,
+    13419,13572,13726,13878,14031,14182,14333,14484,14634,14784,14933,15081,15229,15376,15523,15669,
+    15815,15960,16104,16248,16391,16533,16675,16816,16957,17097,17236,17375,17513,17650,17787,17923,
+    18058,18193,18327,18460,18593,18725,18856,18987,19116,19245,19374,19501,19628,19754,19880,20004,
+    20128,20251,20374,20495,20616,20736,20855,20974,21092,21208,21325,21440,21554,21668,21781,21893,
+    22004,22115,22224,22333,22441,22548,22654,22759,22864,22967,23070,23172,23273,23373,23472,23571,
+    23668,23765,23861,23955,24049,24142,24234,24325,24416,24505,24593,24681,24767,24853,24938,25022,
+    25104,25186,25267,25347,25426,25504,25581,25657,25733,25807,25880,25952,26023,26094,26163,26231,
+    26299,26365,26430,26495,26558,26620,26682,26742,26802,26860,26917,26974,27029,27083,27136,27189,
+    27240,27290,27339,27387,27434,27480,27526,27570,27612,27654,27695,27735,27774,27812,27848,27884,
+    27919,27952,27985,28016,28046,28076,28104,28131,28157,28183,28207,28230,28251,28272,28292,28311,
+    28328,28345,28361,28375,28388,28401,28412,28422,28431,28439,28446,28452,28457,28461,28463,28465,
+    28466,28465,28463,28461,28457,28452,28446,28439,28431,28422,28412,28401,28388,28375,28361,28345,
+    28328,28311,28292,28272,28251,28230,28207,28183,28157,28131,28104,28076,28046,28016,27985,27952,
+    27919,27884,27848,27812,27774,27735,27695,27654,27612,27570,27526,27480,27434,27387,27339,27290,
+    27240,27189,27136,27083,27029,26974,26917,26860,26802,26742,26682,26620,26558,26495,26430,26365,
+    26299,26231,26163,26094,26023,25952,25880,25807,25733,25657,25581,25504,25426,25347,25267,25186,
+    25104,25022,24938,24853,24767,24681,24593,24505,24416,24325,24234,24142,24049,23955,23861,23765,
+    23668,23571,23472,23373,23273,23172,23070,22967,22864,22759,22654,22548,22441,22333,22224,22115,
+    22004,21893,21781,21668,21554,21440,21325,21208,21092,20974,20855,20736,20616,20495,20374,20251,
+    20128,20004,19880,19754,19628,19501,19374,19245,19116,18987,18856,18725,18593,18460,18327,18193,
+    18058,17923,17787,17650,17513,17375,17236,17097,16957,16816,16675,16533,16391,16248,16104,15960,
+    15815,15669,15523,15376,15229,15081,14933,14784,14634,14484,14333,14182,14031,13878,13726,13572,
+    13419,13264,13109,12954,12798,12642,12485,12328,12171,12012,11854,11695,11535,11376,11215,11054,
+    10893,10732,10570,10407,10245,10081,9918,9754,9590,9425,9260,9095,8929,8763,8597,8430,
+    8263,8096,7928,7760,7592,7424,7255,7086,6917,6747,6577,6407,6237,6066,5896,5725,
+    5553,5382,5210,5039,4867,4694,4522,4349,4177,4004,3831,3658,3484,3311,3138,2964,
+    2790,2616,2442,2268,2094,1920,1746,1571,1397,1222,1048,873,699,524,349,175,
+    0,-175,-349,-524,-699,-873,-1048,-1222,-1397,-1571,-1746,-1920,-2094,-2268,-2442,-2616,
+    -2790,-2964,-3138,-3311,-3484,-3658,-3831,-4004,-4177,-4349,-4522,-4694,-4867,-5039,-5210,-5382,
+    -5553,-5725,-5896,-6066,-6237,-6407,-6577,-6747,-6917,-7086,-7255,-7424,-7592,-7760,-7928,-8096,
+    -8263,-8430,-8597,-8763,-8929,-9095,-9260,-9425,-9590,-9754,-9918,-10081,-10245,-10407,-10570,-10732,
+    -10893,-11054,-11215,-11376,-11535,-11695,-11854,-12012,-12171,-12328,-12485,-12642,-12798,-12954,-13109,-13264,
+    -13419,-13572,-13726,-13878,-14031,-14182,-14333,-14484,-14634,-14784,-14933,-15081,-15229,-15376,-15523,-15669,
+    -15815,-15960,-16104,-16248,-16391,-16533,-16675,-16816,-16957,-17097,-17236,-17375,-17513,-17650,-17787,-17923,
+    -18058,-18193,-18327,-18460,-18593,-18725,-18856,-18987,-19116,-19245,-19374,-19501,-19628,-19754,-19880,-20004,
+    -20128,-20251,-20374,-20495,-20616,-20736,-20855,-20974,-21092,-21208,-21325,-21440,-21554,-21668,-21781,-21893,
+    -22004,-22115,-22224,-22333,-22441,-22548,-22654,-22759,-22864,-22967,-23070,-23172,-23273,-23373,-23472,-23571,
+    -23668,-23765,-23861,-23955,-24049,-24142,-24234,-24325,-24416,-24505,-24593,-24681,-24767,-24853,-24938,-25022,
+    -25104,-25186,-25267,-25347,-25426,-25504,-25581,-25657,-25733,-25807,-25880,-25952,-26023,-26094,-26163,-26231,
+    -26299,-26365,-26430,-26495,-26558,-26620,-26682,-26742,-26802,-26860,-26917,-26974,-27029,-27083,-27136,-27189,
+    -27240,-27290,-27339,-27387,-27434,-27480,-27526,-27570,-27612,-27654,-27695,-27735,-27774,-27812,-27848,-27884,
+    -27919,-27952,-27985,-28016,-28046,-28076,-28104,-28131,-28157,-28183,-28207,-28230,-28251,-28272,-28292,-28311,
+    -28328,-28345,-28361,-28375,-28388,-28401,-28412,-28422,-28431,-28439,-28446,-28452,-28457,-28461,-28463,-28465,
+    -28466,-28465,-28463,-28461,-28457,-28452,-28446,-28439,-28431,-28422,-28412,-28401,-28388,-28375,-28361,-28345,
+    -28328,-28311,-28292,-28272,-28251,-28230,-28207,-28183,-28157,-28131,-28104,-28076,-28046,-28016,-27985,-27952,
+    -27919,-27884,-27848,-27812,-27774,-27735,-27695,-27654,-27612,-27570,-27526,-27480,-27434,-27387,-27339,-27290,
+    -27240,-27189,-27136,-27083,-27029,-26974,-26917,-26860,-26802,-26742,-26682,-26620,-26558,-26495,-26430,-26365,
+    -26299,-26231,-26163,-26094,-26023,-25952,-25880,-25807,-25733,-25657,-25581,-25504,-25426,-25347,-25267,-25186,
+    -25104,-25022,-24938,-24853,-24767,-24681,-24593,-24505,-24416,-24325,-24234,-24142,-24049,-23955,-23861,-23765,
+    -23668,-23571,-23472,-23373,-23273,-23172,-23070,-22967,-22864,-22759,-22654,-22548,-22441,-22333,-22224,-22115,
+    -22004,-21893,-21781,-21668,-21554,-21440,-21325,-21208,-21092,-20974,-20855,-20736,-20616,-20495,-20374,-20251,
+    -20128,-20004,-19880,-19754,-19628,-19501,-19374,-19245,-19116,-18987,-18856,-18725,-18593,-18460,-18327,-18193,
+    -18058,-17923,-17787,-17650,-17513,-17375,-17236,-17097,-16957,-16816,-16675,-16533,-16391,-16248,-16104,-15960,
+    -15815,-15669,-15523,-15376,-15229,-15081,-14933,-14784,-14634,-14484,-14333,-14182,-14031,-13878,-13726,-13572,
+    -13419,-13264,-13109,-12954,-12798,-12642,-12485,-12328,-12171,-12012,-11854,-11695,-11535,-11376,-11215,-11054,
+    -10893,-10732,-10570,-10407,-10245,-10081,-9918,-9754,-9590,-9425,-9260,-9095,-8929,-8763,-8597,-8430,
+    -8263,-8096,-7928,-7760,-7592,-7424,-7255,-7086,-6917,-6747,-6577,-6407,-6237,-6066,-5896,-5725,
+    -5553,-5382,-5210,-5039,-4867,-4694,-4522,-4349,-4177,-4004,-3831,-3658,-3484,-3311,-3138,-2964,
+    -2790,-2616,-2442,-2268,-2094,-1920,-1746,-1571,-1397,-1222,-1048,-873,-699,-524,-349,-175};
+
+const int16_t table_sawtooth_mip6[1024]={
+    0,0,0,1,2,3,6,9,13,19,26,35,45,57,71,87,
+    105,125,148,173,200,231,264,299,338,380,424,472,522,576,632,692,
+    755,820,889,961,1036,1113,1194,1277,1363,1452,1544,1638,1734,1833,1934,2037,
+    2142,2249,2357,2467,2579,2692,2806,2921,3037,3154,3271,3389,3507,3625,3743,3860,
+    3978,4094,4210,4325,4439,4552,4663,4773,4882,4988,5093,5196,5296,5394,5490,5583,
+    5674,5762,5848,5930,6010,6087,6160,6231,6298,6363,6424,6482,6537,6588,6637,6682,
+    6724,6764,6800,6833,6863,6891,6916,6938,6957,6974,6989,7001,7012,7020,7026,7031,
+    7034,7036,7036,7035,7033,7031,7028,7024,7020,7016,7011,7007,7004,7000,6998,6996,
+    6996,6996,6998,7002,7007,7014,7023,7034,7047,7063,7081,7101,7125,7151,7180,7212,
+    7247,7285,7327,7372,7420,7471,7526,7584,7646,7711,7779,7851,7926,8004,8086,8171,
+    8259,8351,8445,8542,8642,8745,8850,8958,9069,9181,9296,9413,9531,9651,9773,9896,
+    10020,10145,10271,10397,10524,10651,10779,10906,11033,11159,11285,11410,11534,11656,11777,11897,
+    12015,12131,12245,12356,12466,12572,12676,12778,12876,12971,13063,13152,13237,13319,13397,13472,
+    13543,13610,13674,13733,13789,13841,13890,13934,13975,14011,14044,14074,14100,14122,14141,14156,
+    14168,14177,14183,14186,14186,14183,14178,14171,14162,14150,14137,14122,14106,14088,14069,14050,
+    14030,14009,13989,13968,13947,13927,13908,13889,13872,13856,13841,13828,13817,13808,13801,13797,
+    13796,13797,13802,13810,13821,13835,13854,13876,13902,13932,13966,14004,14047,14094,14145,14201,
+    14262,14327,14396,14470,14549,14632,14720,14812,14909,15010,15115,15224,15337,15454,15575,15700,
+    15828,15959,16094,16231,16371,16514,16659,16807,16956,17107,17259,17413,17567,17722,17878,18034,
+    18189,18345,18500,18653,18806,18957,19107,19255,19400,19543,19683,19821,19955,20086,20213,20336,
+    20455,20570,20680,20786,20886,20982,21073,21158,21238,21312,21381,21444,21501,21553,21598,21638,
+    21672,21700,21722,21738,21748,21753,21752,21746,21734,21717,21695,21667,21635,21599,21558,21513,
+    21464,21411,21355,21296,21233,21169,21102,21033,20962,20890,20818,20744,20671,20597,20524,20452,
+    20381,20311,20244,20179,20116,20057,20001,19948,19900,19856,19817,19784,19755,19733,19716,19706,
+    19703,19706,19717,19735,19761,19794,19836,19886,19944,20011,20086,20170,20263,20365,20475,20595,
+    20723,20860,21006,21160,21324,21495,21675,21863,22059,22262,22473,22691,22916,23147,23384,23628,
+    23876,24130,24388,24651,24917,25186,25457,25731,26007,26283,26560,26837,27113,27388,27660,27930,
+    28197,28460,28718,28971,29218,29459,29692,29917,30134,30341,30539,30726,30901,31065,31216,31354,
+    31478,31588,31682,31761,31824,31870,31899,31910,31903,31877,31832,31767,31682,31577,31452,31305,
+    31137,30947,30735,30502,30246,29967,29667,29344,28998,28629,28238,27824,27388,26930,26449,25947,
+    25422,24876,24309,23721,23112,22483,21834,21166,20479,19774,19051,18310,17553,16779,15991,15187,
+    14369,13538,12694,11839,10972,10094,9208,8312,7409,6498,5581,4659,3733,2803,1870,935,
+    0,-935,-1870,-2803,-3733,-4659,-5581,-6498,-7409,-8312,-9208,-10094,-10972,-11839,-12694,-13538,
+    -14369,-15187,-15991,-16779,-17553,-18310,-19051,-19774,-20479,-21166,-21834,-22483,-23112,-23721,-24309,-24876,
+    -25422,-25947,-26449,-26930,-27388,-27824,-28238,-28629,-28998,-29344,-29667,-29967,-30246,-30502,-30735,-30947,
+    -31137,-31305,-31452,-31577,-31682,-31767,-31832,-31877,-31903,-31910,-31899,-31870,-31824,-31761,-31682,-31588,
+    -31478,-31354,-31216,-31065,-30901,-30726,-30539,-30341,-30134,-29917,-29692,-29459,-29218,-28971,-28718,-28460,
+    -28197,-27930,-27660,-27388,-27113,-26837,-26560,-26283,-26007,-25731,-25457,-25186,-24917,-24651,-24388,-24130,
+    -23876,-23628,-23384,-23147,-22916,-22691,-22473,-22262,-22059,-21863,-21675,-21495,-21324,-21160,-21006,-20860,
+    -20723,-20595,-20475,-20365,-20263,-20170,-20086,-20011,-19944,-19886,-19836,-19794,-19761,-19735,-19717,-19706,
+    -19703,-19706,-19716,-19733,-19755,-19784,-19817,-19856,-19900,-19948,-20001,-20057,-20116,-20179,-20244,-20311,
+    -20381,-20452,-20524,-20597,-20671,-20744,-20818,-20890,-20962,-21033,-21102,-21169,-21233,-21296,-21355,-21411,
+    -21464,-21513,-21558,-21599,-21635,-21667,-21695,-21717,-21734,-21746,-21752,-21753,-21748,-21738,-21722,-21700,
+    -21672,-21638,-21598,-21553,-21501,-21444,-21381,-21312,-21238,-21158,-21073,-20982,-20886,-20786,-20680,-20570,
+    -20455,-20336,-20213,-20086,-19955,-19821,-19683,-19543,-19400,-19255,-19107,-18957,-18806,-18653,-18500,-18345,
+    -18189,-18034,-17878,-17722,-17567,-17413,-17259,-17107,-16956,-16807,-16659,-16514,-16371,-16231,-16094,-15959,
+    -15828,-15700,-15575,-15454,-15337,-15224,-15115,-15010,-14909,-14812,-14720,-14632,-14549,-14470,-14396,-14327,
+    -14262,-14201,-14145,-14094,-14047,-14004,-13966,-13932,-13902,-13876,-13854,-13835,-13821,-13810,-13802,-13797,
+    -13796,-13797,-13801,-13808,-13817,-13828,-13841,-13856,-13872,-13889,-13908,-13927,-13947,-13968,-13989,-14009,
+    -14030,-14050,-14069,-14088,-14106,-14122,-14137,-14150,-14162,-14171,-14178,-14183,-14186,-14186,-14183,-14177,
+    -14168,-14156,-14141,-14122,-14100,-14074,-14044,-14011,-13975,-13934,-13890,-13841,-13789,-13733,-13674,-13610,
+    -13543,-13472,-13397,-13319,-13237,-13152,-13063,-12971,-12876,-12778,-12676,-12572,-12466,-12356,-12245,-12131,
+    -12015,-11897,-11777,-11656,-11534,-11410,-11285,-11159,-11033,-10906,-10779,-10651,-10524,-10397,-10271,-10145,
+    -10020,-9896,-9773,-9651,-9531,-9413,-9296,-9181,-9069,-8958,-8850,-8745,-8642,-8542,-8445,-8351,
+    -8259,-8171,-8086,-8004,-7926,-7851,-7779,-7711,-7646,-7584,-7526,-7471,-7420,-7372,-7327,-7285,
+    -7247,-7212,-7180,-7151,-7125,-7101,-7081,-7063,-7047,-7034,-7023,-7014,-7007,-7002,-6998,-6996,
+    -6996,-6996,-6998,-7000,-7004,-7007,-7011,-7016,-7020,-7024,-7028,-7031,-7033,-7035,-7036,-7036,
+    -7034,-7031,-7026,-7020,-7012,-7001,-6989,-6974,-6957,-6938,-6916,-6891,-6863,-6833,-6800,-6764,
+    -6724,-6682,-6637,-6588,-6537,-6482,-6424,-6363,-6298,-6231,-6160,-6087,-6010,-5930,-5848,-5762,
+    -5674,-5583,-5490,-5394,-5296,-5196,-5093,-4988,-4882,-4773,-4663,-4552,-4439,-4325,-4210,-4094,
+    -3978,-3860,-3743,-3625,-3507,-3389,-3271,-3154,-3037,-2921,-2806,-2692,-2579,-2467,-2357,-2249,
+    -2142,-2037,-1934,-1833,-1734,-1638,-1544,-1452,-1363,-1277,-1194,-1113,-1036,-961,-889,-820,
+    -755,-692,-632,-576,-522,-472,-424,-380,-338,-299,-264,-231,-200,-173,-148,-125,
+    -105,-87,-71,-57,-45,-35,-26,-19,-13,-9,-6,-3,-2,-1,0,0};
+
+const int16_t table_sawtooth_mip7[1024]={
+    0,0,0,0,0,1,2,3,4,5,7,10,13,16,20,25,
+    30,36,42,50,58,67,77,88,99,112,126,141,157,174,192,211,
+    232,254,277,301,327,354,382,412,443,476,510,546,583,622,662,704,
+    747,792,839,887,936,988,1041,1095,1151,1209,1269,1330,1393,1457,1523,1591,
+    1660,1731,1803,1878,1953,2031,2109,2190,2272,2355,2440,2527,2615,2704,2795,2888,
+    2981,3076,3173,3271,3370,3470,3571,3674,3778,3883,3989,4096,4204,4313,4424,4535,
+    4647,4759,4873,4987,5102,5218,5335,5452,5569,5687,5806,5925,6044,6164,6284,6404,
+    6524,6645,6766,6886,7007,7128,7248,7369,7489,7609,7729,7849,7968,8087,8205,8323,
+    8440,8557,8673,8788,8903,9016,9129,9242,9353,9463,9572,9681,9788,9894,9999,10103,
+    10205,10307,10407,10505,10602,10698,10793,10886,10977,11067,11156,11243,11328,11411,11493,11574,
+    11652,11729,11804,11878,11949,12019,12087,12153,12217,12280,12341,12399,12456,12511,12565,12616,
+    12665,12713,12758,12802,12844,12884,12922,12959,12993,13026,13057,13086,13113,13138,13162,13184,
+    13204,13223,13240,13255,13269,13281,13291,13300,13307,13313,13318,13321,13323,13323,13322,13320,
+    13317,13312,13306,13300,13292,13283,13273,13263,13251,13239,13226,13212,13197,13182,13167,13150,
+    13134,13117,13099,13082,13064,13046,13028,13010,12991,12973,12955,12937,12920,12903,12886,12869,
+    12853,12837,12822,12808,12794,12782,12770,12758,12748,12739,12731,12724,12718,12713,12710,12708,
+    12707,12708,12710,12714,12719,12726,12735,12745,12757,12771,12787,12805,12825,12847,12870,12896,
+    12924,12955,12987,13022,13059,13098,13139,13183,13230,13278,13330,13383,13439,13498,13559,13623,
+    13689,13758,13829,13903,13980,14059,14141,14225,14312,14402,14494,14589,14686,14786,14888,14994,
+    15101,15211,15324,15439,15557,15677,15800,15925,16052,16182,16314,16448,16584,16723,16864,17007,
+    17152,17299,17448,17599,17751,17906,18062,18220,18380,18541,18704,18868,19034,19201,19369,19538,
+    19709,19880,20053,20226,20400,20575,20750,20926,21103,21280,21457,21635,21813,21990,22168,22345,
+    22523,22700,22876,23053,23228,23403,23577,23750,23922,24093,24263,24432,24599,24765,24929,25092,
+    25252,25411,25568,25723,25875,26026,26174,26319,26462,26602,26740,26874,27006,27134,27260,27382,
+    27500,27616,27727,27835,27939,28040,28136,28229,28317,28401,28481,28557,28628,28694,28756,28813,
+    28865,28913,28956,28993,29026,29053,29075,29092,29103,29109,29110,29105,29094,29078,29056,29028,
+    28995,28955,28910,28859,28801,28738,28669,28593,28512,28424,28330,28229,28123,28010,27891,27766,
+    27634,27496,27352,27201,27044,26881,26711,26535,26353,26164,25969,25768,25560,25346,25126,24900,
+    24668,24429,24184,23934,23677,23414,23145,22871,22590,22304,22012,21714,21410,21101,20787,20467,
+    20141,19810,19474,19133,18787,18436,18079,17718,17352,16982,16607,16227,15843,15455,15062,14665,
+    14265,13860,13452,13039,12624,12204,11782,11356,10927,10495,10060,9622,9182,8739,8293,7845,
+    7395,6943,6489,6033,5576,5117,4656,4194,3731,3267,2802,2336,1870,1403,935,468,
+    0,-468,-935,-1403,-1870,-2336,-2802,-3267,-3731,-4194,-4656,-5117,-5576,-6033,-6489,-6943,
+    -7395,-7845,-8293,-8739,-9182,-9622,-10060,-10495,-10927,-11356,-11782,-12204,-12624,-13039,-13452,-13860,
+    -14265,-14665,-15062,-15455,-15843,-16227,-16607,-16982,-17352,-17718,-18079,-18436,-18787,-19133,-19474,-19810,
+    -20141,-20467,-20787,-21101,-21410,-21714,-22012,-22304,-22590,-22871,-23145,-23414,-23677,-23934,-24184,-24429,
+    -24668,-24900,-25126,-25346,-25560,-25768,-25969,-26164,-26353,-26535,-26711,-26881,-27044,-27201,-27352,-27496,
+    -27634,-27766,-27891,-28010,-28123,-28229,-28330,-28424,-28512,-28593,-28669,-28738,-28801,-28859,-28910,-28955,
+    -28995,-29028,-29056,-29078,-29094,-29105,-29110,-29109,-29103,-29092,-29075,-29053,-29026,-28993,-28956,-28913,
+    -28865,-28813,-28756,-28694,-28628,-28557,-28481,-28401,-28317,-28229,-28136,-28040,-27939,-27835,-27727,-27616,
+    -27500,-27382,-27260,-27134,-27006,-26874,-26740,-26602,-26462,-26319,-26174,-26026,-25875,-25723,-25568,-25411,
+    -25252,-25092,-24929,-24765,-24599,-24432,-24263,-24093,-23922,-23750,-23577,-23403,-23228,-23053,-22876,-22700,
+    -22523,-22345,-22168,-21990,-21813,-21635,-21457,-21280,-21103,-20926,-20750,-20575,-20400,-20226,-20053,-19880,
+    -19709,-19538,-19369,-19201,-19034,-18868,-18704,-18541,-18380,-18220,-18062,-17906,-17751,-17599,-17448,-17299,
+    -17152,-17007,-16864,-16723,-16584,-16448,-16314,-16182,-16052,-15925,-15800,-15677,-15557,-15439,-15324,-15211,
+    -15101,-14994,-14888,-14786,-14686,-14589,-14494,-14402,-14312,-14225,-14141,-14059,-13980,-13903,-13829,-13758,
+    -13689,-13623,-13559,-13498,-13439,-13383,-13330,-13278,-13230,-13183,-13139,-13098,-13059,-13022,-12987,-12955,
+    -12924,-12896,-12870,-12847,-12825,-12805,-12787,-12771,-12757,-12745,-12735,-12726,-12719,-12714,-12710,-12708,
+    -12707,-12708,-12710,-12713,-12718,-12724,-12731,-12739,-12748,-12758,-12770,-12782,-12794,-12808,-12822,-12837,
+    -12853,-12869,-12886,-12903,-12920,-12937,-12955,-12973,-12991,-13010,-13028,-13046,-13064,-13082,-13099,-13117,
+    -13134,-13150,-13167,-13182,-13197,-13212,-13226,-13239,-13251,-13263,-13273,-13283,-13292,-13300,-13306,-13312,
+    -13317,-13320,-13322,-13323,-13323,-13321,-13318,-13313,-13307,-13300,-13291,-13281,-13269,-13255,-13240,-13223,
+    -13204,-13184,-13162,-13138,-13113,-13086,-13057,-13026,-12993,-12959,-12922,-12884,-12844,-12802,-12758,-12713,
+    -12665,-12616,-12565,-12511,-12456,-12399,-12341,-12280,-12217,-12153,-12087,-12019,-11949,-11878,-11804,-11729,
+    -11652,-11574,-11493,-11411,-11328,-11243,-11156,-11067,-10977,-10886,-10793,-10698,-10602,-10505,-10407,-10307,
+    -10205,-10103,-9999,-9894,-9788,-9681,-9572,-9463,-9353,-9242,-9129,-9016,-8903,-8788,-8673,-8557,
+    -8440,-8323,-8205,-8087,-7968,-7849,-7729,-7609,-7489,-7369,-7248,-7128,-7007,-6886,-6766,-6645,
+    -6524,-6404,-6284,-6164,-6044,-5925,-5806,-5687,-5569,-5452,-5335,-5218,-5102,-4987,-4873,-4759,
+    -4647,-4535,-4424,-4313,-4204,-4096,-3989,-3883,-3778,-3674,-3571,-3470,-3370,-3271,-3173,-3076,
+    -2981,-2888,-2795,-2704,-2615,-2527,-2440,-2355,-2272,-2190,-2109,-2031,-1953,-1878,-1803,-1731,
+    -1660,-1591,-1523,-1457,-1393,-1330,-1269,-1209,-1151,-1095,-1041,-988,-936,-887,-839,-792,
+    -747,-704,-662,-622,-583,-546,-510,-476,-443,-412,-382,-354,-327,-301,-277,-254,
+    -232,-211,-192,-174,-157,-141,-126,-112,-99,-88,-77,-67,-58,-50,-42,-36,
+    -30,-25,-20,-16,-13,-10,-7,-5,-4,-3,-2,-1,0,0,0,0};
+
+const int16_t table_sawtooth_mip8[1024]={
+    0,0,0,0,0,0,0,1,1,2,2,3,4,5,6,7,
+    9,11,13,15,18,20,23,27,30,34,38,43,48,53,59,65,
+    71,78,86,93,101,110,119,129,139,149,160,172,184,197,210,224,
+    238,253,269,285,302,319,337,356,375,395,416,438,460,482,506,530,
+    555,581,607,635,663,691,721,751,782,814,847,881,915,950,986,1023,
+    1061,1100,1139,1179,1221,1263,1306,1349,1394,1440,1486,1534,1582,1631,1682,1733,
+    1785,1838,1891,1946,2002,2059,2116,2175,2234,2295,2356,2419,2482,2546,2611,2678,
+    2745,2813,2882,2952,3023,3095,3167,3241,3316,3392,3468,3546,3624,3704,3784,3865,
+    3948,4031,4115,4200,4286,4373,4460,4549,4638,4729,4820,4913,5006,5100,5194,5290,
+    5387,5484,5582,5682,5782,5882,5984,6086,6190,6294,6398,6504,6610,6717,6825,6934,
+    7043,7153,7264,7376,7488,7601,7715,7829,7944,8059,8176,8292,8410,8528,8647,8766,
+    8886,9006,9127,9248,9370,9493,9616,9739,9863,9988,10113,10238,10364,10490,10616,10743,
+    10871,10998,11126,11254,11383,11512,11641,11771,11900,12030,12160,12291,12421,12552,12683,12814,
+    12945,13076,13207,13339,13470,13602,13733,13865,13997,14128,14260,14391,14522,14654,14785,14916,
+    15047,15178,15308,15439,15569,15699,15829,15958,16088,16216,16345,16473,16601,16729,16856,16983,
+    17109,17235,17361,17486,17610,17734,17858,17981,18103,18225,18346,18467,18587,18706,18825,18943,
+    19060,19177,19293,19408,19522,19636,19748,19860,19971,20082,20191,20299,20407,20514,20619,20724,
+    20828,20930,21032,21133,21233,21331,21429,21525,21620,21715,21808,21900,21990,22080,22168,22255,
+    22341,22426,22509,22591,22672,22751,22829,22906,22982,23056,23128,23199,23269,23338,23405,23470,
+    23534,23597,23658,23717,23775,23832,23887,23940,23992,24042,24091,24138,24183,24227,24269,24309,
+    24348,24385,24421,24454,24486,24517,24545,24572,24597,24620,24642,24662,24680,24696,24710,24723,
+    24734,24743,24750,24755,24758,24760,24760,24757,24753,24747,24740,24730,24718,24705,24689,24672,
+    24653,24632,24608,24583,24556,24528,24497,24464,24429,24392,24354,24313,24271,24226,24180,24131,
+    24081,24028,23974,23918,23860,23799,23737,23673,23607,23539,23469,23397,23323,23247,23169,23089,
+    23008,22924,22838,22751,22661,22570,22477,22381,22284,22185,22084,21981,21877,21770,21661,21551,
+    21439,21325,21209,21091,20971,20849,20726,20601,20474,20345,20215,20082,19948,19812,19675,19535,
+    19394,19251,19107,18960,18812,18663,18511,18358,18204,18047,17890,17730,17569,17406,17242,17076,
+    16909,16740,16570,16398,16224,16050,15873,15695,15516,15336,15154,14970,14785,14599,14412,14223,
+    14033,13841,13649,13455,13260,13063,12866,12667,12467,12266,12064,11860,11656,11450,11244,11036,
+    10828,10618,10407,10196,9983,9770,9555,9340,9124,8907,8689,8470,8251,8031,7810,7588,
+    7365,7142,6919,6694,6469,6244,6017,5791,5563,5335,5107,4878,4649,4419,4189,3958,
+    3727,3496,3265,3033,2801,2568,2335,2102,1869,1636,1403,1169,935,702,468,234,
+    0,-234,-468,-702,-935,-1169,-1403,-1636,-1869,-2102,-2335,-2568,-2801,-3033,-3265,-3496,
+    -3727,-3958,-4189,-4419,-4649,-4878,-5107,-5335,-5563,-5791,-6017,-6244,-6469,-6694,-6919,-7142,
+    -7365,-7588,-7810,-8031,-8251,-8470,-8689,-8907,-9124,-9340,-9555,-9770,-9983,-10196,-10407,-10618,
+    -10828,-11036,-11244,-11450,-11656,-11860,-12064,-12266,-12467,-12667,-12866,-13063,-13260,-13455,-13649,-13841,
+    -14033,-14223,-14412,-14599,-14785,-14970,-15154,-15336,-15516,-15695,-15873,-16050,-16224,-16398,-16570,-16740,
+    -16909,-17076,-17242,-17406,-17569,-17730,-17890,-18047,-18204,-18358,-18511,-18663,-18812,-18960,-19107,-19251,
+    -19394,-19535,-19675,-19812,-19948,-20082,-20215,-20345,-20474,-20601,-20726,-20849,-20971,-21091,-21209,-21325,
+    -21439,-21551,-21661,-21770,-21877,-21981,-22084,-22185,-22284,-22381,-22477,-22570,-22661,-22751,-22838,-22924,
+    -23008,-23089,-23169,-23247,-23323,-23397,-23469,-23539,-23607,-23673,-23737,-23799,-23860,-23918,-23974,-24028,
+    -24081,-24131,-24180,-24226,-24271,-24313,-24354,-24392,-24429,-24464,-24497,-24528,-24556,-24583,-24608,-24632,
+    -24653,-24672,-24689,-24705,-24718,-24730,-24740,-24747,-24753,-24757,-24760,-24760,-24758,-24755,-24750,-24743,
+    -24734,-24723,-24710,-24696,-24680,-24662,-24642,-24620,-24597,-24572,-24545,-24517,-24486,-24454,-24421,-24385,
+    -24348,-24309,-24269,-24227,-24183,-24138,-24091,-24042,-23992,-23940,-23887,-23832,-23775,-23717,-23658,-23597,
+    -23534,-23470,-23405,-23338,-23269,-23199,-23128,-23056,-22982,-22906,-22829,-22751,-22672,-22591,-22509,-22426,
+    -22341,-22255,-22168,-22080,-21990,-21900,-21808,-21715,-21620,-21525,-21429,-21331,-21233,-21133,-21032,-20930,
+    -20828,-20724,-20619,-20514,-20407,-20299,-20191,-20082,-19971,-19860,-19748,-19636,-19522,-19408,-19293,-19177,
+    -19060,-18943,-18825,-18706,-18587,-18467,-18346,-18225,-18103,-17981,-17858,-17734,-17610,-17486,-17361,-17235,
+    -17109,-16983,-16856,-16729,-16601,-16473,-16345,-16216,-16088,-15958,-15829,-15699,-15569,-15439,-15308,-15178,
+    -15047,-14916,-14785,-14654,-14522,-14391,-14260,-14128,-13997,-13865,-13733,-13602,-13470,-13339,-13207,-13076,
+    -12945,-12814,-12683,-12552,-12421,-12291,-12160,-12030,-11900,-11771,-11641,-11512,-11383,-11254,-11126,-10998,
+    -10871,-10743,-10616,-10490,-10364,-10238,-10113,-9988,-9863,-9739,-9616,-9493,-9370,-9248,-9127,-9006,
+    -8886,-8766,-8647,-8528,-8410,-8292,-8176,-8059,-7944,-7829,-7715,-7601,-7488,-7376,-7264,-7153,
+    -7043,-6934,-6825,-6717,-6610,-6504,-6398,-6294,-6190,-6086,-5984,-5882,-5782,-5682,-5582,-5484,
+    -5387,-5290,-5194,-5100,-5006,-4913,-4820,-4729,-4638,-4549,-4460,-4373,-4286,-4200,-4115,-4031,
+    -3948,-3865,-3784,-3704,-3624,-3546,-3468,-3392,-3316,-3241,-3167,-3095,-3023,-2952,-2882,-2813,
+    -2745,-2678,-2611,-2546,-2482,-2419,-2356,-2295,-2234,-2175,-2116,-2059,-2002,-1946,-1891,-1838,
+    -1785,-1733,-1682,-1631,-1582,-1534,-1486,-1440,-1394,-1349,-1306,-1263,-1221,-1179,-1139,-1100,
+    -1061,-1023,-986,-950,-915,-881,-847,-814,-782,-751,-721,-691,-663,-635,-607,-581,
+    -555,-530,-506,-482,-460,-438,-416,-395,-375,-356,-337,-319,-302,-285,-269,-253,
+    -238,-224,-210,-197,-184,-172,-160,-149,-139,-129,-119,-110,-101,-93,-86,-78,
+    -71,-65,-59,-53,-48,-43,-38,-34,-30,-27,-23,-20,-18,-15,-13,-11,
+    -9,-7,-6,-5,-4,-3,-2,-2,-1,-1,0,0,0,0,0,0};
+
+const int16_t table_sawtooth_mip9[1024]={
+    0,117,234,351,468,585,702,818,935,1052,1169,1285,1402,1519,1635,1752,
+    1868,1985,2101,2217,2333,2449,2565,2681,2797,2912,3028,3143,3259,3374,3489,3604,
+    3718,3833,3948,4062,4176,4290,4404,4518,4631,4745,4858,4971,5084,5196,5309,5421,
+    5533,5645,5756,5868,5979,6090,6201,6311,6421,6531,6641,6750,6860,6969,7077,7186,
+    7294,7402,7510,7617,7724,7831,7937,8043,8149,8255,8360,8465,8570,8674,8778,8882,
+    8985,9088,9191,9293,9395,9496,9598,9698,9799,9899,9999,10098,10197,10296,10394,10492,
+    10589,10686,10783,10879,10975,11070,11165,11260,11354,11448,11541,11634,11726,11818,11910,12001,
+    12092,12182,12272,12361,12450,12538,12626,12713,12800,12887,12972,13058,13143,13227,13311,13395,
+    13478,13560,13642,13723,13804,13885,13965,14044,14123,14201,14279,14356,14433,14509,14584,14659,
+    14734,14808,14881,14954,15026,15098,15169,15239,15309,15379,15448,15516,15583,15650,15717,15783,
+    15848,15913,15977,16040,16103,16165,16227,16288,16349,16408,16468,16526,16584,16641,16698,16754,
+    16810,16864,16919,16972,17025,17077,17129,17180,17230,17280,17329,17377,17425,17472,17519,17564,
+    17609,17654,17698,17741,17783,17825,17866,17906,17946,17985,18024,18061,18098,18135,18170,18205,
+    18240,18273,18306,18338,18370,18401,18431,18460,18489,18517,18544,18571,18597,18622,18647,18671,
+    18694,18716,18738,18759,18780,18799,18818,18836,18854,18871,18887,18902,18917,18931,18944,18957,
+    18968,18980,18990,19000,19009,19017,19024,19031,19037,19043,19047,19051,19055,19057,19059,19060,
+    19060,19060,19059,19057,19055,19051,19047,19043,19037,19031,19024,19017,19009,19000,18990,18980,
+    18968,18957,18944,18931,18917,18902,18887,18871,18854,18836,18818,18799,18780,18759,18738,18716,
+    18694,18671,18647,18622,18597,18571,18544,18517,18489,18460,18431,18401,18370,18338,18306,18273,
+    18240,18205,18170,18135,18098,18061,18024,17985,17946,17906,17866,17825,17783,17741,17698,17654,
+    17609,17564,17519,17472,17425,17377,17329,17280,17230,17180,17129,17077,17025,16972,16919,16864,
+    16810,16754,16698,16641,16584,16526,16468,16408,16349,16288,16227,16165,16103,16040,15977,15913,
+    15848,15783,15717,15650,15583,15516,15448,15379,15309,15239,15169,15098,15026,14954,14881,14808,
+    14734,14659,14584,14509,14433,14356,14279,14201,14123,14044,13965,13885,13804,13723,13642,13560,
+    13478,13395,13311,13227,13143,13058,12972,12887,12800,12713,12626,12538,12450,12361,12272,12182,
+    12092,12001,11910,11818,11726,11634,11541,11448,11354,11260,11165,11070,10975,10879,10783,10686,
+    10589,10492,10394,10296,10197,10098,9999,9899,9799,9698,9598,9496,9395,9293,9191,9088,
+    8985,8882,8778,8674,8570,8465,8360,8255,8149,8043,7937,7831,7724,7617,7510,7402,
+    7294,7186,7077,6969,6860,6750,6641,6531,6421,6311,6201,6090,5979,5868,5756,5645,
+    5533,5421,5309,5196,5084,4971,4858,4745,4631,4518,4404,4290,4176,4062,3948,3833,
+    3718,3604,3489,3374,3259,3143,3028,2912,2797,2681,2565,2449,2333,2217,2101,1985,
+    1868,1752,1635,1519,1402,1285,1169,1052,935,818,702,585,468,351,234,117,
+    0,-117,-234,-351,-468,-585,-702,-818,-935,-1052,-1169,-1285,-1402,-1519,-1635,-1752,
+    -1868,-1985,-2101,-2217,-2333,-2449,-2565,-2681,-2797,-2912,-3028,-3143,-3259,-3374,-3489,-3604,
+    -3718,-3833,-3948,-4062,-4176,-4290,-4404,-4518,-4631,-4745,-4858,-4971,-5084,-5196,-5309,-5421,
+    -5533,-5645,-5756,-5868,-5979,-6090,-6201,-6311,-6421,-6531,-6641,-6750,-6860,-6969,-7077,-7186,
+    -7294,-7402,-7510,-7617,-7724,-7831,-7937,-8043,-8149,-8255,-8360,-8465,-8570,-8674,-8778,-8882,
+    -8985,-9088,-9191,-9293,-9395,-9496,-9598,-9698,-9799,-9899,-9999,-10098,-10197,-10296,-10394,-10492,
+    -10589,-10686,-10783,-10879,-10975,-11070,-11165,-11260,-11354,-11448,-11541,-11634,-11726,-11818,-11910,-12001,
+    -12092,-12182,-12272,-12361,-12450,-12538,-12626,-12713,-12800,-12887,-12972,-13058,-13143,-13227,-13311,-13395,
+    -13478,-13560,-13642,-13723,-13804,-13885,-13965,-14044,-14123,-14201,-14279,-14356,-14433,-14509,-14584,-14659,
+    -14734,-14808,-14881,-14954,-15026,-15098,-15169,-15239,-15309,-15379,-15448,-15516,-15583,-15650,-15717,-15783,
+    -15848,-15913,-15977,-16040,-16103,-16165,-16227,-16288,-16349,-16408,-16468,-16526,-16584,-16641,-16698,-16754,
+    -16810,-16864,-16919,-16972,-17025,-17077,-17129,-17180,-17230,-17280,-17329,-17377,-17425,-17472,-17519,-17564,
+    -17609,-17654,-17698,-17741,-17783,-17825,-17866,-17906,-17946,-17985,-18024,-18061,-18098,-18135,-18170,-18205,
+    -18240,-18273,-18306,-18338,-18370,-18401,-18431,-18460,-18489,-18517,-18544,-18571,-18597,-18622,-18647,-18671,
+    -18694,-18716,-18738,-18759,-18780,-18799,-18818,-18836,-18854,-18871,-18887,-18902,-18917,-18931,-18944,-18957,
+    -18968,-18980,-18990,-19000,-19009,-19017,-19024,-19031,-19037,-19043,-19047,-19051,-19055,-19057,-19059,-19060,
+    -19060,-19060,-19059,-19057,-19055,-19051,-19047,-19043,-19037,-19031,-19024,-19017,-19009,-19000,-18990,-18980,
+    -18968,-18957,-18944,-18931,-18917,-18902,-18887,-18871,-18854,-18836,-18818,-18799,-18780,-18759,-18738,-18716,
+    -18694,-18671,-18647,-18622,-18597,-18571,-18544,-18517,-18489,-18460,-18431,-18401,-18370,-18338,-18306,-18273,
+    -18240,-18205,-18170,-18135,-18098,-18061,-18024,-17985,-17946,-17906,-17866,-17825,-17783,-17741,-17698,-17654,
+    -17609,-17564,-17519,-17472,-17425,-17377,-17329,-17280,-17230,-17180,-17129,-17077,-17025,-16972,-16919,-16864,
+    -16810,-16754,-16698,-16641,-16584,-16526,-16468,-16408,-16349,-16288,-16227,-16165,-16103,-16040,-15977,-15913,
+    -15848,-15783,-15717,-15650,-15583,-15516,-15448,-15379,-15309,-15239,-15169,-15098,-15026,-14954,-14881,-14808,
+    -14734,-14659,-14584,-14509,-14433,-14356,-14279,-14201,-14123,-14044,-13965,-13885,-13804,-13723,-13642,-13560,
+    -13478,-13395,-13311,-13227,-13143,-13058,-12972,-12887,-12800,-12713,-12626,-12538,-12450,-12361,-12272,-12182,
+    -12092,-12001,-11910,-11818,-11726,-11634,-11541,-11448,-11354,-11260,-11165,-11070,-10975,-10879,-10783,-10686,
+    -10589,-10492,-10394,-10296,-10197,-10098,-9999,-9899,-9799,-9698,-9598,-9496,-9395,-9293,-9191,-9088,
+    -8985,-8882,-8778,-8674,-8570,-8465,-8360,-8255,-8149,-8043,-7937,-7831,-7724,-7617,-7510,-7402,
+    -7294,-7186,-7077,-6969,-6860,-6750,-6641,-6531,-6421,-6311,-6201,-6090,-5979,-5868,-5756,-5645,
+    -5533,-5421,-5309,-5196,-5084,-4971,-4858,-4745,-4631,-4518,-4404,-4290,-4176,-4062,-3948,-3833,
+    -3718,-3604,-3489,-3374,-3259,-3143,-3028,-2912,-2797,-2681,-2565,-2449,-2333,-2217,-2101,-1985,
+    -1868,-1752,-1635,-1519,-1402,-1285,-1169,-1052,-935,-818,-702,-585,-468,-351,-234,-117};
+
+const int16_t table_squarewave_mip6[1024]={
+    0,867,1734,2599,3462,4323,5180,6032,6881,7723,8560,9390,10213,11028,11834,12631,
+    13418,14195,14961,15715,16458,17188,17905,18609,19299,19974,20635,21280,21910,22524,23122,23703,
+    24267,24814,25344,25856,26351,26827,27285,27725,28146,28549,28934,29300,29647,29976,30286,30578,
+    30851,31106,31343,31561,31762,31946,32111,32260,32391,32506,32605,32687,32754,32767,32767,32767,
+    32767,32767,32767,32767,32762,32704,32634,32553,32461,32359,32247,32126,31997,31859,31713,31560,
+    31401,31235,31064,30888,30707,30522,30334,30142,29949,29753,29556,29357,29159,28960,28762,28565,
+    28369,28174,27982,27793,27607,27424,27245,27070,26899,26733,26573,26418,26268,26125,25987,25857,
+    25732,25615,25505,25401,25305,25217,25136,25063,24997,24939,24889,24847,24812,24785,24766,24755,
+    24751,24755,24766,24784,24810,24843,24882,24929,24981,25041,25106,25177,25254,25336,25423,25516,
+    25613,25714,25819,25928,26041,26157,26276,26397,26521,26647,26774,26902,27032,27163,27293,27424,
+    27555,27685,27814,27942,28069,28194,28317,28437,28556,28671,28783,28892,28998,29099,29197,29291,
+    29380,29464,29544,29619,29689,29754,29814,29868,29916,29960,29997,30029,30055,30075,30090,30098,
+    30101,30098,30090,30075,30055,30030,29999,29963,29921,29875,29823,29767,29706,29640,29570,29496,
+    29418,29336,29250,29161,29069,28974,28876,28776,28674,28570,28464,28357,28248,28139,28029,27918,
+    27808,27697,27587,27478,27370,27262,27156,27052,26950,26850,26752,26657,26564,26475,26389,26307,
+    26228,26153,26082,26015,25952,25894,25840,25791,25747,25708,25674,25645,25622,25603,25590,25582,
+    25579,25582,25590,25603,25622,25645,25674,25708,25747,25791,25840,25894,25952,26015,26082,26153,
+    26228,26307,26389,26475,26564,26657,26752,26850,26950,27052,27156,27262,27370,27478,27587,27697,
+    27808,27918,28029,28139,28248,28357,28464,28570,28674,28776,28876,28974,29069,29161,29250,29336,
+    29418,29496,29570,29640,29706,29767,29823,29875,29921,29963,29999,30030,30055,30075,30090,30098,
+    30101,30098,30090,30075,30055,30029,29997,29960,29916,29868,29814,29754,29689,29619,29544,29464,
+    29380,29291,29197,29099,28998,28892,28783,28671,28556,28437,28317,28194,28069,27942,27814,27685,
+    27555,27424,27293,27163,27032,26902,26774,26647,26521,26397,26276,26157,26041,25928,25819,25714,
+    25613,25516,25423,25336,25254,25177,25106,25041,24981,24929,24882,24843,24810,24784,24766,24755,
+    24751,24755,24766,24785,24812,24847,24889,24939,24997,25063,25136,25217,25305,25401,25505,25615,
+    25732,25857,25987,26125,26268,26418,26573,26733,26899,27070,27245,27424,27607,27793,27982,28174,
+    28369,28565,28762,28960,29159,29357,29556,29753,29949,30142,30334,30522,30707,30888,31064,31235,
+    31401,31560,31713,31859,31997,32126,32247,32359,32461,32553,32634,32704,32762,32767,32767,32767,
+    32767,32767,32767,32767,32754,32687,32605,32506,32391,32260,32111,31946,31762,31561,31343,31106,
+    30851,30578,30286,29976,29647,29300,28934,28549,28146,27725,27285,26827,26351,25856,25344,24814,
+    24267,23703,23122,22524,21910,21280,20635,19974,19299,18609,17905,17188,16458,15715,14961,14195,
+    13418,12631,11834,11028,10213,9390,8560,7723,6881,6032,5180,4323,3462,2599,1734,867,
+    0,-867,-1734,-2599,-3462,-4323,-5180,-6032,-6881,-7723,-8560,-9390,-10213,-11028,-11834,-12631,
+    -13418,-14195,-14961,-15715,-16458,-17188,-17905,-18609,-19299,-19974,-20635,-21280,-21910,-22524,-23122,-23703,
+    -24267,-24814,-25344,-25856,-26351,-26827,-27285,-27725,-28146,-28549,-28934,-29300,-29647,-29976,-30286,-30578,
+    -30851,-31106,-31343,-31561,-31762,-31946,-32111,-32260,-32391,-32506,-32605,-32687,-32754,-32768,-32768,-32768,
+    -32768,-32768,-32768,-32768,-32762,-32704,-32634,-32553,-32461,-32359,-32247,-32126,-31997,-31859,-31713,-31560,
+    -31401,-31235,-31064,-30888,-30707,-30522,-30334,-30142,-29949,-29753,-29556,-29357,-29159,-28960,-28762,-28565,
+    -28369,-28174,-27982,-27793,-27607,-27424,-27245,-27070,-26899,-26733,-26573,-26418,-26268,-26125,-25987,-25857,
+    -25732,-25615,-25505,-25401,-25305,-25217,-25136,-25063,-24997,-24939,-24889,-24847,-24812,-24785,-24766,-24755,
+    -24751,-24755,-24766,-24784,-24810,-24843,-24882,-24929,-24981,-25041,-25106,-25177,-25254,-25336,-25423,-25516,
+    -25613,-25714,-25819,-25928,-26041,-26157,-26276,-26397,-26521,-26647,-26774,-26902,-27032,-27163,-27293,-27424,
+    -27555,-27685,-27814,-27942,-28069,-28194,-28317,-28437,-28556,-28671,-28783,-28892,-28998,-29099,-29197,-29291,
+    -29380,-29464,-29544,-29619,-29689,-29754,-29814,-29868,-29916,-29960,-29997,-30029,-30055,-30075,-30090,-30098,
+    -30101,-30098,-30090,-30075,-30055,-30030,-29999,-29963,-29921,-29875,-29823,-29767,-29706,-29640,-29570,-29496,
+    -29418,-29336,-29250,-29161,-29069,-28974,-28876,-28776,-28674,-28570,-28464,-28357,-28248,-28139,-28029,-27918,
+    -27808,-27697,-27587,-27478,-27370,-27262,-27156,-27052,-26950,-26850,-26752,-26657,-26564,-26475,-26389,-26307,
+    -26228,-26153,-26082,-26015,-25952,-25894,-25840,-25791,-25747,-25708,-25674,-25645,-25622,-25603,-25590,-25582,
+    -25579,-25582,-25590,-25603,-25622,-25645,-25674,-25708,-25747,-25791,-25840,-25894,-25952,-26015,-26082,-26153,
+    -26228,-26307,-26389,-26475,-26564,-26657,-26752,-26850,-26950,-27052,-27156,-27262,-27370,-27478,-27587,-27697,
+    -27808,-27918,-28029,-28139,-28248,-28357,-28464,-28570,-28674,-28776,-28876,-28974,-29069,-29161,-29250,-29336,
+    -29418,-29496,-29570,-29640,-29706,-29767,-29823,-29875,-29921,-29963,-29999,-30030,-30055,-30075,-30090,-30098,
+    -30101,-30098,-30090,-30075,-30055,-30029,-29997,-29960,-29916,-29868,-29814,-29754,-29689,-29619,-29544,-29464,
+    -29380,-29291,-29197,-29099,-28998,-28892,-28783,-28671,-28556,-28437,-28317,-28194,-28069,-27942,-27814,-27685,
+    -27555,-27424,-27293,-27163,-27032,-26902,-26774,-26647,-26521,-26397,-26276,-26157,-26041,-25928,-25819,-25714,
+    -25613,-25516,-25423,-25336,-25254,-25177,-25106,-25041,-24981,-24929,-24882,-24843,-24810,-24784,-24766,-24755,
+    -24751,-24755,-24766,-24785,-24812,-24847,-24889,-24939,-24997,-25063,-25136,-25217,-25305,-25401,-25505,-25615,
+    -25732,-25857,-25987,-26125,-26268,-26418,-26573,-26733,-26899,-27070,-27245,-27424,-27607,-27793,-27982,-28174,
+    -28369,-28565,-28762,-28960,-29159,-29357,-29556,-29753,-29949,-30142,-30334,-30522,-30707,-30888,-31064,-31235,
+    -31401,-31560,-31713,-31859,-31997,-32126,-32247,-32359,-32461,-32553,-32634,-32704,-32762,-32768,-32768,-32768,
+    -32768,-32768,-32768,-32768,-32754,-32687,-32605,-32506,-32391,-32260,-32111,-31946,-31762,-31561,-31343,-31106,
+    -30851,-30578,-30286,-29976,-29647,-29300,-28934,-28549,-28146,-27725,-27285,-26827,-26351,-25856,-25344,-24814,
+    -24267,-23703,-23122,-22524,-21910,-21280,-20635,-19974,-19299,-18609,-17905,-17188,-16458,-15715,-14961,-14195,
+    -13418,-12631,-11834,-11028,-10213,-9390,-8560,-7723,-6881,-6032,-5180,-4323,-3462,-2599,-1734,-867};
+
+const int16_t table_squarewave_mip7[1024]={
+    0,434,867,1301,1734,2167,2599,3031,3463,3893,4323,4752,5181,5608,6034,6460,
+    6883,7306,7727,8147,8566,8982,9397,9811,10222,10632,11039,11445,11848,12249,12648,13045,
+    13439,13831,14220,14606,14990,15372,15750,16125,16498,16867,17234,17597,17957,18314,18668,19018,
+    19365,19708,20048,20384,20717,21045,21371,21692,22010,22323,22633,22939,23241,23539,23832,24122,
+    24407,24688,24965,25238,25507,25771,26030,26286,26537,26783,27025,27263,27496,27724,27948,28167,
+    28382,28592,28798,28999,29195,29387,29574,29756,29934,30107,30275,30439,30598,30752,30902,31047,
+    31187,31323,31454,31580,31702,31819,31932,32040,32143,32242,32336,32426,32511,32592,32669,32741,
+    32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,
+    32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,
+    32767,32767,32758,32697,32634,32568,32499,32427,32354,32277,32199,32118,32035,31950,31863,31773,
+    31682,31589,31494,31397,31299,31199,31097,30994,30890,30784,30677,30569,30460,30349,30238,30125,
+    30012,29898,29784,29668,29552,29436,29319,29202,29084,28967,28849,28731,28613,28495,28377,28259,
+    28142,28024,27908,27791,27675,27560,27445,27331,27218,27105,26994,26883,26773,26664,26557,26450,
+    26345,26241,26138,26037,25937,25838,25741,25646,25552,25460,25370,25281,25194,25109,25026,24945,
+    24866,24789,24714,24641,24570,24501,24435,24370,24308,24249,24191,24136,24083,24033,23985,23940,
+    23897,23856,23818,23783,23750,23720,23692,23667,23645,23625,23608,23593,23581,23572,23565,23561,
+    23560,23561,23565,23572,23581,23593,23608,23625,23645,23667,23692,23720,23750,23783,23818,23856,
+    23897,23940,23985,24033,24083,24136,24191,24249,24308,24370,24435,24501,24570,24641,24714,24789,
+    24866,24945,25026,25109,25194,25281,25370,25460,25552,25646,25741,25838,25937,26037,26138,26241,
+    26345,26450,26557,26664,26773,26883,26994,27105,27218,27331,27445,27560,27675,27791,27908,28024,
+    28142,28259,28377,28495,28613,28731,28849,28967,29084,29202,29319,29436,29552,29668,29784,29898,
+    30012,30125,30238,30349,30460,30569,30677,30784,30890,30994,31097,31199,31299,31397,31494,31589,
+    31682,31773,31863,31950,32035,32118,32199,32277,32354,32427,32499,32568,32634,32697,32758,32767,
+    32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,
+    32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,
+    32767,32741,32669,32592,32511,32426,32336,32242,32143,32040,31932,31819,31702,31580,31454,31323,
+    31187,31047,30902,30752,30598,30439,30275,30107,29934,29756,29574,29387,29195,28999,28798,28592,
+    28382,28167,27948,27724,27496,27263,27025,26783,26537,26286,26030,25771,25507,25238,24965,24688,
+    24407,24122,23832,23539,23241,22939,22633,22323,22010,21692,21371,21045,20717,20384,20048,19708,
+    19365,19018,18668,18314,17957,17597,17234,16867,16498,16125,15750,15372,14990,14606,14220,13831,
+    13439,13045,12648,12249,11848,11445,11039,10632,10222,9811,9397,8982,8566,8147,7727,7306,
+    6883,6460,6034,5608,5181,4752,4323,3893,3463,3031,2599,2167,1734,1301,867,434,
+    0,-434,-867,-1301,-1734,-2167,-2599,-3031,-3463,-3893,-4323,-4752,-5181,-5608,-6034,-6460,
+    -6883,-7306,-7727,-8147,-8566,-8982,-9397,-9811,-10222,-10632,-11039,-11445,-11848,-12249,-12648,-13045,
+    -13439,-13831,-14220,-14606,-14990,-15372,-15750,-16125,-16498,-16867,-17234,-17597,-17957,-18314,-18668,-19018,
+    -19365,-19708,-20048,-20384,-20717,-21045,-21371,-21692,-22010,-22323,-22633,-22939,-23241,-23539,-23832,-24122,
+    -24407,-24688,-24965,-25238,-25507,-25771,-26030,-26286,-26537,-26783,-27025,-27263,-27496,-27724,-27948,-28167,
+    -28382,-28592,-28798,-28999,-29195,-29387,-29574,-29756,-29934,-30107,-30275,-30439,-30598,-30752,-30902,-31047,
+    -31187,-31323,-31454,-31580,-31702,-31819,-31932,-32040,-32143,-32242,-32336,-32426,-32511,-32592,-32669,-32741,
+    -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+    -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+    -32768,-32768,-32758,-32697,-32634,-32568,-32499,-32427,-32354,-32277,-32199,-32118,-32035,-31950,-31863,-31773,
+    -31682,-31589,-31494,-31397,-31299,-31199,-31097,-30994,-30890,-30784,-30677,-30569,-30460,-30349,-30238,-30125,
+    -30012,-29898,-29784,-29668,-29552,-29436,-29319,-29202,-29084,-28967,-28849,-28731,-28613,-28495,-28377,-28259,
+    -28142,-28024,-27908,-27791,-27675,-27560,-27445,-27331,-27218,-27105,-26994,-26883,-26773,-26664,-26557,-26450,
+    -26345,-26241,-26138,-26037,-25937,-25838,-25741,-25646,-25552,-25460,-25370,-25281,-25194,-25109,-25026,-24945,
+    -24866,-24789,-24714,-24641,-24570,-24501,-24435,-24370,-24308,-24249,-24191,-24136,-24083,-24033,-23985,-23940,
+    -23897,-23856,-23818,-23783,-23750,-23720,-23692,-23667,-23645,-23625,-23608,-23593,-23581,-23572,-23565,-23561,
+    -23560,-23561,-23565,-23572,-23581,-23593,-23608,-23625,-23645,-23667,-23692,-23720,-23750,-23783,-23818,-23856,
+    -23897,-23940,-23985,-24033,-24083,-24136,-24191,-24249,-24308,-24370,-24435,-24501,-24570,-24641,-24714,-24789,
+    -24866,-24945,-25026,-25109,-25194,-25281,-25370,-25460,-25552,-25646,-25741,-25838,-25937,-26037,-26138,-26241,
+    -26345,-26450,-26557,-26664,-26773,-26883,-26994,-27105,-27218,-27331,-27445,-27560,-27675,-27791,-27908,-28024,
+    -28142,-28259,-28377,-28495,-28613,-28731,-28849,-28967,-29084,-29202,-29319,-29436,-29552,-29668,-29784,-29898,
+    -30012,-30125,-30238,-30349,-30460,-30569,-30677,-30784,-30890,-30994,-31097,-31199,-31299,-31397,-31494,-31589,
+    -31682,-31773,-31863,-31950,-32035,-32118,-32199,-32277,-32354,-32427,-32499,-32568,-32634,-32697,-32758,-32768,
+    -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+    -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+    -32768,-32741,-32669,-32592,-32511,-32426,-32336,-32242,-32143,-32040,-31932,-31819,-31702,-31580,-31454,-31323,
+    -31187,-31047,-30902,-30752,-30598,-30439,-30275,-30107,-29934,-29756,-29574,-29387,-29195,-28999,-28798,-28592,
+    -28382,-28167,-27948,-27724,-27496,-27263,-27025,-26783,-26537,-26286,-26030,-25771,-25507,-25238,-24965,-24688,
+    -24407,-24122,-23832,-23539,-23241,-22939,-22633,-22323,-22010,-21692,-21371,-21045,-20717,-20384,-20048,-19708,
+    -19365,-19018,-18668,-18314,-17957,-17597,-17234,-16867,-16498,-16125,-15750,-15372,-14990,-14606,-14220,-13831,
+    -13439,-13045,-12648,-12249,-11848,-11445,-11039,-10632,-10222,-9811,-9397,-8982,-8566,-8147,-7727,-7306,
+    -6883,-6460,-6034,-5608,-5181,-4752,-4323,-3893,-3463,-3031,-2599,-2167,-1734,-1301,-867,-434};
+
+const int16_t table_squarewave_mip8[1024]={
+    0,217,434,650,867,1084,1301,1517,1734,1951,2167,2383,2600,2816,3032,3248,
+    3464,3680,3895,4111,4326,4541,4756,4971,5185,5400,5614,5828,6042,6255,6469,6682,
+    6894,7107,7319,7531,7743,7954,8166,8376,8587,8797,9007,9216,9426,9634,9843,10051,
+    10259,10466,10673,10879,11085,11291,11496,11701,11906,12110,12313,12516,12719,12921,13122,13323,
+    13524,13724,13924,14123,14321,14519,14717,14913,15110,15305,15501,15695,15889,16083,16275,16467,
+    16659,16850,17040,17230,17419,17607,17795,17982,18168,18354,18539,18723,18907,19090,19272,19453,
+    19634,19814,19993,20171,20349,20526,20702,20877,21052,21226,21399,21571,21742,21913,22082,22251,
+    22419,22586,22753,22918,23083,23247,23410,23572,23733,23893,24052,24211,24368,24525,24680,24835,
+    24989,25142,25294,25445,25595,25744,25892,26039,26185,26330,26474,26617,26760,26901,27041,27180,
+    27318,27455,27591,27726,27860,27993,28125,28255,28385,28514,28641,28768,28893,29018,29141,29263,
+    29384,29504,29623,29740,29857,29972,30087,30200,30312,30423,30533,30641,30749,30855,30960,31064,
+    31167,31268,31369,31468,31566,31663,31759,31853,31947,32039,32130,32219,32308,32395,32481,32566,
+    32650,32732,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,
+    32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,
+    32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,
+    32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,
+    32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,
+    32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,
+    32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,
+    32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32732,
+    32650,32566,32481,32395,32308,32219,32130,32039,31947,31853,31759,31663,31566,31468,31369,31268,
+    31167,31064,30960,30855,30749,30641,30533,30423,30312,30200,30087,29972,29857,29740,29623,29504,
+    29384,29263,29141,29018,28893,28768,28641,28514,28385,28255,28125,27993,27860,27726,27591,27455,
+    27318,27180,27041,26901,26760,26617,26474,26330,26185,26039,25892,25744,25595,25445,25294,25142,
+    24989,24835,24680,24525,24368,24211,24052,23893,23733,23572,23410,23247,23083,22918,22753,22586,
+    22419,22251,22082,21913,21742,21571,21399,21226,21052,20877,20702,20526,20349,20171,19993,19814,
+    19634,19453,19272,19090,18907,18723,18539,18354,18168,17982,17795,17607,17419,17230,17040,16850,
+    16659,16467,16275,16083,15889,15695,15501,15305,15110,14913,14717,14519,14321,14123,13924,13724,
+    13524,13323,13122,12921,12719,12516,12313,12110,11906,11701,11496,11291,11085,10879,10673,10466,
+    10259,10051,9843,9634,9426,9216,9007,8797,8587,8376,8166,7954,7743,7531,7319,7107,
+    6894,6682,6469,6255,6042,5828,5614,5400,5185,4971,4756,4541,4326,4111,3895,3680,
+    3464,3248,3032,2816,2600,2383,2167,1951,1734,1517,1301,1084,867,650,434,217,
+    0,-217,-434,-650,-867,-1084,-1301,-1517,-1734,-1951,-2167,-2383,-2600,-2816,-3032,-3248,
+    -3464,-3680,-3895,-4111,-4326,-4541,-4756,-4971,-5185,-5400,-5614,-5828,-6042,-6255,-6469,-6682,
+    -6894,-7107,-7319,-7531,-7743,-7954,-8166,-8376,-8587,-8797,-9007,-9216,-9426,-9634,-9843,-10051,
+    -10259,-10466,-10673,-10879,-11085,-11291,-11496,-11701,-11906,-12110,-12313,-12516,-12719,-12921,-13122,-13323,
+    -13524,-13724,-13924,-14123,-14321,-14519,-14717,-14913,-15110,-15305,-15501,-15695,-15889,-16083,-16275,-16467,
+    -16659,-16850,-17040,-17230,-17419,-17607,-17795,-17982,-18168,-18354,-18539,-18723,-18907,-19090,-19272,-19453,
+    -19634,-19814,-19993,-20171,-20349,-20526,-20702,-20877,-21052,-21226,-21399,-21571,-21742,-21913,-22082,-22251,
+    -22419,-22586,-22753,-22918,-23083,-23247,-23410,-23572,-23733,-23893,-24052,-24211,-24368,-24525,-24680,-24835,
+    -24989,-25142,-25294,-25445,-25595,-25744,-25892,-26039,-26185,-26330,-26474,-26617,-26760,-26901,-27041,-27180,
+    -27318,-27455,-27591,-27726,-27860,-27993,-28125,-28255,-28385,-28514,-28641,-28768,-28893,-29018,-29141,-29263,
+    -29384,-29504,-29623,-29740,-29857,-29972,-30087,-30200,-30312,-30423,-30533,-30641,-30749,-30855,-30960,-31064,
+    -31167,-31268,-31369,-31468,-31566,-31663,-31759,-31853,-31947,-32039,-32130,-32219,-32308,-32395,-32481,-32566,
+    -32650,-32732,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+    -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+    -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+    -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+    -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+    -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+    -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+    -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32732,
+    -32650,-32566,-32481,-32395,-32308,-32219,-32130,-32039,-31947,-31853,-31759,-31663,-31566,-31468,-31369,-31268,
+    -31167,-31064,-30960,-30855,-30749,-30641,-30533,-30423,-30312,-30200,-30087,-29972,-29857,-29740,-29623,-29504,
+    -29384,-29263,-29141,-29018,-28893,-28768,-28641,-28514,-28385,-28255,-28125,-27993,-27860,-27726,-27591,-27455,
+    -27318,-27180,-27041,-26901,-26760,-26617,-26474,-26330,-26185,-26039,-25892,-25744,-25595,-25445,-25294,-25142,
+    -24989,-24835,-24680,-24525,-24368,-24211,-24052,-23893,-23733,-23572,-23410,-23247,-23083,-22918,-22753,-22586,
+    -22419,-22251,-22082,-21913,-21742,-21571,-21399,-21226,-21052,-20877,-20702,-20526,-20349,-20171,-19993,-19814,
+    -19634,-19453,-19272,-19090,-18907,-18723,-18539,-18354,-18168,-17982,-17795,-17607,-17419,-17230,-17040,-16850,
+    -16659,-16467,-16275,-16083,-15889,-15695,-15501,-15305,-15110,-14913,-14717,-14519,-14321,-14123,-13924,-13724,
+    -13524,-13323,-13122,-12921,-12719,-12516,-12313,-12110,-11906,-11701,-11496,-11291,-11085,-10879,-10673,-10466,
+    -10259,-10051,-9843,-9634,-9426,-9216,-9007,-8797,-8587,-8376,-8166,-7954,-7743,-7531,-7319,-7107,
+    -6894,-6682,-6469,-6255,-6042,-5828,-5614,-5400,-5185,-4971,-4756,-4541,-4326,-4111,-3895,-3680,
+    -3464,-3248,-3032,-2816,-2600,-2383,-2167,-1951,-1734,-1517,-1301,-1084,-867,-650,-434,-217};
+
+const int16_t table_squarewave2_mip3[1024]={
+    -9625,-9618,-9597,-9563,-9518,-9465,-9406,-9343,-9279,-9217,-9158,-9103,-9053,-9008,-8968,-8932,
+    -8899,-8868,-8838,-8810,-8782,-8756,-8730,-8707,-8685,-8667,-8653,-8643,-8637,-8636,-8639,-8645,
+    -8656,-8669,-8685,-8704,-8724,-8746,-8770,-8796,-8825,-8856,-8891,-8929,-8969,-9013,-9060,-9109,
+    -9160,-9213,-9267,-9322,-9377,-9433,-9489,-9545,-9602,-9659,-9717,-9776,-9835,-9894,-9954,-10013,
+    -10072,-10130,-10186,-10241,-10293,-10344,-10392,-10438,-10482,-10524,-10564,-10602,-10638,-10672,-10703,-10733,
+    -10759,-10782,-10802,-10818,-10830,-10839,-10845,-10847,-10845,-10840,-10833,-10822,-10809,-10792,-10773,-10751,
+    -10726,-10697,-10666,-10631,-10593,-10552,-10509,-10462,-10414,-10363,-10310,-10256,-10200,-10143,-10085,-10026,
+    -9966,-9904,-9842,-9779,-9715,-9651,-9586,-9521,-9457,-9393,-9330,-9269,-9208,-9150,-9093,-9037,
+    -8983,-8932,-8882,-8834,-8788,-8744,-8703,-8664,-8629,-8596,-8567,-8541,-8519,-8501,-8486,-8475,
+    -8467,-8463,-8463,-8465,-8472,-8481,-8494,-8511,-8531,-8555,-8583,-8614,-8649,-8688,-8730,-8775,
+    -8823,-8874,-8927,-8983,-9041,-9101,-9163,-9227,-9292,-9360,-9429,-9500,-9572,-9645,-9719,-9793,
+    -9868,-9942,-10016,-10089,-10162,-10233,-10304,-10373,-10441,-10507,-10571,-10634,-10695,-10753,-10809,-10862,
+    -10912,-10959,-11003,-11043,-11079,-11111,-11139,-11163,-11184,-11200,-11212,-11221,-11225,-11224,-11220,-11211,
+    -11198,-11180,-11158,-11131,-11099,-11063,-11023,-10979,-10930,-10878,-10822,-10762,-10699,-10633,-10563,-10491,
+    -10415,-10337,-10255,-10172,-10086,-9998,-9908,-9817,-9724,-9631,-9537,-9443,-9349,-9255,-9161,-9068,
+    -8976,-8885,-8795,-8707,-8621,-8536,-8454,-8375,-8299,-8226,-8157,-8092,-8030,-7974,-7921,-7873,
+    -7830,-7792,-7759,-7731,-7708,-7691,-7680,-7674,-7674,-7681,-7693,-7712,-7737,-7768,-7806,-7850,
+    -7900,-7956,-8017,-8085,-8158,-8237,-8322,-8412,-8507,-8608,-8713,-8824,-8939,-9059,-9182,-9310,
+    -9440,-9574,-9711,-9850,-9991,-10133,-10278,-10423,-10569,-10716,-10862,-11009,-11154,-11298,-11441,-11582,
+    -11719,-11854,-11985,-12112,-12235,-12352,-12465,-12572,-12672,-12767,-12854,-12934,-13007,-13071,-13127,-13174,
+    -13211,-13238,-13255,-13262,-13257,-13241,-13214,-13175,-13124,-13060,-12985,-12896,-12794,-12680,-12551,-12409,
+    -12254,-12084,-11900,-11701,-11489,-11262,-11021,-10765,-10495,-10211,-9913,-9601,-9275,-8936,-8582,-8215,
+    -7834,-7439,-7032,-6611,-6178,-5732,-5274,-4804,-4323,-3831,-3328,-2815,-2293,-1760,-1218,-668,
+    -109,458,1033,1615,2203,2798,3398,4003,4613,5226,5843,6463,7085,7709,8335,8961,
+    9588,10215,10841,11467,12090,12711,13330,13945,14557,15164,15766,16362,16953,17538,18116,18687,
+    19251,19807,20354,20893,21423,21944,22455,22955,23445,23924,24392,24848,25293,25726,26147,26555,
+    26951,27335,27706,28064,28409,28741,29059,29364,29656,29934,30198,30449,30686,30910,31121,31318,
+    31501,31672,31830,31975,32108,32227,32334,32429,32512,32582,32641,32688,32724,32749,32763,32767,
+    32760,32744,32718,32683,32640,32587,32526,32458,32381,32297,32206,32108,32004,31894,31778,31658,
+    31532,31402,31269,31131,30991,30847,30701,30553,30402,30250,30096,29942,29787,29632,29477,29322,
+    29169,29017,28866,28717,28571,28426,28285,28146,28010,27878,27749,27624,27503,27387,27275,27168,
+    27067,26971,26880,26794,26715,26641,26574,26512,26457,26407,26364,26328,26298,26274,26257,26247,
+    26244,26247,26257,26274,26298,26328,26364,26407,26457,26512,26574,26641,26715,26794,26880,26971,
+    27067,27168,27275,27387,27503,27624,27749,27878,28010,28146,28285,28426,28571,28717,28866,29017,
+    29169,29322,29477,29632,29787,29942,30096,30250,30402,30553,30701,30847,30991,31131,31269,31402,
+    31532,31658,31778,31894,32004,32108,32206,32297,32381,32458,32526,32587,32640,32683,32718,32744,
+    32760,32767,32763,32749,32724,32688,32641,32582,32512,32429,32334,32227,32108,31975,31830,31672,
+    31501,31318,31121,30910,30686,30449,30198,29934,29656,29364,29059,28741,28409,28064,27706,27335,
+    26951,26555,26147,25726,25293,24848,24392,23924,23445,22955,22455,21944,21423,20893,20354,19807,
+    19251,18687,18116,17538,16953,16362,15766,15164,14557,13945,13330,12711,12090,11467,10841,10215,
+    9588,8961,8335,7709,7085,6463,5843,5226,4613,4003,3398,2798,2203,1615,1033,458,
+    -109,-668,-1218,-1760,-2293,-2815,-3328,-3831,-4323,-4804,-5274,-5732,-6178,-6611,-7032,-7439,
+    -7834,-8215,-8582,-8936,-9275,-9601,-9913,-10211,-10495,-10765,-11021,-11262,-11489,-11701,-11900,-12084,
+    -12254,-12409,-12551,-12680,-12794,-12896,-12985,-13060,-13124,-13175,-13214,-13241,-13257,-13262,-13255,-13238,
+    -13211,-13174,-13127,-13071,-13007,-12934,-12854,-12767,-12672,-12572,-12465,-12352,-12235,-12112,-11985,-11854,
+    -11719,-11582,-11441,-11298,-11154,-11009,-10862,-10716,-10569,-10423,-10278,-10133,-9991,-9850,-9711,-9574,
+    -9440,-9310,-9182,-9059,-8939,-8824,-8713,-8608,-8507,-8412,-8322,-8237,-8158,-8085,-8017,-7956,
+    -7900,-7850,-7806,-7768,-7737,-7712,-7693,-7681,-7674,-7674,-7680,-7691,-7708,-7731,-7759,-7792,
+    -7830,-7873,-7921,-7974,-8030,-8092,-8157,-8226,-8299,-8375,-8454,-8536,-8621,-8707,-8795,-8885,
+    -8976,-9068,-9161,-9255,-9349,-9443,-9537,-9631,-9724,-9817,-9908,-9998,-10086,-10172,-10255,-10337,
+    -10415,-10491,-10563,-10633,-10699,-10762,-10822,-10878,-10930,-10979,-11023,-11063,-11099,-11131,-11158,-11180,
+    -11198,-11211,-11220,-11224,-11225,-11221,-11212,-11200,-11184,-11163,-11139,-11111,-11079,-11043,-11003,-10959,
+    -10912,-10862,-10809,-10753,-10695,-10634,-10571,-10507,-10441,-10373,-10304,-10233,-10162,-10089,-10016,-9942,
+    -9868,-9793,-9719,-9645,-9572,-9500,-9429,-9360,-9292,-9227,-9163,-9101,-9041,-8983,-8927,-8874,
+    -8823,-8775,-8730,-8688,-8649,-8614,-8583,-8555,-8531,-8511,-8494,-8481,-8472,-8465,-8463,-8463,
+    -8467,-8475,-8486,-8501,-8519,-8541,-8567,-8596,-8629,-8664,-8703,-8744,-8788,-8834,-8882,-8932,
+    -8983,-9037,-9093,-9150,-9208,-9269,-9330,-9393,-9457,-9521,-9586,-9651,-9715,-9779,-9842,-9904,
+    -9966,-10026,-10085,-10143,-10200,-10256,-10310,-10363,-10414,-10462,-10509,-10552,-10593,-10631,-10666,-10697,
+    -10726,-10751,-10773,-10792,-10809,-10822,-10833,-10840,-10845,-10847,-10845,-10839,-10830,-10818,-10802,-10782,
+    -10759,-10733,-10703,-10672,-10638,-10602,-10564,-10524,-10482,-10438,-10392,-10344,-10293,-10241,-10186,-10130,
+    -10072,-10013,-9954,-9894,-9835,-9776,-9717,-9659,-9602,-9545,-9489,-9433,-9377,-9322,-9267,-9213,
+    -9160,-9109,-9060,-9013,-8969,-8929,-8891,-8856,-8825,-8796,-8770,-8746,-8724,-8704,-8685,-8669,
+    -8656,-8645,-8639,-8636,-8637,-8643,-8653,-8667,-8685,-8707,-8730,-8756,-8782,-8810,-8838,-8868,
+    -8899,-8932,-8968,-9008,-9053,-9103,-9158,-9217,-9279,-9343,-9406,-9465,-9518,-9563,-9597,-9618};
+
+const int16_t table_squarewave2_mip4[1024]={
+    -9529,-9525,-9515,-9499,-9476,-9447,-9412,-9373,-9330,-9283,-9234,-9182,-9130,-9077,-9024,-8972,
+    -8923,-8875,-8831,-8790,-8753,-8720,-8692,-8668,-8649,-8634,-8624,-8619,-8618,-8621,-8627,-8637,
+    -8651,-8667,-8687,-8708,-8733,-8759,-8787,-8817,-8848,-8882,-8917,-8953,-8991,-9031,-9073,-9116,
+    -9161,-9208,-9257,-9307,-9360,-9414,-9469,-9526,-9585,-9644,-9705,-9766,-9828,-9889,-9951,-10012,
+    -10072,-10131,-10189,-10246,-10300,-10353,-10403,-10451,-10496,-10539,-10578,-10615,-10649,-10681,-10709,-10734,
+    -10757,-10776,-10793,-10807,-10818,-10826,-10832,-10835,-10834,-10831,-10826,-10817,-10805,-10790,-10772,-10751,
+    -10727,-10700,-10669,-10636,-10599,-10560,-10517,-10472,-10424,-10373,-10320,-10265,-10207,-10148,-10088,-10026,
+    -9963,-9899,-9835,-9770,-9706,-9641,-9577,-9513,-9449,-9387,-9326,-9265,-9206,-9149,-9093,-9038,
+    -8985,-8934,-8885,-8838,-8793,-8750,-8710,-8672,-8636,-8604,-8574,-8548,-8524,-8504,-8487,-8474,
+    -8464,-8458,-8456,-8458,-8464,-8473,-8487,-8504,-8526,-8551,-8580,-8612,-8648,-8688,-8730,-8776,
+    -8825,-8876,-8930,-8987,-9045,-9106,-9169,-9233,-9299,-9366,-9435,-9504,-9575,-9646,-9719,-9791,
+    -9864,-9937,-10010,-10083,-10155,-10227,-10298,-10368,-10436,-10504,-10569,-10633,-10694,-10754,-10810,-10864,
+    -10914,-10962,-11006,-11046,-11083,-11115,-11144,-11169,-11189,-11205,-11217,-11224,-11227,-11225,-11219,-11209,
+    -11195,-11176,-11152,-11125,-11093,-11058,-11018,-10974,-10927,-10875,-10820,-10762,-10699,-10634,-10565,-10493,
+    -10417,-10339,-10259,-10175,-10090,-10002,-9912,-9821,-9728,-9635,-9540,-9445,-9350,-9255,-9160,-9066,
+    -8972,-8880,-8790,-8702,-8615,-8531,-8450,-8371,-8296,-8224,-8156,-8092,-8031,-7975,-7923,-7875,
+    -7833,-7795,-7762,-7734,-7712,-7695,-7684,-7678,-7678,-7684,-7696,-7714,-7738,-7768,-7804,-7847,
+    -7896,-7951,-8013,-8080,-8154,-8233,-8318,-8409,-8505,-8606,-8713,-8824,-8940,-9060,-9184,-9312,
+    -9443,-9577,-9714,-9853,-9994,-10137,-10281,-10426,-10572,-10718,-10864,-11010,-11154,-11297,-11439,-11579,
+    -11716,-11850,-11980,-12108,-12230,-12349,-12462,-12569,-12671,-12766,-12854,-12935,-13008,-13073,-13129,-13176,
+    -13213,-13241,-13258,-13265,-13260,-13245,-13217,-13178,-13126,-13063,-12986,-12897,-12794,-12678,-12549,-12406,
+    -12250,-12080,-11895,-11697,-11485,-11259,-11018,-10763,-10494,-10211,-9914,-9602,-9277,-8937,-8584,-8217,
+    -7836,-7442,-7034,-6614,-6180,-5735,-5277,-4807,-4325,-3833,-3330,-2816,-2292,-1758,-1216,-665,
+    -105,462,1037,1619,2207,2801,3400,4004,4613,5226,5842,6462,7084,7707,8333,8959,
+    9586,10213,10839,11464,12087,12709,13327,13943,14555,15162,15765,16363,16954,17540,18119,18690,
+    19255,19811,20358,20897,21426,21946,22456,22956,23445,23924,24391,24847,25292,25724,26145,26553,
+    26949,27333,27703,28061,28406,28738,29057,29362,29654,29933,30198,30450,30688,30912,31123,31321,
+    31505,31676,31834,31979,32111,32230,32336,32430,32512,32582,32640,32687,32722,32747,32761,32764,
+    32758,32742,32716,32681,32637,32585,32524,32456,32380,32296,32206,32109,32006,31896,31781,31661,
+    31536,31406,31272,31135,30994,30849,30702,30553,30402,30249,30095,29940,29785,29630,29475,29320,
+    29167,29014,28864,28715,28568,28424,28283,28144,28009,27877,27749,27625,27505,27390,27279,27172,
+    27071,26974,26883,26797,26717,26643,26575,26512,26456,26406,26363,26326,26295,26272,26255,26245,
+    26241,26245,26255,26272,26295,26326,26363,26406,26456,26512,26575,26643,26717,26797,26883,26974,
+    27071,27172,27279,27390,27505,27625,27749,27877,28009,28144,28283,28424,28568,28715,28864,29014,
+    29167,29320,29475,29630,29785,29940,30095,30249,30402,30553,30702,30849,30994,31135,31272,31406,
+    31536,31661,31781,31896,32006,32109,32206,32296,32380,32456,32524,32585,32637,32681,32716,32742,
+    32758,32764,32761,32747,32722,32687,32640,32582,32512,32430,32336,32230,32111,31979,31834,31676,
+    31505,31321,31123,30912,30688,30450,30198,29933,29654,29362,29057,28738,28406,28061,27703,27333,
+    26949,26553,26145,25724,25292,24847,24391,23924,23445,22956,22456,21946,21426,20897,20358,19811,
+    19255,18690,18119,17540,16954,16363,15765,15162,14555,13943,13327,12709,12087,11464,10839,10213,
+    9586,8959,8333,7707,7084,6462,5842,5226,4613,4004,3400,2801,2207,1619,1037,462,
+    -105,-665,-1216,-1758,-2292,-2816,-3330,-3833,-4325,-4807,-5277,-5735,-6180,-6614,-7034,-7442,
+    -7836,-8217,-8584,-8937,-9277,-9602,-9914,-10211,-10494,-10763,-11018,-11259,-11485,-11697,-11895,-12080,
+    -12250,-12406,-12549,-12678,-12794,-12897,-12986,-13063,-13126,-13178,-13217,-13245,-13260,-13265,-13258,-13241,
+    -13213,-13176,-13129,-13073,-13008,-12935,-12854,-12766,-12671,-12569,-12462,-12349,-12230,-12108,-11980,-11850,
+    -11716,-11579,-11439,-11297,-11154,-11010,-10864,-10718,-10572,-10426,-10281,-10137,-9994,-9853,-9714,-9577,
+    -9443,-9312,-9184,-9060,-8940,-8824,-8713,-8606,-8505,-8409,-8318,-8233,-8154,-8080,-8013,-7951,
+    -7896,-7847,-7804,-7768,-7738,-7714,-7696,-7684,-7678,-7678,-7684,-7695,-7712,-7734,-7762,-7795,
+    -7833,-7875,-7923,-7975,-8031,-8092,-8156,-8224,-8296,-8371,-8450,-8531,-8615,-8702,-8790,-8880,
+    -8972,-9066,-9160,-9255,-9350,-9445,-9540,-9635,-9728,-9821,-9912,-10002,-10090,-10175,-10259,-10339,
+    -10417,-10493,-10565,-10634,-10699,-10762,-10820,-10875,-10927,-10974,-11018,-11058,-11093,-11125,-11152,-11176,
+    -11195,-11209,-11219,-11225,-11227,-11224,-11217,-11205,-11189,-11169,-11144,-11115,-11083,-11046,-11006,-10962,
+    -10914,-10864,-10810,-10754,-10694,-10633,-10569,-10504,-10436,-10368,-10298,-10227,-10155,-10083,-10010,-9937,
+    -9864,-9791,-9719,-9646,-9575,-9504,-9435,-9366,-9299,-9233,-9169,-9106,-9045,-8987,-8930,-8876,
+    -8825,-8776,-8730,-8688,-8648,-8612,-8580,-8551,-8526,-8504,-8487,-8473,-8464,-8458,-8456,-8458,
+    -8464,-8474,-8487,-8504,-8524,-8548,-8574,-8604,-8636,-8672,-8710,-8750,-8793,-8838,-8885,-8934,
+    -8985,-9038,-9093,-9149,-9206,-9265,-9326,-9387,-9449,-9513,-9577,-9641,-9706,-9770,-9835,-9899,
+    -9963,-10026,-10088,-10148,-10207,-10265,-10320,-10373,-10424,-10472,-10517,-10560,-10599,-10636,-10669,-10700,
+    -10727,-10751,-10772,-10790,-10805,-10817,-10826,-10831,-10834,-10835,-10832,-10826,-10818,-10807,-10793,-10776,
+    -10757,-10734,-10709,-10681,-10649,-10615,-10578,-10539,-10496,-10451,-10403,-10353,-10300,-10246,-10189,-10131,
+    -10072,-10012,-9951,-9889,-9828,-9766,-9705,-9644,-9585,-9526,-9469,-9414,-9360,-9307,-9257,-9208,
+    -9161,-9116,-9073,-9031,-8991,-8953,-8917,-8882,-8848,-8817,-8787,-8759,-8733,-8708,-8687,-8667,
+    -8651,-8637,-8627,-8621,-8618,-8619,-8624,-8634,-8649,-8668,-8692,-8720,-8753,-8790,-8831,-8875,
+    -8923,-8972,-9024,-9077,-9130,-9182,-9234,-9283,-9330,-9373,-9412,-9447,-9476,-9499,-9515,-9525};
+
+const int16_t table_squarewave2_mip5[1024]={
+    -9313,-9311,-9308,-9301,-9292,-9281,-9268,-9252,-9234,-9214,-9193,-9170,-9145,-9120,-9093,-9065,
+    -9037,-9009,-8980,-8952,-8924,-8897,-8870,-8845,-8821,-8799,-8778,-8760,-8744,-8730,-8719,-8711,
+    -8706,-8704,-8705,-8709,-8717,-8728,-8742,-8760,-8782,-8807,-8836,-8868,-8903,-8942,-8983,-9028,
+    -9076,-9126,-9179,-9234,-9291,-9351,-9412,-9474,-9538,-9602,-9668,-9734,-9800,-9866,-9932,-9997,
+    -10062,-10125,-10188,-10249,-10308,-10365,-10420,-10473,-10523,-10570,-10615,-10657,-10695,-10731,-10762,-10791,
+    -10816,-10837,-10855,-10869,-10879,-10886,-10888,-10887,-10883,-10875,-10863,-10848,-10829,-10807,-10782,-10754,
+    -10723,-10688,-10651,-10612,-10570,-10525,-10478,-10429,-10379,-10326,-10272,-10216,-10160,-10102,-10043,-9983,
+    -9922,-9862,-9800,-9739,-9677,-9616,-9555,-9494,-9434,-9375,-9316,-9259,-9202,-9147,-9093,-9041,
+    -8991,-8942,-8895,-8850,-8808,-8767,-8729,-8694,-8661,-8630,-8603,-8578,-8556,-8538,-8522,-8509,
+    -8500,-8494,-8492,-8492,-8496,-8504,-8515,-8529,-8547,-8569,-8593,-8621,-8653,-8688,-8726,-8767,
+    -8812,-8859,-8909,-8962,-9018,-9077,-9137,-9200,-9265,-9332,-9401,-9472,-9543,-9616,-9690,-9765,
+    -9840,-9915,-9991,-10066,-10141,-10215,-10289,-10361,-10432,-10501,-10569,-10634,-10698,-10758,-10817,-10872,
+    -10924,-10973,-11018,-11060,-11098,-11132,-11162,-11188,-11210,-11227,-11239,-11248,-11251,-11250,-11245,-11234,
+    -11219,-11200,-11175,-11146,-11113,-11075,-11033,-10987,-10936,-10882,-10823,-10761,-10696,-10627,-10555,-10479,
+    -10401,-10321,-10238,-10152,-10065,-9976,-9886,-9794,-9702,-9609,-9515,-9421,-9327,-9234,-9141,-9048,
+    -8957,-8868,-8779,-8693,-8609,-8527,-8447,-8371,-8297,-8227,-8160,-8097,-8038,-7983,-7932,-7885,
+    -7844,-7807,-7775,-7748,-7727,-7711,-7700,-7695,-7696,-7702,-7715,-7733,-7757,-7787,-7824,-7866,
+    -7914,-7968,-8028,-8094,-8166,-8243,-8326,-8414,-8508,-8606,-8710,-8819,-8932,-9049,-9171,-9296,
+    -9426,-9558,-9693,-9831,-9972,-10114,-10259,-10404,-10550,-10697,-10845,-10991,-11137,-11282,-11426,-11567,
+    -11706,-11842,-11975,-12104,-12229,-12349,-12463,-12572,-12675,-12771,-12861,-12943,-13017,-13082,-13139,-13187,
+    -13225,-13253,-13271,-13278,-13274,-13259,-13232,-13193,-13142,-13079,-13002,-12913,-12810,-12694,-12564,-12420,
+    -12263,-12091,-11906,-11706,-11492,-11263,-11021,-10764,-10492,-10207,-9907,-9593,-9266,-8924,-8569,-8200,
+    -7818,-7423,-7014,-6594,-6160,-5715,-5257,-4788,-4308,-3816,-3314,-2802,-2280,-1748,-1207,-658,
+    -100,465,1038,1618,2205,2797,3396,3999,4607,5218,5834,6453,7074,7697,8322,8948,
+    9574,10200,10826,11451,12074,12695,13314,13929,14541,15148,15751,16349,16942,17528,18107,18680,
+    19246,19803,20352,20893,21424,21946,22458,22960,23451,23932,24401,24859,25305,25739,26161,26571,
+    26967,27351,27722,28080,28425,28756,29074,29378,29669,29946,30210,30460,30696,30919,31128,31324,
+    31506,31676,31832,31975,32106,32223,32329,32422,32503,32572,32630,32676,32711,32735,32749,32752,
+    32746,32729,32703,32668,32625,32572,32512,32443,32367,32284,32195,32098,31996,31887,31773,31654,
+    31531,31402,31270,31134,30995,30852,30707,30560,30411,30260,30107,29954,29800,29646,29492,29338,
+    29185,29033,28882,28733,28585,28440,28298,28158,28021,27888,27758,27632,27510,27393,27280,27172,
+    27068,26971,26878,26791,26710,26635,26565,26502,26446,26395,26351,26314,26284,26260,26243,26232,
+    26229,26232,26243,26260,26284,26314,26351,26395,26446,26502,26565,26635,26710,26791,26878,26971,
+    27068,27172,27280,27393,27510,27632,27758,27888,28021,28158,28298,28440,28585,28733,28882,29033,
+    29185,29338,29492,29646,29800,29954,30107,30260,30411,30560,30707,30852,30995,31134,31270,31402,
+    31531,31654,31773,31887,31996,32098,32195,32284,32367,32443,32512,32572,32625,32668,32703,32729,
+    32746,32752,32749,32735,32711,32676,32630,32572,32503,32422,32329,32223,32106,31975,31832,31676,
+    31506,31324,31128,30919,30696,30460,30210,29946,29669,29378,29074,28756,28425,28080,27722,27351,
+    26967,26571,26161,25739,25305,24859,24401,23932,23451,22960,22458,21946,21424,20893,20352,19803,
+    19246,18680,18107,17528,16942,16349,15751,15148,14541,13929,13314,12695,12074,11451,10826,10200,
+    9574,8948,8322,7697,7074,6453,5834,5218,4607,3999,3396,2797,2205,1618,1038,465,
+    -100,-658,-1207,-1748,-2280,-2802,-3314,-3816,-4308,-4788,-5257,-5715,-6160,-6594,-7014,-7423,
+    -7818,-8200,-8569,-8924,-9266,-9593,-9907,-10207,-10492,-10764,-11021,-11263,-11492,-11706,-11906,-12091,
+    -12263,-12420,-12564,-12694,-12810,-12913,-13002,-13079,-13142,-13193,-13232,-13259,-13274,-13278,-13271,-13253,
+    -13225,-13187,-13139,-13082,-13017,-12943,-12861,-12771,-12675,-12572,-12463,-12349,-12229,-12104,-11975,-11842,
+    -11706,-11567,-11426,-11282,-11137,-10991,-10845,-10697,-10550,-10404,-10259,-10114,-9972,-9831,-9693,-9558,
+    -9426,-9296,-9171,-9049,-8932,-8819,-8710,-8606,-8508,-8414,-8326,-8243,-8166,-8094,-8028,-7968,
+    -7914,-7866,-7824,-7787,-7757,-7733,-7715,-7702,-7696,-7695,-7700,-7711,-7727,-7748,-7775,-7807,
+    -7844,-7885,-7932,-7983,-8038,-8097,-8160,-8227,-8297,-8371,-8447,-8527,-8609,-8693,-8779,-8868,
+    -8957,-9048,-9141,-9234,-9327,-9421,-9515,-9609,-9702,-9794,-9886,-9976,-10065,-10152,-10238,-10321,
+    -10401,-10479,-10555,-10627,-10696,-10761,-10823,-10882,-10936,-10987,-11033,-11075,-11113,-11146,-11175,-11200,
+    -11219,-11234,-11245,-11250,-11251,-11248,-11239,-11227,-11210,-11188,-11162,-11132,-11098,-11060,-11018,-10973,
+    -10924,-10872,-10817,-10758,-10698,-10634,-10569,-10501,-10432,-10361,-10289,-10215,-10141,-10066,-9991,-9915,
+    -9840,-9765,-9690,-9616,-9543,-9472,-9401,-9332,-9265,-9200,-9137,-9077,-9018,-8962,-8909,-8859,
+    -8812,-8767,-8726,-8688,-8653,-8621,-8593,-8569,-8547,-8529,-8515,-8504,-8496,-8492,-8492,-8494,
+    -8500,-8509,-8522,-8538,-8556,-8578,-8603,-8630,-8661,-8694,-8729,-8767,-8808,-8850,-8895,-8942,
+    -8991,-9041,-9093,-9147,-9202,-9259,-9316,-9375,-9434,-9494,-9555,-9616,-9677,-9739,-9800,-9862,
+    -9922,-9983,-10043,-10102,-10160,-10216,-10272,-10326,-10379,-10429,-10478,-10525,-10570,-10612,-10651,-10688,
+    -10723,-10754,-10782,-10807,-10829,-10848,-10863,-10875,-10883,-10887,-10888,-10886,-10879,-10869,-10855,-10837,
+    -10816,-10791,-10762,-10731,-10695,-10657,-10615,-10570,-10523,-10473,-10420,-10365,-10308,-10249,-10188,-10125,
+    -10062,-9997,-9932,-9866,-9800,-9734,-9668,-9602,-9538,-9474,-9412,-9351,-9291,-9234,-9179,-9126,
+    -9076,-9028,-8983,-8942,-8903,-8868,-8836,-8807,-8782,-8760,-8742,-8728,-8717,-8709,-8705,-8704,
+    -8706,-8711,-8719,-8730,-8744,-8760,-8778,-8799,-8821,-8845,-8870,-8897,-8924,-8952,-8980,-9009,
+    -9037,-9065,-9093,-9120,-9145,-9170,-9193,-9214,-9234,-9252,-9268,-9281,-9292,-9301,-9308,-9311};
+
+const int16_t table_squarewave2_mip6[1024]={
+    -7934,-7936,-7940,-7948,-7959,-7972,-7989,-8009,-8032,-8057,-8086,-8117,-8151,-8187,-8226,-8267,
+    -8311,-8357,-8406,-8456,-8508,-8563,-8619,-8676,-8735,-8796,-8858,-8920,-8984,-9049,-9114,-9180,
+    -9247,-9314,-9380,-9447,-9514,-9581,-9647,-9712,-9777,-9841,-9905,-9967,-10027,-10087,-10145,-10202,
+    -10256,-10310,-10361,-10410,-10457,-10502,-10544,-10584,-10622,-10657,-10690,-10720,-10747,-10772,-10793,-10812,
+    -10828,-10841,-10852,-10859,-10863,-10865,-10863,-10859,-10852,-10842,-10829,-10813,-10795,-10774,-10750,-10724,
+    -10696,-10665,-10631,-10596,-10558,-10519,-10477,-10434,-10389,-10342,-10294,-10244,-10193,-10141,-10088,-10035,
+    -9980,-9925,-9870,-9814,-9758,-9702,-9646,-9590,-9535,-9480,-9425,-9372,-9319,-9268,-9218,-9169,
+    -9121,-9075,-9030,-8988,-8947,-8908,-8871,-8836,-8804,-8773,-8745,-8720,-8697,-8677,-8659,-8644,
+    -8632,-8623,-8616,-8612,-8611,-8613,-8618,-8625,-8635,-8648,-8664,-8683,-8704,-8728,-8754,-8783,
+    -8814,-8848,-8884,-8923,-8963,-9006,-9050,-9097,-9145,-9195,-9246,-9299,-9352,-9407,-9463,-9520,
+    -9578,-9636,-9695,-9754,-9813,-9872,-9931,-9990,-10048,-10105,-10162,-10219,-10274,-10327,-10380,-10431,
+    -10481,-10529,-10575,-10619,-10661,-10701,-10738,-10774,-10806,-10836,-10864,-10888,-10910,-10929,-10944,-10957,
+    -10967,-10973,-10977,-10977,-10974,-10967,-10957,-10944,-10928,-10909,-10886,-10860,-10831,-10799,-10764,-10726,
+    -10685,-10641,-10595,-10545,-10493,-10439,-10383,-10324,-10263,-10200,-10135,-10069,-10001,-9932,-9862,-9790,
+    -9718,-9645,-9571,-9497,-9423,-9349,-9275,-9201,-9128,-9056,-8984,-8914,-8845,-8778,-8712,-8648,
+    -8586,-8526,-8469,-8414,-8363,-8313,-8267,-8225,-8185,-8149,-8117,-8088,-8064,-8043,-8026,-8014,
+    -8006,-8002,-8003,-8008,-8018,-8032,-8051,-8075,-8103,-8136,-8174,-8217,-8263,-8315,-8371,-8432,
+    -8497,-8566,-8639,-8717,-8798,-8884,-8973,-9066,-9162,-9261,-9363,-9468,-9576,-9686,-9799,-9913,
+    -10029,-10146,-10265,-10385,-10505,-10626,-10746,-10867,-10987,-11106,-11224,-11340,-11455,-11568,-11678,-11785,
+    -11890,-11990,-12087,-12180,-12268,-12352,-12430,-12503,-12570,-12631,-12685,-12733,-12773,-12806,-12831,-12848,
+    -12856,-12856,-12847,-12828,-12800,-12762,-12714,-12656,-12587,-12508,-12417,-12316,-12203,-12078,-11942,-11794,
+    -11634,-11462,-11277,-11081,-10871,-10650,-10416,-10169,-9910,-9638,-9354,-9057,-8748,-8426,-8092,-7746,
+    -7387,-7016,-6634,-6240,-5834,-5417,-4988,-4549,-4099,-3638,-3167,-2686,-2196,-1696,-1187,-669,
+    -143,391,934,1483,2039,2602,3171,3746,4326,4911,5501,6094,6691,7292,7895,8500,
+    9107,9715,10324,10933,11542,12151,12758,13364,13968,14569,15167,15762,16352,16939,17520,18096,
+    18666,19231,19788,20338,20881,21416,21943,22461,22970,23470,23959,24439,24908,25367,25814,26250,
+    26675,27087,27488,27876,28252,28615,28964,29301,29625,29935,30231,30514,30784,31039,31281,31509,
+    31723,31923,32109,32282,32441,32586,32718,32767,32767,32767,32767,32767,32767,32767,32767,32767,
+    32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32674,32561,32440,32312,32177,
+    32036,31889,31736,31579,31417,31250,31080,30906,30730,30551,30370,30187,30003,29818,29633,29448,
+    29264,29080,28898,28717,28538,28362,28189,28019,27852,27690,27531,27378,27229,27085,26947,26815,
+    26689,26569,26455,26349,26249,26157,26072,25995,25925,25863,25810,25764,25726,25697,25676,25664,
+    25659,25664,25676,25697,25726,25764,25810,25863,25925,25995,26072,26157,26249,26349,26455,26569,
+    26689,26815,26947,27085,27229,27378,27531,27690,27852,28019,28189,28362,28538,28717,28898,29080,
+    29264,29448,29633,29818,30003,30187,30370,30551,30730,30906,31080,31250,31417,31579,31736,31889,
+    32036,32177,32312,32440,32561,32674,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,
+    32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32718,32586,32441,32282,32109,31923,
+    31723,31509,31281,31039,30784,30514,30231,29935,29625,29301,28964,28615,28252,27876,27488,27087,
+    26675,26250,25814,25367,24908,24439,23959,23470,22970,22461,21943,21416,20881,20338,19788,19231,
+    18666,18096,17520,16939,16352,15762,15167,14569,13968,13364,12758,12151,11542,10933,10324,9715,
+    9107,8500,7895,7292,6691,6094,5501,4911,4326,3746,3171,2602,2039,1483,934,391,
+    -143,-669,-1187,-1696,-2196,-2686,-3167,-3638,-4099,-4549,-4988,-5417,-5834,-6240,-6634,-7016,
+    -7387,-7746,-8092,-8426,-8748,-9057,-9354,-9638,-9910,-10169,-10416,-10650,-10871,-11081,-11277,-11462,
+    -11634,-11794,-11942,-12078,-12203,-12316,-12417,-12508,-12587,-12656,-12714,-12762,-12800,-12828,-12847,-12856,
+    -12856,-12848,-12831,-12806,-12773,-12733,-12685,-12631,-12570,-12503,-12430,-12352,-12268,-12180,-12087,-11990,
+    -11890,-11785,-11678,-11568,-11455,-11340,-11224,-11106,-10987,-10867,-10746,-10626,-10505,-10385,-10265,-10146,
+    -10029,-9913,-9799,-9686,-9576,-9468,-9363,-9261,-9162,-9066,-8973,-8884,-8798,-8717,-8639,-8566,
+    -8497,-8432,-8371,-8315,-8263,-8217,-8174,-8136,-8103,-8075,-8051,-8032,-8018,-8008,-8003,-8002,
+    -8006,-8014,-8026,-8043,-8064,-8088,-8117,-8149,-8185,-8225,-8267,-8313,-8363,-8414,-8469,-8526,
+    -8586,-8648,-8712,-8778,-8845,-8914,-8984,-9056,-9128,-9201,-9275,-9349,-9423,-9497,-9571,-9645,
+    -9718,-9790,-9862,-9932,-10001,-10069,-10135,-10200,-10263,-10324,-10383,-10439,-10493,-10545,-10595,-10641,
+    -10685,-10726,-10764,-10799,-10831,-10860,-10886,-10909,-10928,-10944,-10957,-10967,-10974,-10977,-10977,-10973,
+    -10967,-10957,-10944,-10929,-10910,-10888,-10864,-10836,-10806,-10774,-10738,-10701,-10661,-10619,-10575,-10529,
+    -10481,-10431,-10380,-10327,-10274,-10219,-10162,-10105,-10048,-9990,-9931,-9872,-9813,-9754,-9695,-9636,
+    -9578,-9520,-9463,-9407,-9352,-9299,-9246,-9195,-9145,-9097,-9050,-9006,-8963,-8923,-8884,-8848,
+    -8814,-8783,-8754,-8728,-8704,-8683,-8664,-8648,-8635,-8625,-8618,-8613,-8611,-8612,-8616,-8623,
+    -8632,-8644,-8659,-8677,-8697,-8720,-8745,-8773,-8804,-8836,-8871,-8908,-8947,-8988,-9030,-9075,
+    -9121,-9169,-9218,-9268,-9319,-9372,-9425,-9480,-9535,-9590,-9646,-9702,-9758,-9814,-9870,-9925,
+    -9980,-10035,-10088,-10141,-10193,-10244,-10294,-10342,-10389,-10434,-10477,-10519,-10558,-10596,-10631,-10665,
+    -10696,-10724,-10750,-10774,-10795,-10813,-10829,-10842,-10852,-10859,-10863,-10865,-10863,-10859,-10852,-10841,
+    -10828,-10812,-10793,-10772,-10747,-10720,-10690,-10657,-10622,-10584,-10544,-10502,-10457,-10410,-10361,-10310,
+    -10256,-10202,-10145,-10087,-10027,-9967,-9905,-9841,-9777,-9712,-9647,-9581,-9514,-9447,-9380,-9314,
+    -9247,-9180,-9114,-9049,-8984,-8920,-8858,-8796,-8735,-8676,-8619,-8563,-8508,-8456,-8406,-8357,
+    -8311,-8267,-8226,-8187,-8151,-8117,-8086,-8057,-8032,-8009,-7989,-7972,-7959,-7948,-7940,-7936};
+
+const int16_t table_squarewave2_mip7[1024]={
+    -10574,-10574,-10573,-10571,-10569,-10566,-10562,-10558,-10553,-10548,-10541,-10534,-10527,-10519,-10510,-10500,
+    -10490,-10479,-10468,-10456,-10444,-10430,-10417,-10402,-10387,-10372,-10356,-10339,-10322,-10305,-10287,-10268,
+    -10249,-10229,-10209,-10188,-10167,-10146,-10124,-10102,-10079,-10056,-10032,-10009,-9984,-9960,-9935,-9910,
+    -9884,-9859,-9833,-9806,-9780,-9753,-9726,-9699,-9672,-9644,-9617,-9589,-9561,-9533,-9505,-9477,
+    -9449,-9421,-9393,-9365,-9337,-9309,-9281,-9253,-9225,-9198,-9170,-9143,-9115,-9088,-9061,-9035,
+    -9008,-8982,-8956,-8931,-8905,-8880,-8856,-8831,-8807,-8784,-8761,-8738,-8716,-8694,-8672,-8651,
+    -8631,-8611,-8592,-8573,-8554,-8537,-8520,-8503,-8487,-8472,-8457,-8443,-8430,-8417,-8405,-8394,
+    -8383,-8373,-8364,-8355,-8348,-8341,-8335,-8329,-8325,-8321,-8318,-8316,-8315,-8314,-8314,-8316,
+    -8318,-8321,-8324,-8329,-8334,-8341,-8348,-8356,-8365,-8375,-8385,-8397,-8409,-8423,-8437,-8452,
+    -8468,-8485,-8503,-8521,-8541,-8561,-8583,-8605,-8628,-8651,-8676,-8701,-8728,-8755,-8783,-8811,
+    -8841,-8871,-8902,-8934,-8967,-9000,-9034,-9069,-9104,-9140,-9177,-9215,-9253,-9292,-9331,-9371,
+    -9412,-9453,-9494,-9537,-9579,-9622,-9666,-9710,-9755,-9800,-9845,-9891,-9937,-9983,-10030,-10076,
+    -10124,-10171,-10218,-10266,-10314,-10362,-10410,-10458,-10506,-10555,-10603,-10651,-10699,-10747,-10795,-10842,
+    -10890,-10937,-10984,-11031,-11077,-11123,-11169,-11214,-11259,-11303,-11347,-11391,-11433,-11475,-11517,-11558,
+    -11598,-11637,-11676,-11714,-11751,-11787,-11822,-11856,-11890,-11922,-11953,-11984,-12013,-12041,-12067,-12093,
+    -12117,-12140,-12162,-12182,-12201,-12219,-12235,-12249,-12263,-12274,-12284,-12292,-12299,-12304,-12308,-12309,
+    -12309,-12307,-12303,-12297,-12290,-12280,-12269,-12255,-12239,-12222,-12202,-12180,-12156,-12130,-12102,-12071,
+    -12038,-12003,-11966,-11926,-11884,-11840,-11793,-11744,-11692,-11638,-11581,-11522,-11460,-11396,-11329,-11259,
+    -11187,-11113,-11035,-10955,-10872,-10787,-10699,-10608,-10514,-10418,-10319,-10217,-10112,-10004,-9894,-9781,
+    -9665,-9546,-9424,-9300,-9172,-9042,-8909,-8773,-8634,-8492,-8347,-8200,-8049,-7896,-7740,-7581,
+    -7419,-7254,-7087,-6916,-6743,-6567,-6388,-6206,-6021,-5834,-5644,-5451,-5255,-5056,-4855,-4651,
+    -4445,-4235,-4023,-3809,-3591,-3372,-3149,-2924,-2697,-2467,-2234,-1999,-1762,-1522,-1280,-1035,
+    -788,-539,-287,-34,222,480,740,1003,1267,1533,1802,2072,2344,2618,2894,3172,
+    3452,3733,4016,4300,4586,4874,5163,5454,5746,6039,6334,6630,6927,7225,7525,7825,
+    8127,8429,8732,9037,9342,9648,9954,10261,10569,10877,11186,11496,11805,12115,12425,12736,
+    13046,13357,13668,13979,14289,14600,14910,15220,15530,15839,16148,16457,16765,17072,17379,17685,
+    17990,18294,18598,18900,19202,19502,19801,20099,20396,20692,20986,21278,21570,21859,22147,22434,
+    22718,23001,23282,23561,23839,24114,24387,24658,24927,25193,25457,25719,25979,26236,26490,26742,
+    26992,27239,27483,27724,27962,28198,28430,28660,28887,29110,29331,29548,29762,29973,30180,30385,
+    30585,30783,30977,31167,31354,31537,31717,31893,32065,32233,32398,32559,32716,32767,32767,32767,
+    32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,
+    32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,
+    32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,
+    32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,
+    32767,32767,32767,32767,32716,32559,32398,32233,32065,31893,31717,31537,31354,31167,30977,30783,
+    30585,30385,30180,29973,29762,29548,29331,29110,28887,28660,28430,28198,27962,27724,27483,27239,
+    26992,26742,26490,26236,25979,25719,25457,25193,24927,24658,24387,24114,23839,23561,23282,23001,
+    22718,22434,22147,21859,21570,21278,20986,20692,20396,20099,19801,19502,19202,18900,18598,18294,
+    17990,17685,17379,17072,16765,16457,16148,15839,15530,15220,14910,14600,14289,13979,13668,13357,
+    13046,12736,12425,12115,11805,11496,11186,10877,10569,10261,9954,9648,9342,9037,8732,8429,
+    8127,7825,7525,7225,6927,6630,6334,6039,5746,5454,5163,4874,4586,4300,4016,3733,
+    3452,3172,2894,2618,2344,2072,1802,1533,1267,1003,740,480,222,-34,-287,-539,
+    -788,-1035,-1280,-1522,-1762,-1999,-2234,-2467,-2697,-2924,-3149,-3372,-3591,-3809,-4023,-4235,
+    -4445,-4651,-4855,-5056,-5255,-5451,-5644,-5834,-6021,-6206,-6388,-6567,-6743,-6916,-7087,-7254,
+    -7419,-7581,-7740,-7896,-8049,-8200,-8347,-8492,-8634,-8773,-8909,-9042,-9172,-9300,-9424,-9546,
+    -9665,-9781,-9894,-10004,-10112,-10217,-10319,-10418,-10514,-10608,-10699,-10787,-10872,-10955,-11035,-11113,
+    -11187,-11259,-11329,-11396,-11460,-11522,-11581,-11638,-11692,-11744,-11793,-11840,-11884,-11926,-11966,-12003,
+    -12038,-12071,-12102,-12130,-12156,-12180,-12202,-12222,-12239,-12255,-12269,-12280,-12290,-12297,-12303,-12307,
+    -12309,-12309,-12308,-12304,-12299,-12292,-12284,-12274,-12263,-12249,-12235,-12219,-12201,-12182,-12162,-12140,
+    -12117,-12093,-12067,-12041,-12013,-11984,-11953,-11922,-11890,-11856,-11822,-11787,-11751,-11714,-11676,-11637,
+    -11598,-11558,-11517,-11475,-11433,-11391,-11347,-11303,-11259,-11214,-11169,-11123,-11077,-11031,-10984,-10937,
+    -10890,-10842,-10795,-10747,-10699,-10651,-10603,-10555,-10506,-10458,-10410,-10362,-10314,-10266,-10218,-10171,
+    -10124,-10076,-10030,-9983,-9937,-9891,-9845,-9800,-9755,-9710,-9666,-9622,-9579,-9537,-9494,-9453,
+    -9412,-9371,-9331,-9292,-9253,-9215,-9177,-9140,-9104,-9069,-9034,-9000,-8967,-8934,-8902,-8871,
+    -8841,-8811,-8783,-8755,-8728,-8701,-8676,-8651,-8628,-8605,-8583,-8561,-8541,-8521,-8503,-8485,
+    -8468,-8452,-8437,-8423,-8409,-8397,-8385,-8375,-8365,-8356,-8348,-8341,-8334,-8329,-8324,-8321,
+    -8318,-8316,-8314,-8314,-8315,-8316,-8318,-8321,-8325,-8329,-8335,-8341,-8348,-8355,-8364,-8373,
+    -8383,-8394,-8405,-8417,-8430,-8443,-8457,-8472,-8487,-8503,-8520,-8537,-8554,-8573,-8592,-8611,
+    -8631,-8651,-8672,-8694,-8716,-8738,-8761,-8784,-8807,-8831,-8856,-8880,-8905,-8931,-8956,-8982,
+    -9008,-9035,-9061,-9088,-9115,-9143,-9170,-9198,-9225,-9253,-9281,-9309,-9337,-9365,-9393,-9421,
+    -9449,-9477,-9505,-9533,-9561,-9589,-9617,-9644,-9672,-9699,-9726,-9753,-9780,-9806,-9833,-9859,
+    -9884,-9910,-9935,-9960,-9984,-10009,-10032,-10056,-10079,-10102,-10124,-10146,-10167,-10188,-10209,-10229,
+    -10249,-10268,-10287,-10305,-10322,-10339,-10356,-10372,-10387,-10402,-10417,-10430,-10444,-10456,-10468,-10479,
+    -10490,-10500,-10510,-10519,-10527,-10534,-10541,-10548,-10553,-10558,-10562,-10566,-10569,-10571,-10573,-10574};
+
+const int16_t table_squarewave2_mip8[1024]={
+    -4947,-4947,-4949,-4952,-4956,-4962,-4969,-4976,-4986,-4996,-5007,-5020,-5034,-5049,-5065,-5083,
+    -5101,-5121,-5142,-5165,-5188,-5212,-5238,-5265,-5293,-5322,-5352,-5384,-5416,-5450,-5485,-5521,
+    -5558,-5596,-5635,-5675,-5716,-5758,-5802,-5846,-5891,-5938,-5985,-6034,-6083,-6133,-6185,-6237,
+    -6290,-6344,-6399,-6455,-6512,-6570,-6628,-6688,-6748,-6809,-6871,-6934,-6997,-7062,-7127,-7193,
+    -7259,-7326,-7394,-7463,-7532,-7602,-7673,-7744,-7816,-7888,-7961,-8035,-8109,-8184,-8259,-8335,
+    -8411,-8487,-8564,-8642,-8720,-8798,-8877,-8956,-9035,-9115,-9195,-9275,-9356,-9436,-9517,-9599,
+    -9680,-9762,-9843,-9925,-10007,-10089,-10171,-10254,-10336,-10418,-10500,-10582,-10665,-10747,-10829,-10911,
+    -10993,-11074,-11156,-11237,-11318,-11399,-11480,-11560,-11640,-11720,-11800,-11879,-11958,-12036,-12114,-12192,
+    -12269,-12346,-12422,-12498,-12573,-12648,-12722,-12795,-12868,-12940,-13012,-13083,-13153,-13223,-13292,-13360,
+    -13427,-13494,-13560,-13625,-13689,-13752,-13815,-13876,-13937,-13997,-14055,-14113,-14170,-14226,-14280,-14334,
+    -14387,-14438,-14489,-14538,-14586,-14633,-14679,-14724,-14768,-14810,-14851,-14891,-14929,-14967,-15003,-15037,
+    -15071,-15103,-15133,-15163,-15191,-15217,-15242,-15266,-15288,-15309,-15328,-15345,-15362,-15376,-15390,-15401,
+    -15411,-15420,-15427,-15432,-15436,-15438,-15438,-15437,-15434,-15430,-15423,-15416,-15406,-15395,-15382,-15367,
+    -15351,-15333,-15313,-15291,-15267,-15242,-15215,-15186,-15156,-15123,-15089,-15053,-15015,-14975,-14934,-14890,
+    -14845,-14798,-14749,-14698,-14646,-14591,-14535,-14476,-14416,-14354,-14290,-14224,-14157,-14087,-14016,-13942,
+    -13867,-13790,-13710,-13629,-13547,-13462,-13375,-13287,-13196,-13104,-13009,-12913,-12815,-12715,-12614,-12510,
+    -12404,-12297,-12188,-12077,-11964,-11849,-11732,-11614,-11493,-11371,-11247,-11121,-10994,-10864,-10733,-10600,
+    -10465,-10329,-10191,-10051,-9909,-9765,-9620,-9473,-9324,-9174,-9022,-8868,-8713,-8556,-8397,-8237,
+    -8075,-7912,-7747,-7580,-7412,-7242,-7071,-6898,-6724,-6548,-6371,-6192,-6012,-5830,-5647,-5463,
+    -5277,-5090,-4902,-4712,-4521,-4328,-4134,-3940,-3743,-3546,-3347,-3147,-2946,-2744,-2541,-2337,
+    -2131,-1925,-1717,-1509,-1299,-1088,-877,-664,-451,-236,-21,195,412,630,848,1068,
+    1288,1509,1730,1952,2175,2399,2623,2848,3073,3299,3525,3752,3979,4207,4435,4664,
+    4893,5122,5352,5582,5812,6043,6273,6504,6735,6967,7198,7429,7661,7893,8124,8356,
+    8587,8819,9051,9282,9513,9744,9975,10206,10436,10667,10897,11126,11356,11585,11813,12041,
+    12269,12496,12723,12949,13175,13400,13625,13849,14072,14295,14517,14738,14959,15178,15397,15615,
+    15833,16049,16265,16479,16693,16905,17117,17328,17537,17746,17953,18160,18365,18569,18772,18974,
+    19174,19373,19571,19768,19963,20157,20349,20540,20730,20918,21105,21290,21474,21656,21837,22016,
+    22194,22370,22544,22717,22888,23057,23225,23390,23555,23717,23877,24036,24193,24348,24501,24652,
+    24802,24949,25095,25238,25380,25519,25657,25792,25926,26057,26186,26314,26439,26562,26683,26801,
+    26918,27032,27145,27255,27362,27468,27571,27672,27771,27867,27962,28053,28143,28230,28315,28398,
+    28478,28556,28631,28704,28775,28843,28909,28973,29034,29092,29148,29202,29253,29302,29348,29392,
+    29434,29473,29509,29543,29574,29603,29630,29654,29675,29694,29710,29724,29735,29744,29751,29754,
+    29756,29754,29751,29744,29735,29724,29710,29694,29675,29654,29630,29603,29574,29543,29509,29473,
+    29434,29392,29348,29302,29253,29202,29148,29092,29034,28973,28909,28843,28775,28704,28631,28556,
+    28478,28398,28315,28230,28143,28053,27962,27867,27771,27672,27571,27468,27362,27255,27145,27032,
+    26918,26801,26683,26562,26439,26314,26186,26057,25926,25792,25657,25519,25380,25238,25095,24949,
+    24802,24652,24501,24348,24193,24036,23877,23717,23555,23390,23225,23057,22888,22717,22544,22370,
+    22194,22016,21837,21656,21474,21290,21105,20918,20730,20540,20349,20157,19963,19768,19571,19373,
+    19174,18974,18772,18569,18365,18160,17953,17746,17537,17328,17117,16905,16693,16479,16265,16049,
+    15833,15615,15397,15178,14959,14738,14517,14295,14072,13849,13625,13400,13175,12949,12723,12496,
+    12269,12041,11813,11585,11356,11126,10897,10667,10436,10206,9975,9744,9513,9282,9051,8819,
+    8587,8356,8124,7893,7661,7429,7198,6967,6735,6504,6273,6043,5812,5582,5352,5122,
+    4893,4664,4435,4207,3979,3752,3525,3299,3073,2848,2623,2399,2175,1952,1730,1509,
+    1288,1068,848,630,412,195,-21,-236,-451,-664,-877,-1088,-1299,-1509,-1717,-1925,
+    -2131,-2337,-2541,-2744,-2946,-3147,-3347,-3546,-3743,-3940,-4134,-4328,-4521,-4712,-4902,-5090,
+    -5277,-5463,-5647,-5830,-6012,-6192,-6371,-6548,-6724,-6898,-7071,-7242,-7412,-7580,-7747,-7912,
+    -8075,-8237,-8397,-8556,-8713,-8868,-9022,-9174,-9324,-9473,-9620,-9765,-9909,-10051,-10191,-10329,
+    -10465,-10600,-10733,-10864,-10994,-11121,-11247,-11371,-11493,-11614,-11732,-11849,-11964,-12077,-12188,-12297,
+    -12404,-12510,-12614,-12715,-12815,-12913,-13009,-13104,-13196,-13287,-13375,-13462,-13547,-13629,-13710,-13790,
+    -13867,-13942,-14016,-14087,-14157,-14224,-14290,-14354,-14416,-14476,-14535,-14591,-14646,-14698,-14749,-14798,
+    -14845,-14890,-14934,-14975,-15015,-15053,-15089,-15123,-15156,-15186,-15215,-15242,-15267,-15291,-15313,-15333,
+    -15351,-15367,-15382,-15395,-15406,-15416,-15423,-15430,-15434,-15437,-15438,-15438,-15436,-15432,-15427,-15420,
+    -15411,-15401,-15390,-15376,-15362,-15345,-15328,-15309,-15288,-15266,-15242,-15217,-15191,-15163,-15133,-15103,
+    -15071,-15037,-15003,-14967,-14929,-14891,-14851,-14810,-14768,-14724,-14679,-14633,-14586,-14538,-14489,-14438,
+    -14387,-14334,-14280,-14226,-14170,-14113,-14055,-13997,-13937,-13876,-13815,-13752,-13689,-13625,-13560,-13494,
+    -13427,-13360,-13292,-13223,-13153,-13083,-13012,-12940,-12868,-12795,-12722,-12648,-12573,-12498,-12422,-12346,
+    -12269,-12192,-12114,-12036,-11958,-11879,-11800,-11720,-11640,-11560,-11480,-11399,-11318,-11237,-11156,-11074,
+    -10993,-10911,-10829,-10747,-10665,-10582,-10500,-10418,-10336,-10254,-10171,-10089,-10007,-9925,-9843,-9762,
+    -9680,-9599,-9517,-9436,-9356,-9275,-9195,-9115,-9035,-8956,-8877,-8798,-8720,-8642,-8564,-8487,
+    -8411,-8335,-8259,-8184,-8109,-8035,-7961,-7888,-7816,-7744,-7673,-7602,-7532,-7463,-7394,-7326,
+    -7259,-7193,-7127,-7062,-6997,-6934,-6871,-6809,-6748,-6688,-6628,-6570,-6512,-6455,-6399,-6344,
+    -6290,-6237,-6185,-6133,-6083,-6034,-5985,-5938,-5891,-5846,-5802,-5758,-5716,-5675,-5635,-5596,
+    -5558,-5521,-5485,-5450,-5416,-5384,-5352,-5322,-5293,-5265,-5238,-5212,-5188,-5165,-5142,-5121,
+    -5101,-5083,-5065,-5049,-5034,-5020,-5007,-4996,-4986,-4976,-4969,-4962,-4956,-4952,-4949,-4947};
+
+const int16_t table_squarewave2_mip9[1024]={
+    -17351,-17351,-17350,-17348,-17346,-17343,-17339,-17335,-17330,-17325,-17318,-17312,-17304,-17296,-17287,-17278,
+    -17268,-17257,-17245,-17233,-17221,-17207,-17193,-17179,-17163,-17147,-17131,-17114,-17096,-17077,-17058,-17038,
+    -17018,-16997,-16975,-16953,-16930,-16906,-16882,-16857,-16831,-16805,-16778,-16751,-16723,-16694,-16665,-16635,
+    -16604,-16573,-16541,-16508,-16475,-16442,-16407,-16372,-16337,-16301,-16264,-16226,-16188,-16150,-16111,-16071,
+    -16030,-15989,-15948,-15905,-15863,-15819,-15775,-15730,-15685,-15639,-15593,-15546,-15498,-15450,-15402,-15352,
+    -15302,-15252,-15201,-15149,-15097,-15044,-14991,-14937,-14883,-14828,-14772,-14716,-14659,-14602,-14544,-14486,
+    -14427,-14368,-14308,-14247,-14186,-14124,-14062,-14000,-13937,-13873,-13809,-13744,-13679,-13613,-13547,-13480,
+    -13413,-13345,-13277,-13208,-13138,-13069,-12998,-12928,-12856,-12785,-12712,-12640,-12567,-12493,-12419,-12344,
+    -12269,-12194,-12118,-12041,-11964,-11887,-11809,-11731,-11652,-11573,-11494,-11414,-11333,-11252,-11171,-11090,
+    -11007,-10925,-10842,-10759,-10675,-10591,-10506,-10421,-10336,-10250,-10164,-10078,-9991,-9904,-9816,-9728,
+    -9640,-9551,-9462,-9373,-9283,-9193,-9102,-9011,-8920,-8829,-8737,-8645,-8552,-8460,-8366,-8273,
+    -8179,-8085,-7991,-7896,-7801,-7706,-7610,-7515,-7419,-7322,-7226,-7129,-7031,-6934,-6836,-6738,
+    -6640,-6541,-6443,-6344,-6245,-6145,-6045,-5946,-5845,-5745,-5644,-5544,-5443,-5342,-5240,-5139,
+    -5037,-4935,-4833,-4730,-4628,-4525,-4422,-4319,-4216,-4113,-4009,-3905,-3802,-3698,-3594,-3489,
+    -3385,-3281,-3176,-3071,-2966,-2861,-2756,-2651,-2546,-2441,-2335,-2230,-2124,-2018,-1912,-1807,
+    -1701,-1595,-1489,-1383,-1276,-1170,-1064,-958,-851,-745,-639,-532,-426,-319,-213,-106,
+    0,106,213,319,426,532,639,745,851,958,1064,1170,1276,1383,1489,1595,
+    1701,1807,1912,2018,2124,2230,2335,2441,2546,2651,2756,2861,2966,3071,3176,3281,
+    3385,3489,3594,3698,3802,3905,4009,4113,4216,4319,4422,4525,4628,4730,4833,4935,
+    5037,5139,5240,5342,5443,5544,5645,5745,5845,5946,6045,6145,6245,6344,6443,6542,
+    6640,6738,6836,6934,7031,7129,7226,7322,7419,7515,7611,7706,7801,7896,7991,8085,
+    8179,8273,8366,8460,8552,8645,8737,8829,8920,9011,9102,9193,9283,9373,9462,9551,
+    9640,9728,9816,9904,9991,10078,10164,10250,10336,10421,10506,10591,10675,10759,10842,10925,
+    11007,11090,11171,11252,11333,11414,11494,11573,11652,11731,11809,11887,11964,12041,12118,12194,
+    12269,12344,12419,12493,12567,12640,12712,12785,12856,12928,12998,13069,13138,13208,13277,13345,
+    13413,13480,13547,13613,13679,13744,13809,13873,13937,14000,14062,14124,14186,14247,14308,14368,
+    14427,14486,14544,14602,14659,14716,14772,14828,14883,14937,14991,15044,15097,15149,15201,15252,
+    15302,15352,15402,15450,15498,15546,15593,15639,15685,15730,15775,15819,15863,15905,15948,15989,
+    16030,16071,16111,16150,16189,16227,16264,16301,16337,16372,16407,16442,16475,16509,16541,16573,
+    16604,16635,16665,16694,16723,16751,16778,16805,16831,16857,16882,16906,16930,16953,16975,16997,
+    17018,17038,17058,17077,17096,17114,17131,17147,17163,17179,17193,17207,17221,17233,17245,17257,
+    17268,17278,17287,17296,17304,17312,17319,17325,17330,17335,17339,17343,17346,17348,17350,17351,
+    17351,17351,17350,17348,17346,17343,17339,17335,17330,17325,17319,17312,17304,17296,17287,17278,
+    17268,17257,17245,17233,17221,17207,17193,17179,17163,17147,17131,17114,17096,17077,17058,17038,
+    17018,16997,16975,16953,16930,16906,16882,16857,16831,16805,16778,16751,16723,16694,16665,16635,
+    16604,16573,16541,16509,16475,16442,16407,16372,16337,16301,16264,16227,16189,16150,16111,16071,
+    16030,15989,15948,15905,15863,15819,15775,15730,15685,15639,15593,15546,15498,15450,15402,15352,
+    15302,15252,15201,15149,15097,15044,14991,14937,14883,14828,14772,14716,14659,14602,14544,14486,
+    14427,14368,14308,14247,14186,14124,14062,14000,13937,13873,13809,13744,13679,13613,13547,13480,
+    13413,13345,13277,13208,13138,13069,12998,12928,12856,12785,12712,12640,12567,12493,12419,12344,
+    12269,12194,12118,12041,11964,11887,11809,11731,11652,11573,11494,11414,11333,11252,11171,11090,
+    11007,10925,10842,10759,10675,10591,10506,10421,10336,10250,10164,10078,9991,9904,9816,9728,
+    9640,9551,9462,9373,9283,9193,9102,9011,8920,8829,8737,8645,8552,8460,8366,8273,
+    8179,8085,7991,7896,7801,7706,7611,7515,7419,7322,7226,7129,7031,6934,6836,6738,
+    6640,6542,6443,6344,6245,6145,6045,5946,5845,5745,5645,5544,5443,5342,5240,5139,
+    5037,4935,4833,4730,4628,4525,4422,4319,4216,4113,4009,3905,3802,3698,3594,3489,
+    3385,3281,3176,3071,2966,2861,2756,2651,2546,2441,2335,2230,2124,2018,1912,1807,
+    1701,1595,1489,1383,1276,1170,1064,958,851,745,639,532,426,319,213,106,
+    0,-106,-213,-319,-426,-532,-639,-745,-851,-958,-1064,-1170,-1276,-1383,-1489,-1595,
+    -1701,-1807,-1912,-2018,-2124,-2230,-2335,-2441,-2546,-2651,-2756,-2861,-2966,-3071,-3176,-3281,
+    -3385,-3489,-3594,-3698,-3802,-3905,-4009,-4113,-4216,-4319,-4422,-4525,-4628,-4730,-4833,-4935,
+    -5037,-5139,-5240,-5342,-5443,-5544,-5644,-5745,-5845,-5946,-6045,-6145,-6245,-6344,-6443,-6541,
+    -6640,-6738,-6836,-6934,-7031,-7129,-7226,-7322,-7419,-7515,-7610,-7706,-7801,-7896,-7991,-8085,
+    -8179,-8273,-8366,-8460,-8552,-8645,-8737,-8829,-8920,-9011,-9102,-9193,-9283,-9373,-9462,-9551,
+    -9640,-9728,-9816,-9904,-9991,-10078,-10164,-10250,-10336,-10421,-10506,-10591,-10675,-10759,-10842,-10925,
+    -11007,-11090,-11171,-11252,-11333,-11414,-11494,-11573,-11652,-11731,-11809,-11887,-11964,-12041,-12118,-12194,
+    -12269,-12344,-12419,-12493,-12567,-12640,-12712,-12785,-12856,-12928,-12998,-13069,-13138,-13208,-13277,-13345,
+    -13413,-13480,-13547,-13613,-13679,-13744,-13809,-13873,-13937,-14000,-14062,-14124,-14186,-14247,-14308,-14368,
+    -14427,-14486,-14544,-14602,-14659,-14716,-14772,-14828,-14883,-14937,-14991,-15044,-15097,-15149,-15201,-15252,
+    -15302,-15352,-15402,-15450,-15498,-15546,-15593,-15639,-15685,-15730,-15775,-15819,-15863,-15905,-15948,-15989,
+    -16030,-16071,-16111,-16150,-16188,-16226,-16264,-16301,-16337,-16372,-16407,-16442,-16475,-16508,-16541,-16573,
+    -16604,-16635,-16665,-16694,-16723,-16751,-16778,-16805,-16831,-16857,-16882,-16906,-16930,-16953,-16975,-16997,
+    -17018,-17038,-17058,-17077,-17096,-17114,-17131,-17147,-17163,-17179,-17193,-17207,-17221,-17233,-17245,-17257,
+    -17268,-17278,-17287,-17296,-17304,-17312,-17318,-17325,-17330,-17335,-17339,-17343,-17346,-17348,-17350,-17351};
+
+const int16_t table_squarewave3_mip4[1024]={
+    -4051,-4049,-4046,-4041,-4033,-4024,-4013,-4001,-3989,-3976,-3963,-3950,-3938,-3928,-3919,-3912,
+    -3907,-3905,-3905,-3908,-3915,-3924,-3936,-3951,-3969,-3989,-4011,-4036,-4061,-4089,-4116,-4145,
+    -4173,-4201,-4228,-4254,-4279,-4302,-4322,-4341,-4357,-4370,-4380,-4388,-4392,-4394,-4393,-4389,
+    -4382,-4373,-4362,-4348,-4332,-4315,-4296,-4275,-4254,-4231,-4208,-4184,-4160,-4135,-4111,-4087,
+    -4064,-4041,-4019,-3999,-3979,-3962,-3945,-3931,-3918,-3908,-3900,-3894,-3890,-3889,-3891,-3895,
+    -3902,-3912,-3924,-3938,-3955,-3973,-3994,-4017,-4041,-4066,-4093,-4120,-4147,-4175,-4202,-4229,
+    -4255,-4279,-4302,-4324,-4343,-4360,-4375,-4386,-4396,-4402,-4406,-4406,-4404,-4399,-4391,-4380,
+    -4367,-4351,-4333,-4314,-4292,-4269,-4244,-4219,-4193,-4166,-4139,-4112,-4085,-4059,-4033,-4009,
+    -3985,-3964,-3944,-3926,-3910,-3896,-3885,-3876,-3870,-3866,-3866,-3868,-3873,-3880,-3891,-3904,
+    -3920,-3938,-3958,-3981,-4005,-4031,-4059,-4087,-4116,-4146,-4176,-4205,-4235,-4263,-4290,-4315,
+    -4339,-4361,-4381,-4398,-4412,-4423,-4431,-4436,-4438,-4437,-4433,-4425,-4414,-4400,-4384,-4364,
+    -4343,-4319,-4293,-4266,-4237,-4207,-4176,-4145,-4113,-4082,-4052,-4022,-3993,-3965,-3940,-3916,
+    -3894,-3875,-3859,-3845,-3834,-3826,-3821,-3820,-3822,-3827,-3835,-3847,-3862,-3879,-3900,-3923,
+    -3949,-3977,-4007,-4039,-4072,-4106,-4140,-4175,-4210,-4245,-4278,-4311,-4342,-4371,-4397,-4422,
+    -4443,-4461,-4476,-4488,-4496,-4500,-4500,-4497,-4489,-4478,-4463,-4444,-4423,-4398,-4370,-4339,
+    -4306,-4272,-4235,-4197,-4159,-4120,-4081,-4042,-4004,-3967,-3932,-3898,-3867,-3838,-3813,-3790,
+    -3771,-3755,-3743,-3735,-3732,-3732,-3737,-3746,-3759,-3776,-3797,-3821,-3850,-3882,-3916,-3954,
+    -3994,-4036,-4079,-4124,-4169,-4215,-4260,-4305,-4349,-4391,-4430,-4468,-4502,-4533,-4560,-4583,
+    -4601,-4615,-4624,-4628,-4627,-4621,-4610,-4593,-4571,-4545,-4514,-4479,-4439,-4396,-4350,-4301,
+    -4249,-4196,-4141,-4086,-4030,-3975,-3921,-3868,-3818,-3770,-3725,-3684,-3647,-3615,-3587,-3565,
+    -3548,-3537,-3532,-3534,-3542,-3556,-3576,-3603,-3635,-3674,-3718,-3767,-3821,-3879,-3941,-4006,
+    -4074,-4145,-4216,-4288,-4360,-4431,-4501,-4568,-4633,-4693,-4749,-4800,-4845,-4883,-4915,-4939,
+    -4955,-4963,-4962,-4953,-4935,-4908,-4872,-4828,-4775,-4714,-4646,-4571,-4489,-4401,-4308,-4212,
+    -4111,-4009,-3904,-3800,-3696,-3594,-3494,-3399,-3308,-3223,-3146,-3076,-3016,-2966,-2926,-2898,
+    -2882,-2879,-2889,-2914,-2952,-3004,-3070,-3150,-3244,-3352,-3472,-3604,-3748,-3902,-4066,-4237,
+    -4415,-4598,-4785,-4974,-5162,-5349,-5531,-5707,-5875,-6033,-6177,-6307,-6420,-6512,-6584,-6631,
+    -6652,-6645,-6608,-6539,-6436,-6298,-6123,-5910,-5657,-5365,-5031,-4655,-4237,-3777,-3275,-2730,
+    -2143,-1515,-847,-140,605,1387,2204,3054,3934,4843,5779,6738,7719,8717,9731,10757,
+    11792,12833,13877,14919,15958,16989,18010,19017,20007,20976,21922,22842,23733,24591,25416,26204,
+    26954,27662,28329,28951,29528,30058,30541,30977,31364,31703,31994,32237,32433,32582,32687,32747,
+    32765,32743,32682,32584,32451,32287,32093,31873,31628,31363,31079,30781,30470,30150,29824,29495,
+    29166,28840,28520,28208,27908,27622,27352,27100,26870,26661,26477,26319,26187,26084,26009,25965,
+    25950,25965,26009,26084,26187,26319,26477,26661,26870,27100,27352,27622,27908,28208,28520,28840,
+    29166,29495,29824,30150,30470,30781,31079,31363,31628,31873,32093,32287,32451,32584,32682,32743,
+    32765,32747,32687,32582,32433,32237,31994,31703,31364,30977,30541,30058,29528,28951,28329,27662,
+    26954,26204,25416,24591,23733,22842,21922,20976,20007,19017,18010,16989,15958,14919,13877,12833,
+    11792,10757,9731,8717,7719,6738,5779,4843,3934,3054,2204,1387,605,-140,-847,-1515,
+    -2143,-2730,-3275,-3777,-4237,-4655,-5031,-5365,-5657,-5910,-6123,-6298,-6436,-6539,-6608,-6645,
+    -6652,-6631,-6584,-6512,-6420,-6307,-6177,-6033,-5875,-5707,-5531,-5349,-5162,-4974,-4785,-4598,
+    -4415,-4237,-4066,-3902,-3748,-3604,-3472,-3352,-3244,-3150,-3070,-3004,-2952,-2914,-2889,-2879,
+    -2882,-2898,-2926,-2966,-3016,-3076,-3146,-3223,-3308,-3399,-3494,-3594,-3696,-3800,-3904,-4009,
+    -4111,-4212,-4308,-4401,-4489,-4571,-4646,-4714,-4775,-4828,-4872,-4908,-4935,-4953,-4962,-4963,
+    -4955,-4939,-4915,-4883,-4845,-4800,-4749,-4693,-4633,-4568,-4501,-4431,-4360,-4288,-4216,-4145,
+    -4074,-4006,-3941,-3879,-3821,-3767,-3718,-3674,-3635,-3603,-3576,-3556,-3542,-3534,-3532,-3537,
+    -3548,-3565,-3587,-3615,-3647,-3684,-3725,-3770,-3818,-3868,-3921,-3975,-4030,-4086,-4141,-4196,
+    -4249,-4301,-4350,-4396,-4439,-4479,-4514,-4545,-4571,-4593,-4610,-4621,-4627,-4628,-4624,-4615,
+    -4601,-4583,-4560,-4533,-4502,-4468,-4430,-4391,-4349,-4305,-4260,-4215,-4169,-4124,-4079,-4036,
+    -3994,-3954,-3916,-3882,-3850,-3821,-3797,-3776,-3759,-3746,-3737,-3732,-3732,-3735,-3743,-3755,
+    -3771,-3790,-3813,-3838,-3867,-3898,-3932,-3967,-4004,-4042,-4081,-4120,-4159,-4197,-4235,-4272,
+    -4306,-4339,-4370,-4398,-4423,-4444,-4463,-4478,-4489,-4497,-4500,-4500,-4496,-4488,-4476,-4461,
+    -4443,-4422,-4397,-4371,-4342,-4311,-4278,-4245,-4210,-4175,-4140,-4106,-4072,-4039,-4007,-3977,
+    -3949,-3923,-3900,-3879,-3862,-3847,-3835,-3827,-3822,-3820,-3821,-3826,-3834,-3845,-3859,-3875,
+    -3894,-3916,-3940,-3965,-3993,-4022,-4052,-4082,-4113,-4145,-4176,-4207,-4237,-4266,-4293,-4319,
+    -4343,-4364,-4384,-4400,-4414,-4425,-4433,-4437,-4438,-4436,-4431,-4423,-4412,-4398,-4381,-4361,
+    -4339,-4315,-4290,-4263,-4235,-4205,-4176,-4146,-4116,-4087,-4059,-4031,-4005,-3981,-3958,-3938,
+    -3920,-3904,-3891,-3880,-3873,-3868,-3866,-3866,-3870,-3876,-3885,-3896,-3910,-3926,-3944,-3964,
+    -3985,-4009,-4033,-4059,-4085,-4112,-4139,-4166,-4193,-4219,-4244,-4269,-4292,-4314,-4333,-4351,
+    -4367,-4380,-4391,-4399,-4404,-4406,-4406,-4402,-4396,-4386,-4375,-4360,-4343,-4324,-4302,-4279,
+    -4255,-4229,-4202,-4175,-4147,-4120,-4093,-4066,-4041,-4017,-3994,-3973,-3955,-3938,-3924,-3912,
+    -3902,-3895,-3891,-3889,-3890,-3894,-3900,-3908,-3918,-3931,-3945,-3962,-3979,-3999,-4019,-4041,
+    -4064,-4087,-4111,-4135,-4160,-4184,-4208,-4231,-4254,-4275,-4296,-4315,-4332,-4348,-4362,-4373,
+    -4382,-4389,-4393,-4394,-4392,-4388,-4380,-4370,-4357,-4341,-4322,-4302,-4279,-4254,-4228,-4201,
+    -4173,-4145,-4116,-4089,-4061,-4036,-4011,-3989,-3969,-3951,-3936,-3924,-3915,-3908,-3905,-3905,
+    -3907,-3912,-3919,-3928,-3938,-3950,-3963,-3976,-3989,-4001,-4013,-4024,-4033,-4041,-4046,-4049};
+
+const int16_t table_squarewave3_mip5[1024]={
+    -3687,-3688,-3693,-3701,-3711,-3725,-3741,-3760,-3781,-3805,-3831,-3858,-3888,-3918,-3950,-3983,
+    -4016,-4050,-4083,-4117,-4149,-4181,-4213,-4242,-4271,-4297,-4322,-4344,-4364,-4382,-4397,-4409,
+    -4418,-4425,-4429,-4430,-4428,-4424,-4416,-4407,-4394,-4380,-4363,-4344,-4323,-4301,-4277,-4253,
+    -4227,-4201,-4174,-4147,-4121,-4094,-4069,-4044,-4021,-3998,-3978,-3959,-3941,-3926,-3914,-3903,
+    -3895,-3889,-3886,-3885,-3887,-3891,-3897,-3906,-3918,-3931,-3946,-3963,-3982,-4002,-4024,-4047,
+    -4070,-4094,-4118,-4143,-4167,-4191,-4214,-4237,-4259,-4279,-4298,-4315,-4331,-4344,-4356,-4365,
+    -4372,-4377,-4379,-4379,-4377,-4373,-4366,-4356,-4345,-4332,-4317,-4300,-4281,-4261,-4240,-4218,
+    -4196,-4172,-4149,-4125,-4101,-4078,-4056,-4034,-4013,-3994,-3976,-3959,-3945,-3932,-3922,-3913,
+    -3907,-3903,-3901,-3902,-3905,-3911,-3918,-3928,-3940,-3954,-3970,-3987,-4006,-4027,-4048,-4071,
+    -4094,-4117,-4141,-4165,-4189,-4212,-4235,-4256,-4277,-4296,-4314,-4330,-4344,-4357,-4367,-4375,
+    -4380,-4383,-4384,-4382,-4378,-4372,-4363,-4352,-4339,-4324,-4307,-4288,-4268,-4246,-4224,-4200,
+    -4175,-4151,-4126,-4101,-4076,-4052,-4028,-4006,-3985,-3965,-3947,-3930,-3916,-3904,-3894,-3887,
+    -3882,-3879,-3879,-3882,-3887,-3895,-3905,-3917,-3932,-3949,-3968,-3989,-4011,-4035,-4060,-4086,
+    -4112,-4139,-4167,-4194,-4220,-4246,-4272,-4296,-4318,-4339,-4359,-4376,-4391,-4403,-4413,-4421,
+    -4425,-4427,-4426,-4422,-4415,-4406,-4394,-4379,-4362,-4342,-4320,-4296,-4271,-4244,-4215,-4186,
+    -4156,-4126,-4095,-4064,-4034,-4005,-3977,-3950,-3925,-3902,-3881,-3862,-3846,-3832,-3821,-3814,
+    -3810,-3808,-3811,-3816,-3825,-3837,-3852,-3870,-3891,-3914,-3940,-3969,-3999,-4031,-4065,-4099,
+    -4135,-4171,-4207,-4243,-4278,-4313,-4346,-4377,-4406,-4434,-4458,-4480,-4499,-4514,-4526,-4534,
+    -4538,-4538,-4535,-4527,-4516,-4500,-4481,-4458,-4432,-4402,-4369,-4333,-4295,-4255,-4213,-4170,
+    -4125,-4081,-4036,-3991,-3947,-3904,-3863,-3824,-3787,-3753,-3723,-3696,-3673,-3655,-3641,-3631,
+    -3627,-3627,-3633,-3644,-3660,-3681,-3707,-3738,-3774,-3814,-3858,-3906,-3957,-4011,-4067,-4125,
+    -4185,-4246,-4306,-4367,-4426,-4484,-4540,-4593,-4642,-4688,-4729,-4766,-4796,-4821,-4840,-4852,
+    -4857,-4855,-4846,-4829,-4805,-4773,-4735,-4689,-4636,-4577,-4511,-4440,-4364,-4284,-4199,-4112,
+    -4022,-3930,-3838,-3746,-3655,-3567,-3481,-3399,-3322,-3251,-3187,-3131,-3082,-3044,-3015,-2996,
+    -2989,-2994,-3011,-3040,-3082,-3137,-3204,-3284,-3377,-3481,-3597,-3724,-3861,-4007,-4161,-4322,
+    -4489,-4660,-4834,-5009,-5184,-5356,-5525,-5687,-5841,-5985,-6116,-6234,-6335,-6417,-6479,-6517,
+    -6531,-6519,-6477,-6405,-6301,-6163,-5989,-5779,-5531,-5244,-4917,-4549,-4141,-3691,-3200,-2667,
+    -2093,-1478,-823,-129,603,1371,2174,3011,3879,4777,5701,6650,7621,8611,9618,10638,
+    11668,12705,13746,14788,15827,16860,17884,18895,19891,20867,21821,22750,23651,24521,25357,26158,
+    26920,27642,28322,28958,29549,30093,30589,31037,31437,31787,32088,32341,32545,32701,32767,32767,
+    32767,32767,32767,32716,32581,32412,32213,31985,31733,31458,31164,30854,30531,30198,29860,29517,
+    29175,28835,28502,28177,27864,27565,27284,27021,26780,26563,26370,26205,26068,25960,25882,25835,
+    25819,25835,25882,25960,26068,26205,26370,26563,26780,27021,27284,27565,27864,28177,28502,28835,
+    29175,29517,29860,30198,30531,30854,31164,31458,31733,31985,32213,32412,32581,32716,32767,32767,
+    32767,32767,32767,32701,32545,32341,32088,31787,31437,31037,30589,30093,29549,28958,28322,27642,
+    26920,26158,25357,24521,23651,22750,21821,20867,19891,18895,17884,16860,15827,14788,13746,12705,
+    11668,10638,9618,8611,7621,6650,5701,4777,3879,3011,2174,1371,603,-129,-823,-1478,
+    -2093,-2667,-3200,-3691,-4141,-4549,-4917,-5244,-5531,-5779,-5989,-6163,-6301,-6405,-6477,-6519,
+    -6531,-6517,-6479,-6417,-6335,-6234,-6116,-5985,-5841,-5687,-5525,-5356,-5184,-5009,-4834,-4660,
+    -4489,-4322,-4161,-4007,-3861,-3724,-3597,-3481,-3377,-3284,-3204,-3137,-3082,-3040,-3011,-2994,
+    -2989,-2996,-3015,-3044,-3082,-3131,-3187,-3251,-3322,-3399,-3481,-3567,-3655,-3746,-3838,-3930,
+    -4022,-4112,-4199,-4284,-4364,-4440,-4511,-4577,-4636,-4689,-4735,-4773,-4805,-4829,-4846,-4855,
+    -4857,-4852,-4840,-4821,-4796,-4766,-4729,-4688,-4642,-4593,-4540,-4484,-4426,-4367,-4306,-4246,
+    -4185,-4125,-4067,-4011,-3957,-3906,-3858,-3814,-3774,-3738,-3707,-3681,-3660,-3644,-3633,-3627,
+    -3627,-3631,-3641,-3655,-3673,-3696,-3723,-3753,-3787,-3824,-3863,-3904,-3947,-3991,-4036,-4081,
+    -4125,-4170,-4213,-4255,-4295,-4333,-4369,-4402,-4432,-4458,-4481,-4500,-4516,-4527,-4535,-4538,
+    -4538,-4534,-4526,-4514,-4499,-4480,-4458,-4434,-4406,-4377,-4346,-4313,-4278,-4243,-4207,-4171,
+    -4135,-4099,-4065,-4031,-3999,-3969,-3940,-3914,-3891,-3870,-3852,-3837,-3825,-3816,-3811,-3808,
+    -3810,-3814,-3821,-3832,-3846,-3862,-3881,-3902,-3925,-3950,-3977,-4005,-4034,-4064,-4095,-4126,
+    -4156,-4186,-4215,-4244,-4271,-4296,-4320,-4342,-4362,-4379,-4394,-4406,-4415,-4422,-4426,-4427,
+    -4425,-4421,-4413,-4403,-4391,-4376,-4359,-4339,-4318,-4296,-4272,-4246,-4220,-4194,-4167,-4139,
+    -4112,-4086,-4060,-4035,-4011,-3989,-3968,-3949,-3932,-3917,-3905,-3895,-3887,-3882,-3879,-3879,
+    -3882,-3887,-3894,-3904,-3916,-3930,-3947,-3965,-3985,-4006,-4028,-4052,-4076,-4101,-4126,-4151,
+    -4175,-4200,-4224,-4246,-4268,-4288,-4307,-4324,-4339,-4352,-4363,-4372,-4378,-4382,-4384,-4383,
+    -4380,-4375,-4367,-4357,-4344,-4330,-4314,-4296,-4277,-4256,-4235,-4212,-4189,-4165,-4141,-4117,
+    -4094,-4071,-4048,-4027,-4006,-3987,-3970,-3954,-3940,-3928,-3918,-3911,-3905,-3902,-3901,-3903,
+    -3907,-3913,-3922,-3932,-3945,-3959,-3976,-3994,-4013,-4034,-4056,-4078,-4101,-4125,-4149,-4172,
+    -4196,-4218,-4240,-4261,-4281,-4300,-4317,-4332,-4345,-4356,-4366,-4373,-4377,-4379,-4379,-4377,
+    -4372,-4365,-4356,-4344,-4331,-4315,-4298,-4279,-4259,-4237,-4214,-4191,-4167,-4143,-4118,-4094,
+    -4070,-4047,-4024,-4002,-3982,-3963,-3946,-3931,-3918,-3906,-3897,-3891,-3887,-3885,-3886,-3889,
+    -3895,-3903,-3914,-3926,-3941,-3959,-3978,-3998,-4021,-4044,-4069,-4094,-4121,-4147,-4174,-4201,
+    -4227,-4253,-4277,-4301,-4323,-4344,-4363,-4380,-4394,-4407,-4416,-4424,-4428,-4430,-4429,-4425,
+    -4418,-4409,-4397,-4382,-4364,-4344,-4322,-4297,-4271,-4242,-4213,-4181,-4149,-4117,-4083,-4050,
+    -4016,-3983,-3950,-3918,-3888,-3858,-3831,-3805,-3781,-3760,-3741,-3725,-3711,-3701,-3693,-3688};
+
+const int16_t table_squarewave3_mip6[1024]={
+    -4312,-4312,-4311,-4310,-4308,-4306,-4303,-4299,-4295,-4291,-4286,-4280,-4274,-4268,-4261,-4254,
+    -4246,-4238,-4230,-4221,-4212,-4202,-4193,-4183,-4173,-4162,-4152,-4141,-4131,-4120,-4109,-4098,
+    -4087,-4076,-4065,-4054,-4043,-4033,-4022,-4012,-4002,-3992,-3982,-3973,-3964,-3955,-3947,-3939,
+    -3932,-3925,-3918,-3912,-3906,-3901,-3896,-3892,-3888,-3885,-3882,-3880,-3879,-3878,-3878,-3878,
+    -3879,-3881,-3883,-3886,-3889,-3893,-3898,-3903,-3908,-3914,-3921,-3929,-3936,-3945,-3953,-3963,
+    -3972,-3983,-3993,-4004,-4015,-4027,-4039,-4051,-4063,-4076,-4089,-4102,-4115,-4129,-4142,-4156,
+    -4169,-4183,-4196,-4209,-4223,-4236,-4249,-4261,-4274,-4286,-4298,-4310,-4321,-4332,-4343,-4353,
+    -4362,-4371,-4380,-4388,-4396,-4403,-4409,-4415,-4420,-4425,-4428,-4432,-4434,-4436,-4437,-4437,
+    -4437,-4436,-4434,-4432,-4429,-4425,-4420,-4415,-4409,-4402,-4395,-4387,-4378,-4369,-4359,-4349,
+    -4338,-4326,-4314,-4301,-4288,-4275,-4261,-4246,-4232,-4217,-4201,-4186,-4170,-4154,-4138,-4122,
+    -4105,-4089,-4073,-4057,-4040,-4024,-4009,-3993,-3977,-3962,-3947,-3933,-3919,-3905,-3892,-3879,
+    -3867,-3855,-3844,-3834,-3824,-3815,-3807,-3799,-3792,-3786,-3781,-3777,-3773,-3770,-3769,-3768,
+    -3768,-3769,-3770,-3773,-3777,-3781,-3787,-3793,-3800,-3809,-3818,-3828,-3838,-3850,-3862,-3876,
+    -3890,-3905,-3920,-3936,-3953,-3971,-3989,-4007,-4026,-4046,-4066,-4086,-4107,-4128,-4150,-4171,
+    -4193,-4215,-4236,-4258,-4280,-4302,-4323,-4344,-4365,-4386,-4406,-4426,-4446,-4465,-4483,-4501,
+    -4518,-4534,-4549,-4564,-4578,-4591,-4603,-4613,-4623,-4632,-4640,-4646,-4652,-4656,-4659,-4660,
+    -4660,-4660,-4657,-4654,-4649,-4643,-4635,-4626,-4616,-4604,-4591,-4577,-4562,-4545,-4527,-4507,
+    -4487,-4465,-4442,-4418,-4393,-4367,-4340,-4312,-4284,-4254,-4224,-4193,-4161,-4129,-4096,-4063,
+    -4030,-3996,-3962,-3928,-3894,-3860,-3826,-3793,-3759,-3726,-3694,-3662,-3631,-3600,-3571,-3542,
+    -3514,-3488,-3462,-3438,-3415,-3394,-3374,-3355,-3339,-3324,-3311,-3300,-3290,-3283,-3278,-3275,
+    -3274,-3275,-3279,-3285,-3293,-3303,-3316,-3332,-3350,-3370,-3393,-3418,-3446,-3476,-3509,-3544,
+    -3581,-3621,-3663,-3707,-3753,-3802,-3852,-3905,-3960,-4016,-4074,-4134,-4195,-4258,-4322,-4387,
+    -4454,-4521,-4589,-4658,-4727,-4796,-4866,-4935,-5005,-5074,-5142,-5210,-5277,-5342,-5407,-5469,
+    -5530,-5590,-5646,-5701,-5753,-5802,-5848,-5890,-5929,-5965,-5996,-6023,-6046,-6064,-6077,-6085,
+    -6088,-6085,-6076,-6061,-6040,-6013,-5978,-5937,-5889,-5834,-5771,-5701,-5622,-5536,-5441,-5338,
+    -5227,-5107,-4978,-4840,-4693,-4537,-4372,-4197,-4013,-3819,-3616,-3403,-3180,-2947,-2704,-2452,
+    -2190,-1917,-1635,-1344,-1042,-731,-410,-79,261,611,970,1338,1716,2102,2497,2901,
+    3313,3733,4162,4598,5042,5494,5953,6418,6890,7369,7854,8344,8840,9342,9848,10358,
+    10873,11392,11914,12439,12967,13497,14030,14564,15099,15635,16171,16708,17244,17779,18313,18845,
+    19375,19903,20428,20949,21467,21980,22489,22992,23490,23982,24468,24947,25419,25884,26340,26788,
+    27227,27658,28078,28489,28889,29279,29658,30026,30382,30726,31058,31377,31684,31977,32257,32523,
+    32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,
+    32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,
+    32767,32523,32257,31977,31684,31377,31058,30726,30382,30026,29658,29279,28889,28489,28078,27658,
+    27227,26788,26340,25884,25419,24947,24468,23982,23490,22992,22489,21980,21467,20949,20428,19903,
+    19375,18845,18313,17779,17244,16708,16171,15635,15099,14564,14030,13497,12967,12439,11914,11392,
+    10873,10358,9848,9342,8840,8344,7854,7369,6890,6418,5953,5494,5042,4598,4162,3733,
+    3313,2901,2497,2102,1716,1338,970,611,261,-79,-410,-731,-1042,-1344,-1635,-1917,
+    -2190,-2452,-2704,-2947,-3180,-3403,-3616,-3819,-4013,-4197,-4372,-4537,-4693,-4840,-4978,-5107,
+    -5227,-5338,-5441,-5536,-5622,-5701,-5771,-5834,-5889,-5937,-5978,-6013,-6040,-6061,-6076,-6085,
+    -6088,-6085,-6077,-6064,-6046,-6023,-5996,-5965,-5929,-5890,-5848,-5802,-5753,-5701,-5646,-5590,
+    -5530,-5469,-5407,-5342,-5277,-5210,-5142,-5074,-5005,-4935,-4866,-4796,-4727,-4658,-4589,-4521,
+    -4454,-4387,-4322,-4258,-4195,-4134,-4074,-4016,-3960,-3905,-3852,-3802,-3753,-3707,-3663,-3621,
+    -3581,-3544,-3509,-3476,-3446,-3418,-3393,-3370,-3350,-3332,-3316,-3303,-3293,-3285,-3279,-3275,
+    -3274,-3275,-3278,-3283,-3290,-3300,-3311,-3324,-3339,-3355,-3374,-3394,-3415,-3438,-3462,-3488,
+    -3514,-3542,-3571,-3600,-3631,-3662,-3694,-3726,-3759,-3793,-3826,-3860,-3894,-3928,-3962,-3996,
+    -4030,-4063,-4096,-4129,-4161,-4193,-4224,-4254,-4284,-4312,-4340,-4367,-4393,-4418,-4442,-4465,
+    -4487,-4507,-4527,-4545,-4562,-4577,-4591,-4604,-4616,-4626,-4635,-4643,-4649,-4654,-4657,-4660,
+    -4660,-4660,-4659,-4656,-4652,-4646,-4640,-4632,-4623,-4613,-4603,-4591,-4578,-4564,-4549,-4534,
+    -4518,-4501,-4483,-4465,-4446,-4426,-4406,-4386,-4365,-4344,-4323,-4302,-4280,-4258,-4236,-4215,
+    -4193,-4171,-4150,-4128,-4107,-4086,-4066,-4046,-4026,-4007,-3989,-3971,-3953,-3936,-3920,-3905,
+    -3890,-3876,-3862,-3850,-3838,-3828,-3818,-3809,-3800,-3793,-3787,-3781,-3777,-3773,-3770,-3769,
+    -3768,-3768,-3769,-3770,-3773,-3777,-3781,-3786,-3792,-3799,-3807,-3815,-3824,-3834,-3844,-3855,
+    -3867,-3879,-3892,-3905,-3919,-3933,-3947,-3962,-3977,-3993,-4009,-4024,-4040,-4057,-4073,-4089,
+    -4105,-4122,-4138,-4154,-4170,-4186,-4201,-4217,-4232,-4246,-4261,-4275,-4288,-4301,-4314,-4326,
+    -4338,-4349,-4359,-4369,-4378,-4387,-4395,-4402,-4409,-4415,-4420,-4425,-4429,-4432,-4434,-4436,
+    -4437,-4437,-4437,-4436,-4434,-4432,-4428,-4425,-4420,-4415,-4409,-4403,-4396,-4388,-4380,-4371,
+    -4362,-4353,-4343,-4332,-4321,-4310,-4298,-4286,-4274,-4261,-4249,-4236,-4223,-4209,-4196,-4183,
+    -4169,-4156,-4142,-4129,-4115,-4102,-4089,-4076,-4063,-4051,-4039,-4027,-4015,-4004,-3993,-3983,
+    -3972,-3963,-3953,-3945,-3936,-3929,-3921,-3914,-3908,-3903,-3898,-3893,-3889,-3886,-3883,-3881,
+    -3879,-3878,-3878,-3878,-3879,-3880,-3882,-3885,-3888,-3892,-3896,-3901,-3906,-3912,-3918,-3925,
+    -3932,-3939,-3947,-3955,-3964,-3973,-3982,-3992,-4002,-4012,-4022,-4033,-4043,-4054,-4065,-4076,
+    -4087,-4098,-4109,-4120,-4131,-4141,-4152,-4162,-4173,-4183,-4193,-4202,-4212,-4221,-4230,-4238,
+    -4246,-4254,-4261,-4268,-4274,-4280,-4286,-4291,-4295,-4299,-4303,-4306,-4308,-4310,-4311,-4312};
+
+const int16_t table_squarewave3_mip7[1024]={
+    -1796,-1797,-1799,-1804,-1810,-1818,-1828,-1840,-1853,-1868,-1885,-1904,-1924,-1947,-1970,-1996,
+    -2023,-2052,-2082,-2114,-2148,-2183,-2219,-2257,-2297,-2338,-2380,-2424,-2469,-2515,-2563,-2612,
+    -2662,-2713,-2766,-2819,-2874,-2929,-2986,-3043,-3101,-3161,-3220,-3281,-3342,-3404,-3467,-3530,
+    -3594,-3658,-3723,-3788,-3853,-3919,-3984,-4050,-4116,-4182,-4249,-4315,-4381,-4447,-4513,-4578,
+    -4643,-4708,-4773,-4837,-4901,-4964,-5026,-5088,-5150,-5210,-5270,-5329,-5387,-5444,-5501,-5556,
+    -5610,-5664,-5716,-5767,-5816,-5865,-5912,-5958,-6003,-6046,-6087,-6128,-6167,-6204,-6239,-6274,
+    -6306,-6337,-6366,-6394,-6420,-6444,-6466,-6486,-6505,-6522,-6537,-6550,-6562,-6571,-6579,-6584,
+    -6588,-6590,-6590,-6588,-6584,-6578,-6570,-6561,-6549,-6535,-6520,-6502,-6483,-6462,-6439,-6414,
+    -6387,-6358,-6328,-6296,-6262,-6226,-6188,-6149,-6108,-6065,-6021,-5975,-5928,-5879,-5828,-5776,
+    -5723,-5668,-5612,-5554,-5495,-5435,-5374,-5311,-5247,-5183,-5117,-5050,-4982,-4914,-4844,-4774,
+    -4703,-4631,-4559,-4486,-4413,-4339,-4264,-4190,-4115,-4039,-3964,-3888,-3813,-3737,-3661,-3585,
+    -3510,-3435,-3360,-3285,-3211,-3137,-3063,-2990,-2918,-2847,-2776,-2706,-2636,-2568,-2501,-2434,
+    -2369,-2305,-2242,-2180,-2119,-2060,-2002,-1946,-1891,-1838,-1786,-1736,-1687,-1640,-1595,-1552,
+    -1511,-1471,-1434,-1398,-1365,-1333,-1304,-1276,-1251,-1228,-1207,-1189,-1172,-1158,-1147,-1137,
+    -1130,-1126,-1123,-1123,-1126,-1131,-1138,-1148,-1161,-1175,-1193,-1212,-1234,-1259,-1286,-1316,
+    -1348,-1382,-1419,-1458,-1500,-1544,-1590,-1639,-1690,-1744,-1800,-1858,-1918,-1980,-2045,-2111,
+    -2180,-2251,-2324,-2399,-2475,-2554,-2635,-2717,-2801,-2886,-2974,-3063,-3153,-3245,-3338,-3433,
+    -3529,-3626,-3725,-3824,-3925,-4026,-4129,-4232,-4336,-4440,-4545,-4651,-4757,-4864,-4971,-5078,
+    -5185,-5292,-5399,-5506,-5613,-5720,-5826,-5932,-6037,-6141,-6245,-6348,-6451,-6552,-6652,-6751,
+    -6849,-6945,-7040,-7134,-7226,-7316,-7405,-7491,-7576,-7659,-7739,-7817,-7894,-7967,-8039,-8107,
+    -8173,-8237,-8297,-8355,-8410,-8462,-8510,-8556,-8598,-8637,-8672,-8704,-8733,-8758,-8779,-8796,
+    -8810,-8819,-8825,-8827,-8825,-8818,-8808,-8793,-8774,-8750,-8723,-8690,-8654,-8612,-8567,-8516,
+    -8461,-8402,-8337,-8268,-8194,-8116,-8033,-7944,-7851,-7753,-7651,-7543,-7431,-7313,-7191,-7064,
+    -6932,-6795,-6653,-6506,-6354,-6198,-6036,-5870,-5699,-5523,-5343,-5158,-4968,-4773,-4574,-4370,
+    -4161,-3949,-3731,-3509,-3283,-3053,-2818,-2579,-2336,-2088,-1837,-1582,-1323,-1060,-793,-523,
+    -249,29,309,594,881,1172,1466,1763,2062,2365,2670,2978,3288,3601,3916,4233,
+    4553,4874,5197,5522,5849,6177,6507,6838,7170,7503,7838,8173,8509,8845,9182,9519,
+    9857,10194,10532,10869,11206,11543,11879,12215,12550,12884,13217,13549,13879,14208,14536,14862,
+    15186,15508,15828,16146,16462,16775,17086,17394,17699,18001,18301,18597,18890,19180,19466,19748,
+    20027,20302,20573,20840,21103,21361,21616,21865,22110,22351,22587,22817,23043,23264,23480,23690,
+    23895,24095,24289,24478,24661,24838,25009,25175,25335,25488,25636,25777,25913,26042,26165,26281,
+    26391,26495,26592,26682,26766,26844,26915,26979,27036,27087,27131,27169,27199,27223,27240,27250,
+    27253,27250,27240,27223,27199,27169,27131,27087,27036,26979,26915,26844,26766,26682,26592,26495,
+    26391,26281,26165,26042,25913,25777,25636,25488,25335,25175,25009,24838,24661,24478,24289,24095,
+    23895,23690,23480,23264,23043,22817,22587,22351,22110,21865,21616,21361,21103,20840,20573,20302,
+    20027,19748,19466,19180,18890,18597,18301,18001,17699,17394,17086,16775,16462,16146,15828,15508,
+    15186,14862,14536,14208,13879,13549,13217,12884,12550,12215,11879,11543,11206,10869,10532,10194,
+    9857,9519,9182,8845,8509,8173,7838,7503,7170,6838,6507,6177,5849,5522,5197,4874,
+    4553,4233,3916,3601,3288,2978,2670,2365,2062,1763,1466,1172,881,594,309,29,
+    -249,-523,-793,-1060,-1323,-1582,-1837,-2088,-2336,-2579,-2818,-3053,-3283,-3509,-3731,-3949,
+    -4161,-4370,-4574,-4773,-4968,-5158,-5343,-5523,-5699,-5870,-6036,-6198,-6354,-6506,-6653,-6795,
+    -6932,-7064,-7191,-7313,-7431,-7543,-7651,-7753,-7851,-7944,-8033,-8116,-8194,-8268,-8337,-8402,
+    -8461,-8516,-8567,-8612,-8654,-8690,-8723,-8750,-8774,-8793,-8808,-8818,-8825,-8827,-8825,-8819,
+    -8810,-8796,-8779,-8758,-8733,-8704,-8672,-8637,-8598,-8556,-8510,-8462,-8410,-8355,-8297,-8237,
+    -8173,-8107,-8039,-7967,-7894,-7817,-7739,-7659,-7576,-7491,-7405,-7316,-7226,-7134,-7040,-6945,
+    -6849,-6751,-6652,-6552,-6451,-6348,-6245,-6141,-6037,-5932,-5826,-5720,-5613,-5506,-5399,-5292,
+    -5185,-5078,-4971,-4864,-4757,-4651,-4545,-4440,-4336,-4232,-4129,-4026,-3925,-3824,-3725,-3626,
+    -3529,-3433,-3338,-3245,-3153,-3063,-2974,-2886,-2801,-2717,-2635,-2554,-2475,-2399,-2324,-2251,
+    -2180,-2111,-2045,-1980,-1918,-1858,-1800,-1744,-1690,-1639,-1590,-1544,-1500,-1458,-1419,-1382,
+    -1348,-1316,-1286,-1259,-1234,-1212,-1193,-1175,-1161,-1148,-1138,-1131,-1126,-1123,-1123,-1126,
+    -1130,-1137,-1147,-1158,-1172,-1189,-1207,-1228,-1251,-1276,-1304,-1333,-1365,-1398,-1434,-1471,
+    -1511,-1552,-1595,-1640,-1687,-1736,-1786,-1838,-1891,-1946,-2002,-2060,-2119,-2180,-2242,-2305,
+    -2369,-2434,-2501,-2568,-2636,-2706,-2776,-2847,-2918,-2990,-3063,-3137,-3211,-3285,-3360,-3435,
+    -3510,-3585,-3661,-3737,-3813,-3888,-3964,-4039,-4115,-4190,-4264,-4339,-4413,-4486,-4559,-4631,
+    -4703,-4774,-4844,-4914,-4982,-5050,-5117,-5183,-5247,-5311,-5374,-5435,-5495,-5554,-5612,-5668,
+    -5723,-5776,-5828,-5879,-5928,-5975,-6021,-6065,-6108,-6149,-6188,-6226,-6262,-6296,-6328,-6358,
+    -6387,-6414,-6439,-6462,-6483,-6502,-6520,-6535,-6549,-6561,-6570,-6578,-6584,-6588,-6590,-6590,
+    -6588,-6584,-6579,-6571,-6562,-6550,-6537,-6522,-6505,-6486,-6466,-6444,-6420,-6394,-6366,-6337,
+    -6306,-6274,-6239,-6204,-6167,-6128,-6087,-6046,-6003,-5958,-5912,-5865,-5816,-5767,-5716,-5664,
+    -5610,-5556,-5501,-5444,-5387,-5329,-5270,-5210,-5150,-5088,-5026,-4964,-4901,-4837,-4773,-4708,
+    -4643,-4578,-4513,-4447,-4381,-4315,-4249,-4182,-4116,-4050,-3984,-3919,-3853,-3788,-3723,-3658,
+    -3594,-3530,-3467,-3404,-3342,-3281,-3220,-3161,-3101,-3043,-2986,-2929,-2874,-2819,-2766,-2713,
+    -2662,-2612,-2563,-2515,-2469,-2424,-2380,-2338,-2297,-2257,-2219,-2183,-2148,-2114,-2082,-2052,
+    -2023,-1996,-1970,-1947,-1924,-1904,-1885,-1868,-1853,-1840,-1828,-1818,-1810,-1804,-1799,-1797};
+
+const int16_t table_squarewave3_mip8[1024]={
+    -595,-595,-596,-598,-601,-605,-609,-615,-621,-628,-636,-644,-654,-664,-675,-687,
+    -699,-713,-727,-742,-758,-774,-792,-810,-829,-848,-869,-890,-912,-935,-958,-982,
+    -1007,-1033,-1060,-1087,-1115,-1143,-1173,-1203,-1234,-1265,-1297,-1330,-1364,-1398,-1433,-1468,
+    -1504,-1541,-1579,-1617,-1655,-1695,-1735,-1775,-1816,-1858,-1900,-1943,-1986,-2030,-2075,-2120,
+    -2165,-2211,-2258,-2305,-2353,-2401,-2449,-2498,-2547,-2597,-2647,-2698,-2749,-2801,-2852,-2905,
+    -2957,-3010,-3064,-3117,-3171,-3225,-3280,-3335,-3390,-3445,-3501,-3557,-3613,-3670,-3726,-3783,
+    -3840,-3897,-3954,-4012,-4070,-4127,-4185,-4243,-4301,-4359,-4418,-4476,-4534,-4593,-4651,-4709,
+    -4768,-4826,-4885,-4943,-5001,-5059,-5117,-5175,-5233,-5291,-5349,-5406,-5464,-5521,-5578,-5635,
+    -5692,-5748,-5804,-5860,-5916,-5971,-6027,-6082,-6136,-6190,-6244,-6298,-6351,-6404,-6457,-6509,
+    -6561,-6612,-6663,-6713,-6763,-6813,-6862,-6911,-6959,-7006,-7054,-7100,-7146,-7192,-7237,-7281,
+    -7325,-7368,-7410,-7452,-7493,-7534,-7574,-7613,-7652,-7690,-7727,-7764,-7800,-7835,-7869,-7903,
+    -7936,-7968,-7999,-8030,-8060,-8089,-8117,-8144,-8171,-8196,-8221,-8245,-8268,-8290,-8311,-8332,
+    -8351,-8370,-8388,-8404,-8420,-8435,-8449,-8462,-8474,-8485,-8495,-8504,-8512,-8519,-8526,-8531,
+    -8535,-8538,-8540,-8541,-8541,-8540,-8537,-8534,-8530,-8525,-8518,-8511,-8502,-8493,-8482,-8470,
+    -8457,-8443,-8428,-8412,-8395,-8376,-8357,-8336,-8315,-8292,-8268,-8243,-8216,-8189,-8161,-8131,
+    -8100,-8068,-8035,-8001,-7966,-7930,-7892,-7853,-7814,-7773,-7731,-7687,-7643,-7598,-7551,-7503,
+    -7454,-7405,-7353,-7301,-7248,-7194,-7138,-7081,-7024,-6965,-6905,-6844,-6782,-6718,-6654,-6589,
+    -6522,-6455,-6386,-6316,-6246,-6174,-6101,-6027,-5952,-5876,-5800,-5722,-5643,-5563,-5482,-5400,
+    -5317,-5233,-5148,-5062,-4975,-4887,-4799,-4709,-4618,-4527,-4435,-4341,-4247,-4152,-4056,-3959,
+    -3862,-3763,-3664,-3564,-3463,-3361,-3258,-3155,-3051,-2946,-2840,-2734,-2627,-2519,-2410,-2301,
+    -2191,-2080,-1969,-1857,-1744,-1631,-1517,-1403,-1288,-1172,-1056,-939,-822,-704,-585,-466,
+    -347,-227,-107,14,135,257,379,501,624,747,871,995,1119,1244,1369,1494,
+    1619,1745,1871,1997,2123,2250,2377,2504,2631,2758,2886,3013,3141,3269,3396,3524,
+    3652,3780,3908,4036,4164,4292,4419,4547,4675,4802,4930,5057,5184,5312,5438,5565,
+    5692,5818,5944,6070,6195,6321,6446,6570,6695,6819,6942,7066,7189,7311,7433,7555,
+    7676,7797,7918,8037,8157,8276,8394,8512,8629,8746,8862,8977,9092,9207,9320,9433,
+    9545,9657,9768,9878,9988,10096,10204,10312,10418,10524,10629,10733,10836,10938,11040,11140,
+    11240,11339,11437,11534,11630,11726,11820,11913,12005,12097,12187,12276,12365,12452,12538,12624,
+    12708,12791,12873,12954,13033,13112,13189,13266,13341,13415,13488,13560,13630,13700,13768,13835,
+    13901,13965,14029,14091,14152,14211,14269,14326,14382,14437,14490,14542,14592,14642,14690,14736,
+    14782,14826,14868,14909,14949,14988,15025,15061,15096,15129,15160,15191,15220,15247,15274,15298,
+    15322,15344,15364,15383,15401,15418,15432,15446,15458,15469,15478,15486,15492,15497,15501,15503,
+    15504,15503,15501,15497,15492,15486,15478,15469,15458,15446,15432,15418,15401,15383,15364,15344,
+    15322,15298,15274,15247,15220,15191,15160,15129,15096,15061,15025,14988,14949,14909,14868,14826,
+    14782,14736,14690,14642,14592,14542,14490,14437,14382,14326,14269,14211,14152,14091,14029,13965,
+    13901,13835,13768,13700,13630,13560,13488,13415,13341,13266,13189,13112,13033,12954,12873,12791,
+    12708,12624,12538,12452,12365,12276,12187,12097,12005,11913,11820,11726,11630,11534,11437,11339,
+    11240,11140,11040,10938,10836,10733,10629,10524,10418,10312,10204,10096,9988,9878,9768,9657,
+    9545,9433,9320,9207,9092,8977,8862,8746,8629,8512,8394,8276,8157,8037,7918,7797,
+    7676,7555,7433,7311,7189,7066,6942,6819,6695,6570,6446,6321,6195,6070,5944,5818,
+    5692,5565,5438,5312,5184,5057,4930,4802,4675,4547,4419,4292,4164,4036,3908,3780,
+    3652,3524,3396,3269,3141,3013,2886,2758,2631,2504,2377,2250,2123,1997,1871,1745,
+    1619,1494,1369,1244,1119,995,871,747,624,501,379,257,135,14,-107,-227,
+    -347,-466,-585,-704,-822,-939,-1056,-1172,-1288,-1403,-1517,-1631,-1744,-1857,-1969,-2080,
+    -2191,-2301,-2410,-2519,-2627,-2734,-2840,-2946,-3051,-3155,-3258,-3361,-3463,-3564,-3664,-3763,
+    -3862,-3959,-4056,-4152,-4247,-4341,-4435,-4527,-4618,-4709,-4799,-4887,-4975,-5062,-5148,-5233,
+    -5317,-5400,-5482,-5563,-5643,-5722,-5800,-5876,-5952,-6027,-6101,-6174,-6246,-6316,-6386,-6455,
+    -6522,-6589,-6654,-6718,-6782,-6844,-6905,-6965,-7024,-7081,-7138,-7194,-7248,-7301,-7353,-7405,
+    -7454,-7503,-7551,-7598,-7643,-7687,-7731,-7773,-7814,-7853,-7892,-7930,-7966,-8001,-8035,-8068,
+    -8100,-8131,-8161,-8189,-8216,-8243,-8268,-8292,-8315,-8336,-8357,-8376,-8395,-8412,-8428,-8443,
+    -8457,-8470,-8482,-8493,-8502,-8511,-8518,-8525,-8530,-8534,-8537,-8540,-8541,-8541,-8540,-8538,
+    -8535,-8531,-8526,-8519,-8512,-8504,-8495,-8485,-8474,-8462,-8449,-8435,-8420,-8404,-8388,-8370,
+    -8351,-8332,-8311,-8290,-8268,-8245,-8221,-8196,-8171,-8144,-8117,-8089,-8060,-8030,-7999,-7968,
+    -7936,-7903,-7869,-7835,-7800,-7764,-7727,-7690,-7652,-7613,-7574,-7534,-7493,-7452,-7410,-7368,
+    -7325,-7281,-7237,-7192,-7146,-7100,-7054,-7006,-6959,-6911,-6862,-6813,-6763,-6713,-6663,-6612,
+    -6561,-6509,-6457,-6404,-6351,-6298,-6244,-6190,-6136,-6082,-6027,-5971,-5916,-5860,-5804,-5748,
+    -5692,-5635,-5578,-5521,-5464,-5406,-5349,-5291,-5233,-5175,-5117,-5059,-5001,-4943,-4885,-4826,
+    -4768,-4709,-4651,-4593,-4534,-4476,-4418,-4359,-4301,-4243,-4185,-4127,-4070,-4012,-3954,-3897,
+    -3840,-3783,-3726,-3670,-3613,-3557,-3501,-3445,-3390,-3335,-3280,-3225,-3171,-3117,-3064,-3010,
+    -2957,-2905,-2852,-2801,-2749,-2698,-2647,-2597,-2547,-2498,-2449,-2401,-2353,-2305,-2258,-2211,
+    -2165,-2120,-2075,-2030,-1986,-1943,-1900,-1858,-1816,-1775,-1735,-1695,-1655,-1617,-1579,-1541,
+    -1504,-1468,-1433,-1398,-1364,-1330,-1297,-1265,-1234,-1203,-1173,-1143,-1115,-1087,-1060,-1033,
+    -1007,-982,-958,-935,-912,-890,-869,-848,-829,-810,-792,-774,-758,-742,-727,-713,
+    -699,-687,-675,-664,-654,-644,-636,-628,-621,-615,-609,-605,-601,-598,-596,-595};
+
+const int16_t table_squarewave3_mip9[1024]={
+    -8049,-8049,-8049,-8048,-8047,-8045,-8044,-8042,-8039,-8037,-8034,-8031,-8027,-8024,-8020,-8015,
+    -8010,-8005,-8000,-7995,-7989,-7982,-7976,-7969,-7962,-7955,-7947,-7939,-7931,-7922,-7913,-7904,
+    -7895,-7885,-7875,-7864,-7854,-7843,-7831,-7820,-7808,-7796,-7783,-7771,-7758,-7744,-7731,-7717,
+    -7703,-7688,-7673,-7658,-7643,-7627,-7611,-7595,-7579,-7562,-7545,-7527,-7510,-7492,-7474,-7455,
+    -7436,-7417,-7398,-7379,-7359,-7338,-7318,-7297,-7276,-7255,-7234,-7212,-7190,-7167,-7145,-7122,
+    -7099,-7075,-7052,-7028,-7003,-6979,-6954,-6929,-6904,-6878,-6853,-6827,-6800,-6774,-6747,-6720,
+    -6693,-6665,-6637,-6609,-6581,-6552,-6524,-6494,-6465,-6436,-6406,-6376,-6346,-6315,-6284,-6253,
+    -6222,-6191,-6159,-6127,-6095,-6063,-6030,-5997,-5964,-5931,-5897,-5864,-5830,-5795,-5761,-5726,
+    -5692,-5657,-5621,-5586,-5550,-5514,-5478,-5442,-5405,-5369,-5332,-5295,-5258,-5220,-5182,-5144,
+    -5106,-5068,-5030,-4991,-4952,-4913,-4874,-4834,-4795,-4755,-4715,-4675,-4635,-4594,-4554,-4513,
+    -4472,-4431,-4389,-4348,-4306,-4264,-4223,-4180,-4138,-4096,-4053,-4010,-3967,-3924,-3881,-3838,
+    -3794,-3751,-3707,-3663,-3619,-3575,-3530,-3486,-3441,-3397,-3352,-3307,-3262,-3217,-3171,-3126,
+    -3080,-3035,-2989,-2943,-2897,-2851,-2804,-2758,-2712,-2665,-2618,-2572,-2525,-2478,-2431,-2384,
+    -2337,-2289,-2242,-2194,-2147,-2099,-2051,-2004,-1956,-1908,-1860,-1812,-1764,-1715,-1667,-1619,
+    -1570,-1522,-1473,-1425,-1376,-1327,-1279,-1230,-1181,-1132,-1083,-1034,-985,-936,-887,-838,
+    -789,-740,-691,-641,-592,-543,-494,-444,-395,-346,-296,-247,-198,-148,-99,-49,
+    0,49,99,148,198,247,296,346,395,444,494,543,592,641,691,740,
+    789,838,887,936,985,1034,1083,1132,1181,1230,1279,1327,1376,1425,1473,1522,
+    1570,1619,1667,1715,1764,1812,1860,1908,1956,2004,2051,2099,2147,2194,2242,2289,
+    2337,2384,2431,2478,2525,2572,2619,2665,2712,2758,2805,2851,2897,2943,2989,3035,
+    3080,3126,3171,3217,3262,3307,3352,3397,3441,3486,3531,3575,3619,3663,3707,3751,
+    3794,3838,3881,3924,3967,4010,4053,4096,4138,4180,4223,4265,4306,4348,4389,4431,
+    4472,4513,4554,4594,4635,4675,4715,4755,4795,4835,4874,4913,4952,4991,5030,5068,
+    5106,5144,5182,5220,5258,5295,5332,5369,5406,5442,5478,5514,5550,5586,5621,5657,
+    5692,5726,5761,5795,5830,5864,5897,5931,5964,5997,6030,6063,6095,6127,6159,6191,
+    6222,6253,6284,6315,6346,6376,6406,6436,6465,6494,6524,6552,6581,6609,6637,6665,
+    6693,6720,6747,6774,6800,6827,6853,6879,6904,6929,6954,6979,7004,7028,7052,7075,
+    7099,7122,7145,7167,7190,7212,7234,7255,7276,7297,7318,7339,7359,7379,7398,7417,
+    7437,7455,7474,7492,7510,7527,7545,7562,7579,7595,7611,7627,7643,7658,7673,7688,
+    7703,7717,7731,7744,7758,7771,7783,7796,7808,7820,7831,7843,7854,7864,7875,7885,
+    7895,7904,7913,7922,7931,7939,7947,7955,7962,7969,7976,7982,7989,7995,8000,8005,
+    8010,8015,8020,8024,8027,8031,8034,8037,8040,8042,8044,8045,8047,8048,8049,8049,
+    8049,8049,8049,8048,8047,8045,8044,8042,8040,8037,8034,8031,8027,8024,8020,8015,
+    8010,8005,8000,7995,7989,7982,7976,7969,7962,7955,7947,7939,7931,7922,7913,7904,
+    7895,7885,7875,7864,7854,7843,7831,7820,7808,7796,7783,7771,7758,7744,7731,7717,
+    7703,7688,7673,7658,7643,7627,7611,7595,7579,7562,7545,7527,7510,7492,7474,7455,
+    7437,7417,7398,7379,7359,7339,7318,7297,7276,7255,7234,7212,7190,7167,7145,7122,
+    7099,7075,7052,7028,7004,6979,6954,6929,6904,6879,6853,6827,6800,6774,6747,6720,
+    6693,6665,6637,6609,6581,6552,6524,6494,6465,6436,6406,6376,6346,6315,6284,6253,
+    6222,6191,6159,6127,6095,6063,6030,5997,5964,5931,5897,5864,5830,5795,5761,5726,
+    5692,5657,5621,5586,5550,5514,5478,5442,5406,5369,5332,5295,5258,5220,5182,5144,
+    5106,5068,5030,4991,4952,4913,4874,4835,4795,4755,4715,4675,4635,4594,4554,4513,
+    4472,4431,4389,4348,4306,4265,4223,4180,4138,4096,4053,4010,3967,3924,3881,3838,
+    3794,3751,3707,3663,3619,3575,3531,3486,3441,3397,3352,3307,3262,3217,3171,3126,
+    3080,3035,2989,2943,2897,2851,2805,2758,2712,2665,2619,2572,2525,2478,2431,2384,
+    2337,2289,2242,2194,2147,2099,2051,2004,1956,1908,1860,1812,1764,1715,1667,1619,
+    1570,1522,1473,1425,1376,1327,1279,1230,1181,1132,1083,1034,985,936,887,838,
+    789,740,691,641,592,543,494,444,395,346,296,247,198,148,99,49,
+    0,-49,-99,-148,-198,-247,-296,-346,-395,-444,-494,-543,-592,-641,-691,-740,
+    -789,-838,-887,-936,-985,-1034,-1083,-1132,-1181,-1230,-1279,-1327,-1376,-1425,-1473,-1522,
+    -1570,-1619,-1667,-1715,-1764,-1812,-1860,-1908,-1956,-2004,-2051,-2099,-2147,-2194,-2242,-2289,
+    -2337,-2384,-2431,-2478,-2525,-2572,-2618,-2665,-2712,-2758,-2804,-2851,-2897,-2943,-2989,-3035,
+    -3080,-3126,-3171,-3217,-3262,-3307,-3352,-3397,-3441,-3486,-3530,-3575,-3619,-3663,-3707,-3751,
+    -3794,-3838,-3881,-3924,-3967,-4010,-4053,-4096,-4138,-4180,-4223,-4264,-4306,-4348,-4389,-4431,
+    -4472,-4513,-4554,-4594,-4635,-4675,-4715,-4755,-4795,-4834,-4874,-4913,-4952,-4991,-5030,-5068,
+    -5106,-5144,-5182,-5220,-5258,-5295,-5332,-5369,-5405,-5442,-5478,-5514,-5550,-5586,-5621,-5657,
+    -5692,-5726,-5761,-5795,-5830,-5864,-5897,-5931,-5964,-5997,-6030,-6063,-6095,-6127,-6159,-6191,
+    -6222,-6253,-6284,-6315,-6346,-6376,-6406,-6436,-6465,-6494,-6524,-6552,-6581,-6609,-6637,-6665,
+    -6693,-6720,-6747,-6774,-6800,-6827,-6853,-6878,-6904,-6929,-6954,-6979,-7003,-7028,-7052,-7075,
+    -7099,-7122,-7145,-7167,-7190,-7212,-7234,-7255,-7276,-7297,-7318,-7338,-7359,-7379,-7398,-7417,
+    -7436,-7455,-7474,-7492,-7510,-7527,-7545,-7562,-7579,-7595,-7611,-7627,-7643,-7658,-7673,-7688,
+    -7703,-7717,-7731,-7744,-7758,-7771,-7783,-7796,-7808,-7820,-7831,-7843,-7854,-7864,-7875,-7885,
+    -7895,-7904,-7913,-7922,-7931,-7939,-7947,-7955,-7962,-7969,-7976,-7982,-7989,-7995,-8000,-8005,
+    -8010,-8015,-8020,-8024,-8027,-8031,-8034,-8037,-8039,-8042,-8044,-8045,-8047,-8048,-8049,-8049};
+
+const int16_t table_wd1_mip7[1024]={
+    0,-101,-203,-304,-405,-506,-606,-706,-805,-903,-1001,-1098,-1194,-1289,-1383,-1475,
+    -1567,-1657,-1746,-1833,-1919,-2003,-2086,-2167,-2246,-2323,-2398,-2471,-2542,-2611,-2678,-2742,
+    -2805,-2864,-2922,-2976,-3029,-3078,-3125,-3170,-3211,-3250,-3286,-3320,-3350,-3377,-3402,-3423,
+    -3442,-3457,-3469,-3479,-3485,-3488,-3488,-3484,-3478,-3468,-3456,-3440,-3421,-3398,-3373,-3344,
+    -3312,-3278,-3239,-3198,-3154,-3106,-3056,-3002,-2946,-2886,-2824,-2758,-2690,-2619,-2545,-2468,
+    -2388,-2306,-2221,-2133,-2043,-1950,-1855,-1758,-1658,-1556,-1452,-1345,-1237,-1126,-1013,-899,
+    -783,-665,-545,-423,-301,-176,-51,76,205,334,464,596,728,861,995,1129,
+    1264,1399,1535,1671,1808,1944,2080,2217,2353,2489,2624,2759,2894,3028,3161,3294,
+    3426,3556,3686,3815,3942,4068,4193,4316,4437,4557,4676,4792,4907,5019,5130,5239,
+    5345,5449,5551,5650,5747,5842,5934,6023,6109,6193,6274,6352,6427,6499,6568,6634,
+    6697,6757,6813,6866,6916,6963,7006,7046,7082,7115,7144,7170,7193,7212,7227,7239,
+    7247,7252,7253,7250,7244,7235,7222,7205,7185,7161,7134,7103,7069,7031,6990,6946,
+    6898,6847,6792,6735,6674,6610,6543,6473,6400,6323,6244,6163,6078,5991,5901,5808,
+    5713,5616,5516,5414,5310,5203,5095,4985,4872,4758,4642,4525,4406,4286,4164,4042,
+    3918,3793,3667,3540,3413,3285,3156,3028,2898,2769,2640,2510,2381,2252,2123,1995,
+    1868,1741,1615,1490,1366,1243,1121,1001,882,765,650,536,425,315,208,103,
+    0,-100,-198,-293,-385,-474,-560,-643,-723,-800,-873,-943,-1009,-1071,-1130,-1184,
+    -1235,-1282,-1324,-1363,-1397,-1427,-1452,-1473,-1489,-1501,-1508,-1510,-1508,-1500,-1488,-1471,
+    -1448,-1421,-1388,-1350,-1307,-1259,-1206,-1147,-1083,-1014,-939,-859,-774,-683,-587,-485,
+    -378,-266,-148,-25,103,237,376,521,670,825,985,1151,1321,1497,1677,1863,
+    2053,2249,2449,2654,2864,3078,3297,3520,3748,3980,4217,4457,4702,4950,5203,5459,
+    5719,5982,6249,6519,6793,7069,7349,7631,7916,8204,8495,8787,9082,9380,9679,9980,
+    10282,10587,10892,11199,11507,11816,12126,12437,12748,13059,13371,13683,13995,14306,14617,14928,
+    15238,15546,15854,16161,16466,16770,17072,17373,17671,17967,18261,18552,18841,19126,19409,19689,
+    19965,20238,20508,20773,21035,21293,21546,21795,22040,22280,22515,22745,22970,23189,23404,23613,
+    23816,24013,24205,24390,24569,24742,24908,25068,25221,25368,25507,25640,25765,25883,25994,26098,
+    26194,26282,26363,26436,26501,26558,26607,26648,26681,26706,26723,26731,26731,26722,26705,26679,
+    26645,26603,26551,26491,26423,26346,26260,26165,26062,25950,25829,25700,25562,25415,25260,25096,
+    24923,24742,24552,24354,24147,23932,23709,23477,23237,22989,22732,22468,22196,21916,21628,21332,
+    21028,20717,20399,20073,19740,19400,19053,18699,18338,17970,17596,17215,16829,16435,16036,15631,
+    15220,14804,14382,13955,13523,13085,12643,12196,11745,11289,10829,10365,9897,9425,8950,8471,
+    7989,7505,7017,6527,6034,5540,5043,4544,4043,3541,3038,2533,2028,1521,1015,507,
+    0,-507,-1015,-1521,-2028,-2533,-3038,-3541,-4043,-4544,-5043,-5540,-6034,-6527,-7017,-7505,
+    -7989,-8471,-8950,-9425,-9897,-10365,-10829,-11289,-11745,-12196,-12643,-13085,-13523,-13955,-14382,-14804,
+    -15220,-15631,-16036,-16435,-16829,-17215,-17596,-17970,-18338,-18699,-19053,-19400,-19740,-20073,-20399,-20717,
+    -21028,-21332,-21628,-21916,-22196,-22468,-22732,-22989,-23237,-23477,-23709,-23932,-24147,-24354,-24552,-24742,
+    -24923,-25096,-25260,-25415,-25562,-25700,-25829,-25950,-26062,-26165,-26260,-26346,-26423,-26491,-26551,-26603,
+    -26645,-26679,-26705,-26722,-26731,-26731,-26723,-26706,-26681,-26648,-26607,-26558,-26501,-26436,-26363,-26282,
+    -26194,-26098,-25994,-25883,-25765,-25640,-25507,-25368,-25221,-25068,-24908,-24742,-24569,-24390,-24205,-24013,
+    -23816,-23613,-23404,-23189,-22970,-22745,-22515,-22280,-22040,-21795,-21546,-21293,-21035,-20773,-20508,-20238,
+    -19965,-19689,-19409,-19126,-18841,-18552,-18261,-17967,-17671,-17373,-17072,-16770,-16466,-16161,-15854,-15546,
+    -15238,-14928,-14617,-14306,-13995,-13683,-13371,-13059,-12748,-12437,-12126,-11816,-11507,-11199,-10892,-10587,
+    -10282,-9980,-9679,-9380,-9082,-8787,-8495,-8204,-7916,-7631,-7349,-7069,-6793,-6519,-6249,-5982,
+    -5719,-5459,-5203,-4950,-4702,-4457,-4217,-3980,-3748,-3520,-3297,-3078,-2864,-2654,-2449,-2249,
+    -2053,-1863,-1677,-1497,-1321,-1151,-985,-825,-670,-521,-376,-237,-103,25,148,266,
+    378,485,587,683,774,859,939,1014,1083,1147,1206,1259,1307,1350,1388,1421,
+    1448,1471,1488,1500,1508,1510,1508,1501,1489,1473,1452,1427,1397,1363,1324,1282,
+    1235,1184,1130,1071,1009,943,873,800,723,643,560,474,385,293,198,100,
+    0,-103,-208,-315,-425,-536,-650,-765,-882,-1001,-1121,-1243,-1366,-1490,-1615,-1741,
+    -1868,-1995,-2123,-2252,-2381,-2510,-2640,-2769,-2898,-3028,-3156,-3285,-3413,-3540,-3667,-3793,
+    -3918,-4042,-4164,-4286,-4406,-4525,-4642,-4758,-4872,-4985,-5095,-5203,-5310,-5414,-5516,-5616,
+    -5713,-5808,-5901,-5991,-6078,-6163,-6244,-6323,-6400,-6473,-6543,-6610,-6674,-6735,-6792,-6847,
+    -6898,-6946,-6990,-7031,-7069,-7103,-7134,-7161,-7185,-7205,-7222,-7235,-7244,-7250,-7253,-7252,
+    -7247,-7239,-7227,-7212,-7193,-7170,-7144,-7115,-7082,-7046,-7006,-6963,-6916,-6866,-6813,-6757,
+    -6697,-6634,-6568,-6499,-6427,-6352,-6274,-6193,-6109,-6023,-5934,-5842,-5747,-5650,-5551,-5449,
+    -5345,-5239,-5130,-5019,-4907,-4792,-4676,-4557,-4437,-4316,-4193,-4068,-3942,-3815,-3686,-3556,
+    -3426,-3294,-3161,-3028,-2894,-2759,-2624,-2489,-2353,-2217,-2080,-1944,-1808,-1671,-1535,-1399,
+    -1264,-1129,-995,-861,-728,-596,-464,-334,-205,-76,51,176,301,423,545,665,
+    783,899,1013,1126,1237,1345,1452,1556,1658,1758,1855,1950,2043,2133,2221,2306,
+    2388,2468,2545,2619,2690,2758,2824,2886,2946,3002,3056,3106,3154,3198,3239,3278,
+    3312,3344,3373,3398,3421,3440,3456,3468,3478,3484,3488,3488,3485,3479,3469,3457,
+    3442,3423,3402,3377,3350,3320,3286,3250,3211,3170,3125,3078,3029,2976,2922,2864,
+    2805,2742,2678,2611,2542,2471,2398,2323,2246,2167,2086,2003,1919,1833,1746,1657,
+    1567,1475,1383,1289,1194,1098,1001,903,805,706,606,506,405,304,203,101};
+
+const int16_t table_wd1_mip8[1024]={
+    0,-51,-101,-152,-203,-253,-304,-354,-405,-455,-505,-555,-605,-655,-704,-754,
+    -803,-852,-900,-949,-997,-1045,-1093,-1140,-1187,-1234,-1280,-1326,-1372,-1418,-1463,-1507,
+    -1551,-1595,-1639,-1681,-1724,-1766,-1807,-1848,-1889,-1929,-1969,-2007,-2046,-2084,-2121,-2158,
+    -2194,-2229,-2264,-2299,-2332,-2365,-2398,-2429,-2460,-2491,-2520,-2549,-2577,-2605,-2632,-2658,
+    -2683,-2707,-2731,-2754,-2776,-2798,-2818,-2838,-2857,-2875,-2892,-2909,-2924,-2939,-2953,-2966,
+    -2978,-2989,-2999,-3009,-3017,-3025,-3031,-3037,-3042,-3046,-3049,-3051,-3052,-3052,-3051,-3049,
+    -3046,-3042,-3037,-3031,-3025,-3017,-3008,-2998,-2987,-2976,-2963,-2949,-2934,-2918,-2901,-2884,
+    -2865,-2845,-2824,-2802,-2779,-2755,-2730,-2704,-2676,-2648,-2619,-2589,-2558,-2525,-2492,-2458,
+    -2422,-2386,-2348,-2310,-2271,-2230,-2189,-2146,-2102,-2058,-2012,-1966,-1918,-1870,-1820,-1770,
+    -1718,-1666,-1612,-1558,-1503,-1446,-1389,-1331,-1271,-1211,-1150,-1088,-1025,-961,-896,-831,
+    -764,-697,-628,-559,-489,-418,-346,-274,-200,-126,-51,25,102,180,258,337,
+    417,498,579,662,744,828,912,997,1083,1170,1257,1344,1433,1522,1612,1702,
+    1793,1884,1976,2069,2162,2256,2350,2445,2540,2636,2732,2829,2926,3024,3122,3220,
+    3319,3419,3518,3618,3719,3820,3921,4022,4124,4226,4328,4430,4533,4636,4739,4843,
+    4946,5050,5154,5258,5362,5466,5571,5675,5780,5884,5989,6094,6198,6303,6408,6512,
+    6617,6721,6826,6930,7034,7138,7242,7346,7449,7553,7656,7759,7862,7964,8066,8168,
+    8270,8371,8472,8573,8673,8773,8873,8972,9071,9169,9267,9364,9461,9557,9653,9749,
+    9844,9938,10032,10125,10217,10309,10400,10491,10581,10670,10759,10847,10934,11021,11107,11192,
+    11276,11359,11442,11524,11605,11685,11764,11843,11921,11997,12073,12148,12222,12295,12367,12438,
+    12508,12578,12646,12713,12779,12844,12908,12971,13033,13094,13153,13212,13270,13326,13381,13435,
+    13488,13540,13591,13640,13688,13735,13781,13825,13869,13911,13952,13991,14029,14066,14102,14137,
+    14170,14202,14232,14261,14289,14315,14341,14364,14387,14408,14428,14446,14463,14478,14493,14505,
+    14517,14527,14535,14542,14548,14552,14555,14556,14556,14555,14552,14548,14542,14534,14526,14516,
+    14504,14491,14476,14460,14443,14424,14403,14381,14358,14333,14307,14279,14250,14219,14187,14153,
+    14118,14081,14043,14003,13962,13920,13876,13831,13784,13736,13686,13635,13582,13528,13473,13416,
+    13357,13298,13237,13174,13110,13045,12978,12910,12840,12769,12697,12623,12548,12472,12394,12315,
+    12235,12153,12070,11986,11900,11813,11725,11636,11545,11453,11360,11265,11170,11073,10975,10875,
+    10775,10673,10570,10466,10361,10254,10147,10038,9929,9818,9706,9593,9479,9364,9248,9131,
+    9013,8893,8773,8652,8530,8407,8283,8158,8032,7906,7778,7650,7521,7390,7259,7128,
+    6995,6862,6728,6593,6457,6321,6184,6046,5908,5769,5629,5489,5348,5206,5064,4921,
+    4778,4634,4490,4345,4200,4054,3908,3761,3614,3467,3319,3170,3022,2873,2723,2574,
+    2424,2274,2123,1973,1822,1671,1519,1368,1216,1065,913,761,609,457,304,152,
+    0,-152,-304,-457,-609,-761,-913,-1065,-1216,-1368,-1519,-1671,-1822,-1973,-2123,-2274,
+    -2424,-2574,-2723,-2873,-3022,-3170,-3319,-3467,-3614,-3761,-3908,-4054,-4200,-4345,-4490,-4634,
+    -4778,-4921,-5064,-5206,-5348,-5489,-5629,-5769,-5908,-6046,-6184,-6321,-6457,-6593,-6728,-6862,
+    -6995,-7128,-7259,-7390,-7521,-7650,-7778,-7906,-8032,-8158,-8283,-8407,-8530,-8652,-8773,-8893,
+    -9013,-9131,-9248,-9364,-9479,-9593,-9706,-9818,-9929,-10038,-10147,-10254,-10361,-10466,-10570,-10673,
+    -10775,-10875,-10975,-11073,-11170,-11265,-11360,-11453,-11545,-11636,-11725,-11813,-11900,-11986,-12070,-12153,
+    -12235,-12315,-12394,-12472,-12548,-12623,-12697,-12769,-12840,-12910,-12978,-13045,-13110,-13174,-13237,-13298,
+    -13357,-13416,-13473,-13528,-13582,-13635,-13686,-13736,-13784,-13831,-13876,-13920,-13962,-14003,-14043,-14081,
+    -14118,-14153,-14187,-14219,-14250,-14279,-14307,-14333,-14358,-14381,-14403,-14424,-14443,-14460,-14476,-14491,
+    -14504,-14516,-14526,-14534,-14542,-14548,-14552,-14555,-14556,-14556,-14555,-14552,-14548,-14542,-14535,-14527,
+    -14517,-14505,-14493,-14478,-14463,-14446,-14428,-14408,-14387,-14364,-14341,-14315,-14289,-14261,-14232,-14202,
+    -14170,-14137,-14102,-14066,-14029,-13991,-13952,-13911,-13869,-13825,-13781,-13735,-13688,-13640,-13591,-13540,
+    -13488,-13435,-13381,-13326,-13270,-13212,-13153,-13094,-13033,-12971,-12908,-12844,-12779,-12713,-12646,-12578,
+    -12508,-12438,-12367,-12295,-12222,-12148,-12073,-11997,-11921,-11843,-11764,-11685,-11605,-11524,-11442,-11359,
+    -11276,-11192,-11107,-11021,-10934,-10847,-10759,-10670,-10581,-10491,-10400,-10309,-10217,-10125,-10032,-9938,
+    -9844,-9749,-9653,-9557,-9461,-9364,-9267,-9169,-9071,-8972,-8873,-8773,-8673,-8573,-8472,-8371,
+    -8270,-8168,-8066,-7964,-7862,-7759,-7656,-7553,-7449,-7346,-7242,-7138,-7034,-6930,-6826,-6721,
+    -6617,-6512,-6408,-6303,-6198,-6094,-5989,-5884,-5780,-5675,-5571,-5466,-5362,-5258,-5154,-5050,
+    -4946,-4843,-4739,-4636,-4533,-4430,-4328,-4226,-4124,-4022,-3921,-3820,-3719,-3618,-3518,-3419,
+    -3319,-3220,-3122,-3024,-2926,-2829,-2732,-2636,-2540,-2445,-2350,-2256,-2162,-2069,-1976,-1884,
+    -1793,-1702,-1612,-1522,-1433,-1344,-1257,-1170,-1083,-997,-912,-828,-744,-662,-579,-498,
+    -417,-337,-258,-180,-102,-25,51,126,200,274,346,418,489,559,628,697,
+    764,831,896,961,1025,1088,1150,1211,1271,1331,1389,1446,1503,1558,1612,1666,
+    1718,1770,1820,1870,1918,1966,2012,2058,2102,2146,2189,2230,2271,2310,2348,2386,
+    2422,2458,2492,2525,2558,2589,2619,2648,2676,2704,2730,2755,2779,2802,2824,2845,
+    2865,2884,2901,2918,2934,2949,2963,2976,2987,2998,3008,3017,3025,3031,3037,3042,
+    3046,3049,3051,3052,3052,3051,3049,3046,3042,3037,3031,3025,3017,3009,2999,2989,
+    2978,2966,2953,2939,2924,2909,2892,2875,2857,2838,2818,2798,2776,2754,2731,2707,
+    2683,2658,2632,2605,2577,2549,2520,2491,2460,2429,2398,2365,2332,2299,2264,2229,
+    2194,2158,2121,2084,2046,2007,1969,1929,1889,1848,1807,1766,1724,1681,1639,1595,
+    1551,1507,1463,1418,1372,1326,1280,1234,1187,1140,1093,1045,997,949,900,852,
+    803,754,704,655,605,555,505,455,405,354,304,253,203,152,101,51};
+
+const int16_t table_wd1_mip9[1024]={
+    0,51,101,152,203,254,304,355,406,456,507,558,608,659,710,760,
+    811,861,912,962,1012,1063,1113,1163,1213,1264,1314,1364,1414,1464,1514,1564,
+    1613,1663,1713,1762,1812,1861,1911,1960,2009,2059,2108,2157,2206,2255,2303,2352,
+    2401,2449,2498,2546,2594,2642,2690,2738,2786,2834,2881,2929,2976,3024,3071,3118,
+    3165,3212,3258,3305,3351,3398,3444,3490,3536,3582,3627,3673,3718,3764,3809,3854,
+    3898,3943,3988,4032,4076,4120,4164,4208,4252,4295,4338,4381,4424,4467,4510,4552,
+    4595,4637,4679,4720,4762,4803,4845,4886,4926,4967,5008,5048,5088,5128,5168,5207,
+    5246,5286,5324,5363,5402,5440,5478,5516,5554,5591,5629,5666,5702,5739,5776,5812,
+    5848,5884,5919,5954,5990,6024,6059,6093,6128,6162,6195,6229,6262,6295,6328,6360,
+    6393,6425,6457,6488,6520,6551,6582,6612,6643,6673,6702,6732,6761,6790,6819,6848,
+    6876,6904,6932,6960,6987,7014,7041,7067,7093,7119,7145,7170,7196,7220,7245,7269,
+    7293,7317,7341,7364,7387,7410,7432,7454,7476,7498,7519,7540,7560,7581,7601,7621,
+    7640,7660,7679,7697,7716,7734,7752,7769,7787,7803,7820,7837,7853,7868,7884,7899,
+    7914,7928,7943,7957,7970,7984,7997,8010,8022,8034,8046,8058,8069,8080,8091,8101,
+    8111,8121,8130,8139,8148,8157,8165,8173,8180,8188,8195,8201,8208,8214,8220,8225,
+    8230,8235,8239,8244,8248,8251,8254,8257,8260,8262,8264,8266,8267,8269,8269,8270,
+    8270,8270,8269,8269,8267,8266,8264,8262,8260,8257,8254,8251,8248,8244,8239,8235,
+    8230,8225,8220,8214,8208,8201,8195,8188,8180,8173,8165,8157,8148,8139,8130,8121,
+    8111,8101,8091,8080,8069,8058,8046,8034,8022,8010,7997,7984,7970,7957,7943,7928,
+    7914,7899,7884,7868,7853,7837,7820,7803,7787,7769,7752,7734,7716,7697,7679,7660,
+    7640,7621,7601,7581,7560,7540,7519,7498,7476,7454,7432,7410,7387,7364,7341,7317,
+    7293,7269,7245,7220,7196,7170,7145,7119,7093,7067,7041,7014,6987,6960,6932,6904,
+    6876,6848,6819,6790,6761,6732,6702,6673,6643,6612,6582,6551,6520,6488,6457,6425,
+    6393,6360,6328,6295,6262,6229,6195,6162,6128,6093,6059,6024,5990,5954,5919,5884,
+    5848,5812,5776,5739,5702,5666,5629,5591,5554,5516,5478,5440,5402,5363,5324,5286,
+    5246,5207,5168,5128,5088,5048,5008,4967,4926,4886,4845,4803,4762,4720,4679,4637,
+    4595,4552,4510,4467,4424,4381,4338,4295,4252,4208,4164,4120,4076,4032,3988,3943,
+    3898,3854,3809,3764,3718,3673,3627,3582,3536,3490,3444,3398,3351,3305,3258,3212,
+    3165,3118,3071,3024,2976,2929,2881,2834,2786,2738,2690,2642,2594,2546,2498,2449,
+    2401,2352,2303,2255,2206,2157,2108,2059,2009,1960,1911,1861,1812,1762,1713,1663,
+    1613,1564,1514,1464,1414,1364,1314,1264,1213,1163,1113,1063,1012,962,912,861,
+    811,760,710,659,608,558,507,456,406,355,304,254,203,152,101,51,
+    0,-51,-101,-152,-203,-254,-304,-355,-406,-456,-507,-558,-608,-659,-710,-760,
+    -811,-861,-912,-962,-1012,-1063,-1113,-1163,-1213,-1264,-1314,-1364,-1414,-1464,-1514,-1564,
+    -1613,-1663,-1713,-1762,-1812,-1861,-1911,-1960,-2009,-2059,-2108,-2157,-2206,-2255,-2303,-2352,
+    -2401,-2449,-2498,-2546,-2594,-2642,-2690,-2738,-2786,-2834,-2881,-2929,-2976,-3024,-3071,-3118,
+    -3165,-3212,-3258,-3305,-3351,-3398,-3444,-3490,-3536,-3582,-3627,-3673,-3718,-3764,-3809,-3854,
+    -3898,-3943,-3988,-4032,-4076,-4120,-4164,-4208,-4252,-4295,-4338,-4381,-4424,-4467,-4510,-4552,
+    -4595,-4637,-4679,-4720,-4762,-4803,-4845,-4886,-4926,-4967,-5008,-5048,-5088,-5128,-5168,-5207,
+    -5246,-5286,-5324,-5363,-5402,-5440,-5478,-5516,-5554,-5591,-5629,-5666,-5702,-5739,-5776,-5812,
+    -5848,-5884,-5919,-5954,-5990,-6024,-6059,-6093,-6128,-6162,-6195,-6229,-6262,-6295,-6328,-6360,
+    -6393,-6425,-6457,-6488,-6520,-6551,-6582,-6612,-6643,-6673,-6702,-6732,-6761,-6790,-6819,-6848,
+    -6876,-6904,-6932,-6960,-6987,-7014,-7041,-7067,-7093,-7119,-7145,-7170,-7196,-7220,-7245,-7269,
+    -7293,-7317,-7341,-7364,-7387,-7410,-7432,-7454,-7476,-7498,-7519,-7540,-7560,-7581,-7601,-7621,
+    -7640,-7660,-7679,-7697,-7716,-7734,-7752,-7769,-7787,-7803,-7820,-7837,-7853,-7868,-7884,-7899,
+    -7914,-7928,-7943,-7957,-7970,-7984,-7997,-8010,-8022,-8034,-8046,-8058,-8069,-8080,-8091,-8101,
+    -8111,-8121,-8130,-8139,-8148,-8157,-8165,-8173,-8180,-8188,-8195,-8201,-8208,-8214,-8220,-8225,
+    -8230,-8235,-8239,-8244,-8248,-8251,-8254,-8257,-8260,-8262,-8264,-8266,-8267,-8269,-8269,-8270,
+    -8270,-8270,-8269,-8269,-8267,-8266,-8264,-8262,-8260,-8257,-8254,-8251,-8248,-8244,-8239,-8235,
+    -8230,-8225,-8220,-8214,-8208,-8201,-8195,-8188,-8180,-8173,-8165,-8157,-8148,-8139,-8130,-8121,
+    -8111,-8101,-8091,-8080,-8069,-8058,-8046,-8034,-8022,-8010,-7997,-7984,-7970,-7957,-7943,-7928,
+    -7914,-7899,-7884,-7868,-7853,-7837,-7820,-7803,-7787,-7769,-7752,-7734,-7716,-7697,-7679,-7660,
+    -7640,-7621,-7601,-7581,-7560,-7540,-7519,-7498,-7476,-7454,-7432,-7410,-7387,-7364,-7341,-7317,
+    -7293,-7269,-7245,-7220,-7196,-7170,-7145,-7119,-7093,-7067,-7041,-7014,-6987,-6960,-6932,-6904,
+    -6876,-6848,-6819,-6790,-6761,-6732,-6702,-6673,-6643,-6612,-6582,-6551,-6520,-6488,-6457,-6425,
+    -6393,-6360,-6328,-6295,-6262,-6229,-6195,-6162,-6128,-6093,-6059,-6024,-5990,-5954,-5919,-5884,
+    -5848,-5812,-5776,-5739,-5702,-5666,-5629,-5591,-5554,-5516,-5478,-5440,-5402,-5363,-5324,-5286,
+    -5246,-5207,-5168,-5128,-5088,-5048,-5008,-4967,-4926,-4886,-4845,-4803,-4762,-4720,-4679,-4637,
+    -4595,-4552,-4510,-4467,-4424,-4381,-4338,-4295,-4252,-4208,-4164,-4120,-4076,-4032,-3988,-3943,
+    -3898,-3854,-3809,-3764,-3718,-3673,-3627,-3582,-3536,-3490,-3444,-3398,-3351,-3305,-3258,-3212,
+    -3165,-3118,-3071,-3024,-2976,-2929,-2881,-2834,-2786,-2738,-2690,-2642,-2594,-2546,-2498,-2449,
+    -2401,-2352,-2303,-2255,-2206,-2157,-2108,-2059,-2009,-1960,-1911,-1861,-1812,-1762,-1713,-1663,
+    -1613,-1564,-1514,-1464,-1414,-1364,-1314,-1264,-1213,-1163,-1113,-1063,-1012,-962,-912,-861,
+    -811,-760,-710,-659,-608,-558,-507,-456,-406,-355,-304,-254,-203,-152,-101,-51};
+
+const int16_t table_wd2_mip7[1024]={
+    22663,22453,22241,22026,21809,21590,21368,21145,20919,20692,20462,20231,19999,19764,19529,19291,
+    19053,18813,18572,18330,18087,17843,17599,17353,17107,16861,16613,16366,16118,15870,15621,15373,
+    15125,14876,14628,14380,14132,13885,13638,13392,13146,12902,12657,12414,12172,11930,11690,11450,
+    11212,10975,10740,10506,10273,10041,9812,9584,9357,9133,8910,8689,8469,8252,8037,7824,
+    7613,7404,7197,6993,6790,6590,6393,6198,6005,5814,5627,5441,5258,5078,4901,4726,
+    4553,4384,4217,4053,3891,3732,3576,3423,3273,3125,2980,2838,2699,2563,2429,2299,
+    2171,2046,1924,1804,1688,1574,1463,1355,1250,1148,1048,951,857,765,676,590,
+    507,426,348,272,199,129,61,-5,-68,-128,-186,-242,-295,-346,-395,-442,
+    -486,-528,-568,-606,-642,-676,-707,-737,-765,-791,-815,-837,-858,-877,-894,-909,
+    -923,-935,-946,-955,-963,-970,-975,-979,-981,-983,-983,-982,-979,-976,-972,-967,
+    -961,-954,-946,-937,-928,-917,-906,-895,-883,-870,-856,-842,-828,-813,-798,-782,
+    -767,-750,-734,-717,-700,-683,-666,-648,-631,-613,-595,-578,-560,-542,-525,-507,
+    -490,-473,-456,-439,-422,-406,-389,-373,-357,-342,-326,-311,-297,-282,-268,-255,
+    -241,-228,-216,-204,-192,-180,-169,-158,-148,-138,-128,-119,-111,-102,-94,-87,
+    -79,-72,-66,-60,-54,-49,-44,-39,-35,-31,-27,-23,-20,-17,-15,-13,
+    -11,-9,-7,-6,-4,-3,-3,-2,-1,-1,-1,0,0,0,0,0,
+    0,0,0,0,0,0,1,1,1,2,3,3,4,6,7,9,
+    11,13,15,17,20,23,27,31,35,39,44,49,54,60,66,72,
+    79,87,94,102,111,119,128,138,148,158,169,180,192,204,216,228,
+    241,255,268,282,297,311,326,342,357,373,389,406,422,439,456,473,
+    490,507,525,542,560,578,595,613,631,648,666,683,700,717,734,750,
+    767,782,798,813,828,842,856,870,883,895,906,917,928,937,946,954,
+    961,967,972,976,979,982,983,983,981,979,975,970,963,955,946,935,
+    923,909,894,877,858,837,815,791,765,737,707,676,642,606,568,528,
+    486,442,395,346,295,242,186,128,68,5,-61,-129,-199,-272,-348,-426,
+    -507,-590,-676,-765,-857,-951,-1048,-1148,-1250,-1355,-1463,-1574,-1688,-1804,-1924,-2046,
+    -2171,-2299,-2429,-2563,-2699,-2838,-2980,-3125,-3273,-3423,-3576,-3732,-3891,-4053,-4217,-4384,
+    -4553,-4726,-4901,-5078,-5258,-5441,-5627,-5814,-6005,-6198,-6393,-6590,-6790,-6993,-7197,-7404,
+    -7613,-7824,-8037,-8252,-8469,-8689,-8910,-9133,-9357,-9584,-9812,-10041,-10273,-10506,-10740,-10975,
+    -11212,-11450,-11690,-11930,-12172,-12414,-12657,-12902,-13146,-13392,-13638,-13885,-14132,-14380,-14628,-14876,
+    -15125,-15373,-15621,-15870,-16118,-16366,-16613,-16861,-17107,-17353,-17599,-17843,-18087,-18330,-18572,-18813,
+    -19053,-19291,-19529,-19764,-19999,-20231,-20462,-20692,-20919,-21145,-21368,-21590,-21809,-22026,-22241,-22453,
+    -22663,-22870,-23075,-23277,-23476,-23672,-23866,-24056,-24243,-24427,-24608,-24786,-24960,-25130,-25298,-25461,
+    -25621,-25778,-25930,-26079,-26224,-26364,-26501,-26634,-26763,-26887,-27008,-27124,-27235,-27343,-27446,-27544,
+    -27638,-27728,-27813,-27893,-27969,-28040,-28107,-28168,-28225,-28277,-28325,-28367,-28405,-28438,-28466,-28489,
+    -28507,-28520,-28529,-28532,-28531,-28524,-28513,-28497,-28476,-28449,-28418,-28383,-28342,-28296,-28246,-28190,
+    -28130,-28065,-27996,-27921,-27842,-27758,-27670,-27577,-27479,-27377,-27270,-27159,-27043,-26923,-26799,-26671,
+    -26538,-26401,-26260,-26114,-25965,-25812,-25655,-25494,-25329,-25161,-24989,-24813,-24634,-24451,-24265,-24076,
+    -23884,-23688,-23489,-23288,-23083,-22876,-22665,-22453,-22237,-22019,-21799,-21576,-21351,-21124,-20894,-20663,
+    -20430,-20195,-19958,-19719,-19479,-19238,-18995,-18751,-18506,-18259,-18012,-17764,-17514,-17264,-17014,-16763,
+    -16511,-16259,-16007,-15755,-15502,-15249,-14997,-14745,-14493,-14241,-13990,-13739,-13489,-13239,-12990,-12742,
+    -12495,-12249,-12005,-11761,-11518,-11277,-11038,-10799,-10563,-10328,-10094,-9863,-9633,-9405,-9179,-8955,
+    -8733,-8514,-8296,-8081,-7868,-7658,-7450,-7244,-7041,-6841,-6643,-6448,-6256,-6066,-5879,-5696,
+    -5515,-5336,-5161,-4989,-4820,-4653,-4490,-4330,-4173,-4019,-3869,-3721,-3576,-3435,-3297,-3162,
+    -3030,-2902,-2776,-2654,-2535,-2419,-2306,-2197,-2090,-1987,-1887,-1790,-1696,-1605,-1517,-1432,
+    -1350,-1271,-1195,-1122,-1052,-984,-919,-857,-798,-742,-688,-636,-587,-541,-497,-455,
+    -416,-379,-344,-311,-281,-252,-225,-201,-178,-157,-137,-120,-103,-89,-76,-64,
+    -53,-44,-36,-29,-23,-17,-13,-10,-7,-4,-3,-2,-1,0,0,0,
+    0,0,0,0,1,2,3,4,7,10,13,17,23,29,36,44,
+    53,64,76,89,103,120,137,157,178,201,225,252,281,311,344,379,
+    416,455,497,541,587,636,688,742,798,857,919,984,1052,1122,1195,1271,
+    1350,1432,1517,1605,1696,1790,1887,1987,2090,2197,2306,2419,2535,2654,2776,2902,
+    3030,3162,3297,3435,3576,3721,3869,4019,4173,4330,4490,4653,4820,4989,5161,5336,
+    5515,5696,5879,6066,6256,6448,6643,6841,7041,7244,7450,7658,7868,8081,8296,8514,
+    8733,8955,9179,9405,9633,9863,10094,10328,10563,10799,11038,11277,11518,11761,12005,12249,
+    12495,12742,12990,13239,13489,13739,13990,14241,14493,14745,14997,15249,15502,15755,16007,16259,
+    16511,16763,17014,17264,17514,17764,18012,18259,18506,18751,18995,19238,19479,19719,19958,20195,
+    20430,20663,20894,21124,21351,21576,21799,22019,22237,22453,22665,22876,23083,23288,23489,23688,
+    23884,24076,24265,24451,24634,24813,24989,25161,25329,25494,25655,25812,25965,26114,26260,26401,
+    26538,26671,26799,26923,27043,27159,27270,27377,27479,27577,27670,27758,27842,27921,27996,28065,
+    28130,28190,28246,28296,28342,28383,28418,28449,28476,28497,28513,28524,28531,28532,28529,28520,
+    28507,28489,28466,28438,28405,28367,28325,28277,28225,28168,28107,28040,27969,27893,27813,27728,
+    27638,27544,27446,27343,27235,27124,27008,26887,26763,26634,26501,26364,26224,26079,25930,25778,
+    25621,25461,25298,25130,24960,24786,24608,24427,24243,24056,23866,23672,23476,23277,23075,22870};
+
+const int16_t table_wd2_mip8[1024]={
+    16997,16893,16787,16682,16575,16468,16360,16252,16144,16035,15925,15815,15704,15593,15482,15370,
+    15257,15145,15032,14918,14804,14690,14576,14461,14346,14231,14116,14000,13884,13768,13651,13535,
+    13418,13302,13185,13068,12951,12833,12716,12599,12482,12364,12247,12130,12012,11895,11778,11661,
+    11544,11427,11310,11193,11077,10960,10844,10728,10612,10496,10381,10266,10151,10036,9922,9808,
+    9694,9580,9467,9354,9242,9130,9018,8907,8796,8685,8575,8465,8356,8247,8139,8031,
+    7924,7817,7711,7605,7500,7395,7291,7187,7084,6981,6879,6778,6677,6577,6478,6379,
+    6281,6183,6087,5990,5895,5800,5706,5612,5520,5428,5336,5246,5156,5067,4978,4891,
+    4804,4718,4632,4548,4464,4381,4299,4217,4136,4057,3977,3899,3822,3745,3669,3594,
+    3520,3447,3374,3303,3232,3162,3093,3024,2957,2890,2824,2760,2695,2632,2570,2508,
+    2448,2388,2329,2271,2213,2157,2101,2046,1993,1939,1887,1836,1785,1736,1687,1639,
+    1591,1545,1499,1455,1411,1368,1325,1284,1243,1203,1164,1126,1088,1052,1016,980,
+    946,912,880,847,816,785,755,726,698,670,643,617,591,566,542,518,
+    495,473,451,430,410,390,371,353,335,317,301,285,269,254,240,226,
+    212,200,187,176,164,153,143,133,124,115,106,98,90,83,76,70,
+    64,58,53,47,43,38,34,30,27,24,21,18,16,13,11,10,
+    8,7,5,4,3,3,2,1,1,1,0,0,0,0,0,0,
+    0,0,0,0,0,0,0,-1,-1,-1,-2,-3,-3,-4,-5,-7,
+    -8,-10,-11,-13,-16,-18,-21,-24,-27,-30,-34,-38,-43,-47,-53,-58,
+    -64,-70,-76,-83,-90,-98,-106,-115,-124,-133,-143,-153,-164,-176,-187,-200,
+    -212,-226,-240,-254,-269,-285,-301,-317,-335,-353,-371,-390,-410,-430,-451,-473,
+    -495,-518,-542,-566,-591,-617,-643,-670,-698,-726,-755,-785,-816,-847,-880,-912,
+    -946,-980,-1016,-1052,-1088,-1126,-1164,-1203,-1243,-1284,-1325,-1368,-1411,-1455,-1499,-1545,
+    -1591,-1639,-1687,-1736,-1785,-1836,-1887,-1939,-1993,-2046,-2101,-2157,-2213,-2271,-2329,-2388,
+    -2448,-2508,-2570,-2632,-2695,-2760,-2824,-2890,-2957,-3024,-3093,-3162,-3232,-3303,-3374,-3447,
+    -3520,-3594,-3669,-3745,-3822,-3899,-3977,-4057,-4136,-4217,-4299,-4381,-4464,-4548,-4632,-4718,
+    -4804,-4891,-4978,-5067,-5156,-5246,-5336,-5428,-5520,-5612,-5706,-5800,-5895,-5990,-6087,-6183,
+    -6281,-6379,-6478,-6577,-6677,-6778,-6879,-6981,-7084,-7187,-7291,-7395,-7500,-7605,-7711,-7817,
+    -7924,-8031,-8139,-8247,-8356,-8465,-8575,-8685,-8796,-8907,-9018,-9130,-9242,-9354,-9467,-9580,
+    -9694,-9808,-9922,-10036,-10151,-10266,-10381,-10496,-10612,-10728,-10844,-10960,-11077,-11193,-11310,-11427,
+    -11544,-11661,-11778,-11895,-12012,-12130,-12247,-12364,-12482,-12599,-12716,-12833,-12951,-13068,-13185,-13302,
+    -13418,-13535,-13651,-13768,-13884,-14000,-14116,-14231,-14346,-14461,-14576,-14690,-14804,-14918,-15032,-15145,
+    -15257,-15370,-15482,-15593,-15704,-15815,-15925,-16035,-16144,-16252,-16360,-16468,-16575,-16682,-16787,-16893,
+    -16997,-17101,-17204,-17307,-17409,-17510,-17611,-17711,-17810,-17908,-18006,-18102,-18198,-18293,-18387,-18481,
+    -18573,-18665,-18756,-18846,-18934,-19022,-19109,-19195,-19280,-19364,-19447,-19529,-19610,-19690,-19769,-19846,
+    -19923,-19998,-20073,-20146,-20218,-20289,-20358,-20427,-20494,-20560,-20625,-20688,-20751,-20812,-20871,-20930,
+    -20987,-21043,-21097,-21150,-21202,-21252,-21301,-21349,-21395,-21440,-21483,-21525,-21566,-21605,-21642,-21678,
+    -21713,-21746,-21777,-21808,-21836,-21863,-21889,-21912,-21935,-21956,-21975,-21992,-22008,-22023,-22036,-22047,
+    -22057,-22065,-22071,-22076,-22079,-22080,-22080,-22078,-22074,-22069,-22062,-22053,-22043,-22031,-22017,-22002,
+    -21984,-21965,-21945,-21923,-21898,-21873,-21845,-21816,-21785,-21752,-21718,-21682,-21644,-21604,-21562,-21519,
+    -21474,-21428,-21379,-21329,-21277,-21223,-21168,-21111,-21052,-20991,-20929,-20865,-20799,-20731,-20662,-20590,
+    -20517,-20443,-20367,-20288,-20209,-20127,-20044,-19959,-19872,-19784,-19694,-19602,-19509,-19414,-19317,-19218,
+    -19118,-19016,-18913,-18808,-18701,-18593,-18483,-18371,-18258,-18143,-18027,-17909,-17789,-17668,-17545,-17421,
+    -17295,-17167,-17039,-16908,-16776,-16643,-16508,-16371,-16233,-16094,-15953,-15811,-15667,-15522,-15376,-15228,
+    -15079,-14928,-14776,-14623,-14468,-14312,-14155,-13997,-13837,-13676,-13513,-13350,-13185,-13019,-12852,-12684,
+    -12514,-12343,-12172,-11999,-11825,-11649,-11473,-11296,-11118,-10938,-10758,-10577,-10394,-10211,-10027,-9842,
+    -9656,-9469,-9281,-9092,-8903,-8712,-8521,-8329,-8136,-7943,-7748,-7553,-7358,-7161,-6964,-6767,
+    -6568,-6369,-6170,-5970,-5769,-5568,-5366,-5164,-4961,-4758,-4554,-4350,-4146,-3941,-3736,-3530,
+    -3324,-3118,-2911,-2704,-2497,-2290,-2083,-1875,-1667,-1459,-1251,-1043,-834,-626,-417,-209,
+    0,209,417,626,834,1043,1251,1459,1667,1875,2083,2290,2497,2704,2911,3118,
+    3324,3530,3736,3941,4146,4350,4554,4758,4961,5164,5366,5568,5769,5970,6170,6369,
+    6568,6767,6964,7161,7358,7553,7748,7943,8136,8329,8521,8712,8903,9092,9281,9469,
+    9656,9842,10027,10211,10394,10577,10758,10938,11118,11296,11473,11649,11825,11999,12172,12343,
+    12514,12684,12852,13019,13185,13350,13513,13676,13837,13997,14155,14312,14468,14623,14776,14928,
+    15079,15228,15376,15522,15667,15811,15953,16094,16233,16371,16508,16643,16776,16908,17039,17167,
+    17295,17421,17545,17668,17789,17909,18027,18143,18258,18371,18483,18593,18701,18808,18913,19016,
+    19118,19218,19317,19414,19509,19602,19694,19784,19872,19959,20044,20127,20209,20288,20367,20443,
+    20517,20590,20662,20731,20799,20865,20929,20991,21052,21111,21168,21223,21277,21329,21379,21428,
+    21474,21519,21562,21604,21644,21682,21718,21752,21785,21816,21845,21873,21898,21923,21945,21965,
+    21984,22002,22017,22031,22043,22053,22062,22069,22074,22078,22080,22080,22079,22076,22071,22065,
+    22057,22047,22036,22023,22008,21992,21975,21956,21935,21912,21889,21863,21836,21808,21777,21746,
+    21713,21678,21642,21605,21566,21525,21483,21440,21395,21349,21301,21252,21202,21150,21097,21043,
+    20987,20930,20871,20812,20751,20688,20625,20560,20494,20427,20358,20289,20218,20146,20073,19998,
+    19923,19846,19769,19690,19610,19529,19447,19364,19280,19195,19109,19022,18934,18846,18756,18665,
+    18573,18481,18387,18293,18198,18102,18006,17908,17810,17711,17611,17510,17409,17307,17204,17101};
+
+const int16_t table_wd2_mip9[1024]={
+    16997,16997,16996,16994,16992,16989,16986,16982,16977,16971,16965,16959,16951,16943,16935,16925,
+    16915,16905,16894,16882,16869,16856,16843,16828,16813,16798,16781,16764,16747,16729,16710,16691,
+    16671,16650,16629,16607,16584,16561,16537,16513,16488,16462,16436,16409,16382,16353,16325,16295,
+    16265,16235,16204,16172,16139,16106,16073,16038,16004,15968,15932,15896,15858,15820,15782,15743,
+    15703,15663,15622,15581,15539,15496,15453,15410,15365,15320,15275,15229,15182,15135,15087,15039,
+    14990,14941,14891,14840,14789,14737,14685,14632,14579,14525,14471,14416,14360,14304,14247,14190,
+    14133,14074,14016,13956,13897,13836,13776,13714,13652,13590,13527,13464,13400,13335,13270,13205,
+    13139,13073,13006,12938,12870,12802,12733,12664,12594,12524,12453,12382,12310,12238,12165,12092,
+    12019,11945,11870,11796,11720,11645,11568,11492,11415,11337,11259,11181,11102,11023,10943,10863,
+    10783,10702,10621,10539,10457,10375,10292,10209,10125,10041,9957,9872,9787,9702,9616,9530,
+    9443,9356,9269,9181,9093,9005,8917,8828,8738,8649,8559,8468,8378,8287,8196,8104,
+    8012,7920,7828,7735,7642,7549,7455,7361,7267,7173,7078,6983,6888,6792,6697,6601,
+    6505,6408,6311,6214,6117,6020,5922,5824,5726,5628,5529,5431,5332,5233,5133,5034,
+    4934,4834,4734,4634,4533,4433,4332,4231,4130,4029,3927,3826,3724,3622,3520,3418,
+    3316,3214,3111,3009,2906,2803,2700,2597,2494,2391,2287,2184,2081,1977,1873,1770,
+    1666,1562,1458,1354,1250,1146,1042,938,834,730,626,521,417,313,209,104,
+    0,-104,-209,-313,-417,-521,-626,-730,-834,-938,-1042,-1146,-1250,-1354,-1458,-1562,
+    -1666,-1770,-1873,-1977,-2081,-2184,-2287,-2391,-2494,-2597,-2700,-2803,-2906,-3009,-3111,-3214,
+    -3316,-3418,-3520,-3622,-3724,-3826,-3927,-4029,-4130,-4231,-4332,-4433,-4533,-4634,-4734,-4834,
+    -4934,-5034,-5133,-5233,-5332,-5431,-5529,-5628,-5726,-5824,-5922,-6020,-6117,-6214,-6311,-6408,
+    -6505,-6601,-6697,-6792,-6888,-6983,-7078,-7173,-7267,-7361,-7455,-7549,-7642,-7735,-7828,-7920,
+    -8012,-8104,-8196,-8287,-8378,-8468,-8559,-8649,-8738,-8828,-8917,-9005,-9093,-9181,-9269,-9356,
+    -9443,-9530,-9616,-9702,-9787,-9872,-9957,-10041,-10125,-10209,-10292,-10375,-10457,-10539,-10621,-10702,
+    -10783,-10863,-10943,-11023,-11102,-11181,-11259,-11337,-11415,-11492,-11568,-11645,-11720,-11796,-11870,-11945,
+    -12019,-12092,-12165,-12238,-12310,-12382,-12453,-12524,-12594,-12664,-12733,-12802,-12870,-12938,-13006,-13073,
+    -13139,-13205,-13270,-13335,-13400,-13464,-13527,-13590,-13652,-13714,-13776,-13836,-13897,-13956,-14016,-14074,
+    -14133,-14190,-14247,-14304,-14360,-14416,-14471,-14525,-14579,-14632,-14685,-14737,-14789,-14840,-14891,-14941,
+    -14990,-15039,-15087,-15135,-15182,-15229,-15275,-15320,-15365,-15410,-15453,-15496,-15539,-15581,-15622,-15663,
+    -15703,-15743,-15782,-15820,-15858,-15896,-15932,-15968,-16004,-16038,-16073,-16106,-16139,-16172,-16204,-16235,
+    -16265,-16295,-16325,-16353,-16382,-16409,-16436,-16462,-16488,-16513,-16537,-16561,-16584,-16607,-16629,-16650,
+    -16671,-16691,-16710,-16729,-16747,-16764,-16781,-16798,-16813,-16828,-16843,-16856,-16869,-16882,-16894,-16905,
+    -16915,-16925,-16935,-16943,-16951,-16959,-16965,-16971,-16977,-16982,-16986,-16989,-16992,-16994,-16996,-16997,
+    -16997,-16997,-16996,-16994,-16992,-16989,-16986,-16982,-16977,-16971,-16965,-16959,-16951,-16943,-16935,-16925,
+    -16915,-16905,-16894,-16882,-16869,-16856,-16843,-16828,-16813,-16798,-16781,-16764,-16747,-16729,-16710,-16691,
+    -16671,-16650,-16629,-16607,-16584,-16561,-16537,-16513,-16488,-16462,-16436,-16409,-16382,-16353,-16325,-16295,
+    -16265,-16235,-16204,-16172,-16139,-16106,-16073,-16038,-16004,-15968,-15932,-15896,-15858,-15820,-15782,-15743,
+    -15703,-15663,-15622,-15581,-15539,-15496,-15453,-15410,-15365,-15320,-15275,-15229,-15182,-15135,-15087,-15039,
+    -14990,-14941,-14891,-14840,-14789,-14737,-14685,-14632,-14579,-14525,-14471,-14416,-14360,-14304,-14247,-14190,
+    -14133,-14074,-14016,-13956,-13897,-13836,-13776,-13714,-13652,-13590,-13527,-13464,-13400,-13335,-13270,-13205,
+    -13139,-13073,-13006,-12938,-12870,-12802,-12733,-12664,-12594,-12524,-12453,-12382,-12310,-12238,-12165,-12092,
+    -12019,-11945,-11870,-11796,-11720,-11645,-11568,-11492,-11415,-11337,-11259,-11181,-11102,-11023,-10943,-10863,
+    -10783,-10702,-10621,-10539,-10457,-10375,-10292,-10209,-10125,-10041,-9957,-9872,-9787,-9702,-9616,-9530,
+    -9443,-9356,-9269,-9181,-9093,-9005,-8917,-8828,-8738,-8649,-8559,-8468,-8378,-8287,-8196,-8104,
+    -8012,-7920,-7828,-7735,-7642,-7549,-7455,-7361,-7267,-7173,-7078,-6983,-6888,-6792,-6697,-6601,
+    -6505,-6408,-6311,-6214,-6117,-6020,-5922,-5824,-5726,-5628,-5529,-5431,-5332,-5233,-5133,-5034,
+    -4934,-4834,-4734,-4634,-4533,-4433,-4332,-4231,-4130,-4029,-3927,-3826,-3724,-3622,-3520,-3418,
+    -3316,-3214,-3111,-3009,-2906,-2803,-2700,-2597,-2494,-2391,-2287,-2184,-2081,-1977,-1873,-1770,
+    -1666,-1562,-1458,-1354,-1250,-1146,-1042,-938,-834,-730,-626,-521,-417,-313,-209,-104,
+    0,104,209,313,417,521,626,730,834,938,1042,1146,1250,1354,1458,1562,
+    1666,1770,1873,1977,2081,2184,2287,2391,2494,2597,2700,2803,2906,3009,3111,3214,
+    3316,3418,3520,3622,3724,3826,3927,4029,4130,4231,4332,4433,4533,4634,4734,4834,
+    4934,5034,5133,5233,5332,5431,5529,5628,5726,5824,5922,6020,6117,6214,6311,6408,
+    6505,6601,6697,6792,6888,6983,7078,7173,7267,7361,7455,7549,7642,7735,7828,7920,
+    8012,8104,8196,8287,8378,8468,8559,8649,8738,8828,8917,9005,9093,9181,9269,9356,
+    9443,9530,9616,9702,9787,9872,9957,10041,10125,10209,10292,10375,10457,10539,10621,10702,
+    10783,10863,10943,11023,11102,11181,11259,11337,11415,11492,11568,11645,11720,11796,11870,11945,
+    12019,12092,12165,12238,12310,12382,12453,12524,12594,12664,12733,12802,12870,12938,13006,13073,
+    13139,13205,13270,13335,13400,13464,13527,13590,13652,13714,13776,13836,13897,13956,14016,14074,
+    14133,14190,14247,14304,14360,14416,14471,14525,14579,14632,14685,14737,14789,14840,14891,14941,
+    14990,15039,15087,15135,15182,15229,15275,15320,15365,15410,15453,15496,15539,15581,15622,15663,
+    15703,15743,15782,15820,15858,15896,15932,15968,16004,16038,16073,16106,16139,16172,16204,16235,
+    16265,16295,16325,16353,16382,16409,16436,16462,16488,16513,16537,16561,16584,16607,16629,16650,
+    16671,16691,16710,16729,16747,16764,16781,16798,16813,16828,16843,16856,16869,16882,16894,16905,
+    16915,16925,16935,16943,16951,16959,16965,16971,16977,16982,16986,16989,16992,16994,16996,16997};
+
+const int16_t table_wd3_mip7[1024]={
+    -13068,-12584,-12097,-11605,-11110,-10611,-10108,-9602,-9093,-8581,-8066,-7549,-7029,-6507,-5983,-5458,
+    -4930,-4402,-3872,-3341,-2809,-2277,-1744,-1211,-678,-145,388,920,1451,1982,2511,3039,
+    3566,4091,4614,5136,5655,6172,6686,7198,7707,8212,8715,9214,9710,10202,10690,11175,
+    11655,12130,12602,13069,13531,13988,14440,14887,15329,15766,16197,16622,17042,17455,17863,18265,
+    18660,19049,19432,19808,20178,20541,20897,21247,21589,21925,22253,22575,22889,23196,23495,23787,
+    24072,24349,24619,24881,25136,25382,25622,25853,26077,26293,26502,26702,26895,27080,27258,27427,
+    27589,27743,27889,28028,28158,28282,28397,28505,28605,28697,28782,28860,28930,28992,29047,29095,
+    29135,29169,29195,29214,29225,29230,29228,29219,29204,29181,29152,29116,29074,29025,28970,28909,
+    28842,28768,28689,28603,28512,28415,28313,28205,28091,27972,27848,27719,27585,27445,27301,27152,
+    26999,26841,26678,26512,26341,26165,25986,25803,25616,25426,25231,25034,24832,24628,24420,24210,
+    23996,23779,23560,23338,23113,22886,22656,22424,22190,21954,21715,21475,21233,20989,20744,20497,
+    20248,19998,19747,19494,19241,18986,18730,18473,18216,17957,17698,17439,17178,16918,16656,16395,
+    16133,15870,15608,15345,15082,14820,14557,14294,14031,13769,13506,13244,12982,12720,12459,12197,
+    11937,11676,11416,11157,10898,10639,10381,10124,9867,9610,9354,9099,8844,8590,8336,8083,
+    7831,7579,7328,7077,6827,6578,6329,6080,5832,5585,5338,5092,4846,4600,4355,4111,
+    3867,3623,3380,3137,2894,2652,2410,2168,1927,1685,1444,1203,962,722,481,241,
+    0,-241,-481,-722,-962,-1203,-1444,-1685,-1927,-2168,-2410,-2652,-2894,-3137,-3380,-3623,
+    -3867,-4111,-4355,-4600,-4846,-5092,-5338,-5585,-5832,-6080,-6329,-6578,-6827,-7077,-7328,-7579,
+    -7831,-8083,-8336,-8590,-8844,-9099,-9354,-9610,-9867,-10124,-10381,-10639,-10898,-11157,-11416,-11676,
+    -11937,-12197,-12459,-12720,-12982,-13244,-13506,-13769,-14031,-14294,-14557,-14820,-15082,-15345,-15608,-15870,
+    -16133,-16395,-16656,-16918,-17178,-17439,-17698,-17957,-18216,-18473,-18730,-18986,-19241,-19494,-19747,-19998,
+    -20248,-20497,-20744,-20989,-21233,-21475,-21715,-21954,-22190,-22424,-22656,-22886,-23113,-23338,-23560,-23779,
+    -23996,-24210,-24420,-24628,-24832,-25034,-25231,-25426,-25616,-25803,-25986,-26165,-26341,-26512,-26678,-26841,
+    -26999,-27152,-27301,-27445,-27585,-27719,-27848,-27972,-28091,-28205,-28313,-28415,-28512,-28603,-28689,-28768,
+    -28842,-28909,-28970,-29025,-29074,-29116,-29152,-29181,-29204,-29219,-29228,-29230,-29225,-29214,-29195,-29169,
+    -29135,-29095,-29047,-28992,-28930,-28860,-28782,-28697,-28605,-28505,-28397,-28282,-28158,-28028,-27889,-27743,
+    -27589,-27427,-27258,-27080,-26895,-26702,-26502,-26293,-26077,-25853,-25622,-25382,-25136,-24881,-24619,-24349,
+    -24072,-23787,-23495,-23196,-22889,-22575,-22253,-21925,-21589,-21247,-20897,-20541,-20178,-19808,-19432,-19049,
+    -18660,-18265,-17863,-17455,-17042,-16622,-16197,-15766,-15329,-14887,-14440,-13988,-13531,-13069,-12602,-12130,
+    -11655,-11175,-10690,-10202,-9710,-9214,-8715,-8212,-7707,-7198,-6686,-6172,-5655,-5136,-4614,-4091,
+    -3566,-3039,-2511,-1982,-1451,-920,-388,145,678,1211,1744,2277,2809,3341,3872,4402,
+    4930,5458,5983,6507,7029,7549,8066,8581,9093,9602,10108,10611,11110,11605,12097,12584,
+    13068,13547,14021,14490,14955,15414,15868,16317,16760,17197,17628,18053,18471,18883,19289,19688,
+    20080,20464,20842,21212,21575,21930,22277,22617,22948,23271,23586,23893,24191,24481,24761,25034,
+    25297,25551,25796,26032,26259,26476,26684,26883,27072,27251,27421,27581,27731,27872,28003,28124,
+    28235,28336,28427,28508,28580,28641,28693,28734,28766,28787,28799,28801,28792,28774,28747,28709,
+    28662,28605,28538,28462,28376,28281,28177,28063,27940,27808,27666,27516,27357,27189,27012,26827,
+    26634,26432,26221,26003,25777,25543,25301,25052,24795,24531,24259,23981,23696,23404,23106,22801,
+    22490,22173,21850,21522,21188,20848,20504,20154,19800,19441,19078,18710,18339,17963,17584,17201,
+    16815,16426,16035,15640,15243,14844,14443,14040,13635,13228,12821,12412,12003,11593,11183,10772,
+    10361,9951,9541,9131,8722,8315,7908,7503,7099,6697,6297,5899,5504,5111,4721,4334,
+    3950,3569,3191,2817,2447,2081,1719,1362,1009,660,316,-22,-356,-685,-1008,-1325,
+    -1637,-1943,-2244,-2538,-2826,-3108,-3383,-3652,-3914,-4169,-4418,-4660,-4894,-5122,-5342,-5556,
+    -5761,-5960,-6151,-6334,-6510,-6678,-6839,-6991,-7136,-7273,-7403,-7524,-7638,-7744,-7841,-7931,
+    -8013,-8087,-8154,-8212,-8262,-8305,-8340,-8367,-8386,-8397,-8401,-8397,-8386,-8367,-8341,-8307,
+    -8266,-8218,-8162,-8100,-8031,-7954,-7871,-7781,-7685,-7582,-7472,-7357,-7235,-7107,-6974,-6834,
+    -6689,-6538,-6382,-6221,-6055,-5884,-5708,-5527,-5342,-5153,-4959,-4762,-4560,-4355,-4147,-3935,
+    -3720,-3502,-3281,-3058,-2832,-2604,-2374,-2142,-1908,-1673,-1436,-1199,-960,-721,-481,-241,
+    0,241,481,721,960,1199,1436,1673,1908,2142,2374,2604,2832,3058,3281,3502,
+    3720,3935,4147,4355,4560,4762,4959,5153,5342,5527,5708,5884,6055,6221,6382,6538,
+    6689,6834,6974,7107,7235,7357,7472,7582,7685,7781,7871,7954,8031,8100,8162,8218,
+    8266,8307,8341,8367,8386,8397,8401,8397,8386,8367,8340,8305,8262,8212,8154,8087,
+    8013,7931,7841,7744,7638,7524,7403,7273,7136,6991,6839,6678,6510,6334,6151,5960,
+    5761,5556,5342,5122,4894,4660,4418,4169,3914,3652,3383,3108,2826,2538,2244,1943,
+    1637,1325,1008,685,356,22,-316,-660,-1009,-1362,-1719,-2081,-2447,-2817,-3191,-3569,
+    -3950,-4334,-4721,-5111,-5504,-5899,-6297,-6697,-7099,-7503,-7908,-8315,-8722,-9131,-9541,-9951,
+    -10361,-10772,-11183,-11593,-12003,-12412,-12821,-13228,-13635,-14040,-14443,-14844,-15243,-15640,-16035,-16426,
+    -16815,-17201,-17584,-17963,-18339,-18710,-19078,-19441,-19800,-20154,-20504,-20848,-21188,-21522,-21850,-22173,
+    -22490,-22801,-23106,-23404,-23696,-23981,-24259,-24531,-24795,-25052,-25301,-25543,-25777,-26003,-26221,-26432,
+    -26634,-26827,-27012,-27189,-27357,-27516,-27666,-27808,-27940,-28063,-28177,-28281,-28376,-28462,-28538,-28605,
+    -28662,-28709,-28747,-28774,-28792,-28801,-28799,-28787,-28766,-28734,-28693,-28641,-28580,-28508,-28427,-28336,
+    -28235,-28124,-28003,-27872,-27731,-27581,-27421,-27251,-27072,-26883,-26684,-26476,-26259,-26032,-25796,-25551,
+    -25297,-25034,-24761,-24481,-24191,-23893,-23586,-23271,-22948,-22617,-22277,-21930,-21575,-21212,-20842,-20464,
+    -20080,-19688,-19289,-18883,-18471,-18053,-17628,-17197,-16760,-16317,-15868,-15414,-14955,-14490,-14021,-13547};
+
+const int16_t table_wd3_mip8[1024]={
+    0,241,481,721,962,1202,1442,1682,1921,2161,2399,2638,2876,3114,3351,3588,
+    3824,4060,4295,4529,4763,4996,5228,5459,5690,5920,6149,6377,6604,6830,7054,7278,
+    7501,7723,7943,8163,8381,8598,8813,9027,9240,9452,9662,9870,10077,10283,10487,10689,
+    10890,11089,11287,11482,11677,11869,12059,12248,12435,12620,12803,12984,13164,13341,13516,13689,
+    13860,14029,14196,14361,14524,14684,14842,14998,15152,15304,15453,15600,15744,15886,16026,16163,
+    16298,16430,16560,16688,16813,16935,17055,17172,17287,17399,17509,17615,17720,17821,17920,18016,
+    18109,18200,18288,18373,18456,18535,18612,18686,18757,18826,18891,18954,19014,19071,19125,19176,
+    19225,19270,19313,19353,19389,19423,19454,19482,19507,19529,19548,19565,19578,19588,19596,19600,
+    19601,19600,19596,19588,19578,19565,19548,19529,19507,19482,19454,19423,19389,19353,19313,19270,
+    19225,19176,19125,19071,19014,18954,18891,18826,18757,18686,18612,18535,18456,18373,18288,18200,
+    18109,18016,17920,17821,17720,17615,17509,17399,17287,17172,17055,16935,16813,16688,16560,16430,
+    16298,16163,16026,15886,15744,15600,15453,15304,15152,14998,14842,14684,14524,14361,14196,14029,
+    13860,13689,13516,13341,13164,12984,12803,12620,12435,12248,12059,11869,11677,11483,11287,11089,
+    10890,10689,10487,10283,10077,9870,9662,9452,9240,9027,8813,8598,8381,8163,7943,7723,
+    7501,7278,7054,6830,6604,6377,6149,5920,5690,5459,5228,4996,4763,4529,4295,4060,
+    3824,3588,3351,3114,2876,2638,2399,2161,1921,1682,1442,1202,962,721,481,241,
+    0,-241,-481,-721,-962,-1202,-1442,-1682,-1921,-2161,-2399,-2638,-2876,-3114,-3351,-3588,
+    -3824,-4060,-4295,-4529,-4763,-4996,-5228,-5459,-5690,-5920,-6149,-6377,-6604,-6830,-7054,-7278,
+    -7501,-7723,-7943,-8163,-8381,-8598,-8813,-9027,-9240,-9452,-9662,-9870,-10077,-10283,-10487,-10689,
+    -10890,-11089,-11287,-11483,-11677,-11869,-12059,-12248,-12435,-12620,-12803,-12984,-13164,-13341,-13516,-13689,
+    -13860,-14029,-14196,-14361,-14524,-14684,-14842,-14998,-15152,-15304,-15453,-15600,-15744,-15886,-16026,-16163,
+    -16298,-16430,-16560,-16688,-16813,-16935,-17055,-17172,-17287,-17399,-17509,-17615,-17720,-17821,-17920,-18016,
+    -18109,-18200,-18288,-18373,-18456,-18535,-18612,-18686,-18757,-18826,-18891,-18954,-19014,-19071,-19125,-19176,
+    -19225,-19270,-19313,-19353,-19389,-19423,-19454,-19482,-19507,-19529,-19548,-19565,-19578,-19588,-19596,-19600,
+    -19601,-19600,-19596,-19588,-19578,-19565,-19548,-19529,-19507,-19482,-19454,-19423,-19389,-19353,-19313,-19270,
+    -19225,-19176,-19125,-19071,-19014,-18954,-18891,-18826,-18757,-18686,-18612,-18535,-18456,-18373,-18288,-18200,
+    -18109,-18016,-17920,-17821,-17720,-17615,-17509,-17399,-17287,-17172,-17055,-16935,-16813,-16688,-16560,-16430,
+    -16298,-16163,-16026,-15886,-15744,-15600,-15453,-15304,-15152,-14998,-14842,-14684,-14524,-14361,-14196,-14029,
+    -13860,-13689,-13516,-13341,-13164,-12984,-12803,-12620,-12435,-12248,-12059,-11869,-11677,-11482,-11287,-11089,
+    -10890,-10689,-10487,-10283,-10077,-9870,-9662,-9452,-9240,-9027,-8813,-8598,-8381,-8163,-7943,-7723,
+    -7501,-7278,-7054,-6830,-6604,-6377,-6149,-5920,-5690,-5459,-5228,-4996,-4763,-4529,-4295,-4060,
+    -3824,-3588,-3351,-3114,-2876,-2638,-2399,-2161,-1921,-1682,-1442,-1202,-962,-721,-481,-241,
+    0,241,481,721,962,1202,1442,1682,1921,2161,2399,2638,2876,3114,3351,3588,
+    3824,4060,4295,4529,4763,4996,5228,5459,5690,5920,6149,6377,6604,6830,7054,7278,
+    7501,7723,7943,8163,8381,8598,8813,9027,9240,9452,9662,9870,10077,10283,10487,10689,
+    10890,11089,11287,11483,11677,11869,12059,12248,12435,12620,12803,12984,13164,13341,13516,13689,
+    13860,14029,14196,14361,14524,14684,14842,14998,15152,15304,15453,15600,15744,15886,16026,16163,
+    16298,16430,16560,16688,16813,16935,17055,17172,17287,17399,17509,17615,17720,17821,17920,18016,
+    18109,18200,18288,18373,18456,18535,18612,18686,18757,18826,18891,18954,19014,19071,19125,19176,
+    19225,19270,19313,19353,19389,19423,19454,19482,19507,19529,19548,19565,19578,19588,19596,19600,
+    19601,19600,19596,19588,19578,19565,19548,19529,19507,19482,19454,19423,19389,19353,19313,19270,
+    19225,19176,19125,19071,19014,18954,18891,18826,18757,18686,18612,18535,18456,18373,18288,18200,
+    18109,18016,17920,17821,17720,17615,17509,17399,17287,17172,17055,16935,16813,16688,16560,16430,
+    16298,16163,16026,15886,15744,15600,15453,15304,15152,14998,14842,14684,14524,14361,14196,14029,
+    13860,13689,13516,13341,13164,12984,12803,12620,12435,12248,12059,11869,11677,11483,11287,11089,
+    10890,10689,10487,10283,10077,9870,9662,9452,9240,9027,8813,8598,8381,8163,7943,7723,
+    7501,7278,7054,6830,6604,6377,6149,5920,5690,5459,5228,4996,4763,4529,4295,4060,
+    3824,3588,3351,3114,2876,2638,2399,2161,1921,1682,1442,1202,962,721,481,241,
+    0,-241,-481,-721,-962,-1202,-1442,-1682,-1921,-2161,-2399,-2638,-2876,-3114,-3351,-3588,
+    -3824,-4060,-4295,-4529,-4763,-4996,-5228,-5459,-5690,-5920,-6149,-6377,-6604,-6830,-7054,-7278,
+    -7501,-7723,-7943,-8163,-8381,-8598,-8813,-9027,-9240,-9452,-9662,-9870,-10077,-10283,-10487,-10689,
+    -10890,-11089,-11287,-11483,-11677,-11869,-12059,-12248,-12435,-12620,-12803,-12984,-13164,-13341,-13516,-13689,
+    -13860,-14029,-14196,-14361,-14524,-14684,-14842,-14998,-15152,-15304,-15453,-15600,-15744,-15886,-16026,-16163,
+    -16298,-16430,-16560,-16688,-16813,-16935,-17055,-17172,-17287,-17399,-17509,-17615,-17720,-17821,-17920,-18016,
+    -18109,-18200,-18288,-18373,-18456,-18535,-18612,-18686,-18757,-18826,-18891,-18954,-19014,-19071,-19125,-19176,
+    -19225,-19270,-19313,-19353,-19389,-19423,-19454,-19482,-19507,-19529,-19548,-19565,-19578,-19588,-19596,-19600,
+    -19601,-19600,-19596,-19588,-19578,-19565,-19548,-19529,-19507,-19482,-19454,-19423,-19389,-19353,-19313,-19270,
+    -19225,-19176,-19125,-19071,-19014,-18954,-18891,-18826,-18757,-18686,-18612,-18535,-18456,-18373,-18288,-18200,
+    -18109,-18016,-17920,-17821,-17720,-17615,-17509,-17399,-17287,-17172,-17055,-16935,-16813,-16688,-16560,-16430,
+    -16298,-16163,-16026,-15886,-15744,-15600,-15453,-15304,-15152,-14998,-14842,-14684,-14524,-14361,-14196,-14029,
+    -13860,-13689,-13516,-13341,-13164,-12984,-12803,-12620,-12435,-12248,-12059,-11869,-11677,-11483,-11287,-11089,
+    -10890,-10689,-10487,-10283,-10077,-9870,-9662,-9452,-9240,-9027,-8813,-8598,-8381,-8163,-7943,-7723,
+    -7501,-7278,-7054,-6830,-6604,-6377,-6149,-5920,-5690,-5459,-5228,-4996,-4763,-4529,-4295,-4060,
+    -3824,-3588,-3351,-3114,-2876,-2638,-2399,-2161,-1921,-1682,-1442,-1202,-962,-721,-481,-241};
+
+const int16_t table_wd4_mip7[1024]={
+    9573,9572,9568,9561,9552,9541,9526,9510,9490,9468,9444,9417,9387,9355,9321,9284,
+    9245,9203,9159,9113,9064,9013,8959,8904,8846,8786,8723,8659,8593,8524,8454,8381,
+    8307,8231,8153,8073,7991,7908,7823,7736,7648,7558,7467,7374,7280,7185,7088,6990,
+    6891,6791,6690,6588,6485,6380,6276,6170,6063,5956,5849,5740,5631,5522,5413,5303,
+    5192,5082,4971,4860,4749,4638,4528,4417,4306,4196,4086,3976,3867,3757,3649,3541,
+    3433,3327,3220,3115,3010,2906,2803,2701,2600,2500,2400,2302,2205,2109,2015,1921,
+    1829,1738,1648,1560,1473,1387,1303,1220,1139,1059,981,904,829,756,684,613,
+    545,478,412,348,286,226,167,110,55,1,-51,-102,-150,-197,-243,-286,
+    -329,-369,-408,-445,-481,-515,-548,-579,-608,-636,-663,-688,-712,-734,-755,-775,
+    -794,-811,-827,-842,-856,-868,-880,-890,-900,-908,-916,-923,-929,-934,-939,-943,
+    -946,-949,-951,-953,-955,-956,-956,-957,-957,-957,-957,-957,-957,-957,-958,-958,
+    -959,-960,-961,-963,-965,-968,-971,-975,-979,-985,-991,-998,-1006,-1015,-1025,-1035,
+    -1048,-1061,-1075,-1091,-1108,-1127,-1146,-1168,-1191,-1215,-1241,-1269,-1298,-1329,-1362,-1397,
+    -1434,-1472,-1512,-1555,-1599,-1645,-1694,-1744,-1797,-1852,-1909,-1968,-2029,-2093,-2159,-2227,
+    -2297,-2370,-2444,-2522,-2601,-2683,-2767,-2854,-2943,-3034,-3128,-3223,-3322,-3422,-3525,-3630,
+    -3737,-3847,-3959,-4073,-4189,-4307,-4428,-4550,-4675,-4802,-4931,-5062,-5194,-5329,-5465,-5604,
+    -5744,-5886,-6029,-6174,-6321,-6469,-6619,-6770,-6923,-7076,-7231,-7387,-7545,-7703,-7862,-8022,
+    -8183,-8345,-8507,-8670,-8834,-8998,-9162,-9327,-9492,-9656,-9821,-9986,-10151,-10315,-10479,-10643,
+    -10806,-10969,-11131,-11292,-11453,-11612,-11770,-11927,-12083,-12238,-12391,-12542,-12692,-12840,-12987,-13131,
+    -13274,-13414,-13552,-13688,-13821,-13952,-14080,-14206,-14328,-14448,-14565,-14679,-14789,-14897,-15001,-15101,
+    -15198,-15292,-15382,-15467,-15549,-15628,-15702,-15771,-15837,-15898,-15955,-16008,-16056,-16100,-16138,-16172,
+    -16202,-16226,-16246,-16260,-16269,-16274,-16273,-16267,-16255,-16239,-16217,-16189,-16156,-16118,-16074,-16024,
+    -15969,-15908,-15841,-15769,-15691,-15607,-15518,-15422,-15321,-15214,-15101,-14983,-14858,-14728,-14592,-14450,
+    -14302,-14148,-13989,-13823,-13652,-13475,-13293,-13105,-12911,-12711,-12506,-12295,-12079,-11857,-11630,-11397,
+    -11159,-10916,-10667,-10414,-10155,-9891,-9622,-9348,-9070,-8786,-8498,-8205,-7908,-7606,-7300,-6990,
+    -6676,-6357,-6034,-5708,-5378,-5044,-4706,-4365,-4021,-3674,-3323,-2969,-2613,-2253,-1891,-1526,
+    -1159,-790,-419,-45,330,707,1086,1467,1848,2231,2615,3000,3386,3773,4160,4547,
+    4935,5323,5710,6098,6485,6872,7258,7643,8028,8411,8794,9175,9554,9932,10308,10682,
+    11054,11423,11791,12156,12518,12878,13234,13588,13938,14285,14628,14968,15304,15636,15964,16288,
+    16608,16923,17234,17540,17842,18138,18429,18716,18997,19272,19543,19807,20066,20319,20566,20807,
+    21042,21271,21494,21710,21920,22123,22319,22509,22692,22868,23037,23199,23354,23502,23643,23776,
+    23902,24021,24132,24236,24332,24421,24502,24575,24641,24699,24750,24793,24828,24855,24874,24886,
+    24890,24886,24874,24855,24828,24793,24750,24699,24641,24575,24502,24421,24332,24236,24132,24021,
+    23902,23776,23643,23502,23354,23199,23037,22868,22692,22509,22319,22123,21920,21710,21494,21271,
+    21042,20807,20566,20319,20066,19807,19543,19272,18997,18716,18429,18138,17842,17540,17234,16923,
+    16608,16288,15964,15636,15304,14968,14628,14285,13938,13588,13234,12878,12518,12156,11791,11423,
+    11054,10682,10308,9932,9554,9175,8794,8411,8028,7643,7258,6872,6485,6098,5710,5323,
+    4935,4547,4160,3773,3386,3000,2615,2231,1848,1467,1086,707,330,-45,-419,-790,
+    -1159,-1526,-1891,-2253,-2613,-2969,-3323,-3674,-4021,-4365,-4706,-5044,-5378,-5708,-6034,-6357,
+    -6676,-6990,-7300,-7606,-7908,-8205,-8498,-8786,-9070,-9348,-9622,-9891,-10155,-10414,-10667,-10916,
+    -11159,-11397,-11630,-11857,-12079,-12295,-12506,-12711,-12911,-13105,-13293,-13475,-13652,-13823,-13989,-14148,
+    -14302,-14450,-14592,-14728,-14858,-14983,-15101,-15214,-15321,-15422,-15518,-15607,-15691,-15769,-15841,-15908,
+    -15969,-16024,-16074,-16118,-16156,-16189,-16217,-16239,-16255,-16267,-16273,-16274,-16269,-16260,-16246,-16226,
+    -16202,-16172,-16138,-16100,-16056,-16008,-15955,-15898,-15837,-15771,-15702,-15628,-15549,-15467,-15382,-15292,
+    -15198,-15101,-15001,-14897,-14789,-14679,-14565,-14448,-14328,-14206,-14080,-13952,-13821,-13688,-13552,-13414,
+    -13274,-13131,-12987,-12840,-12692,-12542,-12391,-12238,-12083,-11927,-11770,-11612,-11453,-11292,-11131,-10969,
+    -10806,-10643,-10479,-10315,-10151,-9986,-9821,-9656,-9492,-9327,-9162,-8998,-8834,-8670,-8507,-8345,
+    -8183,-8022,-7862,-7703,-7545,-7387,-7231,-7076,-6923,-6770,-6619,-6469,-6321,-6174,-6029,-5886,
+    -5744,-5604,-5465,-5329,-5194,-5062,-4931,-4802,-4675,-4550,-4428,-4307,-4189,-4073,-3959,-3847,
+    -3737,-3630,-3525,-3422,-3322,-3223,-3128,-3034,-2943,-2854,-2767,-2683,-2601,-2522,-2444,-2370,
+    -2297,-2227,-2159,-2093,-2029,-1968,-1909,-1852,-1797,-1744,-1694,-1645,-1599,-1555,-1512,-1472,
+    -1434,-1397,-1362,-1329,-1298,-1269,-1241,-1215,-1191,-1168,-1146,-1127,-1108,-1091,-1075,-1061,
+    -1048,-1035,-1025,-1015,-1006,-998,-991,-985,-979,-975,-971,-968,-965,-963,-961,-960,
+    -959,-958,-958,-957,-957,-957,-957,-957,-957,-957,-956,-956,-955,-953,-951,-949,
+    -946,-943,-939,-934,-929,-923,-916,-908,-900,-890,-880,-868,-856,-842,-827,-811,
+    -794,-775,-755,-734,-712,-688,-663,-636,-608,-579,-548,-515,-481,-445,-408,-369,
+    -329,-286,-243,-197,-150,-102,-51,1,55,110,167,226,286,348,412,478,
+    545,613,684,756,829,904,981,1059,1139,1220,1303,1387,1473,1560,1648,1738,
+    1829,1921,2015,2109,2205,2302,2400,2500,2600,2701,2803,2906,3010,3115,3220,3327,
+    3433,3541,3649,3757,3867,3976,4086,4196,4306,4417,4528,4638,4749,4860,4971,5082,
+    5192,5303,5413,5522,5631,5740,5849,5956,6063,6170,6276,6380,6485,6588,6690,6791,
+    6891,6990,7088,7185,7280,7374,7467,7558,7648,7736,7823,7908,7991,8073,8153,8231,
+    8307,8381,8454,8524,8593,8659,8723,8786,8846,8904,8959,9013,9064,9113,9159,9203,
+    9245,9284,9321,9355,9387,9417,9444,9468,9490,9510,9526,9541,9552,9561,9568,9572};
+
+const int16_t table_wd4_mip8[1024]={
+    11488,11487,11484,11480,11474,11466,11456,11445,11432,11418,11401,11383,11363,11342,11318,11294,
+    11267,11239,11208,11177,11143,11108,11071,11033,10993,10951,10908,10863,10816,10768,10718,10666,
+    10613,10558,10502,10444,10385,10324,10261,10197,10131,10064,9995,9925,9853,9780,9705,9629,
+    9552,9473,9392,9310,9227,9142,9056,8969,8880,8790,8699,8606,8512,8416,8320,8222,
+    8123,8023,7921,7818,7715,7610,7503,7396,7288,7178,7068,6956,6843,6729,6615,6499,
+    6382,6264,6146,6026,5906,5784,5662,5539,5415,5290,5165,5039,4912,4784,4655,4526,
+    4396,4266,4134,4002,3870,3737,3603,3469,3335,3200,3064,2928,2791,2654,2517,2379,
+    2241,2103,1964,1825,1686,1546,1406,1266,1126,986,845,704,564,423,282,141,
+    0,-141,-282,-423,-564,-704,-845,-986,-1126,-1266,-1406,-1546,-1686,-1825,-1964,-2103,
+    -2241,-2379,-2517,-2654,-2791,-2928,-3064,-3200,-3335,-3469,-3603,-3737,-3870,-4003,-4134,-4266,
+    -4396,-4526,-4655,-4784,-4912,-5039,-5165,-5290,-5415,-5539,-5662,-5784,-5906,-6026,-6146,-6264,
+    -6382,-6499,-6615,-6729,-6843,-6956,-7068,-7178,-7288,-7396,-7503,-7610,-7715,-7818,-7921,-8023,
+    -8123,-8222,-8320,-8416,-8512,-8606,-8699,-8790,-8880,-8969,-9056,-9142,-9227,-9310,-9392,-9473,
+    -9552,-9629,-9705,-9780,-9853,-9925,-9995,-10064,-10131,-10197,-10261,-10324,-10385,-10444,-10502,-10558,
+    -10613,-10666,-10718,-10768,-10816,-10863,-10908,-10951,-10993,-11033,-11071,-11108,-11143,-11177,-11208,-11239,
+    -11267,-11294,-11318,-11342,-11363,-11383,-11401,-11418,-11432,-11445,-11456,-11466,-11474,-11480,-11484,-11487,
+    -11488,-11487,-11484,-11480,-11474,-11466,-11456,-11445,-11432,-11418,-11401,-11383,-11363,-11342,-11318,-11294,
+    -11267,-11239,-11208,-11177,-11143,-11108,-11071,-11033,-10993,-10951,-10908,-10863,-10816,-10768,-10718,-10666,
+    -10613,-10558,-10502,-10444,-10385,-10324,-10261,-10197,-10131,-10064,-9995,-9925,-9853,-9780,-9705,-9629,
+    -9552,-9473,-9392,-9310,-9227,-9142,-9056,-8969,-8880,-8790,-8699,-8606,-8512,-8416,-8320,-8222,
+    -8123,-8023,-7921,-7818,-7715,-7610,-7503,-7396,-7288,-7178,-7068,-6956,-6843,-6729,-6615,-6499,
+    -6382,-6264,-6146,-6026,-5906,-5784,-5662,-5539,-5415,-5290,-5165,-5039,-4912,-4784,-4655,-4526,
+    -4396,-4266,-4134,-4002,-3870,-3737,-3603,-3469,-3335,-3200,-3064,-2928,-2791,-2654,-2517,-2379,
+    -2241,-2103,-1964,-1825,-1686,-1546,-1406,-1266,-1126,-986,-845,-704,-564,-423,-282,-141,
+    0,141,282,423,564,704,845,986,1126,1266,1406,1546,1686,1825,1964,2103,
+    2241,2379,2517,2654,2791,2928,3064,3200,3335,3469,3603,3737,3870,4002,4134,4266,
+    4396,4526,4655,4784,4912,5039,5165,5290,5415,5539,5662,5784,5906,6026,6146,6264,
+    6382,6499,6615,6729,6843,6956,7068,7178,7288,7396,7503,7610,7715,7818,7921,8023,
+    8123,8222,8320,8416,8512,8606,8699,8790,8880,8969,9056,9142,9227,9310,9392,9473,
+    9552,9629,9705,9780,9853,9925,9995,10064,10131,10197,10261,10324,10385,10444,10502,10558,
+    10613,10666,10718,10768,10816,10863,10908,10951,10993,11033,11071,11108,11143,11177,11208,11239,
+    11267,11294,11318,11342,11363,11383,11401,11418,11432,11445,11456,11466,11474,11480,11484,11487,
+    11488,11487,11484,11480,11474,11466,11456,11445,11432,11418,11401,11383,11363,11342,11318,11294,
+    11267,11239,11208,11177,11143,11108,11071,11033,10993,10951,10908,10863,10816,10768,10718,10666,
+    10613,10558,10502,10444,10385,10324,10261,10197,10131,10064,9995,9925,9853,9780,9705,9629,
+    9552,9473,9392,9310,9227,9142,9056,8969,8880,8790,8699,8606,8512,8416,8320,8222,
+    8123,8023,7921,7818,7715,7610,7503,7396,7288,7178,7068,6956,6843,6729,6615,6499,
+    6382,6264,6146,6026,5906,5784,5662,5539,5415,5290,5165,5039,4912,4784,4655,4526,
+    4396,4266,4134,4002,3870,3737,3603,3469,3335,3200,3064,2928,2791,2654,2517,2379,
+    2241,2103,1964,1825,1686,1546,1406,1266,1126,986,845,704,564,423,282,141,
+    0,-141,-282,-423,-564,-704,-845,-986,-1126,-1266,-1406,-1546,-1686,-1825,-1964,-2103,
+    -2241,-2379,-2517,-2654,-2791,-2928,-3064,-3200,-3335,-3469,-3603,-3737,-3870,-4002,-4134,-4266,
+    -4396,-4526,-4655,-4784,-4912,-5039,-5165,-5290,-5415,-5539,-5662,-5784,-5906,-6026,-6146,-6264,
+    -6382,-6499,-6615,-6729,-6843,-6956,-7068,-7178,-7288,-7396,-7503,-7610,-7715,-7818,-7921,-8023,
+    -8123,-8222,-8320,-8416,-8512,-8606,-8699,-8790,-8880,-8969,-9056,-9142,-9227,-9310,-9392,-9473,
+    -9552,-9629,-9705,-9780,-9853,-9925,-9995,-10064,-10131,-10197,-10261,-10324,-10385,-10444,-10502,-10558,
+    -10613,-10666,-10718,-10768,-10816,-10863,-10908,-10951,-10993,-11033,-11071,-11108,-11143,-11177,-11208,-11239,
+    -11267,-11294,-11318,-11342,-11363,-11383,-11401,-11418,-11432,-11445,-11456,-11466,-11474,-11480,-11484,-11487,
+    -11488,-11487,-11484,-11480,-11474,-11466,-11456,-11445,-11432,-11418,-11401,-11383,-11363,-11342,-11318,-11294,
+    -11267,-11239,-11208,-11177,-11143,-11108,-11071,-11033,-10993,-10951,-10908,-10863,-10816,-10768,-10718,-10666,
+    -10613,-10558,-10502,-10444,-10385,-10324,-10261,-10197,-10131,-10064,-9995,-9925,-9853,-9780,-9705,-9629,
+    -9552,-9473,-9392,-9310,-9227,-9142,-9056,-8969,-8880,-8790,-8699,-8606,-8512,-8416,-8320,-8222,
+    -8123,-8023,-7921,-7818,-7715,-7610,-7503,-7396,-7288,-7178,-7068,-6956,-6843,-6729,-6615,-6499,
+    -6382,-6264,-6146,-6026,-5906,-5784,-5662,-5539,-5415,-5290,-5165,-5039,-4912,-4784,-4655,-4526,
+    -4396,-4266,-4134,-4003,-3870,-3737,-3603,-3469,-3335,-3200,-3064,-2928,-2791,-2654,-2517,-2379,
+    -2241,-2103,-1964,-1825,-1686,-1546,-1406,-1266,-1126,-986,-845,-704,-564,-423,-282,-141,
+    0,141,282,423,564,704,845,986,1126,1266,1406,1546,1686,1825,1964,2103,
+    2241,2379,2517,2654,2791,2928,3064,3200,3335,3469,3603,3737,3870,4002,4134,4266,
+    4396,4526,4655,4784,4912,5039,5165,5290,5415,5539,5662,5784,5906,6026,6146,6264,
+    6382,6499,6615,6729,6843,6956,7068,7178,7288,7396,7503,7610,7715,7818,7921,8023,
+    8123,8222,8320,8416,8512,8606,8699,8790,8880,8969,9056,9142,9227,9310,9392,9473,
+    9552,9629,9705,9780,9853,9925,9995,10064,10131,10197,10261,10324,10385,10444,10502,10558,
+    10613,10666,10718,10768,10816,10863,10908,10951,10993,11033,11071,11108,11143,11177,11208,11239,
+    11267,11294,11318,11342,11363,11383,11401,11418,11432,11445,11456,11466,11474,11480,11484,11487};
+
+const int16_t table_wd5_mip6[1024]={
+    0,-134,-263,-389,-509,-624,-733,-835,-930,-1017,-1097,-1167,-1229,-1281,-1323,-1355,
+    -1376,-1386,-1384,-1371,-1345,-1307,-1255,-1191,-1114,-1023,-919,-801,-668,-522,-362,-188,
+    0,202,418,648,892,1150,1420,1705,2002,2311,2634,2968,3314,3671,4040,4419,
+    4808,5206,5614,6030,6454,6886,7324,7769,8219,8674,9133,9596,10062,10530,11000,11470,
+    11940,12410,12877,13343,13806,14265,14719,15168,15611,16047,16476,16896,17307,17709,18100,18480,
+    18848,19203,19546,19875,20189,20488,20772,21040,21291,21525,21741,21940,22120,22281,22423,22546,
+    22649,22731,22794,22836,22858,22858,22838,22798,22736,22654,22550,22427,22282,22117,21933,21728,
+    21503,21260,20997,20716,20416,20099,19764,19413,19046,18663,18265,17853,17427,16988,16537,16074,
+    15601,15117,14624,14123,13615,13100,12579,12053,11523,10990,10455,9919,9382,8847,8312,7780,
+    7252,6728,6209,5697,5191,4694,4206,3727,3259,2803,2359,1929,1512,1110,724,353,
+    0,-336,-653,-952,-1231,-1490,-1729,-1947,-2143,-2318,-2471,-2601,-2708,-2792,-2853,-2891,
+    -2905,-2896,-2863,-2806,-2726,-2622,-2495,-2345,-2172,-1976,-1758,-1518,-1256,-972,-668,-344,
+    0,363,745,1145,1562,1995,2444,2908,3386,3877,4381,4896,5422,5957,6501,7053,
+    7611,8174,8743,9314,9888,10464,11039,11614,12186,12756,13321,13881,14434,14980,15517,16045,
+    16561,17066,17558,18036,18499,18945,19375,19787,20180,20553,20905,21236,21545,21830,22091,22328,
+    22539,22725,22883,23015,23119,23194,23241,23259,23247,23205,23134,23032,22899,22736,22542,22318,
+    22063,21776,21460,21112,20735,20327,19890,19423,18927,18403,17850,17269,16662,16028,15368,14682,
+    13973,13239,12482,11704,10904,10084,9244,8386,7510,6617,5710,4788,3852,2905,1946,977,
+    0,-985,-1976,-2973,-3973,-4977,-5981,-6987,-7991,-8993,-9992,-10986,-11975,-12957,-13930,-14894,
+    -15848,-16791,-17720,-18636,-19537,-20422,-21290,-22140,-22970,-23781,-24571,-25340,-26086,-26808,-27506,-28179,
+    -28826,-29447,-30041,-30607,-31145,-31655,-32135,-32586,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+    -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+    -32768,-32768,-32768,-32768,-32455,-32037,-31597,-31137,-30656,-30156,-29639,-29104,-28552,-27985,-27404,-26809,
+    -26202,-25583,-24954,-24315,-23668,-23013,-22352,-21685,-21014,-20339,-19662,-18983,-18304,-17625,-16948,-16273,
+    -15601,-14933,-14270,-13613,-12962,-12320,-11685,-11060,-10444,-9839,-9245,-8663,-8093,-7537,-6994,-6465,
+    -5951,-5453,-4969,-4502,-4051,-3617,-3200,-2800,-2417,-2052,-1705,-1376,-1065,-772,-496,-239,
+    0,221,425,611,780,931,1065,1183,1285,1370,1440,1494,1534,1559,1570,1568,
+    1553,1525,1485,1434,1372,1300,1218,1127,1027,920,805,684,557,424,287,145,
+    0,-148,-298,-450,-602,-755,-908,-1061,-1211,-1360,-1507,-1651,-1791,-1927,-2059,-2187,
+    -2309,-2425,-2535,-2639,-2736,-2827,-2910,-2985,-3052,-3112,-3163,-3207,-3241,-3267,-3285,-3294,
+    -3294,-3286,-3269,-3244,-3210,-3168,-3117,-3059,-2993,-2920,-2839,-2752,-2657,-2557,-2450,-2338,
+    -2220,-2097,-1971,-1840,-1705,-1568,-1428,-1286,-1142,-997,-852,-707,-562,-419,-277,-137,
+    0,134,263,389,509,624,733,835,930,1017,1097,1167,1229,1281,1323,1355,
+    1376,1386,1384,1371,1345,1307,1255,1191,1114,1023,919,801,668,522,362,188,
+    0,-202,-418,-648,-892,-1150,-1420,-1705,-2002,-2311,-2634,-2968,-3314,-3671,-4040,-4419,
+    -4808,-5206,-5614,-6030,-6454,-6886,-7324,-7769,-8219,-8674,-9133,-9596,-10062,-10530,-11000,-11470,
+    -11940,-12410,-12877,-13343,-13806,-14265,-14719,-15168,-15611,-16047,-16476,-16896,-17307,-17709,-18100,-18480,
+    -18848,-19203,-19546,-19875,-20189,-20488,-20772,-21040,-21291,-21525,-21741,-21940,-22120,-22281,-22423,-22546,
+    -22649,-22731,-22794,-22836,-22858,-22858,-22838,-22798,-22736,-22654,-22550,-22427,-22282,-22117,-21933,-21728,
+    -21503,-21260,-20997,-20716,-20416,-20099,-19764,-19413,-19046,-18663,-18265,-17853,-17427,-16988,-16537,-16074,
+    -15601,-15117,-14624,-14123,-13615,-13100,-12579,-12053,-11523,-10990,-10455,-9919,-9382,-8847,-8312,-7780,
+    -7252,-6728,-6209,-5697,-5191,-4694,-4206,-3727,-3259,-2803,-2359,-1929,-1512,-1110,-724,-353,
+    0,336,653,952,1231,1490,1729,1947,2143,2318,2471,2601,2708,2792,2853,2891,
+    2905,2896,2863,2806,2726,2622,2495,2345,2172,1976,1758,1518,1256,972,668,344,
+    0,-363,-745,-1145,-1562,-1995,-2444,-2908,-3386,-3877,-4381,-4896,-5422,-5957,-6501,-7053,
+    -7611,-8174,-8743,-9314,-9888,-10464,-11039,-11614,-12186,-12756,-13321,-13881,-14434,-14980,-15517,-16045,
+    -16561,-17066,-17558,-18036,-18499,-18945,-19375,-19787,-20180,-20553,-20905,-21236,-21545,-21830,-22091,-22328,
+    -22539,-22725,-22883,-23015,-23119,-23194,-23241,-23259,-23247,-23205,-23134,-23032,-22899,-22736,-22542,-22318,
+    -22063,-21776,-21460,-21112,-20735,-20327,-19890,-19423,-18927,-18403,-17850,-17269,-16662,-16028,-15368,-14682,
+    -13973,-13239,-12482,-11704,-10904,-10084,-9244,-8386,-7510,-6617,-5710,-4788,-3852,-2905,-1946,-977,
+    0,985,1976,2973,3973,4977,5981,6987,7991,8993,9992,10986,11975,12957,13930,14894,
+    15848,16791,17720,18636,19537,20422,21290,22140,22970,23781,24571,25340,26086,26808,27506,28179,
+    28826,29447,30041,30607,31145,31655,32135,32586,32767,32767,32767,32767,32767,32767,32767,32767,
+    32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,32767,
+    32767,32767,32767,32767,32455,32037,31597,31137,30656,30156,29639,29104,28552,27985,27404,26809,
+    26202,25583,24954,24315,23668,23013,22352,21685,21014,20339,19662,18983,18304,17625,16948,16273,
+    15601,14933,14270,13613,12962,12320,11685,11060,10444,9839,9245,8663,8093,7537,6994,6465,
+    5951,5453,4969,4502,4051,3617,3200,2800,2417,2052,1705,1376,1065,772,496,239,
+    0,-221,-425,-611,-780,-931,-1065,-1183,-1285,-1370,-1440,-1494,-1534,-1559,-1570,-1568,
+    -1553,-1525,-1485,-1434,-1372,-1300,-1218,-1127,-1027,-920,-805,-684,-557,-424,-287,-145,
+    0,148,298,450,602,755,908,1061,1211,1360,1507,1651,1791,1927,2059,2187,
+    2309,2425,2535,2639,2736,2827,2910,2985,3052,3112,3163,3207,3241,3267,3285,3294,
+    3294,3286,3269,3244,3210,3168,3117,3059,2993,2920,2839,2752,2657,2557,2450,2338,
+    2220,2097,1971,1840,1705,1568,1428,1286,1142,997,852,707,562,419,277,137};
+
+const int16_t table_wd5_mip7[1024]={
+    0,2,7,15,27,41,60,81,106,134,166,200,238,279,324,371,
+    422,476,533,593,656,723,792,864,940,1018,1099,1184,1271,1361,1453,1549,
+    1647,1748,1852,1958,2067,2178,2292,2408,2527,2648,2772,2897,3025,3155,3287,3422,
+    3558,3696,3837,3979,4123,4268,4416,4565,4715,4867,5021,5176,5332,5490,5649,5809,
+    5970,6132,6295,6460,6625,6790,6957,7124,7292,7460,7629,7798,7967,8137,8307,8477,
+    8647,8818,8988,9158,9327,9497,9666,9835,10003,10171,10338,10504,10670,10835,10999,11162,
+    11324,11485,11645,11804,11961,12117,12272,12425,12577,12727,12875,13022,13167,13310,13451,13590,
+    13727,13862,13995,14126,14255,14381,14505,14626,14745,14861,14975,15086,15195,15300,15403,15503,
+    15601,15695,15786,15874,15959,16042,16120,16196,16269,16338,16404,16466,16525,16581,16633,16682,
+    16727,16769,16807,16841,16872,16899,16922,16942,16958,16970,16978,16983,16984,16980,16974,16963,
+    16948,16929,16907,16880,16850,16816,16778,16735,16689,16639,16585,16527,16465,16399,16330,16256,
+    16178,16097,16011,15922,15829,15732,15631,15526,15417,15305,15189,15069,14945,14817,14686,14552,
+    14413,14271,14125,13976,13824,13667,13508,13345,13178,13008,12835,12659,12479,12297,12111,11922,
+    11730,11534,11336,11135,10932,10725,10515,10303,10089,9871,9651,9429,9204,8976,8747,8515,
+    8281,8044,7806,7566,7323,7079,6833,6585,6335,6084,5831,5576,5320,5063,4804,4545,
+    4283,4021,3758,3494,3228,2962,2696,2428,2160,1891,1622,1352,1082,812,541,271,
+    0,-271,-541,-812,-1082,-1352,-1622,-1891,-2160,-2428,-2696,-2962,-3228,-3494,-3758,-4021,
+    -4283,-4545,-4804,-5063,-5320,-5576,-5831,-6084,-6335,-6585,-6833,-7079,-7323,-7566,-7806,-8044,
+    -8281,-8515,-8747,-8976,-9204,-9429,-9651,-9871,-10089,-10303,-10515,-10725,-10932,-11135,-11336,-11534,
+    -11730,-11922,-12111,-12297,-12479,-12659,-12835,-13008,-13178,-13345,-13508,-13667,-13824,-13976,-14125,-14271,
+    -14413,-14551,-14686,-14817,-14945,-15069,-15189,-15305,-15417,-15526,-15631,-15732,-15829,-15922,-16011,-16097,
+    -16178,-16256,-16330,-16399,-16465,-16527,-16585,-16639,-16689,-16735,-16777,-16816,-16850,-16880,-16907,-16929,
+    -16948,-16963,-16974,-16980,-16984,-16983,-16978,-16970,-16958,-16942,-16922,-16899,-16872,-16841,-16807,-16768,
+    -16727,-16682,-16633,-16581,-16525,-16466,-16404,-16338,-16269,-16196,-16120,-16042,-15959,-15874,-15786,-15695,
+    -15601,-15503,-15403,-15300,-15195,-15086,-14975,-14861,-14745,-14626,-14505,-14381,-14255,-14126,-13995,-13862,
+    -13727,-13590,-13451,-13310,-13167,-13022,-12875,-12727,-12577,-12425,-12272,-12117,-11961,-11804,-11645,-11485,
+    -11324,-11162,-10999,-10835,-10670,-10504,-10338,-10171,-10003,-9835,-9666,-9497,-9327,-9158,-8988,-8818,
+    -8647,-8477,-8307,-8137,-7967,-7798,-7629,-7460,-7292,-7124,-6957,-6790,-6625,-6460,-6295,-6132,
+    -5970,-5809,-5649,-5490,-5332,-5176,-5021,-4867,-4715,-4565,-4416,-4268,-4123,-3979,-3837,-3696,
+    -3558,-3422,-3287,-3155,-3025,-2897,-2772,-2648,-2527,-2408,-2292,-2178,-2067,-1958,-1852,-1748,
+    -1647,-1549,-1453,-1361,-1271,-1184,-1099,-1018,-940,-864,-792,-723,-656,-593,-533,-476,
+    -422,-371,-324,-279,-238,-200,-166,-134,-106,-81,-60,-41,-27,-15,-7,-2,
+    0,-2,-7,-15,-27,-41,-60,-81,-106,-134,-166,-200,-238,-279,-324,-371,
+    -422,-476,-533,-593,-656,-723,-792,-864,-940,-1018,-1099,-1184,-1271,-1361,-1453,-1549,
+    -1647,-1748,-1852,-1958,-2067,-2178,-2292,-2408,-2527,-2648,-2772,-2897,-3025,-3155,-3287,-3422,
+    -3558,-3696,-3837,-3979,-4123,-4268,-4416,-4565,-4715,-4867,-5021,-5176,-5332,-5490,-5649,-5809,
+    -5970,-6132,-6295,-6460,-6625,-6790,-6957,-7124,-7292,-7460,-7629,-7798,-7967,-8137,-8307,-8477,
+    -8647,-8818,-8988,-9158,-9327,-9497,-9666,-9835,-10003,-10171,-10338,-10504,-10670,-10835,-10999,-11162,
+    -11324,-11485,-11645,-11804,-11961,-12117,-12272,-12425,-12577,-12727,-12875,-13022,-13167,-13310,-13451,-13590,
+    -13727,-13862,-13995,-14126,-14255,-14381,-14505,-14626,-14745,-14861,-14975,-15086,-15195,-15300,-15403,-15503,
+    -15601,-15695,-15786,-15874,-15959,-16042,-16120,-16196,-16269,-16338,-16404,-16466,-16525,-16581,-16633,-16682,
+    -16727,-16769,-16807,-16841,-16872,-16899,-16922,-16942,-16958,-16970,-16978,-16983,-16984,-16980,-16974,-16963,
+    -16948,-16929,-16907,-16880,-16850,-16816,-16778,-16735,-16689,-16639,-16585,-16527,-16465,-16399,-16330,-16256,
+    -16178,-16097,-16011,-15922,-15829,-15732,-15631,-15526,-15417,-15305,-15189,-15069,-14945,-14817,-14686,-14552,
+    -14413,-14271,-14125,-13976,-13824,-13667,-13508,-13345,-13178,-13008,-12835,-12659,-12479,-12297,-12111,-11922,
+    -11730,-11534,-11336,-11135,-10932,-10725,-10515,-10303,-10089,-9871,-9651,-9429,-9204,-8976,-8747,-8515,
+    -8281,-8044,-7806,-7566,-7323,-7079,-6833,-6585,-6335,-6084,-5831,-5576,-5320,-5063,-4804,-4545,
+    -4283,-4021,-3758,-3494,-3228,-2962,-2696,-2428,-2160,-1891,-1622,-1352,-1082,-812,-541,-271,
+    0,271,541,812,1082,1352,1622,1891,2160,2428,2696,2962,3228,3494,3758,4021,
+    4283,4545,4804,5063,5320,5576,5831,6084,6335,6585,6833,7079,7323,7566,7806,8044,
+    8281,8515,8747,8976,9204,9429,9651,9871,10089,10303,10515,10725,10932,11135,11336,11534,
+    11730,11922,12111,12297,12479,12659,12835,13008,13178,13345,13508,13667,13824,13976,14125,14271,
+    14413,14551,14686,14817,14945,15069,15189,15305,15417,15526,15631,15732,15829,15922,16011,16097,
+    16178,16256,16330,16399,16465,16527,16585,16639,16689,16735,16777,16816,16850,16880,16907,16929,
+    16948,16963,16974,16980,16984,16983,16978,16970,16958,16942,16922,16899,16872,16841,16807,16768,
+    16727,16682,16633,16581,16525,16466,16404,16338,16269,16196,16120,16042,15959,15874,15786,15695,
+    15601,15503,15403,15300,15195,15086,14975,14861,14745,14626,14505,14381,14255,14126,13995,13862,
+    13727,13590,13451,13310,13167,13022,12875,12727,12577,12425,12272,12117,11961,11804,11645,11485,
+    11324,11162,10999,10835,10670,10504,10338,10171,10003,9835,9666,9497,9327,9158,8988,8818,
+    8647,8477,8307,8137,7967,7798,7629,7460,7292,7124,6957,6790,6625,6460,6295,6132,
+    5970,5809,5649,5490,5332,5176,5021,4867,4715,4565,4416,4268,4123,3979,3837,3696,
+    3558,3422,3287,3155,3025,2897,2772,2648,2527,2408,2292,2178,2067,1958,1852,1748,
+    1647,1549,1453,1361,1271,1184,1099,1018,940,864,792,723,656,593,533,476,
+    422,371,324,279,238,200,166,134,106,81,60,41,27,15,7,2};
+
+const int16_t table_wd5_mip8[1024]={
+    11031,11031,11030,11029,11028,11026,11024,11021,11018,11014,11011,11006,11001,10996,10991,10985,
+    10978,10971,10964,10956,10948,10940,10931,10922,10912,10902,10891,10880,10869,10857,10845,10832,
+    10819,10806,10792,10778,10763,10748,10733,10717,10701,10684,10667,10650,10632,10613,10595,10576,
+    10556,10536,10516,10496,10474,10453,10431,10409,10386,10363,10340,10316,10292,10268,10243,10217,
+    10192,10165,10139,10112,10085,10057,10029,10001,9972,9943,9914,9884,9853,9823,9792,9760,
+    9729,9697,9664,9631,9598,9565,9531,9496,9462,9427,9392,9356,9320,9283,9247,9210,
+    9172,9134,9096,9058,9019,8980,8940,8901,8860,8820,8779,8738,8696,8655,8613,8570,
+    8527,8484,8441,8397,8353,8309,8264,8219,8174,8128,8082,8036,7989,7943,7895,7848,
+    7800,7752,7704,7655,7607,7557,7508,7458,7408,7358,7307,7256,7205,7154,7102,7050,
+    6998,6946,6893,6840,6787,6733,6680,6626,6571,6517,6462,6407,6352,6296,6241,6185,
+    6129,6072,6016,5959,5902,5844,5787,5729,5671,5613,5555,5496,5437,5378,5319,5260,
+    5200,5140,5080,5020,4960,4899,4838,4778,4716,4655,4594,4532,4470,4408,4346,4284,
+    4221,4159,4096,4033,3970,3907,3844,3780,3716,3653,3589,3525,3460,3396,3332,3267,
+    3202,3137,3072,3007,2942,2877,2811,2746,2680,2615,2549,2483,2417,2351,2285,2218,
+    2152,2086,2019,1953,1886,1819,1752,1686,1619,1552,1485,1418,1350,1283,1216,1149,
+    1081,1014,946,879,812,744,676,609,541,474,406,338,271,203,135,68,
+    0,-68,-135,-203,-271,-338,-406,-474,-541,-609,-676,-744,-812,-879,-946,-1014,
+    -1081,-1149,-1216,-1283,-1350,-1417,-1485,-1552,-1619,-1686,-1752,-1819,-1886,-1953,-2019,-2086,
+    -2152,-2218,-2285,-2351,-2417,-2483,-2549,-2615,-2680,-2746,-2811,-2877,-2942,-3007,-3072,-3137,
+    -3202,-3267,-3332,-3396,-3460,-3525,-3589,-3653,-3716,-3780,-3843,-3907,-3970,-4033,-4096,-4159,
+    -4221,-4284,-4346,-4408,-4470,-4532,-4594,-4655,-4716,-4778,-4838,-4899,-4960,-5020,-5080,-5140,
+    -5200,-5260,-5319,-5378,-5437,-5496,-5555,-5613,-5671,-5729,-5787,-5844,-5902,-5959,-6016,-6072,
+    -6129,-6185,-6241,-6296,-6352,-6407,-6462,-6517,-6571,-6626,-6680,-6733,-6787,-6840,-6893,-6946,
+    -6998,-7050,-7102,-7154,-7205,-7256,-7307,-7358,-7408,-7458,-7508,-7557,-7606,-7655,-7704,-7752,
+    -7800,-7848,-7895,-7943,-7989,-8036,-8082,-8128,-8174,-8219,-8264,-8309,-8353,-8397,-8441,-8484,
+    -8527,-8570,-8613,-8655,-8696,-8738,-8779,-8820,-8860,-8901,-8940,-8980,-9019,-9058,-9096,-9134,
+    -9172,-9210,-9247,-9283,-9320,-9356,-9392,-9427,-9462,-9496,-9531,-9565,-9598,-9631,-9664,-9697,
+    -9729,-9760,-9792,-9823,-9853,-9884,-9914,-9943,-9972,-10001,-10029,-10057,-10085,-10112,-10139,-10165,
+    -10192,-10217,-10243,-10268,-10292,-10316,-10340,-10363,-10386,-10409,-10431,-10453,-10474,-10496,-10516,-10536,
+    -10556,-10576,-10595,-10613,-10632,-10650,-10667,-10684,-10701,-10717,-10733,-10748,-10763,-10778,-10792,-10806,
+    -10819,-10832,-10845,-10857,-10869,-10880,-10891,-10902,-10912,-10922,-10931,-10940,-10948,-10956,-10964,-10971,
+    -10978,-10985,-10991,-10996,-11001,-11006,-11010,-11014,-11018,-11021,-11024,-11026,-11028,-11029,-11030,-11031,
+    -11031,-11031,-11030,-11029,-11028,-11026,-11024,-11021,-11018,-11014,-11011,-11006,-11001,-10996,-10991,-10985,
+    -10978,-10971,-10964,-10956,-10948,-10940,-10931,-10922,-10912,-10902,-10891,-10880,-10869,-10857,-10845,-10832,
+    -10819,-10806,-10792,-10778,-10763,-10748,-10733,-10717,-10701,-10684,-10667,-10650,-10632,-10613,-10595,-10576,
+    -10556,-10536,-10516,-10496,-10474,-10453,-10431,-10409,-10386,-10363,-10340,-10316,-10292,-10268,-10243,-10217,
+    -10192,-10165,-10139,-10112,-10085,-10057,-10029,-10001,-9972,-9943,-9914,-9884,-9853,-9823,-9792,-9760,
+    -9729,-9697,-9664,-9631,-9598,-9565,-9531,-9496,-9462,-9427,-9392,-9356,-9320,-9283,-9247,-9210,
+    -9172,-9134,-9096,-9058,-9019,-8980,-8940,-8901,-8860,-8820,-8779,-8738,-8696,-8655,-8613,-8570,
+    -8527,-8484,-8441,-8397,-8353,-8309,-8264,-8219,-8174,-8128,-8082,-8036,-7989,-7943,-7895,-7848,
+    -7800,-7752,-7704,-7655,-7607,-7557,-7508,-7458,-7408,-7358,-7307,-7256,-7205,-7154,-7102,-7050,
+    -6998,-6946,-6893,-6840,-6787,-6733,-6680,-6626,-6571,-6517,-6462,-6407,-6352,-6296,-6241,-6185,
+    -6129,-6072,-6016,-5959,-5902,-5844,-5787,-5729,-5671,-5613,-5555,-5496,-5437,-5378,-5319,-5260,
+    -5200,-5140,-5080,-5020,-4960,-4899,-4838,-4778,-4716,-4655,-4594,-4532,-4470,-4408,-4346,-4284,
+    -4221,-4159,-4096,-4033,-3970,-3907,-3844,-3780,-3716,-3653,-3589,-3525,-3460,-3396,-3332,-3267,
+    -3202,-3137,-3072,-3007,-2942,-2877,-2811,-2746,-2680,-2615,-2549,-2483,-2417,-2351,-2285,-2218,
+    -2152,-2086,-2019,-1953,-1886,-1819,-1752,-1686,-1619,-1552,-1485,-1418,-1350,-1283,-1216,-1149,
+    -1081,-1014,-946,-879,-812,-744,-676,-609,-541,-474,-406,-338,-271,-203,-135,-68,
+    0,68,135,203,271,338,406,474,541,609,676,744,812,879,946,1014,
+    1081,1149,1216,1283,1350,1417,1485,1552,1619,1686,1752,1819,1886,1953,2019,2086,
+    2152,2218,2285,2351,2417,2483,2549,2615,2680,2746,2811,2877,2942,3007,3072,3137,
+    3202,3267,3332,3396,3460,3525,3589,3653,3716,3780,3843,3907,3970,4033,4096,4159,
+    4221,4284,4346,4408,4470,4532,4594,4655,4716,4778,4838,4899,4960,5020,5080,5140,
+    5200,5260,5319,5378,5437,5496,5555,5613,5671,5729,5787,5844,5902,5959,6016,6072,
+    6129,6185,6241,6296,6352,6407,6462,6517,6571,6626,6680,6733,6787,6840,6893,6946,
+    6998,7050,7102,7154,7205,7256,7307,7358,7408,7458,7508,7557,7606,7655,7704,7752,
+    7800,7848,7895,7943,7989,8036,8082,8128,8174,8219,8264,8309,8353,8397,8441,8484,
+    8527,8570,8613,8655,8696,8738,8779,8820,8860,8901,8940,8980,9019,9058,9096,9134,
+    9172,9210,9247,9283,9320,9356,9392,9427,9462,9496,9531,9565,9598,9631,9664,9697,
+    9729,9760,9792,9823,9853,9884,9914,9943,9972,10001,10029,10057,10085,10112,10139,10165,
+    10192,10217,10243,10268,10292,10316,10340,10363,10386,10409,10431,10453,10474,10496,10516,10536,
+    10556,10576,10595,10613,10632,10650,10667,10684,10701,10717,10733,10748,10763,10778,10792,10806,
+    10819,10832,10845,10857,10869,10880,10891,10902,10912,10922,10931,10940,10948,10956,10964,10971,
+    10978,10985,10991,10996,11001,11006,11010,11014,11018,11021,11024,11026,11028,11029,11030,11031};
+
+const int16_t table_wd6_mip7[1024]={
+    32764,32763,32759,32753,32744,32733,32720,32704,32685,32664,32641,32615,32587,32556,32523,32488,
+    32450,32409,32366,32321,32274,32224,32171,32117,32060,32000,31938,31874,31808,31739,31668,31595,
+    31519,31441,31361,31278,31193,31106,31017,30926,30832,30737,30639,30539,30436,30332,30226,30117,
+    30007,29894,29779,29663,29544,29423,29300,29176,29049,28921,28790,28658,28524,28388,28250,28110,
+    27969,27826,27681,27534,27386,27236,27084,26930,26775,26619,26461,26301,26139,25977,25812,25646,
+    25479,25310,25140,24969,24796,24622,24446,24270,24091,23912,23732,23550,23367,23183,22998,22811,
+    22624,22435,22246,22055,21864,21671,21478,21284,21089,20892,20695,20498,20299,20100,19900,19699,
+    19497,19295,19092,18889,18685,18480,18275,18069,17863,17656,17449,17241,17033,16825,16616,16407,
+    16197,15987,15777,15567,15356,15145,14934,14723,14511,14300,14088,13877,13665,13453,13241,13029,
+    12817,12606,12394,12182,11971,11759,11548,11337,11126,10915,10705,10494,10284,10074,9865,9656,
+    9447,9238,9030,8822,8615,8408,8201,7995,7790,7584,7380,7176,6972,6769,6566,6364,
+    6163,5962,5762,5562,5363,5165,4967,4770,4574,4378,4184,3989,3796,3603,3412,3220,
+    3030,2841,2652,2464,2277,2091,1905,1721,1537,1354,1172,991,811,632,453,276,
+    99,-76,-251,-425,-597,-769,-940,-1110,-1279,-1447,-1614,-1780,-1944,-2108,-2271,-2433,
+    -2594,-2754,-2913,-3071,-3228,-3383,-3538,-3692,-3845,-3996,-4147,-4296,-4445,-4593,-4739,-4884,
+    -5029,-5172,-5314,-5455,-5596,-5735,-5873,-6010,-6146,-6281,-6414,-6547,-6679,-6810,-6939,-7068,
+    -7196,-7322,-7448,-7572,-7696,-7818,-7939,-8060,-8179,-8297,-8414,-8531,-8646,-8760,-8873,-8986,
+    -9097,-9207,-9316,-9425,-9532,-9638,-9743,-9848,-9951,-10053,-10155,-10255,-10355,-10453,-10551,-10647,
+    -10743,-10838,-10932,-11025,-11117,-11208,-11298,-11387,-11476,-11563,-11650,-11736,-11820,-11904,-11988,-12070,
+    -12151,-12232,-12311,-12390,-12468,-12546,-12622,-12698,-12772,-12846,-12919,-12992,-13063,-13134,-13204,-13273,
+    -13342,-13410,-13477,-13543,-13608,-13673,-13737,-13800,-13863,-13925,-13986,-14046,-14106,-14165,-14223,-14281,
+    -14338,-14394,-14450,-14505,-14560,-14613,-14666,-14719,-14771,-14822,-14872,-14922,-14972,-15020,-15069,-15116,
+    -15163,-15210,-15255,-15301,-15345,-15390,-15433,-15476,-15519,-15561,-15602,-15643,-15683,-15723,-15763,-15801,
+    -15840,-15878,-15915,-15952,-15988,-16024,-16060,-16095,-16129,-16163,-16197,-16230,-16263,-16295,-16327,-16358,
+    -16389,-16420,-16450,-16479,-16509,-16538,-16566,-16594,-16622,-16649,-16676,-16703,-16729,-16755,-16780,-16805,
+    -16830,-16854,-16878,-16902,-16925,-16948,-16971,-16993,-17015,-17036,-17058,-17079,-17099,-17120,-17140,-17159,
+    -17179,-17198,-17217,-17235,-17254,-17272,-17289,-17307,-17324,-17340,-17357,-17373,-17389,-17405,-17421,-17436,
+    -17451,-17465,-17480,-17494,-17508,-17522,-17535,-17548,-17561,-17574,-17587,-17599,-17611,-17623,-17635,-17646,
+    -17657,-17668,-17679,-17689,-17700,-17710,-17720,-17729,-17739,-17748,-17757,-17766,-17775,-17783,-17792,-17800,
+    -17808,-17815,-17823,-17830,-17838,-17845,-17851,-17858,-17865,-17871,-17877,-17883,-17889,-17894,-17900,-17905,
+    -17910,-17915,-17920,-17924,-17929,-17933,-17937,-17941,-17945,-17949,-17952,-17955,-17958,-17961,-17964,-17967,
+    -17969,-17972,-17974,-17976,-17978,-17980,-17981,-17983,-17984,-17985,-17986,-17987,-17988,-17988,-17989,-17989,
+    -17989,-17989,-17989,-17988,-17988,-17987,-17986,-17985,-17984,-17983,-17981,-17980,-17978,-17976,-17974,-17972,
+    -17969,-17967,-17964,-17961,-17958,-17955,-17952,-17949,-17945,-17941,-17937,-17933,-17929,-17924,-17920,-17915,
+    -17910,-17905,-17900,-17894,-17889,-17883,-17877,-17871,-17865,-17858,-17851,-17845,-17838,-17830,-17823,-17815,
+    -17808,-17800,-17792,-17783,-17775,-17766,-17757,-17748,-17739,-17729,-17720,-17710,-17700,-17689,-17679,-17668,
+    -17657,-17646,-17635,-17623,-17611,-17599,-17587,-17574,-17561,-17548,-17535,-17522,-17508,-17494,-17480,-17465,
+    -17451,-17436,-17421,-17405,-17389,-17373,-17357,-17340,-17324,-17307,-17289,-17272,-17254,-17235,-17217,-17198,
+    -17179,-17159,-17140,-17120,-17099,-17079,-17058,-17036,-17015,-16993,-16971,-16948,-16925,-16902,-16878,-16854,
+    -16830,-16805,-16780,-16755,-16729,-16703,-16676,-16649,-16622,-16594,-16566,-16538,-16509,-16479,-16450,-16420,
+    -16389,-16358,-16327,-16295,-16263,-16230,-16197,-16163,-16129,-16095,-16060,-16024,-15988,-15952,-15915,-15878,
+    -15840,-15801,-15763,-15723,-15683,-15643,-15602,-15561,-15519,-15476,-15433,-15390,-15345,-15301,-15255,-15210,
+    -15163,-15116,-15069,-15020,-14972,-14922,-14872,-14822,-14771,-14719,-14666,-14613,-14560,-14505,-14450,-14394,
+    -14338,-14281,-14223,-14165,-14106,-14046,-13986,-13925,-13863,-13800,-13737,-13673,-13608,-13543,-13477,-13410,
+    -13342,-13273,-13204,-13134,-13063,-12992,-12919,-12846,-12772,-12698,-12622,-12546,-12468,-12390,-12311,-12232,
+    -12151,-12070,-11988,-11904,-11820,-11736,-11650,-11563,-11476,-11387,-11298,-11208,-11117,-11025,-10932,-10838,
+    -10743,-10647,-10551,-10453,-10355,-10255,-10155,-10053,-9951,-9848,-9743,-9638,-9532,-9425,-9316,-9207,
+    -9097,-8986,-8873,-8760,-8646,-8531,-8414,-8297,-8179,-8060,-7939,-7818,-7696,-7572,-7448,-7322,
+    -7196,-7068,-6939,-6810,-6679,-6547,-6414,-6281,-6146,-6010,-5873,-5735,-5596,-5455,-5314,-5172,
+    -5029,-4884,-4739,-4593,-4445,-4296,-4147,-3996,-3845,-3692,-3538,-3383,-3228,-3071,-2913,-2754,
+    -2594,-2433,-2271,-2108,-1944,-1780,-1614,-1447,-1279,-1110,-940,-769,-597,-425,-251,-76,
+    99,276,453,632,811,991,1172,1354,1537,1721,1905,2091,2277,2464,2652,2841,
+    3030,3220,3412,3603,3796,3989,4184,4378,4574,4770,4967,5165,5363,5562,5762,5962,
+    6163,6364,6566,6769,6972,7176,7380,7584,7790,7995,8201,8408,8615,8822,9030,9238,
+    9447,9656,9865,10074,10284,10494,10705,10915,11126,11337,11548,11759,11971,12182,12394,12606,
+    12817,13029,13241,13453,13665,13877,14088,14300,14511,14723,14934,15145,15356,15567,15777,15987,
+    16197,16407,16616,16825,17033,17241,17449,17656,17863,18069,18275,18480,18685,18889,19092,19295,
+    19497,19699,19900,20100,20299,20498,20695,20892,21089,21284,21478,21671,21864,22055,22246,22435,
+    22624,22811,22998,23183,23367,23550,23732,23912,24091,24270,24446,24622,24796,24969,25140,25310,
+    25479,25646,25812,25977,26139,26301,26461,26619,26775,26930,27084,27236,27386,27534,27681,27826,
+    27969,28110,28250,28388,28524,28658,28790,28921,29049,29176,29300,29423,29544,29663,29779,29894,
+    30007,30117,30226,30332,30436,30539,30639,30737,30832,30926,31017,31106,31193,31278,31361,31441,
+    31519,31595,31668,31739,31808,31874,31938,32000,32060,32117,32171,32224,32274,32321,32366,32409,
+    32450,32488,32523,32556,32587,32615,32641,32664,32685,32704,32720,32733,32744,32753,32759,32763};
+
+const int16_t table_wd6_mip8[1024]={
+    31501,31500,31497,31492,31485,31476,31464,31451,31436,31419,31400,31379,31356,31331,31304,31275,
+    31244,31211,31176,31139,31100,31059,31016,30971,30925,30876,30825,30773,30718,30661,30603,30543,
+    30480,30416,30350,30282,30212,30141,30067,29991,29914,29835,29754,29671,29586,29500,29411,29321,
+    29229,29136,29040,28943,28844,28743,28641,28536,28430,28323,28213,28102,27990,27875,27759,27641,
+    27522,27401,27279,27155,27029,26902,26773,26642,26510,26377,26242,26106,25968,25828,25687,25545,
+    25401,25256,25110,24962,24813,24662,24510,24357,24202,24046,23889,23730,23571,23410,23247,23084,
+    22919,22754,22587,22419,22249,22079,21908,21735,21562,21387,21211,21035,20857,20678,20499,20318,
+    20136,19954,19771,19586,19401,19215,19028,18841,18652,18463,18273,18083,17891,17699,17506,17313,
+    17118,16924,16728,16532,16335,16138,15940,15742,15543,15344,15144,14944,14743,14542,14340,14138,
+    13936,13733,13530,13326,13122,12918,12714,12510,12305,12100,11894,11689,11483,11278,11072,10866,
+    10659,10453,10247,10041,9834,9628,9421,9215,9009,8802,8596,8390,8184,7978,7772,7567,
+    7361,7156,6951,6746,6541,6337,6133,5929,5725,5522,5319,5116,4914,4712,4510,4309,
+    4109,3908,3708,3509,3310,3112,2914,2716,2519,2323,2127,1932,1737,1543,1350,1157,
+    965,773,582,392,203,14,-174,-362,-548,-734,-919,-1104,-1287,-1470,-1652,-1833,
+    -2014,-2193,-2372,-2550,-2726,-2903,-3078,-3252,-3425,-3598,-3769,-3940,-4110,-4278,-4446,-4613,
+    -4779,-4943,-5107,-5270,-5432,-5592,-5752,-5911,-6069,-6225,-6381,-6535,-6689,-6841,-6992,-7142,
+    -7292,-7440,-7586,-7732,-7877,-8020,-8163,-8304,-8444,-8583,-8721,-8858,-8994,-9128,-9261,-9393,
+    -9524,-9654,-9783,-9910,-10036,-10162,-10285,-10408,-10530,-10650,-10769,-10887,-11004,-11120,-11234,-11347,
+    -11459,-11570,-11680,-11788,-11896,-12002,-12107,-12210,-12313,-12414,-12514,-12613,-12711,-12808,-12903,-12997,
+    -13090,-13182,-13273,-13362,-13451,-13538,-13624,-13709,-13792,-13875,-13956,-14036,-14115,-14193,-14270,-14346,
+    -14420,-14494,-14566,-14637,-14707,-14776,-14844,-14911,-14976,-15041,-15104,-15167,-15228,-15289,-15348,-15406,
+    -15463,-15519,-15574,-15628,-15681,-15733,-15784,-15834,-15883,-15931,-15978,-16024,-16069,-16113,-16157,-16199,
+    -16240,-16281,-16320,-16359,-16396,-16433,-16469,-16504,-16538,-16571,-16604,-16635,-16666,-16696,-16725,-16753,
+    -16781,-16807,-16833,-16858,-16883,-16906,-16929,-16951,-16973,-16993,-17013,-17032,-17051,-17069,-17086,-17103,
+    -17118,-17134,-17148,-17162,-17176,-17188,-17200,-17212,-17223,-17233,-17243,-17253,-17261,-17270,-17277,-17285,
+    -17291,-17298,-17303,-17309,-17313,-17318,-17322,-17325,-17328,-17331,-17333,-17335,-17337,-17338,-17338,-17339,
+    -17339,-17338,-17338,-17337,-17336,-17334,-17332,-17330,-17328,-17325,-17322,-17319,-17315,-17312,-17308,-17304,
+    -17300,-17295,-17290,-17286,-17281,-17275,-17270,-17265,-17259,-17253,-17247,-17242,-17235,-17229,-17223,-17217,
+    -17210,-17204,-17197,-17191,-17184,-17178,-17171,-17164,-17157,-17151,-17144,-17137,-17131,-17124,-17117,-17111,
+    -17104,-17097,-17091,-17084,-17078,-17072,-17065,-17059,-17053,-17047,-17041,-17035,-17029,-17024,-17018,-17013,
+    -17007,-17002,-16997,-16992,-16987,-16983,-16978,-16974,-16969,-16965,-16961,-16958,-16954,-16951,-16947,-16944,
+    -16941,-16938,-16936,-16933,-16931,-16929,-16927,-16925,-16924,-16922,-16921,-16920,-16919,-16918,-16918,-16918,
+    -16918,-16918,-16918,-16918,-16919,-16920,-16921,-16922,-16924,-16925,-16927,-16929,-16931,-16933,-16936,-16938,
+    -16941,-16944,-16947,-16951,-16954,-16958,-16961,-16965,-16969,-16974,-16978,-16983,-16987,-16992,-16997,-17002,
+    -17007,-17013,-17018,-17024,-17029,-17035,-17041,-17047,-17053,-17059,-17065,-17072,-17078,-17084,-17091,-17097,
+    -17104,-17111,-17117,-17124,-17131,-17137,-17144,-17151,-17157,-17164,-17171,-17178,-17184,-17191,-17197,-17204,
+    -17210,-17217,-17223,-17229,-17235,-17242,-17247,-17253,-17259,-17265,-17270,-17275,-17281,-17286,-17290,-17295,
+    -17300,-17304,-17308,-17312,-17315,-17319,-17322,-17325,-17328,-17330,-17332,-17334,-17336,-17337,-17338,-17338,
+    -17339,-17339,-17338,-17338,-17337,-17335,-17333,-17331,-17328,-17325,-17322,-17318,-17313,-17309,-17303,-17298,
+    -17291,-17285,-17277,-17270,-17261,-17253,-17243,-17233,-17223,-17212,-17200,-17188,-17176,-17162,-17148,-17134,
+    -17118,-17103,-17086,-17069,-17051,-17032,-17013,-16993,-16973,-16951,-16929,-16906,-16883,-16858,-16833,-16807,
+    -16781,-16753,-16725,-16696,-16666,-16635,-16604,-16571,-16538,-16504,-16469,-16433,-16396,-16359,-16320,-16281,
+    -16240,-16199,-16157,-16113,-16069,-16024,-15978,-15931,-15883,-15834,-15784,-15733,-15681,-15628,-15574,-15519,
+    -15463,-15406,-15348,-15289,-15228,-15167,-15104,-15041,-14976,-14911,-14844,-14776,-14707,-14637,-14566,-14494,
+    -14420,-14346,-14270,-14193,-14115,-14036,-13956,-13875,-13792,-13709,-13624,-13538,-13451,-13362,-13273,-13182,
+    -13090,-12997,-12903,-12808,-12711,-12613,-12514,-12414,-12313,-12210,-12107,-12002,-11896,-11788,-11680,-11570,
+    -11459,-11347,-11234,-11120,-11004,-10887,-10769,-10650,-10530,-10408,-10285,-10162,-10036,-9910,-9783,-9654,
+    -9524,-9393,-9261,-9128,-8994,-8858,-8721,-8583,-8444,-8304,-8163,-8020,-7877,-7732,-7586,-7440,
+    -7292,-7142,-6992,-6841,-6689,-6535,-6381,-6225,-6069,-5911,-5752,-5592,-5432,-5270,-5107,-4943,
+    -4779,-4613,-4446,-4278,-4110,-3940,-3769,-3598,-3425,-3252,-3078,-2903,-2726,-2550,-2372,-2193,
+    -2014,-1833,-1652,-1470,-1287,-1104,-919,-734,-548,-362,-174,14,203,392,582,773,
+    965,1157,1350,1543,1737,1932,2127,2323,2519,2716,2914,3112,3310,3509,3708,3908,
+    4109,4309,4510,4712,4914,5116,5319,5522,5725,5929,6133,6337,6541,6746,6951,7156,
+    7361,7567,7772,7978,8184,8390,8596,8802,9009,9215,9421,9628,9834,10041,10247,10453,
+    10659,10866,11072,11278,11483,11689,11894,12100,12305,12510,12714,12918,13122,13326,13530,13733,
+    13936,14138,14340,14542,14743,14944,15144,15344,15543,15742,15940,16138,16335,16532,16728,16924,
+    17118,17313,17506,17699,17891,18083,18273,18463,18652,18841,19028,19215,19401,19586,19771,19954,
+    20136,20318,20499,20678,20857,21035,21211,21387,21562,21735,21908,22079,22249,22419,22587,22754,
+    22919,23084,23247,23410,23571,23730,23889,24046,24202,24357,24510,24662,24813,24962,25110,25256,
+    25401,25545,25687,25828,25968,26106,26242,26377,26510,26642,26773,26902,27029,27155,27279,27401,
+    27522,27641,27759,27875,27990,28102,28213,28323,28430,28536,28641,28743,28844,28943,29040,29136,
+    29229,29321,29411,29500,29586,29671,29754,29835,29914,29991,30067,30141,30212,30282,30350,30416,
+    30480,30543,30603,30661,30718,30773,30825,30876,30925,30971,31016,31059,31100,31139,31176,31211,
+    31244,31275,31304,31331,31356,31379,31400,31419,31436,31451,31464,31476,31485,31492,31497,31500};
+
+const int16_t table_wd6_mip9[1024]={
+    24209,24209,24207,24205,24202,24198,24193,24187,24180,24172,24164,24154,24143,24132,24120,24107,
+    24093,24078,24062,24045,24027,24008,23989,23968,23947,23925,23902,23878,23853,23827,23800,23772,
+    23744,23714,23684,23653,23621,23588,23554,23519,23484,23447,23410,23371,23332,23292,23251,23209,
+    23167,23123,23079,23033,22987,22940,22892,22844,22794,22743,22692,22640,22587,22533,22478,22423,
+    22366,22309,22251,22192,22132,22072,22010,21948,21885,21821,21756,21691,21624,21557,21489,21420,
+    21351,21280,21209,21137,21064,20990,20916,20841,20765,20688,20611,20532,20453,20373,20293,20211,
+    20129,20046,19963,19878,19793,19707,19620,19533,19445,19356,19266,19176,19085,18993,18901,18808,
+    18714,18619,18524,18428,18331,18234,18136,18037,17938,17838,17737,17635,17533,17431,17327,17223,
+    17118,17013,16907,16800,16693,16585,16477,16368,16258,16147,16036,15925,15813,15700,15587,15473,
+    15358,15243,15127,15011,14894,14777,14659,14540,14421,14302,14182,14061,13940,13818,13696,13573,
+    13450,13326,13202,13077,12952,12826,12700,12573,12446,12318,12190,12062,11933,11803,11673,11543,
+    11412,11281,11149,11017,10885,10752,10619,10485,10351,10216,10081,9946,9811,9675,9538,9401,
+    9264,9127,8989,8851,8713,8574,8435,8296,8156,8016,7875,7735,7594,7453,7311,7170,
+    7028,6885,6743,6600,6457,6314,6170,6026,5882,5738,5594,5449,5304,5159,5014,4869,
+    4723,4577,4431,4285,4139,3992,3846,3699,3552,3405,3258,3111,2963,2816,2668,2521,
+    2373,2225,2077,1929,1781,1633,1485,1336,1188,1039,891,743,594,446,297,149,
+    0,-149,-297,-446,-594,-743,-891,-1039,-1188,-1336,-1485,-1633,-1781,-1929,-2077,-2225,
+    -2373,-2521,-2668,-2816,-2963,-3111,-3258,-3405,-3552,-3699,-3846,-3992,-4139,-4285,-4431,-4577,
+    -4723,-4869,-5014,-5159,-5304,-5449,-5594,-5738,-5882,-6026,-6170,-6314,-6457,-6600,-6743,-6885,
+    -7028,-7170,-7311,-7453,-7594,-7735,-7875,-8016,-8156,-8296,-8435,-8574,-8713,-8851,-8989,-9127,
+    -9264,-9401,-9538,-9675,-9811,-9946,-10081,-10216,-10351,-10485,-10619,-10752,-10885,-11017,-11149,-11281,
+    -11412,-11543,-11673,-11803,-11933,-12062,-12190,-12318,-12446,-12573,-12700,-12826,-12952,-13077,-13202,-13326,
+    -13450,-13573,-13696,-13818,-13940,-14061,-14182,-14302,-14421,-14540,-14659,-14777,-14894,-15011,-15127,-15243,
+    -15358,-15473,-15587,-15700,-15813,-15925,-16036,-16147,-16258,-16368,-16477,-16585,-16693,-16800,-16907,-17013,
+    -17118,-17223,-17327,-17431,-17533,-17635,-17737,-17838,-17938,-18037,-18136,-18234,-18331,-18428,-18524,-18619,
+    -18714,-18808,-18901,-18993,-19085,-19176,-19266,-19356,-19445,-19533,-19620,-19707,-19793,-19878,-19963,-20046,
+    -20129,-20211,-20293,-20373,-20453,-20532,-20611,-20688,-20765,-20841,-20916,-20990,-21064,-21137,-21209,-21280,
+    -21351,-21420,-21489,-21557,-21624,-21691,-21756,-21821,-21885,-21948,-22010,-22072,-22132,-22192,-22251,-22309,
+    -22366,-22423,-22478,-22533,-22587,-22640,-22692,-22743,-22794,-22844,-22892,-22940,-22987,-23033,-23079,-23123,
+    -23167,-23209,-23251,-23292,-23332,-23371,-23410,-23447,-23484,-23519,-23554,-23588,-23621,-23653,-23684,-23714,
+    -23744,-23772,-23800,-23827,-23853,-23878,-23902,-23925,-23947,-23968,-23989,-24008,-24027,-24045,-24062,-24078,
+    -24093,-24107,-24120,-24132,-24143,-24154,-24164,-24172,-24180,-24187,-24193,-24198,-24202,-24205,-24207,-24209,
+    -24209,-24209,-24207,-24205,-24202,-24198,-24193,-24187,-24180,-24172,-24164,-24154,-24143,-24132,-24120,-24107,
+    -24093,-24078,-24062,-24045,-24027,-24008,-23989,-23968,-23947,-23925,-23902,-23878,-23853,-23827,-23800,-23772,
+    -23744,-23714,-23684,-23653,-23621,-23588,-23554,-23519,-23484,-23447,-23410,-23371,-23332,-23292,-23251,-23209,
+    -23167,-23123,-23079,-23033,-22987,-22940,-22892,-22844,-22794,-22743,-22692,-22640,-22587,-22533,-22478,-22423,
+    -22366,-22309,-22251,-22192,-22132,-22072,-22010,-21948,-21885,-21821,-21756,-21691,-21624,-21557,-21489,-21420,
+    -21351,-21280,-21209,-21137,-21064,-20990,-20916,-20841,-20765,-20688,-20611,-20532,-20453,-20373,-20293,-20211,
+    -20129,-20046,-19963,-19878,-19793,-19707,-19620,-19533,-19445,-19356,-19266,-19176,-19085,-18993,-18901,-18808,
+    -18714,-18619,-18524,-18428,-18331,-18234,-18136,-18037,-17938,-17838,-17737,-17635,-17533,-17431,-17327,-17223,
+    -17118,-17013,-16907,-16800,-16693,-16585,-16477,-16368,-16258,-16147,-16036,-15925,-15813,-15700,-15587,-15473,
+    -15358,-15243,-15127,-15011,-14894,-14777,-14659,-14540,-14421,-14302,-14182,-14061,-13940,-13818,-13696,-13573,
+    -13450,-13326,-13202,-13077,-12952,-12826,-12700,-12573,-12446,-12318,-12190,-12062,-11933,-11803,-11673,-11543,
+    -11412,-11281,-11149,-11017,-10885,-10752,-10619,-10485,-10351,-10216,-10081,-9946,-9811,-9675,-9538,-9401,
+    -9264,-9127,-8989,-8851,-8713,-8574,-8435,-8296,-8156,-8016,-7875,-7735,-7594,-7453,-7311,-7170,
+    -7028,-6885,-6743,-6600,-6457,-6314,-6170,-6026,-5882,-5738,-5594,-5449,-5304,-5159,-5014,-4869,
+    -4723,-4577,-4431,-4285,-4139,-3992,-3846,-3699,-3552,-3405,-3258,-3111,-2963,-2816,-2668,-2521,
+    -2373,-2225,-2077,-1929,-1781,-1633,-1485,-1336,-1188,-1039,-891,-743,-594,-446,-297,-149,
+    0,149,297,446,594,743,891,1039,1188,1336,1485,1633,1781,1929,2077,2225,
+    2373,2521,2668,2816,2963,3111,3258,3405,3552,3699,3846,3992,4139,4285,4431,4577,
+    4723,4869,5014,5159,5304,5449,5594,5738,5882,6026,6170,6314,6457,6600,6743,6885,
+    7028,7170,7311,7453,7594,7735,7875,8016,8156,8296,8435,8574,8713,8851,8989,9127,
+    9264,9401,9538,9675,9811,9946,10081,10216,10351,10485,10619,10752,10885,11017,11149,11281,
+    11412,11543,11673,11803,11933,12062,12190,12318,12446,12573,12700,12826,12952,13077,13202,13326,
+    13450,13573,13696,13818,13940,14061,14182,14302,14421,14540,14659,14777,14894,15011,15127,15243,
+    15358,15473,15587,15700,15813,15925,16036,16147,16258,16368,16477,16585,16693,16800,16907,17013,
+    17118,17223,17327,17431,17533,17635,17737,17838,17938,18037,18136,18234,18331,18428,18524,18619,
+    18714,18808,18901,18993,19085,19176,19266,19356,19445,19533,19620,19707,19793,19878,19963,20046,
+    20129,20211,20293,20373,20453,20532,20611,20688,20765,20841,20916,20990,21064,21137,21209,21280,
+    21351,21420,21489,21557,21624,21691,21756,21821,21885,21948,22010,22072,22132,22192,22251,22309,
+    22366,22423,22478,22533,22587,22640,22692,22743,22794,22844,22892,22940,22987,23033,23079,23123,
+    23167,23209,23251,23292,23332,23371,23410,23447,23484,23519,23554,23588,23621,23653,23684,23714,
+    23744,23772,23800,23827,23853,23878,23902,23925,23947,23968,23989,24008,24027,24045,24062,24078,
+    24093,24107,24120,24132,24143,24154,24164,24172,24180,24187,24193,24198,24202,24205,24207,24209};
+
+const int16_t table_wd7_mip6[1024]={
+    21782,21780,21772,21761,21744,21723,21697,21667,21632,21593,21549,21502,21450,21394,21335,21272,
+    21205,21135,21062,20986,20907,20826,20742,20656,20568,20478,20386,20294,20200,20105,20009,19913,
+    19816,19720,19624,19528,19432,19338,19245,19152,19062,18972,18885,18800,18717,18636,18557,18482,
+    18409,18339,18272,18208,18147,18090,18036,17985,17938,17895,17855,17818,17786,17756,17731,17709,
+    17690,17675,17663,17655,17650,17647,17648,17652,17658,17667,17678,17691,17707,17724,17743,17764,
+    17786,17809,17832,17856,17881,17906,17931,17955,17979,18001,18023,18044,18063,18080,18095,18108,
+    18118,18125,18130,18131,18129,18123,18114,18100,18082,18060,18033,18002,17966,17924,17878,17827,
+    17770,17708,17641,17568,17489,17405,17316,17221,17121,17015,16903,16787,16665,16538,16407,16270,
+    16128,15983,15832,15678,15519,15357,15192,15023,14851,14677,14500,14321,14140,13958,13774,13590,
+    13406,13221,13036,12852,12670,12488,12308,12130,11955,11783,11614,11449,11287,11130,10978,10831,
+    10689,10553,10424,10301,10185,10076,9974,9880,9794,9717,9648,9588,9537,9496,9463,9441,
+    9428,9425,9432,9449,9476,9514,9562,9620,9688,9767,9856,9955,10064,10183,10312,10451,
+    10599,10756,10922,11097,11281,11473,11672,11880,12094,12316,12544,12778,13017,13262,13512,13766,
+    14024,14285,14549,14815,15084,15353,15623,15893,16163,16432,16700,16965,17228,17487,17742,17994,
+    18240,18480,18715,18942,19163,19376,19580,19776,19962,20138,20304,20459,20603,20735,20854,20961,
+    21055,21136,21203,21256,21294,21317,21326,21319,21297,21258,21205,21135,21048,20946,20827,20692,
+    20540,20371,20187,19985,19768,19534,19284,19018,18736,18439,18126,17798,17455,17098,16726,16340,
+    15941,15529,15103,14665,14216,13754,13282,12799,12306,11803,11291,10771,10243,9707,9164,8615,
+    8060,7500,6936,6367,5795,5221,4644,4065,3485,2905,2325,1745,1167,591,17,-555,
+    -1123,-1686,-2246,-2801,-3350,-3893,-4430,-4961,-5484,-5999,-6507,-7007,-7497,-7979,-8452,-8915,
+    -9369,-9812,-10245,-10668,-11080,-11482,-11872,-12252,-12620,-12978,-13324,-13659,-13983,-14296,-14598,-14889,
+    -15169,-15437,-15696,-15943,-16181,-16408,-16625,-16832,-17030,-17218,-17398,-17568,-17730,-17884,-18030,-18168,
+    -18299,-18423,-18540,-18652,-18757,-18857,-18951,-19041,-19127,-19208,-19286,-19360,-19432,-19500,-19567,-19632,
+    -19695,-19758,-19819,-19880,-19941,-20002,-20063,-20126,-20189,-20254,-20320,-20388,-20459,-20532,-20607,-20685,
+    -20766,-20851,-20938,-21029,-21124,-21222,-21324,-21430,-21540,-21654,-21772,-21894,-22020,-22150,-22284,-22422,
+    -22564,-22709,-22859,-23012,-23168,-23328,-23491,-23658,-23827,-23999,-24174,-24351,-24530,-24712,-24895,-25080,
+    -25266,-25453,-25641,-25830,-26020,-26209,-26398,-26587,-26775,-26963,-27149,-27334,-27518,-27699,-27879,-28056,
+    -28231,-28402,-28571,-28737,-28899,-29058,-29212,-29363,-29510,-29652,-29790,-29923,-30051,-30175,-30294,-30407,
+    -30515,-30618,-30716,-30808,-30895,-30977,-31053,-31124,-31189,-31249,-31304,-31353,-31397,-31436,-31469,-31498,
+    -31522,-31541,-31555,-31565,-31571,-31572,-31569,-31562,-31552,-31538,-31521,-31500,-31477,-31451,-31422,-31391,
+    -31358,-31323,-31287,-31249,-31210,-31169,-31128,-31087,-31045,-31003,-30960,-30919,-30877,-30837,-30797,-30758,
+    -30721,-30684,-30650,-30617,-30586,-30557,-30530,-30505,-30482,-30462,-30445,-30430,-30417,-30408,-30401,-30397,
+    -30395,-30397,-30401,-30408,-30417,-30430,-30445,-30462,-30482,-30505,-30530,-30557,-30586,-30617,-30650,-30684,
+    -30721,-30758,-30797,-30837,-30877,-30919,-30960,-31003,-31045,-31087,-31128,-31169,-31210,-31249,-31287,-31323,
+    -31358,-31391,-31422,-31451,-31477,-31500,-31521,-31538,-31552,-31562,-31569,-31572,-31571,-31565,-31555,-31541,
+    -31522,-31498,-31469,-31436,-31397,-31353,-31304,-31249,-31189,-31124,-31053,-30977,-30895,-30808,-30716,-30618,
+    -30515,-30407,-30294,-30175,-30051,-29923,-29790,-29652,-29510,-29363,-29212,-29058,-28899,-28737,-28571,-28402,
+    -28231,-28056,-27879,-27699,-27518,-27334,-27149,-26963,-26775,-26587,-26398,-26209,-26020,-25830,-25641,-25453,
+    -25266,-25080,-24895,-24712,-24530,-24351,-24174,-23999,-23827,-23658,-23491,-23328,-23168,-23012,-22859,-22709,
+    -22564,-22422,-22284,-22150,-22020,-21894,-21772,-21654,-21540,-21430,-21324,-21222,-21124,-21029,-20938,-20851,
+    -20766,-20685,-20607,-20532,-20459,-20388,-20320,-20254,-20189,-20126,-20063,-20002,-19941,-19880,-19819,-19758,
+    -19695,-19632,-19567,-19500,-19432,-19360,-19286,-19208,-19127,-19041,-18951,-18857,-18757,-18652,-18540,-18423,
+    -18299,-18168,-18030,-17884,-17730,-17568,-17398,-17218,-17030,-16832,-16625,-16408,-16181,-15943,-15696,-15437,
+    -15169,-14889,-14598,-14296,-13983,-13659,-13324,-12978,-12620,-12252,-11872,-11482,-11080,-10668,-10245,-9812,
+    -9369,-8915,-8452,-7979,-7497,-7007,-6507,-5999,-5484,-4961,-4430,-3893,-3350,-2801,-2246,-1686,
+    -1123,-555,17,591,1167,1745,2325,2905,3485,4065,4644,5221,5795,6367,6936,7500,
+    8060,8615,9164,9707,10243,10771,11291,11803,12306,12799,13282,13754,14216,14665,15103,15529,
+    15941,16340,16726,17098,17455,17798,18126,18439,18736,19018,19284,19534,19768,19985,20187,20371,
+    20540,20692,20827,20946,21048,21135,21205,21258,21297,21319,21326,21317,21294,21256,21203,21136,
+    21055,20961,20854,20735,20603,20459,20304,20138,19962,19776,19580,19376,19163,18942,18715,18480,
+    18240,17994,17742,17487,17228,16965,16700,16432,16163,15893,15623,15353,15084,14815,14549,14285,
+    14024,13766,13512,13262,13017,12778,12544,12316,12094,11880,11672,11473,11281,11097,10922,10756,
+    10599,10451,10312,10183,10064,9955,9856,9767,9688,9620,9562,9514,9476,9449,9432,9425,
+    9428,9441,9463,9496,9537,9588,9648,9717,9794,9880,9974,10076,10185,10301,10424,10553,
+    10689,10831,10978,11130,11287,11449,11614,11783,11955,12130,12308,12488,12670,12852,13036,13221,
+    13406,13590,13774,13958,14140,14321,14500,14677,14851,15023,15192,15357,15519,15678,15832,15983,
+    16128,16270,16407,16538,16665,16787,16903,17015,17121,17221,17316,17405,17489,17568,17641,17708,
+    17770,17827,17878,17924,17966,18002,18033,18060,18082,18100,18114,18123,18129,18131,18130,18125,
+    18118,18108,18095,18080,18063,18044,18023,18001,17979,17955,17931,17906,17881,17856,17832,17809,
+    17786,17764,17743,17724,17707,17691,17678,17667,17658,17652,17648,17647,17650,17655,17663,17675,
+    17690,17709,17731,17756,17786,17818,17855,17895,17938,17985,18036,18090,18147,18208,18272,18339,
+    18409,18482,18557,18636,18717,18800,18885,18972,19062,19152,19245,19338,19432,19528,19624,19720,
+    19816,19913,20009,20105,20200,20294,20386,20478,20568,20656,20742,20826,20907,20986,21062,21135,
+    21205,21272,21335,21394,21450,21502,21549,21593,21632,21667,21697,21723,21744,21761,21772,21780};
+
+const int16_t table_wd7_mip7[1024]={
+    22610,22609,22605,22597,22588,22575,22560,22541,22520,22497,22470,22441,22409,22374,22337,22297,
+    22254,22209,22162,22111,22058,22003,21946,21885,21823,21758,21691,21622,21550,21476,21400,21323,
+    21243,21161,21077,20991,20904,20814,20723,20631,20536,20440,20343,20244,20144,20043,19940,19836,
+    19731,19625,19518,19410,19302,19192,19082,18971,18859,18747,18635,18522,18408,18295,18181,18067,
+    17954,17840,17726,17612,17499,17386,17273,17161,17049,16938,16827,16717,16608,16500,16392,16286,
+    16180,16076,15972,15870,15769,15669,15571,15474,15379,15285,15193,15102,15013,14926,14840,14756,
+    14675,14595,14517,14441,14367,14295,14225,14157,14092,14029,13968,13909,13852,13798,13746,13697,
+    13650,13605,13563,13523,13486,13451,13418,13388,13361,13336,13313,13293,13275,13260,13248,13237,
+    13230,13224,13222,13221,13223,13228,13234,13244,13255,13269,13285,13303,13323,13346,13371,13398,
+    13426,13457,13490,13525,13562,13601,13641,13683,13727,13773,13820,13868,13918,13970,14023,14077,
+    14133,14189,14247,14306,14365,14426,14488,14550,14613,14676,14741,14805,14870,14936,15001,15067,
+    15133,15199,15264,15330,15395,15461,15525,15590,15653,15716,15779,15840,15901,15961,16019,16077,
+    16133,16188,16241,16294,16344,16393,16440,16486,16529,16571,16610,16648,16683,16716,16747,16775,
+    16801,16824,16844,16862,16877,16889,16898,16904,16907,16907,16904,16897,16887,16874,16857,16837,
+    16813,16786,16755,16720,16681,16639,16593,16542,16488,16430,16368,16301,16231,16156,16077,15994,
+    15907,15815,15719,15619,15514,15405,15292,15174,15052,14925,14794,14659,14519,14374,14225,14072,
+    13914,13752,13585,13414,13238,13058,12874,12685,12492,12294,12092,11886,11676,11461,11243,11020,
+    10793,10561,10326,10087,9844,9597,9346,9091,8832,8570,8304,8034,7761,7484,7204,6921,
+    6634,6344,6051,5755,5455,5153,4848,4540,4229,3916,3600,3281,2960,2637,2312,1984,
+    1654,1323,989,653,316,-23,-363,-705,-1049,-1393,-1739,-2086,-2434,-2783,-3133,-3483,
+    -3834,-4186,-4538,-4891,-5244,-5596,-5950,-6303,-6655,-7008,-7360,-7712,-8064,-8415,-8765,-9115,
+    -9463,-9811,-10158,-10503,-10848,-11191,-11533,-11873,-12212,-12549,-12884,-13218,-13549,-13879,-14207,-14532,
+    -14856,-15177,-15496,-15812,-16126,-16437,-16746,-17052,-17355,-17655,-17953,-18248,-18539,-18828,-19113,-19395,
+    -19674,-19950,-20223,-20492,-20757,-21020,-21278,-21534,-21785,-22033,-22277,-22518,-22755,-22988,-23218,-23443,
+    -23665,-23883,-24097,-24308,-24514,-24716,-24915,-25110,-25300,-25487,-25670,-25849,-26024,-26195,-26362,-26525,
+    -26684,-26839,-26990,-27138,-27281,-27421,-27557,-27689,-27817,-27942,-28062,-28179,-28293,-28402,-28508,-28611,
+    -28709,-28804,-28896,-28984,-29069,-29151,-29229,-29304,-29375,-29443,-29509,-29571,-29630,-29686,-29739,-29789,
+    -29836,-29881,-29922,-29961,-29998,-30032,-30063,-30092,-30119,-30143,-30165,-30184,-30202,-30217,-30231,-30242,
+    -30252,-30260,-30266,-30270,-30273,-30274,-30273,-30271,-30268,-30263,-30257,-30250,-30242,-30233,-30223,-30211,
+    -30199,-30186,-30172,-30158,-30143,-30127,-30111,-30094,-30077,-30060,-30042,-30024,-30006,-29988,-29969,-29951,
+    -29932,-29914,-29895,-29877,-29859,-29841,-29824,-29806,-29790,-29773,-29757,-29741,-29726,-29712,-29698,-29684,
+    -29672,-29659,-29648,-29637,-29627,-29618,-29609,-29601,-29594,-29588,-29582,-29578,-29574,-29571,-29569,-29568,
+    -29567,-29568,-29569,-29571,-29574,-29578,-29582,-29588,-29594,-29601,-29609,-29618,-29627,-29637,-29648,-29659,
+    -29672,-29684,-29698,-29712,-29726,-29741,-29757,-29773,-29790,-29806,-29824,-29841,-29859,-29877,-29895,-29914,
+    -29932,-29951,-29969,-29988,-30006,-30024,-30042,-30060,-30077,-30094,-30111,-30127,-30143,-30158,-30172,-30186,
+    -30199,-30211,-30223,-30233,-30242,-30250,-30257,-30263,-30268,-30271,-30273,-30274,-30273,-30270,-30266,-30260,
+    -30252,-30242,-30231,-30217,-30202,-30184,-30165,-30143,-30119,-30092,-30063,-30032,-29998,-29961,-29922,-29881,
+    -29836,-29789,-29739,-29686,-29630,-29571,-29509,-29443,-29375,-29304,-29229,-29151,-29069,-28984,-28896,-28804,
+    -28709,-28611,-28508,-28402,-28293,-28179,-28062,-27942,-27817,-27689,-27557,-27421,-27281,-27138,-26990,-26839,
+    -26684,-26525,-26362,-26195,-26024,-25849,-25670,-25487,-25300,-25110,-24915,-24716,-24514,-24308,-24097,-23883,
+    -23665,-23443,-23218,-22988,-22755,-22518,-22277,-22033,-21785,-21534,-21278,-21020,-20757,-20492,-20223,-19950,
+    -19674,-19395,-19113,-18828,-18539,-18248,-17953,-17655,-17355,-17052,-16746,-16437,-16126,-15812,-15496,-15177,
+    -14856,-14532,-14207,-13879,-13549,-13218,-12884,-12549,-12212,-11873,-11533,-11191,-10848,-10503,-10158,-9811,
+    -9463,-9115,-8765,-8415,-8064,-7712,-7360,-7008,-6655,-6303,-5950,-5596,-5244,-4891,-4538,-4186,
+    -3834,-3483,-3133,-2783,-2434,-2086,-1739,-1393,-1049,-705,-363,-23,316,653,989,1323,
+    1654,1984,2312,2637,2960,3281,3600,3916,4229,4540,4848,5153,5455,5755,6051,6344,
+    6634,6921,7204,7484,7761,8034,8304,8570,8832,9091,9346,9597,9844,10087,10326,10561,
+    10793,11020,11243,11461,11676,11886,12092,12294,12492,12685,12874,13058,13238,13414,13585,13752,
+    13914,14072,14225,14374,14519,14659,14794,14925,15052,15174,15292,15405,15514,15619,15719,15815,
+    15907,15994,16077,16156,16231,16301,16368,16430,16488,16542,16593,16639,16681,16720,16755,16786,
+    16813,16837,16857,16874,16887,16897,16904,16907,16907,16904,16898,16889,16877,16862,16844,16824,
+    16801,16775,16747,16716,16683,16648,16610,16571,16529,16486,16440,16393,16344,16294,16241,16188,
+    16133,16077,16019,15961,15901,15840,15779,15716,15653,15590,15525,15461,15395,15330,15264,15199,
+    15133,15067,15001,14936,14870,14805,14741,14676,14613,14550,14488,14426,14365,14306,14247,14189,
+    14133,14077,14023,13970,13918,13868,13820,13773,13727,13683,13641,13601,13562,13525,13490,13457,
+    13426,13398,13371,13346,13323,13303,13285,13269,13255,13244,13234,13228,13223,13221,13222,13224,
+    13230,13237,13248,13260,13275,13293,13313,13336,13361,13388,13418,13451,13486,13523,13563,13605,
+    13650,13697,13746,13798,13852,13909,13968,14029,14092,14157,14225,14295,14367,14441,14517,14595,
+    14675,14756,14840,14926,15013,15102,15193,15285,15379,15474,15571,15669,15769,15870,15972,16076,
+    16180,16286,16392,16500,16608,16717,16827,16938,17049,17161,17273,17386,17499,17612,17726,17840,
+    17954,18067,18181,18295,18408,18522,18635,18747,18859,18971,19082,19192,19302,19410,19518,19625,
+    19731,19836,19940,20043,20144,20244,20343,20440,20536,20631,20723,20814,20904,20991,21077,21161,
+    21243,21323,21400,21476,21550,21622,21691,21758,21823,21885,21946,22003,22058,22111,22162,22209,
+    22254,22297,22337,22374,22409,22441,22470,22497,22520,22541,22560,22575,22588,22597,22605,22609};
+
+const int16_t table_wd7_mip8[1024]={
+    17392,17393,17393,17394,17395,17397,17398,17400,17403,17406,17409,17412,17416,17420,17424,17429,
+    17434,17439,17445,17451,17457,17463,17470,17477,17485,17492,17500,17508,17517,17525,17534,17544,
+    17553,17563,17573,17583,17593,17604,17615,17626,17637,17649,17661,17673,17685,17697,17709,17722,
+    17735,17748,17761,17774,17787,17800,17814,17828,17841,17855,17869,17883,17897,17911,17925,17939,
+    17954,17968,17982,17996,18010,18025,18039,18053,18067,18081,18095,18109,18123,18136,18150,18163,
+    18177,18190,18203,18216,18229,18241,18254,18266,18278,18289,18301,18312,18323,18334,18344,18354,
+    18364,18374,18383,18392,18400,18408,18416,18423,18430,18437,18443,18449,18454,18459,18463,18467,
+    18470,18473,18475,18477,18479,18479,18479,18479,18478,18476,18474,18471,18468,18464,18459,18454,
+    18447,18441,18433,18425,18416,18406,18396,18384,18372,18360,18346,18332,18316,18300,18283,18266,
+    18247,18228,18207,18186,18164,18140,18116,18091,18065,18038,18011,17982,17952,17921,17889,17856,
+    17822,17787,17751,17714,17676,17636,17596,17554,17512,17468,17423,17377,17330,17281,17232,17181,
+    17129,17076,17022,16967,16910,16852,16793,16733,16671,16608,16544,16479,16412,16344,16275,16205,
+    16133,16060,15985,15910,15833,15754,15675,15594,15511,15428,15343,15256,15168,15079,14989,14897,
+    14804,14709,14613,14516,14417,14317,14216,14113,14008,13903,13796,13687,13577,13466,13353,13239,
+    13124,13007,12889,12769,12648,12526,12402,12276,12150,12022,11892,11761,11629,11496,11361,11224,
+    11086,10947,10807,10665,10521,10377,10231,10083,9934,9784,9633,9480,9326,9171,9014,8856,
+    8696,8536,8373,8210,8046,7880,7712,7544,7374,7203,7031,6858,6683,6507,6330,6152,
+    5972,5791,5609,5426,5242,5057,4870,4683,4494,4304,4113,3921,3728,3534,3338,3142,
+    2945,2746,2547,2347,2145,1943,1740,1536,1330,1124,917,710,501,291,81,-130,
+    -342,-555,-769,-983,-1199,-1415,-1631,-1849,-2067,-2285,-2505,-2725,-2946,-3167,-3389,-3611,
+    -3834,-4058,-4282,-4507,-4732,-4958,-5184,-5410,-5637,-5865,-6093,-6321,-6549,-6778,-7007,-7237,
+    -7467,-7697,-7927,-8158,-8388,-8619,-8850,-9081,-9313,-9544,-9776,-10008,-10239,-10471,-10703,-10934,
+    -11166,-11398,-11629,-11861,-12092,-12324,-12555,-12786,-13017,-13247,-13478,-13708,-13938,-14167,-14396,-14625,
+    -14854,-15082,-15310,-15537,-15764,-15991,-16217,-16443,-16668,-16892,-17116,-17340,-17562,-17785,-18006,-18227,
+    -18447,-18667,-18886,-19104,-19321,-19538,-19754,-19969,-20183,-20396,-20608,-20820,-21031,-21240,-21449,-21657,
+    -21863,-22069,-22274,-22477,-22680,-22881,-23082,-23281,-23479,-23676,-23872,-24066,-24259,-24451,-24642,-24832,
+    -25020,-25207,-25392,-25576,-25759,-25941,-26121,-26299,-26476,-26652,-26826,-26999,-27170,-27340,-27508,-27674,
+    -27839,-28003,-28165,-28325,-28483,-28640,-28795,-28949,-29101,-29251,-29399,-29546,-29690,-29834,-29975,-30114,
+    -30252,-30388,-30522,-30654,-30784,-30912,-31039,-31163,-31286,-31406,-31525,-31642,-31757,-31870,-31980,-32089,
+    -32196,-32301,-32403,-32504,-32603,-32699,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+    -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+    -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+    -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+    -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,
+    -32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32768,-32699,-32603,-32504,-32403,-32301,
+    -32196,-32089,-31980,-31870,-31757,-31642,-31525,-31406,-31286,-31163,-31039,-30912,-30784,-30654,-30522,-30388,
+    -30252,-30114,-29975,-29834,-29690,-29546,-29399,-29251,-29101,-28949,-28795,-28640,-28483,-28325,-28165,-28003,
+    -27839,-27674,-27508,-27340,-27170,-26999,-26826,-26652,-26476,-26299,-26121,-25941,-25759,-25576,-25392,-25207,
+    -25020,-24832,-24642,-24451,-24259,-24066,-23872,-23676,-23479,-23281,-23082,-22881,-22680,-22477,-22274,-22069,
+    -21863,-21657,-21449,-21240,-21031,-20820,-20608,-20396,-20183,-19969,-19754,-19538,-19321,-19104,-18886,-18667,
+    -18447,-18227,-18006,-17785,-17562,-17340,-17116,-16892,-16668,-16443,-16217,-15991,-15764,-15537,-15310,-15082,
+    -14854,-14625,-14396,-14167,-13938,-13708,-13478,-13247,-13017,-12786,-12555,-12324,-12092,-11861,-11629,-11398,
+    -11166,-10934,-10703,-10471,-10239,-10008,-9776,-9544,-9313,-9081,-8850,-8619,-8388,-8158,-7927,-7697,
+    -7467,-7237,-7007,-6778,-6549,-6321,-6093,-5865,-5637,-5410,-5184,-4958,-4732,-4507,-4282,-4058,
+    -3834,-3611,-3389,-3167,-2946,-2725,-2505,-2285,-2067,-1849,-1631,-1415,-1199,-983,-769,-555,
+    -342,-130,81,291,501,710,917,1124,1330,1536,1740,1943,2145,2347,2547,2746,
+    2945,3142,3338,3534,3728,3921,4113,4304,4494,4683,4870,5057,5242,5426,5609,5791,
+    5972,6152,6330,6507,6683,6858,7031,7203,7374,7544,7712,7880,8046,8210,8373,8536,
+    8696,8856,9014,9171,9326,9480,9633,9784,9934,10083,10231,10377,10521,10665,10807,10947,
+    11086,11224,11361,11496,11629,11761,11892,12022,12150,12276,12402,12526,12648,12769,12889,13007,
+    13124,13239,13353,13466,13577,13687,13796,13903,14008,14113,14216,14317,14417,14516,14613,14709,
+    14804,14897,14989,15079,15168,15256,15343,15428,15511,15594,15675,15754,15833,15910,15985,16060,
+    16133,16205,16275,16344,16412,16479,16544,16608,16671,16733,16793,16852,16910,16967,17022,17076,
+    17129,17181,17232,17281,17330,17377,17423,17468,17512,17554,17596,17636,17676,17714,17751,17787,
+    17822,17856,17889,17921,17952,17982,18011,18038,18065,18091,18116,18140,18164,18186,18207,18228,
+    18247,18266,18283,18300,18316,18332,18346,18360,18372,18384,18396,18406,18416,18425,18433,18441,
+    18447,18454,18459,18464,18468,18471,18474,18476,18478,18479,18479,18479,18479,18477,18475,18473,
+    18470,18467,18463,18459,18454,18449,18443,18437,18430,18423,18416,18408,18400,18392,18383,18374,
+    18364,18354,18344,18334,18323,18312,18301,18289,18278,18266,18254,18241,18229,18216,18203,18190,
+    18177,18163,18150,18136,18123,18109,18095,18081,18067,18053,18039,18025,18010,17996,17982,17968,
+    17954,17939,17925,17911,17897,17883,17869,17855,17841,17828,17814,17800,17787,17774,17761,17748,
+    17735,17722,17709,17697,17685,17673,17661,17649,17637,17626,17615,17604,17593,17583,17573,17563,
+    17553,17544,17534,17525,17517,17508,17500,17492,17485,17477,17470,17463,17457,17451,17445,17439,
+    17434,17429,17424,17420,17416,17412,17409,17406,17403,17400,17398,17397,17395,17394,17393,17393};
+
+const int16_t table_wd7_mip9[1024]={
+    26089,26088,26087,26084,26081,26076,26071,26065,26057,26049,26040,26029,26018,26006,25992,25978,
+    25963,25947,25930,25912,25892,25872,25851,25829,25806,25782,25757,25731,25705,25677,25648,25618,
+    25587,25556,25523,25489,25455,25419,25383,25345,25307,25267,25227,25186,25144,25100,25056,25011,
+    24965,24918,24870,24822,24772,24721,24670,24617,24564,24509,24454,24398,24341,24282,24223,24164,
+    24103,24041,23978,23915,23851,23785,23719,23652,23584,23515,23445,23375,23303,23231,23157,23083,
+    23008,22932,22855,22778,22699,22620,22540,22459,22377,22294,22211,22126,22041,21955,21868,21780,
+    21692,21603,21512,21421,21330,21237,21144,21050,20955,20859,20762,20665,20567,20468,20368,20268,
+    20167,20065,19962,19859,19755,19650,19544,19438,19330,19223,19114,19005,18895,18784,18672,18560,
+    18447,18334,18220,18105,17989,17873,17756,17638,17520,17401,17282,17161,17040,16919,16797,16674,
+    16550,16426,16302,16176,16051,15924,15797,15669,15541,15412,15283,15153,15022,14891,14759,14627,
+    14494,14361,14227,14092,13957,13822,13686,13549,13412,13275,13137,12998,12859,12720,12580,12439,
+    12298,12157,12015,11873,11730,11587,11443,11299,11154,11009,10864,10718,10572,10426,10279,10131,
+    9984,9836,9687,9538,9389,9240,9090,8940,8789,8638,8487,8335,8184,8031,7879,7726,
+    7573,7420,7266,7112,6958,6804,6649,6494,6339,6184,6028,5872,5716,5560,5403,5247,
+    5090,4933,4775,4618,4460,4302,4144,3986,3828,3670,3511,3352,3194,3035,2876,2716,
+    2557,2398,2238,2079,1919,1760,1600,1440,1280,1120,960,800,640,480,320,160,
+    0,-160,-320,-480,-640,-800,-960,-1120,-1280,-1440,-1600,-1759,-1919,-2079,-2238,-2398,
+    -2557,-2716,-2876,-3035,-3193,-3352,-3511,-3670,-3828,-3986,-4144,-4302,-4460,-4618,-4775,-4933,
+    -5090,-5247,-5403,-5560,-5716,-5872,-6028,-6184,-6339,-6494,-6649,-6804,-6958,-7112,-7266,-7420,
+    -7573,-7726,-7879,-8031,-8183,-8335,-8487,-8638,-8789,-8940,-9090,-9240,-9389,-9538,-9687,-9836,
+    -9984,-10131,-10279,-10426,-10572,-10718,-10864,-11009,-11154,-11299,-11443,-11587,-11730,-11872,-12015,-12157,
+    -12298,-12439,-12579,-12719,-12859,-12998,-13137,-13275,-13412,-13549,-13686,-13822,-13957,-14092,-14227,-14361,
+    -14494,-14627,-14759,-14891,-15022,-15153,-15283,-15412,-15541,-15669,-15797,-15924,-16051,-16176,-16302,-16426,
+    -16550,-16674,-16797,-16919,-17040,-17161,-17281,-17401,-17520,-17638,-17756,-17873,-17989,-18105,-18220,-18334,
+    -18447,-18560,-18672,-18784,-18895,-19005,-19114,-19223,-19330,-19438,-19544,-19650,-19755,-19859,-19962,-20065,
+    -20167,-20268,-20368,-20468,-20567,-20665,-20762,-20859,-20955,-21050,-21144,-21237,-21330,-21421,-21512,-21603,
+    -21692,-21780,-21868,-21955,-22041,-22126,-22211,-22294,-22377,-22459,-22540,-22620,-22699,-22778,-22855,-22932,
+    -23008,-23083,-23157,-23231,-23303,-23374,-23445,-23515,-23584,-23652,-23719,-23785,-23850,-23915,-23978,-24041,
+    -24103,-24164,-24223,-24282,-24340,-24398,-24454,-24509,-24564,-24617,-24670,-24721,-24772,-24822,-24870,-24918,
+    -24965,-25011,-25056,-25100,-25144,-25186,-25227,-25267,-25307,-25345,-25383,-25419,-25455,-25489,-25523,-25556,
+    -25587,-25618,-25648,-25677,-25705,-25731,-25757,-25782,-25806,-25829,-25851,-25872,-25892,-25912,-25930,-25947,
+    -25963,-25978,-25992,-26006,-26018,-26029,-26040,-26049,-26057,-26065,-26071,-26076,-26081,-26084,-26087,-26088,
+    -26089,-26088,-26087,-26084,-26081,-26076,-26071,-26065,-26057,-26049,-26040,-26029,-26018,-26006,-25992,-25978,
+    -25963,-25947,-25930,-25912,-25892,-25872,-25851,-25829,-25806,-25782,-25757,-25731,-25705,-25677,-25648,-25618,
+    -25587,-25556,-25523,-25489,-25455,-25419,-25383,-25345,-25307,-25267,-25227,-25186,-25144,-25100,-25056,-25011,
+    -24965,-24918,-24870,-24822,-24772,-24721,-24670,-24617,-24564,-24509,-24454,-24398,-24340,-24282,-24223,-24164,
+    -24103,-24041,-23978,-23915,-23850,-23785,-23719,-23652,-23584,-23515,-23445,-23374,-23303,-23231,-23157,-23083,
+    -23008,-22932,-22855,-22778,-22699,-22620,-22540,-22459,-22377,-22294,-22211,-22126,-22041,-21955,-21868,-21780,
+    -21692,-21603,-21512,-21421,-21330,-21237,-21144,-21050,-20955,-20859,-20762,-20665,-20567,-20468,-20368,-20268,
+    -20167,-20065,-19962,-19859,-19755,-19650,-19544,-19438,-19330,-19223,-19114,-19005,-18895,-18784,-18672,-18560,
+    -18447,-18334,-18220,-18105,-17989,-17873,-17756,-17638,-17520,-17401,-17281,-17161,-17040,-16919,-16797,-16674,
+    -16550,-16426,-16302,-16176,-16051,-15924,-15797,-15669,-15541,-15412,-15283,-15153,-15022,-14891,-14759,-14627,
+    -14494,-14361,-14227,-14092,-13957,-13822,-13686,-13549,-13412,-13275,-13137,-12998,-12859,-12719,-12579,-12439,
+    -12298,-12157,-12015,-11872,-11730,-11587,-11443,-11299,-11154,-11009,-10864,-10718,-10572,-10426,-10279,-10131,
+    -9984,-9836,-9687,-9538,-9389,-9240,-9090,-8940,-8789,-8638,-8487,-8335,-8183,-8031,-7879,-7726,
+    -7573,-7420,-7266,-7112,-6958,-6804,-6649,-6494,-6339,-6184,-6028,-5872,-5716,-5560,-5403,-5247,
+    -5090,-4933,-4775,-4618,-4460,-4302,-4144,-3986,-3828,-3670,-3511,-3352,-3193,-3035,-2876,-2716,
+    -2557,-2398,-2238,-2079,-1919,-1759,-1600,-1440,-1280,-1120,-960,-800,-640,-480,-320,-160,
+    0,160,320,480,640,800,960,1120,1280,1440,1600,1760,1919,2079,2238,2398,
+    2557,2716,2876,3035,3194,3352,3511,3670,3828,3986,4144,4302,4460,4618,4775,4933,
+    5090,5247,5403,5560,5716,5872,6028,6184,6339,6494,6649,6804,6958,7112,7266,7420,
+    7573,7726,7879,8031,8184,8335,8487,8638,8789,8940,9090,9240,9389,9538,9687,9836,
+    9984,10131,10279,10426,10572,10718,10864,11009,11154,11299,11443,11587,11730,11873,12015,12157,
+    12298,12439,12580,12720,12859,12998,13137,13275,13412,13549,13686,13822,13957,14092,14227,14361,
+    14494,14627,14759,14891,15022,15153,15283,15412,15541,15669,15797,15924,16051,16176,16302,16426,
+    16550,16674,16797,16919,17040,17161,17282,17401,17520,17638,17756,17873,17989,18105,18220,18334,
+    18447,18560,18672,18784,18895,19005,19114,19223,19330,19438,19544,19650,19755,19859,19962,20065,
+    20167,20268,20368,20468,20567,20665,20762,20859,20955,21050,21144,21237,21330,21421,21512,21603,
+    21692,21780,21868,21955,22041,22126,22211,22294,22377,22459,22540,22620,22699,22778,22855,22932,
+    23008,23083,23157,23231,23303,23375,23445,23515,23584,23652,23719,23785,23851,23915,23978,24041,
+    24103,24164,24223,24282,24341,24398,24454,24509,24564,24617,24670,24721,24772,24822,24870,24918,
+    24965,25011,25056,25100,25144,25186,25227,25267,25307,25345,25383,25419,25455,25489,25523,25556,
+    25587,25618,25648,25677,25705,25731,25757,25782,25806,25829,25851,25872,25892,25912,25930,25947,
+    25963,25978,25992,26006,26018,26029,26040,26049,26057,26065,26071,26076,26081,26084,26087,26088};
+
+const int16_t table_wd8_mip7[1024]={
+    -2297,-2392,-2486,-2578,-2670,-2760,-2848,-2935,-3020,-3104,-3185,-3265,-3342,-3418,-3491,-3561,
+    -3629,-3695,-3758,-3818,-3875,-3930,-3981,-4029,-4075,-4117,-4155,-4190,-4222,-4250,-4275,-4296,
+    -4313,-4326,-4336,-4341,-4343,-4341,-4334,-4324,-4309,-4290,-4267,-4239,-4207,-4171,-4131,-4086,
+    -4036,-3982,-3924,-3861,-3794,-3722,-3646,-3566,-3480,-3391,-3297,-3198,-3095,-2988,-2876,-2760,
+    -2639,-2514,-2385,-2252,-2114,-1973,-1827,-1677,-1523,-1365,-1203,-1038,-868,-695,-518,-338,
+    -154,33,223,417,614,814,1017,1223,1431,1643,1856,2073,2292,2512,2736,2961,
+    3188,3417,3647,3880,4113,4348,4584,4821,5060,5299,5538,5779,6019,6260,6501,6743,
+    6984,7224,7465,7705,7944,8183,8420,8657,8892,9126,9358,9589,9818,10045,10270,10493,
+    10714,10932,11147,11360,11570,11777,11981,12182,12379,12573,12763,12949,13132,13310,13485,13655,
+    13821,13982,14139,14291,14439,14581,14719,14851,14978,15100,15217,15328,15434,15534,15628,15717,
+    15799,15876,15947,16011,16070,16122,16168,16208,16242,16269,16290,16304,16312,16313,16308,16296,
+    16277,16252,16220,16182,16137,16086,16027,15962,15891,15813,15728,15637,15539,15435,15324,15207,
+    15084,14954,14818,14675,14526,14372,14211,14044,13871,13692,13508,13318,13122,12921,12714,12502,
+    12284,12062,11834,11602,11365,11123,10876,10625,10369,10110,9846,9578,9306,9031,8752,8470,
+    8184,7895,7603,7309,7011,6711,6409,6104,5798,5489,5179,4867,4553,4239,3923,3606,
+    3288,2970,2652,2333,2014,1695,1376,1057,740,422,106,-209,-523,-835,-1146,-1455,
+    -1763,-2068,-2371,-2671,-2969,-3265,-3557,-3846,-4132,-4415,-4694,-4970,-5242,-5510,-5773,-6033,
+    -6288,-6538,-6784,-7025,-7261,-7492,-7718,-7939,-8154,-8363,-8567,-8765,-8958,-9144,-9324,-9498,
+    -9666,-9827,-9982,-10130,-10272,-10406,-10535,-10656,-10770,-10878,-10978,-11071,-11157,-11236,-11308,-11372,
+    -11430,-11479,-11522,-11557,-11585,-11605,-11618,-11624,-11622,-11613,-11597,-11573,-11542,-11503,-11457,-11404,
+    -11344,-11276,-11202,-11120,-11032,-10936,-10833,-10724,-10608,-10485,-10356,-10220,-10078,-9929,-9774,-9613,
+    -9446,-9273,-9094,-8909,-8719,-8523,-8322,-8116,-7905,-7689,-7468,-7242,-7012,-6777,-6538,-6295,
+    -6049,-5798,-5544,-5286,-5026,-4762,-4495,-4225,-3953,-3678,-3402,-3123,-2842,-2560,-2276,-1991,
+    -1705,-1417,-1130,-841,-552,-263,26,314,603,890,1177,1463,1748,2031,2313,2593,
+    2871,3147,3420,3691,3959,4225,4487,4746,5001,5253,5501,5745,5985,6220,6451,6677,
+    6899,7115,7326,7532,7732,7927,8116,8298,8475,8645,8809,8967,9118,9262,9399,9529,
+    9651,9767,9875,9976,10068,10154,10231,10301,10362,10416,10461,10498,10527,10548,10560,10563,
+    10558,10545,10523,10492,10452,10404,10347,10282,10207,10124,10032,9931,9822,9704,9577,9441,
+    9296,9143,8982,8811,8633,8445,8250,8045,7833,7612,7384,7147,6902,6649,6389,6120,
+    5844,5561,5270,4972,4667,4354,4035,3709,3377,3037,2692,2340,1983,1619,1250,875,
+    494,109,-282,-677,-1078,-1482,-1891,-2305,-2722,-3143,-3567,-3995,-4426,-4860,-5297,-5737,
+    -6178,-6622,-7068,-7515,-7964,-8415,-8866,-9318,-9771,-10224,-10677,-11131,-11584,-12036,-12488,-12939,
+    -13389,-13837,-14284,-14729,-15171,-15612,-16050,-16485,-16917,-17347,-17772,-18195,-18613,-19027,-19437,-19843,
+    -20244,-20640,-21031,-21417,-21797,-22172,-22541,-22903,-23260,-23610,-23953,-24290,-24619,-24942,-25257,-25565,
+    -25864,-26157,-26441,-26717,-26984,-27244,-27494,-27736,-27969,-28193,-28408,-28614,-28811,-28997,-29175,-29343,
+    -29500,-29648,-29787,-29915,-30033,-30140,-30238,-30325,-30401,-30468,-30523,-30569,-30603,-30627,-30641,-30643,
+    -30635,-30616,-30587,-30547,-30496,-30434,-30362,-30279,-30185,-30080,-29965,-29840,-29704,-29557,-29400,-29232,
+    -29055,-28867,-28668,-28460,-28242,-28013,-27775,-27528,-27270,-27003,-26726,-26441,-26146,-25842,-25529,-25207,
+    -24876,-24537,-24190,-23834,-23470,-23098,-22719,-22332,-21937,-21535,-21126,-20710,-20288,-19858,-19423,-18981,
+    -18533,-18079,-17620,-17155,-16685,-16210,-15730,-15246,-14757,-14264,-13767,-13266,-12762,-12254,-11743,-11230,
+    -10714,-10195,-9674,-9151,-8626,-8100,-7572,-7043,-6514,-5983,-5453,-4922,-4391,-3860,-3330,-2800,
+    -2272,-1744,-1218,-693,-170,351,869,1386,1899,2410,2918,3422,3923,4421,4914,5404,
+    5889,6370,6846,7318,7784,8246,8702,9152,9597,10036,10469,10896,11316,11730,12138,12538,
+    12932,13318,13698,14070,14435,14792,15141,15483,15817,16142,16460,16770,17071,17364,17648,17924,
+    18191,18449,18699,18940,19172,19395,19610,19815,20011,20198,20376,20545,20705,20855,20997,21129,
+    21252,21366,21471,21567,21653,21731,21799,21858,21909,21950,21983,22006,22021,22027,22025,22013,
+    21994,21965,21929,21884,21830,21769,21699,21622,21537,21444,21343,21235,21119,20996,20866,20729,
+    20585,20434,20277,20112,19942,19765,19582,19393,19198,18998,18792,18581,18364,18142,17916,17684,
+    17448,17208,16963,16715,16462,16205,15945,15682,15415,15145,14872,14597,14318,14038,13755,13470,
+    13183,12895,12604,12313,12020,11726,11432,11136,10840,10544,10247,9950,9654,9357,9062,8766,
+    8472,8178,7885,7594,7304,7015,6728,6443,6159,5878,5599,5322,5048,4776,4507,4241,
+    3977,3717,3460,3206,2956,2709,2466,2226,1991,1759,1531,1307,1088,872,661,455,
+    252,55,-138,-327,-511,-690,-864,-1033,-1198,-1357,-1512,-1662,-1806,-1946,-2080,-2210,
+    -2334,-2453,-2568,-2677,-2781,-2879,-2973,-3062,-3145,-3224,-3297,-3366,-3429,-3488,-3542,-3590,
+    -3634,-3674,-3708,-3738,-3763,-3783,-3799,-3811,-3818,-3821,-3819,-3813,-3803,-3790,-3772,-3750,
+    -3724,-3695,-3662,-3625,-3586,-3542,-3496,-3446,-3393,-3337,-3278,-3217,-3152,-3086,-3016,-2945,
+    -2871,-2795,-2717,-2636,-2555,-2471,-2386,-2299,-2211,-2122,-2031,-1940,-1847,-1754,-1660,-1565,
+    -1470,-1374,-1279,-1183,-1087,-991,-895,-799,-704,-609,-515,-422,-329,-237,-147,-57,
+    32,119,205,290,373,454,534,612,688,762,834,904,972,1038,1102,1163,
+    1222,1278,1332,1383,1431,1477,1521,1561,1599,1633,1665,1694,1720,1744,1764,1781,
+    1795,1806,1814,1819,1821,1820,1816,1809,1798,1785,1769,1749,1727,1702,1673,1642,
+    1608,1571,1531,1488,1443,1395,1344,1290,1234,1176,1115,1051,985,917,847,774,
+    700,623,544,464,382,297,212,125,36,-54,-146,-238,-332,-427,-523,-620,
+    -717,-815,-914,-1013,-1112,-1212,-1312,-1412,-1512,-1611,-1711,-1810,-1909,-2007,-2104,-2201};
+
+const int16_t table_wd8_mip8[1024]={
+    -2297,-2297,-2295,-2293,-2289,-2285,-2280,-2273,-2266,-2258,-2249,-2238,-2227,-2215,-2202,-2188,
+    -2173,-2157,-2140,-2123,-2104,-2084,-2063,-2042,-2019,-1996,-1972,-1946,-1920,-1893,-1865,-1836,
+    -1807,-1776,-1745,-1712,-1679,-1645,-1610,-1574,-1537,-1500,-1461,-1422,-1382,-1341,-1300,-1257,
+    -1214,-1170,-1125,-1080,-1034,-987,-939,-890,-841,-791,-740,-689,-637,-584,-531,-477,
+    -422,-367,-311,-254,-197,-139,-81,-22,38,98,159,220,282,344,407,470,
+    534,598,663,728,793,859,926,992,1060,1127,1195,1263,1332,1401,1470,1540,
+    1610,1680,1750,1821,1892,1963,2034,2106,2178,2250,2322,2394,2466,2539,2611,2684,
+    2757,2830,2903,2976,3049,3122,3194,3267,3340,3413,3486,3559,3632,3704,3777,3849,
+    3921,3994,4066,4137,4209,4280,4351,4422,4493,4563,4634,4704,4773,4842,4911,4980,
+    5048,5116,5184,5251,5318,5384,5450,5515,5580,5645,5709,5772,5835,5898,5960,6021,
+    6082,6143,6203,6262,6320,6378,6436,6492,6548,6604,6658,6712,6766,6818,6870,6921,
+    6972,7021,7070,7118,7165,7212,7258,7303,7347,7390,7432,7474,7514,7554,7593,7631,
+    7668,7704,7739,7774,7807,7839,7871,7901,7931,7959,7987,8014,8039,8064,8087,8110,
+    8131,8151,8171,8189,8206,8222,8237,8251,8264,8276,8287,8296,8305,8312,8319,8324,
+    8328,8331,8332,8333,8333,8331,8328,8324,8319,8313,8305,8296,8287,8276,8264,8250,
+    8236,8220,8203,8185,8166,8146,8124,8101,8077,8052,8026,7998,7970,7940,7909,7876,
+    7843,7808,7772,7735,7697,7658,7617,7576,7533,7489,7444,7397,7350,7301,7252,7201,
+    7149,7095,7041,6986,6929,6871,6812,6752,6691,6629,6566,6502,6436,6370,6302,6234,
+    6164,6093,6021,5949,5875,5800,5724,5647,5569,5490,5411,5330,5248,5165,5081,4997,
+    4911,4825,4737,4649,4560,4470,4379,4287,4194,4101,4006,3911,3815,3719,3621,3523,
+    3423,3324,3223,3122,3020,2917,2813,2709,2604,2499,2393,2286,2179,2071,1962,1853,
+    1743,1633,1522,1410,1299,1186,1073,960,846,732,617,502,386,270,154,37,
+    -80,-197,-315,-433,-551,-670,-789,-908,-1027,-1146,-1266,-1386,-1506,-1627,-1747,-1867,
+    -1988,-2109,-2230,-2351,-2472,-2593,-2714,-2835,-2956,-3077,-3198,-3318,-3439,-3560,-3681,-3801,
+    -3921,-4042,-4162,-4282,-4401,-4521,-4640,-4759,-4878,-4996,-5115,-5233,-5350,-5467,-5584,-5701,
+    -5817,-5933,-6048,-6163,-6278,-6392,-6505,-6618,-6731,-6843,-6955,-7066,-7176,-7286,-7396,-7504,
+    -7612,-7720,-7827,-7933,-8039,-8143,-8248,-8351,-8454,-8556,-8657,-8758,-8857,-8956,-9054,-9152,
+    -9248,-9344,-9439,-9533,-9626,-9718,-9809,-9899,-9989,-10077,-10165,-10251,-10337,-10422,-10505,-10588,
+    -10669,-10750,-10829,-10908,-10985,-11062,-11137,-11211,-11284,-11356,-11427,-11497,-11565,-11633,-11699,-11764,
+    -11828,-11891,-11952,-12013,-12072,-12130,-12187,-12242,-12296,-12349,-12401,-12452,-12501,-12549,-12596,-12641,
+    -12685,-12728,-12769,-12810,-12849,-12886,-12922,-12957,-12991,-13023,-13054,-13084,-13112,-13139,-13164,-13188,
+    -13211,-13233,-13253,-13271,-13289,-13305,-13319,-13332,-13344,-13355,-13364,-13371,-13378,-13382,-13386,-13388,
+    -13389,-13388,-13386,-13382,-13378,-13371,-13364,-13355,-13344,-13332,-13319,-13305,-13289,-13271,-13253,-13233,
+    -13211,-13188,-13164,-13139,-13112,-13084,-13054,-13023,-12991,-12957,-12922,-12886,-12849,-12810,-12769,-12728,
+    -12685,-12641,-12596,-12549,-12501,-12452,-12401,-12349,-12296,-12242,-12187,-12130,-12072,-12013,-11952,-11891,
+    -11828,-11764,-11699,-11633,-11565,-11497,-11427,-11356,-11284,-11211,-11137,-11062,-10985,-10908,-10829,-10750,
+    -10669,-10588,-10505,-10422,-10337,-10251,-10165,-10077,-9989,-9899,-9809,-9718,-9626,-9533,-9439,-9344,
+    -9248,-9152,-9054,-8956,-8857,-8758,-8657,-8556,-8454,-8351,-8248,-8143,-8039,-7933,-7827,-7720,
+    -7612,-7504,-7396,-7286,-7176,-7066,-6955,-6843,-6731,-6618,-6505,-6392,-6278,-6163,-6048,-5933,
+    -5817,-5701,-5584,-5467,-5350,-5232,-5115,-4996,-4878,-4759,-4640,-4521,-4401,-4282,-4162,-4042,
+    -3921,-3801,-3681,-3560,-3439,-3318,-3197,-3077,-2956,-2835,-2714,-2593,-2472,-2351,-2230,-2109,
+    -1988,-1867,-1747,-1626,-1506,-1386,-1266,-1146,-1027,-908,-788,-670,-551,-433,-315,-197,
+    -80,37,154,270,386,502,617,732,846,960,1073,1186,1299,1410,1522,1633,
+    1743,1853,1962,2071,2179,2286,2393,2499,2604,2709,2813,2917,3020,3122,3223,3324,
+    3424,3523,3621,3719,3815,3911,4006,4101,4194,4287,4379,4470,4560,4649,4737,4825,
+    4911,4997,5081,5165,5248,5330,5411,5490,5569,5647,5724,5800,5875,5949,6021,6093,
+    6164,6234,6302,6370,6436,6502,6566,6629,6691,6752,6812,6871,6929,6986,7041,7095,
+    7149,7201,7252,7301,7350,7398,7444,7489,7533,7576,7618,7658,7697,7735,7772,7808,
+    7843,7876,7909,7940,7970,7998,8026,8052,8077,8101,8124,8146,8166,8185,8203,8220,
+    8236,8250,8264,8276,8287,8296,8305,8313,8319,8324,8328,8331,8333,8333,8332,8331,
+    8328,8324,8319,8312,8305,8296,8287,8276,8264,8251,8237,8222,8206,8189,8171,8151,
+    8131,8110,8087,8064,8039,8014,7987,7959,7931,7901,7871,7839,7807,7774,7739,7704,
+    7668,7631,7593,7554,7514,7474,7432,7390,7347,7303,7258,7212,7165,7118,7070,7021,
+    6972,6921,6870,6818,6766,6712,6658,6604,6548,6492,6435,6378,6320,6262,6202,6143,
+    6082,6021,5960,5898,5835,5772,5709,5645,5580,5515,5450,5384,5318,5251,5184,5116,
+    5048,4980,4911,4842,4773,4704,4634,4563,4493,4422,4351,4280,4209,4137,4065,3994,
+    3921,3849,3777,3704,3632,3559,3486,3413,3340,3267,3194,3121,3048,2976,2903,2830,
+    2757,2684,2611,2539,2466,2394,2322,2250,2178,2106,2034,1963,1892,1821,1750,1680,
+    1610,1540,1470,1401,1332,1263,1195,1127,1060,992,926,859,793,728,663,598,
+    534,470,407,344,282,220,159,98,38,-22,-81,-139,-197,-254,-311,-367,
+    -422,-477,-531,-584,-637,-689,-740,-791,-841,-890,-939,-987,-1034,-1080,-1125,-1170,
+    -1214,-1257,-1300,-1341,-1382,-1422,-1461,-1500,-1537,-1574,-1610,-1645,-1679,-1712,-1745,-1776,
+    -1807,-1836,-1865,-1893,-1920,-1946,-1972,-1996,-2019,-2042,-2063,-2084,-2104,-2123,-2140,-2157,
+    -2173,-2188,-2202,-2215,-2227,-2238,-2249,-2258,-2266,-2273,-2280,-2285,-2289,-2293,-2295,-2297};
+
+const int16_t table_wd8_mip9[1024]={
+    5546,5546,5545,5545,5544,5543,5542,5541,5539,5537,5535,5533,5531,5528,5525,5522,
+    5519,5516,5512,5508,5504,5500,5495,5491,5486,5481,5475,5470,5464,5458,5452,5446,
+    5439,5432,5426,5418,5411,5403,5396,5388,5380,5371,5363,5354,5345,5336,5326,5317,
+    5307,5297,5287,5276,5266,5255,5244,5233,5222,5210,5198,5186,5174,5162,5149,5137,
+    5124,5110,5097,5084,5070,5056,5042,5028,5013,4999,4984,4969,4954,4938,4923,4907,
+    4891,4875,4858,4842,4825,4808,4791,4774,4757,4739,4721,4703,4685,4667,4649,4630,
+    4611,4592,4573,4554,4534,4514,4495,4475,4454,4434,4414,4393,4372,4351,4330,4308,
+    4287,4265,4243,4221,4199,4177,4155,4132,4109,4086,4063,4040,4016,3993,3969,3945,
+    3921,3897,3873,3849,3824,3799,3774,3749,3724,3699,3674,3648,3622,3596,3571,3544,
+    3518,3492,3465,3439,3412,3385,3358,3331,3304,3276,3249,3221,3193,3165,3137,3109,
+    3081,3053,3024,2996,2967,2938,2909,2880,2851,2822,2792,2763,2733,2704,2674,2644,
+    2614,2584,2554,2524,2493,2463,2432,2402,2371,2340,2309,2278,2247,2216,2185,2154,
+    2122,2091,2059,2028,1996,1964,1932,1900,1868,1836,1804,1772,1740,1707,1675,1642,
+    1610,1577,1545,1512,1479,1446,1413,1380,1348,1314,1281,1248,1215,1182,1149,1115,
+    1082,1049,1015,982,948,915,881,847,814,780,746,713,679,645,611,577,
+    544,510,476,442,408,374,340,306,272,238,204,170,136,102,68,34,
+    0,-34,-68,-102,-136,-170,-204,-238,-272,-306,-340,-374,-408,-442,-476,-510,
+    -544,-577,-611,-645,-679,-713,-746,-780,-814,-847,-881,-915,-948,-982,-1015,-1049,
+    -1082,-1115,-1149,-1182,-1215,-1248,-1281,-1314,-1348,-1380,-1413,-1446,-1479,-1512,-1545,-1577,
+    -1610,-1642,-1675,-1707,-1740,-1772,-1804,-1836,-1868,-1900,-1932,-1964,-1996,-2028,-2059,-2091,
+    -2122,-2154,-2185,-2216,-2247,-2278,-2309,-2340,-2371,-2402,-2432,-2463,-2493,-2524,-2554,-2584,
+    -2614,-2644,-2674,-2704,-2733,-2763,-2793,-2822,-2851,-2880,-2909,-2938,-2967,-2996,-3024,-3053,
+    -3081,-3109,-3137,-3165,-3193,-3221,-3249,-3276,-3304,-3331,-3358,-3385,-3412,-3439,-3465,-3492,
+    -3518,-3544,-3571,-3597,-3622,-3648,-3674,-3699,-3724,-3749,-3774,-3799,-3824,-3849,-3873,-3897,
+    -3921,-3945,-3969,-3993,-4016,-4040,-4063,-4086,-4109,-4132,-4155,-4177,-4199,-4221,-4243,-4265,
+    -4287,-4308,-4330,-4351,-4372,-4393,-4414,-4434,-4454,-4475,-4495,-4514,-4534,-4554,-4573,-4592,
+    -4611,-4630,-4649,-4667,-4685,-4703,-4721,-4739,-4757,-4774,-4791,-4808,-4825,-4842,-4858,-4875,
+    -4891,-4907,-4923,-4938,-4954,-4969,-4984,-4999,-5013,-5028,-5042,-5056,-5070,-5084,-5097,-5110,
+    -5124,-5137,-5149,-5162,-5174,-5186,-5198,-5210,-5222,-5233,-5244,-5255,-5266,-5276,-5287,-5297,
+    -5307,-5317,-5326,-5336,-5345,-5354,-5363,-5371,-5380,-5388,-5396,-5403,-5411,-5418,-5426,-5432,
+    -5439,-5446,-5452,-5458,-5464,-5470,-5475,-5481,-5486,-5491,-5495,-5500,-5504,-5508,-5512,-5516,
+    -5519,-5522,-5525,-5528,-5531,-5533,-5535,-5537,-5539,-5541,-5542,-5543,-5544,-5545,-5545,-5546,
+    -5546,-5546,-5545,-5545,-5544,-5543,-5542,-5541,-5539,-5537,-5535,-5533,-5531,-5528,-5525,-5522,
+    -5519,-5516,-5512,-5508,-5504,-5500,-5495,-5491,-5486,-5481,-5475,-5470,-5464,-5458,-5452,-5446,
+    -5439,-5432,-5426,-5418,-5411,-5403,-5396,-5388,-5380,-5371,-5363,-5354,-5345,-5336,-5326,-5317,
+    -5307,-5297,-5287,-5276,-5266,-5255,-5244,-5233,-5222,-5210,-5198,-5186,-5174,-5162,-5149,-5137,
+    -5124,-5110,-5097,-5084,-5070,-5056,-5042,-5028,-5013,-4999,-4984,-4969,-4954,-4938,-4923,-4907,
+    -4891,-4875,-4858,-4842,-4825,-4808,-4791,-4774,-4757,-4739,-4721,-4703,-4685,-4667,-4649,-4630,
+    -4611,-4592,-4573,-4554,-4534,-4514,-4495,-4475,-4454,-4434,-4414,-4393,-4372,-4351,-4330,-4308,
+    -4287,-4265,-4243,-4221,-4199,-4177,-4155,-4132,-4109,-4086,-4063,-4040,-4016,-3993,-3969,-3945,
+    -3921,-3897,-3873,-3849,-3824,-3799,-3774,-3749,-3724,-3699,-3674,-3648,-3622,-3596,-3571,-3544,
+    -3518,-3492,-3465,-3439,-3412,-3385,-3358,-3331,-3304,-3276,-3249,-3221,-3193,-3165,-3137,-3109,
+    -3081,-3053,-3024,-2996,-2967,-2938,-2909,-2880,-2851,-2822,-2792,-2763,-2733,-2704,-2674,-2644,
+    -2614,-2584,-2554,-2524,-2493,-2463,-2432,-2402,-2371,-2340,-2309,-2278,-2247,-2216,-2185,-2154,
+    -2122,-2091,-2059,-2028,-1996,-1964,-1932,-1900,-1868,-1836,-1804,-1772,-1740,-1707,-1675,-1642,
+    -1610,-1577,-1545,-1512,-1479,-1446,-1413,-1380,-1347,-1314,-1281,-1248,-1215,-1182,-1149,-1115,
+    -1082,-1049,-1015,-982,-948,-915,-881,-847,-814,-780,-746,-713,-679,-645,-611,-577,
+    -544,-510,-476,-442,-408,-374,-340,-306,-272,-238,-204,-170,-136,-102,-68,-34,
+    0,34,68,102,136,170,204,238,272,306,340,374,408,442,476,510,
+    544,577,611,645,679,713,746,780,814,847,881,915,948,982,1015,1049,
+    1082,1115,1149,1182,1215,1248,1281,1314,1348,1380,1413,1446,1479,1512,1545,1577,
+    1610,1642,1675,1707,1740,1772,1804,1836,1868,1900,1932,1964,1996,2028,2059,2091,
+    2122,2154,2185,2216,2247,2278,2309,2340,2371,2402,2432,2463,2493,2524,2554,2584,
+    2614,2644,2674,2704,2733,2763,2793,2822,2851,2880,2909,2938,2967,2996,3024,3053,
+    3081,3109,3137,3165,3193,3221,3249,3276,3304,3331,3358,3385,3412,3439,3465,3492,
+    3518,3544,3571,3597,3622,3648,3674,3699,3724,3749,3774,3799,3824,3849,3873,3897,
+    3921,3945,3969,3993,4017,4040,4063,4086,4109,4132,4155,4177,4199,4221,4243,4265,
+    4287,4308,4330,4351,4372,4393,4414,4434,4454,4475,4495,4514,4534,4554,4573,4592,
+    4611,4630,4649,4667,4685,4703,4721,4739,4757,4774,4791,4808,4825,4842,4858,4875,
+    4891,4907,4923,4938,4954,4969,4984,4999,5013,5028,5042,5056,5070,5084,5097,5110,
+    5124,5137,5149,5162,5174,5186,5198,5210,5222,5233,5244,5255,5266,5276,5287,5297,
+    5307,5317,5326,5336,5345,5354,5363,5371,5380,5388,5396,5403,5411,5418,5426,5432,
+    5439,5446,5452,5458,5464,5470,5475,5481,5486,5491,5495,5500,5504,5508,5512,5516,
+    5519,5522,5525,5528,5531,5533,5535,5537,5539,5541,5542,5543,5544,5545,5545,5546};
+
+const int16_t *const wavetable_mips[16][10]= {
+    { table_sine, table_sine, table_sine, table_sine, table_sine, table_sine, table_sine, table_sine, table_sine, table_sine },
+    { table_halfsine, table_halfsine, table_halfsine_mip2, table_halfsine_mip3, table_halfsine_mip4, table_halfsine_mip5, table_halfsine_mip6, table_halfsine_mip7, table_halfsine_mip8, table_halfsine_mip9 },
+    { table_rectsine, table_rectsine, table_rectsine_mip2, table_rectsine_mip3, table_rectsine_mip4, table_rectsine_mip5, table_rectsine_mip6, table_rectsine_mip7, table_rectsine_mip8, table_rectsine_mip9 },
+    { table_triangle, table_triangle, table_triangle, table_triangle, table_triangle, table_triangle, table_triangle, table_triangle_mip7, table_triangle_mip8, table_triangle_mip8 },
+    { table_sawtooth, table_sawtooth, table_sawtooth, table_sawtooth, table_sawtooth, table_sawtooth, table_sawtooth_mip6, table_sawtooth_mip7, table_sawtooth_mip8, table_sawtooth_mip9 },
+    { table_squarewave, table_squarewave, table_squarewave, table_squarewave, table_squarewave, table_squarewave, table_squarewave_mip6, table_squarewave_mip7, table_squarewave_mip8, table_squarewave_mip8 },
+    { table_squarewave2, table_squarewave2, table_squarewave2, table_squarewave2_mip3, table_squarewave2_mip4, table_squarewave2_mip5, table_squarewave2_mip6, table_squarewave2_mip7, table_squarewave2_mip8, table_squarewave2_mip9 },
+    { table_squarewave3, table_squarewave3, table_squarewave3, table_squarewave3, table_squarewave3_mip4, table_squarewave3_mip5, table_squarewave3_mip6, table_squarewave3_mip7, table_squarewave3_mip8, table_squarewave3_mip9 },
+    { table_wd1, table_wd1, table_wd1, table_wd1, table_wd1, table_wd1, table_wd1, table_wd1_mip7, table_wd1_mip8, table_wd1_mip9 },
+    { table_wd2, table_wd2, table_wd2, table_wd2, table_wd2, table_wd2, table_wd2, table_wd2_mip7, table_wd2_mip8, table_wd2_mip9 },
+    { table_wd3, table_wd3, table_wd3, table_wd3, table_wd3, table_wd3, table_wd3, table_wd3_mip7, table_wd3_mip8, table_wd3_mip8 },
+    { table_wd4, table_wd4, table_wd4, table_wd4, table_wd4, table_wd4, table_wd4, table_wd4_mip7, table_wd4_mip8, table_wd4_mip8 },
+    { table_wd5, table_wd5, table_wd5, table_wd5, table_wd5, table_wd5, table_wd5_mip6, table_wd5_mip7, table_wd5_mip8, table_wd5_mip8 },
+    { table_wd6, table_wd6, table_wd6, table_wd6, table_wd6, table_wd6, table_wd6, table_wd6_mip7, table_wd6_mip8, table_wd6_mip9 },
+    { table_wd7, table_wd7, table_wd7, table_wd7, table_wd7, table_wd7, table_wd7_mip6, table_wd7_mip7, table_wd7_mip8, table_wd7_mip9 },
+    { table_wd8, table_wd8, table_wd8, table_wd8, table_wd8, table_wd8, table_wd8, table_wd8_mip7, table_wd8_mip8, table_wd8_mip9 }
+};
+
+const uint32_t wavetable_mip_bytes = 124928;
@@ -34,7 +34,14 @@ extern "C" {
 #define WAVETABLES_NUMBER 16
 #define WAVETABLES_LENGTH 1024
 
+/* band limited copies of each wavetable, level m keeps the harmonics up to
+   WAVETABLES_LENGTH/2^(m+1).  makewaves.m refuses to exceed the flash cap */
+#define WAVETABLES_MIPS 10
+#define WAVETABLES_MIP_BYTES_MAX (128*1024)
+
 extern const int16_t *wavetables[WAVETABLES_NUMBER];
+extern const int16_t *const wavetable_mips[WAVETABLES_NUMBER][WAVETABLES_MIPS];
+extern const uint32_t wavetable_mip_bytes;
 
 extern const int16_t table_sine[];
  